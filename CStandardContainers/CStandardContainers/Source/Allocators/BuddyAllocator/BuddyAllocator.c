@@ -0,0 +1,530 @@
+#include "BuddyAllocator.h"
+#include "../../Utils/MemoryUtils.h"
+
+// Definition of the links that are stored within every free block.
+typedef struct _CSC_BuddyAllocatorFreeBlock
+{
+	struct _CSC_BuddyAllocatorFreeBlock* pPrevious;
+	struct _CSC_BuddyAllocatorFreeBlock* pNext;
+} CSC_BuddyAllocatorFreeBlock;
+
+static CSC_PCVOID CSCMETHOD CSC_BuddyAllocatorGetInterface(_In_ CONST CSC_IBaseInterface* CONST pThis, _In_ CONST EBaseInterfaceType interfaceType);
+
+static CSC_STATUS CSCMETHOD CSC_BuddyAllocatorInit(_Inout_ CSC_IAllocator* CONST pThis);
+static CSC_STATUS CSCMETHOD CSC_BuddyAllocatorCleanup(_Inout_ CSC_IAllocator* CONST pThis);
+static CSC_PVOID CSCMETHOD CSC_BuddyAllocatorAlloc(_In_ CONST CSC_IAllocator* CONST pThis, _In_ CONST CSC_SIZE_T size);
+static CSC_PVOID CSCMETHOD CSC_BuddyAllocatorAllocZero(_In_ CONST CSC_IAllocator* CONST pThis, _In_ CONST CSC_SIZE_T size);
+static CSC_STATUS CSCMETHOD CSC_BuddyAllocatorFree(_In_ CONST CSC_IAllocator* CONST pThis, _In_ CONST CSC_PVOID pMemoryBlock);
+static CSC_BOOLEAN CSCMETHOD CSC_BuddyAllocatorIsUsable(_In_ CONST CSC_IAllocator* CONST pThis);
+static CSC_SIZE_T CSCMETHOD CSC_BuddyAllocatorGetUsableSize(_In_ CONST CSC_IAllocator* CONST pThis, _In_ CONST CSC_PCVOID pMemoryBlock);
+
+static CSC_IBaseInterfaceVirtualTable g_BuddyAllocatorBaseInterfaceVTable =
+{
+	CSC_BuddyAllocatorGetInterface
+};
+
+static CSC_IAllocatorVirtualTable g_BuddyAllocatorAllocatorVTable =
+{
+	CSC_BuddyAllocatorInit,
+	CSC_BuddyAllocatorCleanup,
+	CSC_BuddyAllocatorAlloc,
+	CSC_BuddyAllocatorAllocZero,
+	CSC_BuddyAllocatorFree,
+	CSC_BuddyAllocatorIsUsable,
+	NULL,
+	NULL,
+	NULL,
+	CSC_BuddyAllocatorGetUsableSize
+};
+
+
+static CSC_BOOLEAN CSCMETHOD CSC_BuddyAllocatorIsValid(_In_ CONST CSC_BuddyAllocator* CONST pThis)
+{
+	if (!pThis || pThis->baseInterface.pIBaseInterfaceVirtualTable != &g_BuddyAllocatorBaseInterfaceVTable || pThis->allocatorInterface.pIAllocatorVirtualTable != &g_BuddyAllocatorAllocatorVTable || !pThis->pBase || !pThis->minBlockSize)
+	{
+		return (CSC_BOOLEAN)FALSE;
+	}
+
+	return (CSC_BOOLEAN)TRUE;
+}
+
+static CSC_BOOLEAN CSCMETHOD CSC_BuddyAllocatorTestBit(_In_ CONST CSC_BYTE* CONST pBitmap, _In_ CONST CSC_SIZE_T index)
+{
+	return (CSC_BOOLEAN)((pBitmap[index >> 3] >> (index & (CSC_SIZE_T)7)) & (CSC_BYTE)1);
+}
+
+static void CSCMETHOD CSC_BuddyAllocatorSetBit(_Inout_ CSC_BYTE* CONST pBitmap, _In_ CONST CSC_SIZE_T index)
+{
+	pBitmap[index >> 3] |= (CSC_BYTE)((CSC_BYTE)1 << (index & (CSC_SIZE_T)7));
+}
+
+static void CSCMETHOD CSC_BuddyAllocatorClearBit(_Inout_ CSC_BYTE* CONST pBitmap, _In_ CONST CSC_SIZE_T index)
+{
+	pBitmap[index >> 3] &= (CSC_BYTE)~((CSC_BYTE)1 << (index & (CSC_SIZE_T)7));
+}
+
+static void CSCMETHOD CSC_BuddyAllocatorToggleBit(_Inout_ CSC_BYTE* CONST pBitmap, _In_ CONST CSC_SIZE_T index)
+{
+	pBitmap[index >> 3] ^= (CSC_BYTE)((CSC_BYTE)1 << (index & (CSC_SIZE_T)7));
+}
+
+// Nodes are numbered level by level starting at the root, hence level l starts at node 2^l - 1 and the children of node n are 2n + 1 and 2n + 2.
+static CSC_BuddyAllocatorFreeBlock* CSCMETHOD CSC_BuddyAllocatorGetNodeAddress(_In_ CONST CSC_BuddyAllocator* CONST pThis, _In_ CONST CSC_SIZE_T node, _In_ CONST CSC_SIZE_T level)
+{
+	return (CSC_BuddyAllocatorFreeBlock*)(pThis->pBase + (node + (CSC_SIZE_T)1 - ((CSC_SIZE_T)1 << level)) * (pThis->treeSize >> level));
+}
+
+static CSC_SIZE_T CSCMETHOD CSC_BuddyAllocatorGetNode(_In_ CONST CSC_BuddyAllocator* CONST pThis, _In_ CONST CSC_SIZE_T offset, _In_ CONST CSC_SIZE_T level)
+{
+	return ((CSC_SIZE_T)1 << level) - (CSC_SIZE_T)1 + offset / (pThis->treeSize >> level);
+}
+
+// Every change of the free state of a block toggles the pair bit of it's parent, which keeps the bit equal to the exclusive or of the free states of both buddies.
+static void CSCMETHOD CSC_BuddyAllocatorPushFreeBlock(_Inout_ CSC_BuddyAllocator* CONST pThis, _In_ CONST CSC_SIZE_T node, _In_ CONST CSC_SIZE_T level)
+{
+	CSC_BuddyAllocatorFreeBlock* CONST pBlock = CSC_BuddyAllocatorGetNodeAddress(pThis, node, level);
+
+	pBlock->pPrevious = NULL;
+	pBlock->pNext = (CSC_BuddyAllocatorFreeBlock*)pThis->pFreeLists[level];
+
+	if (pBlock->pNext)
+	{
+		pBlock->pNext->pPrevious = pBlock;
+	}
+
+	pThis->pFreeLists[level] = (CSC_PVOID)pBlock;
+	++pThis->freeBlockCounts[level];
+	pThis->freeBytes += pThis->treeSize >> level;
+
+	if (node)
+	{
+		CSC_BuddyAllocatorToggleBit(pThis->pPairBitmap, (node - (CSC_SIZE_T)1) >> 1);
+	}
+}
+
+static void CSCMETHOD CSC_BuddyAllocatorRemoveFreeBlock(_Inout_ CSC_BuddyAllocator* CONST pThis, _In_ CONST CSC_SIZE_T node, _In_ CONST CSC_SIZE_T level)
+{
+	CSC_BuddyAllocatorFreeBlock* CONST pBlock = CSC_BuddyAllocatorGetNodeAddress(pThis, node, level);
+
+	if (pBlock->pPrevious)
+	{
+		pBlock->pPrevious->pNext = pBlock->pNext;
+	}
+	else
+	{
+		pThis->pFreeLists[level] = (CSC_PVOID)pBlock->pNext;
+	}
+
+	if (pBlock->pNext)
+	{
+		pBlock->pNext->pPrevious = pBlock->pPrevious;
+	}
+
+	--pThis->freeBlockCounts[level];
+	pThis->freeBytes -= pThis->treeSize >> level;
+
+	if (node)
+	{
+		CSC_BuddyAllocatorToggleBit(pThis->pPairBitmap, (node - (CSC_SIZE_T)1) >> 1);
+	}
+}
+
+static void CSCMETHOD CSC_BuddyAllocatorInitializeNode(_Inout_ CSC_BuddyAllocator* CONST pThis, _In_ CONST CSC_SIZE_T node, _In_ CONST CSC_SIZE_T level, _In_ CONST CSC_SIZE_T offset)
+{
+	CONST CSC_SIZE_T blockSize = pThis->treeSize >> level;
+
+	// The tree is rounded up to a power of two, blocks beyond the managed memory stay allocated forever and are never touched.
+	if (offset >= pThis->managedBytes)
+	{
+		return;
+	}
+
+	if (offset + blockSize <= pThis->managedBytes)
+	{
+		CSC_BuddyAllocatorPushFreeBlock(pThis, node, level);
+		return;
+	}
+
+	CSC_BuddyAllocatorSetBit(pThis->pSplitBitmap, node);
+	CSC_BuddyAllocatorInitializeNode(pThis, node * (CSC_SIZE_T)2 + (CSC_SIZE_T)1, level + (CSC_SIZE_T)1, offset);
+	CSC_BuddyAllocatorInitializeNode(pThis, node * (CSC_SIZE_T)2 + (CSC_SIZE_T)2, level + (CSC_SIZE_T)1, offset + (blockSize >> 1));
+}
+
+static CSC_BOOLEAN CSCMETHOD CSC_BuddyAllocatorFindBlock(_In_ CONST CSC_BuddyAllocator* CONST pThis, _In_ CONST CSC_PCVOID pMemoryBlock, _Out_ CSC_SIZE_T* CONST pNode, _Out_ CSC_SIZE_T* CONST pLevel)
+{
+	CSC_SIZE_T offset, node, level;
+
+	if ((CONST CSC_BYTE*)pMemoryBlock < pThis->pBase)
+	{
+		return (CSC_BOOLEAN)FALSE;
+	}
+
+	offset = (CSC_SIZE_T)((CONST CSC_BYTE*)pMemoryBlock - pThis->pBase);
+
+	if (offset >= pThis->managedBytes || offset % pThis->minBlockSize)
+	{
+		return (CSC_BOOLEAN)FALSE;
+	}
+
+	// The allocated block is the first block on the path from the root that isn't split.
+	for (level = (CSC_SIZE_T)0; ; ++level)
+	{
+		node = CSC_BuddyAllocatorGetNode(pThis, offset, level);
+
+		if (level == pThis->maxLevel || !CSC_BuddyAllocatorTestBit(pThis->pSplitBitmap, node))
+		{
+			break;
+		}
+	}
+
+	if (offset % (pThis->treeSize >> level))
+	{
+		return (CSC_BOOLEAN)FALSE;
+	}
+
+	*pNode = node;
+	*pLevel = level;
+
+	return (CSC_BOOLEAN)TRUE;
+}
+
+static CSC_PVOID CSCMETHOD CSC_BuddyAllocatorAllocate(_In_ CONST CSC_IAllocator* CONST pThis, _In_ CONST CSC_SIZE_T size, _In_ CONST CSC_BOOLEAN zeroMemory)
+{
+	CSC_BuddyAllocator* CONST pAllocator = (CSC_BuddyAllocator* CONST)CSC_CONTAINING_RECORD(pThis, CONST CSC_BuddyAllocator, allocatorInterface);
+	CSC_BuddyAllocatorFreeBlock* pBlock;
+	CSC_SIZE_T blockSize, targetLevel, level, node;
+
+	if (!pThis || !size || !CSC_BuddyAllocatorIsValid(pAllocator))
+	{
+		return NULL;
+	}
+
+	if (size > pAllocator->managedBytes)
+	{
+		++pAllocator->failedAllocCount;
+		return NULL;
+	}
+
+	for (blockSize = pAllocator->minBlockSize, targetLevel = pAllocator->maxLevel; blockSize < size; blockSize <<= 1)
+	{
+		--targetLevel;
+	}
+
+	// Search the smallest free block that is at least as large as the requested one.
+	for (level = targetLevel; !pAllocator->pFreeLists[level]; --level)
+	{
+		if (!level)
+		{
+			++pAllocator->failedAllocCount;
+			return NULL;
+		}
+	}
+
+	node = CSC_BuddyAllocatorGetNode(pAllocator, (CSC_SIZE_T)((CSC_BYTE*)pAllocator->pFreeLists[level] - pAllocator->pBase), level);
+	CSC_BuddyAllocatorRemoveFreeBlock(pAllocator, node, level);
+
+	// Split the block until it has the requested size, the upper halves are put on the free lists.
+	for (; level < targetLevel; ++level)
+	{
+		CSC_BuddyAllocatorSetBit(pAllocator->pSplitBitmap, node);
+		CSC_BuddyAllocatorPushFreeBlock(pAllocator, node * (CSC_SIZE_T)2 + (CSC_SIZE_T)2, level + (CSC_SIZE_T)1);
+		node = node * (CSC_SIZE_T)2 + (CSC_SIZE_T)1;
+	}
+
+	++pAllocator->allocCount;
+	pBlock = CSC_BuddyAllocatorGetNodeAddress(pAllocator, node, level);
+
+	if (zeroMemory)
+	{
+		CSC_MemoryUtilsSetZeroMemory((CSC_PVOID)pBlock, size);
+	}
+
+	return (CSC_PVOID)pBlock;
+}
+
+
+static CSC_PCVOID CSCMETHOD CSC_BuddyAllocatorGetInterface(_In_ CONST CSC_IBaseInterface* CONST pThis, _In_ CONST EBaseInterfaceType interfaceType)
+{
+	CONST CSC_BuddyAllocator* CONST pAllocator = (CONST CSC_BuddyAllocator* CONST)pThis;
+
+	if (!pThis)
+	{
+		return NULL;
+	}
+
+	switch (interfaceType)
+	{
+	case csc_bit_IAllocator:
+
+		return (CSC_PCVOID)&pAllocator->allocatorInterface;
+
+	default:
+
+		return NULL;
+	}
+}
+
+static CSC_STATUS CSCMETHOD CSC_BuddyAllocatorInit(_Inout_ CSC_IAllocator* CONST pThis)
+{
+	if (!pThis || !CSC_BuddyAllocatorIsValid(CSC_CONTAINING_RECORD(pThis, CSC_BuddyAllocator, allocatorInterface)))
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	return CSC_STATUS_SUCCESS;
+}
+
+static CSC_STATUS CSCMETHOD CSC_BuddyAllocatorCleanup(_Inout_ CSC_IAllocator* CONST pThis)
+{
+	if (!pThis)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	return CSC_BuddyAllocatorDestroy(CSC_CONTAINING_RECORD(pThis, CSC_BuddyAllocator, allocatorInterface));
+}
+
+static CSC_PVOID CSCMETHOD CSC_BuddyAllocatorAlloc(_In_ CONST CSC_IAllocator* CONST pThis, _In_ CONST CSC_SIZE_T size)
+{
+	return CSC_BuddyAllocatorAllocate(pThis, size, (CSC_BOOLEAN)FALSE);
+}
+
+static CSC_PVOID CSCMETHOD CSC_BuddyAllocatorAllocZero(_In_ CONST CSC_IAllocator* CONST pThis, _In_ CONST CSC_SIZE_T size)
+{
+	return CSC_BuddyAllocatorAllocate(pThis, size, (CSC_BOOLEAN)TRUE);
+}
+
+static CSC_STATUS CSCMETHOD CSC_BuddyAllocatorFree(_In_ CONST CSC_IAllocator* CONST pThis, _In_ CONST CSC_PVOID pMemoryBlock)
+{
+	CSC_BuddyAllocator* CONST pAllocator = (CSC_BuddyAllocator* CONST)CSC_CONTAINING_RECORD(pThis, CONST CSC_BuddyAllocator, allocatorInterface);
+	CSC_SIZE_T node, level, parent;
+
+	if (!pThis || !pMemoryBlock || !CSC_BuddyAllocatorIsValid(pAllocator) || !CSC_BuddyAllocatorFindBlock(pAllocator, pMemoryBlock, &node, &level))
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	// While the block is allocated the pair bit of it's parent equals the free state of it's buddy, merge as long as the buddy is free.
+	for (; level; --level)
+	{
+		parent = (node - (CSC_SIZE_T)1) >> 1;
+
+		if (!CSC_BuddyAllocatorTestBit(pAllocator->pPairBitmap, parent))
+		{
+			break;
+		}
+
+		CSC_BuddyAllocatorRemoveFreeBlock(pAllocator, (node & (CSC_SIZE_T)1) ? node + (CSC_SIZE_T)1 : node - (CSC_SIZE_T)1, level);
+		CSC_BuddyAllocatorClearBit(pAllocator->pSplitBitmap, parent);
+		node = parent;
+	}
+
+	CSC_BuddyAllocatorPushFreeBlock(pAllocator, node, level);
+	++pAllocator->freeCount;
+
+	return CSC_STATUS_SUCCESS;
+}
+
+static CSC_BOOLEAN CSCMETHOD CSC_BuddyAllocatorIsUsable(_In_ CONST CSC_IAllocator* CONST pThis)
+{
+	if (!pThis || !CSC_BuddyAllocatorIsValid(CSC_CONTAINING_RECORD(pThis, CONST CSC_BuddyAllocator, allocatorInterface)))
+	{
+		return (CSC_BOOLEAN)FALSE;
+	}
+
+	return (CSC_BOOLEAN)TRUE;
+}
+
+static CSC_SIZE_T CSCMETHOD CSC_BuddyAllocatorGetUsableSize(_In_ CONST CSC_IAllocator* CONST pThis, _In_ CONST CSC_PCVOID pMemoryBlock)
+{
+	CONST CSC_BuddyAllocator* CONST pAllocator = CSC_CONTAINING_RECORD(pThis, CONST CSC_BuddyAllocator, allocatorInterface);
+
+	if (!pThis)
+	{
+		return (CSC_SIZE_T)0;
+	}
+
+	return CSC_BuddyAllocatorGetBlockSize(pAllocator, pMemoryBlock);
+}
+
+
+CSC_STATUS CSCMETHOD CSC_BuddyAllocatorInitialize(_Out_ CSC_BuddyAllocator* CONST pThis, _In_ CONST CSC_PVOID pRegion, _In_ CONST CSC_SIZE_T regionSize, _In_ CONST CSC_SIZE_T minBlockSize)
+{
+	CSC_STATUS status;
+	CSC_BYTE* CONST pRegionEnd = (CSC_BYTE*)pRegion + regionSize;
+	CSC_SIZE_T blockSize = (CSC_SIZE_T)0x10;
+	CSC_SIZE_T leafCount = (CSC_SIZE_T)1;
+	CSC_SIZE_T maxLevel = (CSC_SIZE_T)0;
+	CSC_SIZE_T bitmapSize;
+	CSC_BYTE* pBase;
+
+	if (!pThis || !pRegion || !regionSize || (CSC_SIZE_T)pRegionEnd < (CSC_SIZE_T)pRegion)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	// Free blocks hold two links, hence the minimum block size is at least the size of two pointers.
+	while (blockSize < ((minBlockSize) ? minBlockSize : CSC_BUDDY_ALLOCATOR_DEFAULT_MIN_BLOCK_SIZE) || blockSize < sizeof(CSC_BuddyAllocatorFreeBlock))
+	{
+		if (blockSize > regionSize)
+		{
+			return CSC_STATUS_INVALID_PARAMETER;
+		}
+
+		blockSize <<= 1;
+	}
+
+	// The tree covers the next power of two of the amount of minimum blocks, it is never larger than twice the region.
+	while (leafCount < regionSize / blockSize)
+	{
+		if (leafCount > (~(CSC_SIZE_T)0 >> 2) / blockSize)
+		{
+			return CSC_STATUS_INVALID_PARAMETER;
+		}
+
+		leafCount <<= 1;
+		++maxLevel;
+	}
+
+	bitmapSize = (leafCount + (CSC_SIZE_T)7) >> 3;
+	pBase = (CSC_BYTE*)pRegion + bitmapSize * (CSC_SIZE_T)2;
+	pBase += (blockSize - (CSC_SIZE_T)((CSC_DATA_POINTER_TYPE)pBase & (blockSize - (CSC_SIZE_T)1))) & (blockSize - (CSC_SIZE_T)1);
+
+	if (pBase >= pRegionEnd || (CSC_SIZE_T)(pRegionEnd - pBase) < blockSize)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	status = CSC_MemoryUtilsSetZeroMemory((CSC_PVOID)pThis, sizeof(CSC_BuddyAllocator));
+
+	if (status != CSC_STATUS_SUCCESS)
+	{
+		return status;
+	}
+
+	status = CSC_MemoryUtilsSetZeroMemory(pRegion, bitmapSize * (CSC_SIZE_T)2);
+
+	if (status != CSC_STATUS_SUCCESS)
+	{
+		return status;
+	}
+
+	pThis->baseInterface.pIBaseInterfaceVirtualTable = &g_BuddyAllocatorBaseInterfaceVTable;
+	pThis->allocatorInterface.pIAllocatorVirtualTable = &g_BuddyAllocatorAllocatorVTable;
+	pThis->pBase = pBase;
+	pThis->pSplitBitmap = (CSC_BYTE*)pRegion;
+	pThis->pPairBitmap = (CSC_BYTE*)pRegion + bitmapSize;
+	pThis->minBlockSize = blockSize;
+	pThis->treeSize = leafCount * blockSize;
+	pThis->maxLevel = maxLevel;
+	pThis->managedBytes = (CSC_SIZE_T)(pRegionEnd - pBase) / blockSize * blockSize;
+
+	CSC_BuddyAllocatorInitializeNode(pThis, (CSC_SIZE_T)0, (CSC_SIZE_T)0, (CSC_SIZE_T)0);
+
+	return CSC_STATUS_SUCCESS;
+}
+
+CSC_STATUS CSCMETHOD CSC_BuddyAllocatorDestroy(_Inout_ CSC_BuddyAllocator* CONST pThis)
+{
+	if (!CSC_BuddyAllocatorIsValid(pThis))
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	return CSC_MemoryUtilsSetZeroMemory((CSC_PVOID)pThis, sizeof(CSC_BuddyAllocator));
+}
+
+
+CSC_SIZE_T CSCMETHOD CSC_BuddyAllocatorGetBlockSize(_In_ CONST CSC_BuddyAllocator* CONST pThis, _In_ CONST CSC_PCVOID pMemoryBlock)
+{
+	CSC_SIZE_T node, level;
+
+	if (!pMemoryBlock || !CSC_BuddyAllocatorIsValid(pThis) || !CSC_BuddyAllocatorFindBlock(pThis, pMemoryBlock, &node, &level))
+	{
+		return (CSC_SIZE_T)0;
+	}
+
+	return pThis->treeSize >> level;
+}
+
+CSC_STATUS CSCMETHOD CSC_BuddyAllocatorGetStatistics(_In_ CONST CSC_BuddyAllocator* CONST pThis, _Out_ CSC_BuddyAllocatorStatistics* CONST pStatistics)
+{
+	CSC_STATUS status;
+	CSC_SIZE_T level;
+
+	if (!pStatistics || !CSC_BuddyAllocatorIsValid(pThis))
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	status = CSC_MemoryUtilsSetZeroMemory((CSC_PVOID)pStatistics, sizeof(CSC_BuddyAllocatorStatistics));
+
+	if (status != CSC_STATUS_SUCCESS)
+	{
+		return status;
+	}
+
+	pStatistics->managedBytes = pThis->managedBytes;
+	pStatistics->freeBytes = pThis->freeBytes;
+	pStatistics->allocCount = pThis->allocCount;
+	pStatistics->freeCount = pThis->freeCount;
+	pStatistics->failedAllocCount = pThis->failedAllocCount;
+
+	for (level = (CSC_SIZE_T)0; level <= pThis->maxLevel; ++level)
+	{
+		pStatistics->freeBlockCounts[pThis->maxLevel - level] = pThis->freeBlockCounts[level];
+
+		if (!pStatistics->largestFreeBlock && pThis->freeBlockCounts[level])
+		{
+			pStatistics->largestFreeBlock = pThis->treeSize >> level;
+		}
+	}
+
+	// The free memory is a multiple of the minimum block size, dividing both values by it keeps the multiplication from overflowing for all practical region sizes.
+	if (pThis->freeBytes)
+	{
+		pStatistics->fragmentationPerMille = (CSC_SIZE_T)1000 - (pStatistics->largestFreeBlock / pThis->minBlockSize) * (CSC_SIZE_T)1000 / (pThis->freeBytes / pThis->minBlockSize);
+	}
+
+	return CSC_STATUS_SUCCESS;
+}
+
+CSC_SIZE_T CSCMETHOD CSC_BuddyAllocatorGetMinBlockSize(_In_ CONST CSC_BuddyAllocator* CONST pThis)
+{
+	if (!CSC_BuddyAllocatorIsValid(pThis))
+	{
+		return (CSC_SIZE_T)0;
+	}
+
+	return pThis->minBlockSize;
+}
+
+CSC_SIZE_T CSCMETHOD CSC_BuddyAllocatorGetManagedBytes(_In_ CONST CSC_BuddyAllocator* CONST pThis)
+{
+	if (!CSC_BuddyAllocatorIsValid(pThis))
+	{
+		return (CSC_SIZE_T)0;
+	}
+
+	return pThis->managedBytes;
+}
+
+CSC_IBaseInterface* CSCMETHOD CSC_BuddyAllocatorGetIBaseInterface(_In_ CONST CSC_BuddyAllocator* CONST pThis)
+{
+	if (!CSC_BuddyAllocatorIsValid(pThis))
+	{
+		return (CSC_IBaseInterface*)NULL;
+	}
+
+	return (CSC_IBaseInterface*)&pThis->baseInterface;
+}
+
+CSC_IAllocator* CSCMETHOD CSC_BuddyAllocatorGetIAllocator(_In_ CONST CSC_BuddyAllocator* CONST pThis)
+{
+	if (!CSC_BuddyAllocatorIsValid(pThis))
+	{
+		return (CSC_IAllocator*)NULL;
+	}
+
+	return (CSC_IAllocator*)&pThis->allocatorInterface;
+}
\ No newline at end of file
@@ -0,0 +1,82 @@
+#ifndef CSC_BUDDY_ALLOCATOR
+#define CSC_BUDDY_ALLOCATOR
+
+/*
+Description:
+The BuddyAllocator implements the IAllocator interface on top of a memory region that is supplied by the caller, for example a static buffer in a freestanding build without a system heap.
+The region is managed as a binary tree of blocks whose sizes are powers of two multiples of the minimum block size, every request is served by the smallest block that can hold it.
+Larger blocks are split in halves (buddies) on demand, and a freed block is merged with it's buddy as long as the buddy is free, hence allocations and frees take O(log n) steps.
+The state of the tree is tracked in two bitmaps with one bit per inner node: one bit marks split blocks, the other holds the exclusive or of the free states of both children, which is all that is needed to decide whether a freed block can be merged.
+Both bitmaps are placed at the start of the region, they consume about 1/(4 * minimum block size) of it, the remaining part is rounded down to a multiple of the minimum block size.
+Free blocks are kept on doubly linked lists per block size, which are stored within the free blocks themselves.
+Since every block is aligned to it's own size relative to the start of the managed memory, blocks are aligned to the minimum block size and no header is required.
+The allocator doesn't require any operating system or library support, it is not thread safe though.
+*/
+
+// Include the current configuration of the library containing various type definitions and other things.
+#include "../../Configuration/Configuration.h"
+// Include the IBaseInterface as the allocator can be queried for the interfaces it implements.
+#include "../../Interfaces/IBaseInterface.h"
+// Include the IAllocator interface as the allocator implements it.
+#include "../../Interfaces/IAllocator.h"
+
+// Definition of the maximum amount of block sizes, one for every power of two a CSC_SIZE_T can hold.
+#define CSC_BUDDY_ALLOCATOR_MAX_ORDERS (sizeof(CSC_SIZE_T) * (CSC_SIZE_T)8)
+// Definition of the minimum block size that is used if no other value is supplied.
+#define CSC_BUDDY_ALLOCATOR_DEFAULT_MIN_BLOCK_SIZE (CSC_SIZE_T)0x20
+
+// Definition of the statistics of the allocator.
+// The free block counts are indexed by order, order 0 holds blocks of the minimum block size and every following order doubles the size.
+// The fragmentation is the share of free memory that is not part of the largest free block, in per mille.
+typedef struct _CSC_BuddyAllocatorStatistics
+{
+	CSC_SIZE_T managedBytes;
+	CSC_SIZE_T freeBytes;
+	CSC_SIZE_T largestFreeBlock;
+	CSC_SIZE_T fragmentationPerMille;
+	CSC_SIZE_T allocCount;
+	CSC_SIZE_T freeCount;
+	CSC_SIZE_T failedAllocCount;
+	CSC_SIZE_T freeBlockCounts[CSC_BUDDY_ALLOCATOR_MAX_ORDERS];
+} CSC_BuddyAllocatorStatistics;
+
+typedef struct _CSC_BuddyAllocator
+{
+	CSC_IBaseInterface baseInterface;
+	CSC_IAllocator allocatorInterface;
+	CSC_BYTE* pBase;
+	CSC_BYTE* pSplitBitmap;
+	CSC_BYTE* pPairBitmap;
+	CSC_SIZE_T minBlockSize;
+	CSC_SIZE_T treeSize;
+	CSC_SIZE_T maxLevel;
+	CSC_SIZE_T managedBytes;
+	CSC_SIZE_T freeBytes;
+	CSC_SIZE_T allocCount;
+	CSC_SIZE_T freeCount;
+	CSC_SIZE_T failedAllocCount;
+	CSC_PVOID pFreeLists[CSC_BUDDY_ALLOCATOR_MAX_ORDERS];
+	CSC_SIZE_T freeBlockCounts[CSC_BUDDY_ALLOCATOR_MAX_ORDERS];
+} CSC_BuddyAllocator;
+
+// Initializes the allocator to manage the supplied region, which must stay valid for the lifetime of the allocator.
+// The minimum block size is rounded up to a power of two that can hold two pointers, a value of 0 uses CSC_BUDDY_ALLOCATOR_DEFAULT_MIN_BLOCK_SIZE.
+// Returns CSC_STATUS_SUCCESS on success, otherwise an error code is returned.
+CSC_STATUS CSCMETHOD CSC_BuddyAllocatorInitialize(_Out_ CSC_BuddyAllocator* CONST pThis, _In_ CONST CSC_PVOID pRegion, _In_ CONST CSC_SIZE_T regionSize, _In_ CONST CSC_SIZE_T minBlockSize);
+// Detaches the allocator from the region and zeroes out the object, blocks that are still allocated become invalid.
+// Returns CSC_STATUS_SUCCESS on success, otherwise an error code is returned.
+CSC_STATUS CSCMETHOD CSC_BuddyAllocatorDestroy(_Inout_ CSC_BuddyAllocator* CONST pThis);
+
+// Retrieves the size of the block that backs an allocation, which is the requested size rounded up to a power of two multiple of the minimum block size.
+// Returns 0 if the parameters are invalid.
+CSC_SIZE_T CSCMETHOD CSC_BuddyAllocatorGetBlockSize(_In_ CONST CSC_BuddyAllocator* CONST pThis, _In_ CONST CSC_PCVOID pMemoryBlock);
+// Fills the supplied structure with the current statistics of the allocator.
+// Returns CSC_STATUS_SUCCESS on success, otherwise an error code is returned.
+CSC_STATUS CSCMETHOD CSC_BuddyAllocatorGetStatistics(_In_ CONST CSC_BuddyAllocator* CONST pThis, _Out_ CSC_BuddyAllocatorStatistics* CONST pStatistics);
+
+CSC_SIZE_T CSCMETHOD CSC_BuddyAllocatorGetMinBlockSize(_In_ CONST CSC_BuddyAllocator* CONST pThis);
+CSC_SIZE_T CSCMETHOD CSC_BuddyAllocatorGetManagedBytes(_In_ CONST CSC_BuddyAllocator* CONST pThis);
+CSC_IBaseInterface* CSCMETHOD CSC_BuddyAllocatorGetIBaseInterface(_In_ CONST CSC_BuddyAllocator* CONST pThis);
+CSC_IAllocator* CSCMETHOD CSC_BuddyAllocatorGetIAllocator(_In_ CONST CSC_BuddyAllocator* CONST pThis);
+
+#endif
\ No newline at end of file
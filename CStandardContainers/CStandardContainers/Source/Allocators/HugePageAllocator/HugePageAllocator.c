@@ -0,0 +1,640 @@
+// Request the GNU extensions of the system headers, which contain the huge page related flags.
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+
+#include "HugePageAllocator.h"
+
+#ifdef CSC_CONFIG_LINUX_NATIVE
+
+#include "../../Utils/MemoryUtils.h"
+
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+// Definition of the origins of a block, which are stored in the block header or the entry of the mapping table.
+#define CSC_HUGE_PAGE_ALLOCATOR_BLOCK_PARENT (CSC_SIZE_T)0x50415245
+#define CSC_HUGE_PAGE_ALLOCATOR_BLOCK_HUGE_TLB (CSC_SIZE_T)0x48544C42
+#define CSC_HUGE_PAGE_ALLOCATOR_BLOCK_TRANSPARENT (CSC_SIZE_T)0x54485047
+// Definition of the address that marks an entry of the mapping table, which was claimed for a mapping that is still being created.
+#define CSC_HUGE_PAGE_ALLOCATOR_MAPPING_RESERVED (CSC_SIZE_T)1
+
+// Definition of the header that precedes blocks of the parent allocator and mapped blocks that are not kept in the mapping table.
+// For mapped blocks the size is the size of the whole mapping, which starts at the header.
+typedef struct _CSC_HugePageAllocatorBlockHeader
+{
+	CSC_SIZE_T origin;
+	CSC_SIZE_T size;
+} CSC_HugePageAllocatorBlockHeader;
+
+static CSC_PCVOID CSCMETHOD CSC_HugePageAllocatorGetInterface(_In_ CONST CSC_IBaseInterface* CONST pThis, _In_ CONST EBaseInterfaceType interfaceType);
+
+static CSC_STATUS CSCMETHOD CSC_HugePageAllocatorInit(_Inout_ CSC_IAllocator* CONST pThis);
+static CSC_STATUS CSCMETHOD CSC_HugePageAllocatorCleanup(_Inout_ CSC_IAllocator* CONST pThis);
+static CSC_PVOID CSCMETHOD CSC_HugePageAllocatorAlloc(_In_ CONST CSC_IAllocator* CONST pThis, _In_ CONST CSC_SIZE_T size);
+static CSC_PVOID CSCMETHOD CSC_HugePageAllocatorAllocZero(_In_ CONST CSC_IAllocator* CONST pThis, _In_ CONST CSC_SIZE_T size);
+static CSC_STATUS CSCMETHOD CSC_HugePageAllocatorFree(_In_ CONST CSC_IAllocator* CONST pThis, _In_ CONST CSC_PVOID pMemoryBlock);
+static CSC_BOOLEAN CSCMETHOD CSC_HugePageAllocatorIsUsable(_In_ CONST CSC_IAllocator* CONST pThis);
+static CSC_SIZE_T CSCMETHOD CSC_HugePageAllocatorGetUsableSize(_In_ CONST CSC_IAllocator* CONST pThis, _In_ CONST CSC_PCVOID pMemoryBlock);
+
+static CSC_IBaseInterfaceVirtualTable g_HugePageAllocatorBaseInterfaceVTable =
+{
+	CSC_HugePageAllocatorGetInterface
+};
+
+static CSC_IAllocatorVirtualTable g_HugePageAllocatorAllocatorVTable =
+{
+	CSC_HugePageAllocatorInit,
+	CSC_HugePageAllocatorCleanup,
+	CSC_HugePageAllocatorAlloc,
+	CSC_HugePageAllocatorAllocZero,
+	CSC_HugePageAllocatorFree,
+	CSC_HugePageAllocatorIsUsable,
+	NULL,
+	NULL,
+	NULL,
+	CSC_HugePageAllocatorGetUsableSize
+};
+
+
+static CSC_BOOLEAN CSCMETHOD CSC_HugePageAllocatorIsValid(_In_ CONST CSC_HugePageAllocator* CONST pThis)
+{
+	if (!pThis || pThis->baseInterface.pIBaseInterfaceVirtualTable != &g_HugePageAllocatorBaseInterfaceVTable || pThis->allocatorInterface.pIAllocatorVirtualTable != &g_HugePageAllocatorAllocatorVTable || !pThis->pParentAllocator || !pThis->hugePageSize)
+	{
+		return (CSC_BOOLEAN)FALSE;
+	}
+
+	return (CSC_BOOLEAN)TRUE;
+}
+
+// Claims a free entry of the mapping table for a new mapping.
+// Returns a null pointer if all entries are in use.
+static CSC_HugePageAllocatorMapping* CSCMETHOD CSC_HugePageAllocatorClaimMapping(_Inout_ CSC_HugePageAllocator* CONST pThis)
+{
+	CSC_SIZE_T iterator;
+	CSC_SIZE_T expected;
+
+	for (iterator = (CSC_SIZE_T)0; iterator < CSC_HUGE_PAGE_ALLOCATOR_MAPPING_SLOTS; ++iterator)
+	{
+		expected = (CSC_SIZE_T)0;
+
+		if (!CSC_ATOMIC_LOAD(&pThis->mappings[iterator].address) && CSC_ATOMIC_COMPARE_EXCHANGE(&pThis->mappings[iterator].address, &expected, CSC_HUGE_PAGE_ALLOCATOR_MAPPING_RESERVED))
+		{
+			return &pThis->mappings[iterator];
+		}
+	}
+
+	return (CSC_HugePageAllocatorMapping*)NULL;
+}
+
+// Looks up the entry of the mapping table that holds the size of the block, without touching the memory in front of the block.
+// Returns a null pointer if the block is not kept in the table.
+static CSC_HugePageAllocatorMapping* CSCMETHOD CSC_HugePageAllocatorFindMapping(_In_ CONST CSC_HugePageAllocator* CONST pThis, _In_ CONST CSC_PCVOID pMemoryBlock)
+{
+	CSC_SIZE_T iterator;
+
+	// Blocks in the table start at the beginning of their huge page aligned mapping.
+	if ((CSC_DATA_POINTER_TYPE)pMemoryBlock % pThis->hugePageSize)
+	{
+		return (CSC_HugePageAllocatorMapping*)NULL;
+	}
+
+	for (iterator = (CSC_SIZE_T)0; iterator < CSC_HUGE_PAGE_ALLOCATOR_MAPPING_SLOTS; ++iterator)
+	{
+		if (CSC_ATOMIC_LOAD(&pThis->mappings[iterator].address) == (CSC_SIZE_T)(CSC_DATA_POINTER_TYPE)pMemoryBlock)
+		{
+			return (CSC_HugePageAllocatorMapping*)&pThis->mappings[iterator];
+		}
+	}
+
+	return (CSC_HugePageAllocatorMapping*)NULL;
+}
+
+// Removes an unmapped mapping from the statistics of the allocator.
+static void CSCMETHOD CSC_HugePageAllocatorCountUnmapping(_Inout_ CSC_HugePageAllocator* CONST pThis, _In_ CONST CSC_SIZE_T origin, _In_ CONST CSC_SIZE_T mappingSize)
+{
+	if (origin == CSC_HUGE_PAGE_ALLOCATOR_BLOCK_HUGE_TLB)
+	{
+		CSC_ATOMIC_FETCH_SUB(&pThis->hugeTlbMappingCount, (CSC_SIZE_T)1);
+	}
+	else
+	{
+		CSC_ATOMIC_FETCH_SUB(&pThis->transparentMappingCount, (CSC_SIZE_T)1);
+	}
+
+	CSC_ATOMIC_FETCH_SUB(&pThis->mappedBytes, mappingSize);
+}
+
+static CSC_PVOID CSCMETHOD CSC_HugePageAllocatorMapHugeTlb(_In_ CONST CSC_HugePageAllocator* CONST pThis, _In_ CONST CSC_SIZE_T mappingSize)
+{
+	CSC_PVOID pMapping;
+	CSC_SIZE_T pageShift = (CSC_SIZE_T)0;
+	int mapFlags = MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB;
+
+	if (pThis->flags & CSC_HUGE_PAGE_ALLOCATOR_FLAG_PREFAULT)
+	{
+		mapFlags |= MAP_POPULATE;
+	}
+
+#ifdef MAP_HUGE_SHIFT
+	// Select the huge page size explicitly, so that sizes other than the system default can be used.
+	while (((CSC_SIZE_T)1 << pageShift) < pThis->hugePageSize)
+	{
+		++pageShift;
+	}
+
+	mapFlags |= (int)(pageShift << MAP_HUGE_SHIFT);
+#endif
+
+	pMapping = mmap(NULL, mappingSize, PROT_READ | PROT_WRITE, mapFlags, -1, 0);
+
+	return (pMapping == MAP_FAILED) ? NULL : pMapping;
+}
+
+static CSC_PVOID CSCMETHOD CSC_HugePageAllocatorMapTransparent(_In_ CONST CSC_HugePageAllocator* CONST pThis, _In_ CONST CSC_SIZE_T mappingSize)
+{
+	CSC_BYTE* pMapping;
+	CSC_BYTE* pAligned;
+	CSC_SIZE_T prefixLength, suffixLength;
+	int mapFlags = MAP_PRIVATE | MAP_ANONYMOUS;
+
+	if (mappingSize > ~(CSC_SIZE_T)0 - pThis->hugePageSize)
+	{
+		return NULL;
+	}
+
+	// Transparent huge pages can only back huge page aligned ranges, hence the mapping is oversized and trimmed to an aligned range.
+	pMapping = (CSC_BYTE*)mmap(NULL, mappingSize + pThis->hugePageSize, PROT_READ | PROT_WRITE, mapFlags, -1, 0);
+
+	if ((CSC_PVOID)pMapping == MAP_FAILED)
+	{
+		return NULL;
+	}
+
+	prefixLength = (pThis->hugePageSize - (CSC_SIZE_T)((CSC_DATA_POINTER_TYPE)pMapping % pThis->hugePageSize)) % pThis->hugePageSize;
+	suffixLength = pThis->hugePageSize - prefixLength;
+	pAligned = pMapping + prefixLength;
+
+	if (prefixLength)
+	{
+		munmap((CSC_PVOID)pMapping, prefixLength);
+	}
+
+	if (suffixLength)
+	{
+		munmap((CSC_PVOID)(pAligned + mappingSize), suffixLength);
+	}
+
+	madvise((CSC_PVOID)pAligned, mappingSize, MADV_HUGEPAGE);
+
+	if (pThis->flags & CSC_HUGE_PAGE_ALLOCATOR_FLAG_PREFAULT)
+	{
+		// MAP_POPULATE would have faulted the pages in prior to the advice, hence the range is populated afterwards.
+#ifdef MADV_POPULATE_WRITE
+		if (madvise((CSC_PVOID)pAligned, mappingSize, MADV_POPULATE_WRITE))
+#endif
+		{
+			CSC_SIZE_T offset;
+
+			for (offset = (CSC_SIZE_T)0; offset < mappingSize; offset += pThis->hugePageSize)
+			{
+				((CSC_ATOMIC CSC_BYTE*)pAligned)[offset] = (CSC_BYTE)0;
+			}
+		}
+	}
+
+	return (CSC_PVOID)pAligned;
+}
+
+static CSC_PVOID CSCMETHOD CSC_HugePageAllocatorAllocate(_In_ CONST CSC_IAllocator* CONST pThis, _In_ CONST CSC_SIZE_T size, _In_ CONST CSC_BOOLEAN zeroMemory)
+{
+	CSC_HugePageAllocator* CONST pAllocator = (CSC_HugePageAllocator* CONST)CSC_CONTAINING_RECORD(pThis, CONST CSC_HugePageAllocator, allocatorInterface);
+	CSC_HugePageAllocatorBlockHeader* pHeader = NULL;
+	CSC_HugePageAllocatorMapping* pMapping;
+	CSC_BYTE* pBlock = NULL;
+	CSC_SIZE_T mappingSize;
+	CSC_SIZE_T headerSize;
+	CSC_SIZE_T origin;
+
+	if (!pThis || !size || !CSC_HugePageAllocatorIsValid(pAllocator) || size > ~(CSC_SIZE_T)0 - CSC_HUGE_PAGE_ALLOCATOR_HEADER_SIZE - pAllocator->hugePageSize)
+	{
+		return NULL;
+	}
+
+	if (size < pAllocator->largeBlockThreshold)
+	{
+		if (zeroMemory)
+		{
+			pHeader = (CSC_HugePageAllocatorBlockHeader*)CSC_IAllocatorAllocZero(pAllocator->pParentAllocator, size + CSC_HUGE_PAGE_ALLOCATOR_HEADER_SIZE);
+		}
+		else
+		{
+			pHeader = (CSC_HugePageAllocatorBlockHeader*)CSC_IAllocatorAlloc(pAllocator->pParentAllocator, size + CSC_HUGE_PAGE_ALLOCATOR_HEADER_SIZE);
+		}
+
+		if (!pHeader)
+		{
+			return NULL;
+		}
+
+		pHeader->origin = CSC_HUGE_PAGE_ALLOCATOR_BLOCK_PARENT;
+		pHeader->size = size;
+
+		return (CSC_PVOID)((CSC_BYTE*)pHeader + CSC_HUGE_PAGE_ALLOCATOR_HEADER_SIZE);
+	}
+
+	// The size of the mapping is kept in the mapping table, only if the table is full it is stored in a header in front of the block.
+	pMapping = CSC_HugePageAllocatorClaimMapping(pAllocator);
+	headerSize = (pMapping) ? (CSC_SIZE_T)0 : CSC_HUGE_PAGE_ALLOCATOR_HEADER_SIZE;
+	mappingSize = (size + headerSize + pAllocator->hugePageSize - (CSC_SIZE_T)1) / pAllocator->hugePageSize * pAllocator->hugePageSize;
+
+	if (!(pAllocator->flags & CSC_HUGE_PAGE_ALLOCATOR_FLAG_TRANSPARENT_ONLY))
+	{
+		pBlock = (CSC_BYTE*)CSC_HugePageAllocatorMapHugeTlb(pAllocator, mappingSize);
+		origin = CSC_HUGE_PAGE_ALLOCATOR_BLOCK_HUGE_TLB;
+	}
+
+	if (!pBlock)
+	{
+		pBlock = (CSC_BYTE*)CSC_HugePageAllocatorMapTransparent(pAllocator, mappingSize);
+		origin = CSC_HUGE_PAGE_ALLOCATOR_BLOCK_TRANSPARENT;
+	}
+
+	if (!pBlock)
+	{
+		if (pMapping)
+		{
+			CSC_ATOMIC_STORE(&pMapping->address, (CSC_SIZE_T)0);
+		}
+
+		return NULL;
+	}
+
+	if (origin == CSC_HUGE_PAGE_ALLOCATOR_BLOCK_HUGE_TLB)
+	{
+		CSC_ATOMIC_FETCH_ADD(&pAllocator->hugeTlbMappingCount, (CSC_SIZE_T)1);
+	}
+	else
+	{
+		CSC_ATOMIC_FETCH_ADD(&pAllocator->transparentMappingCount, (CSC_SIZE_T)1);
+	}
+
+	CSC_ATOMIC_FETCH_ADD(&pAllocator->mappedBytes, mappingSize);
+
+	if (pMapping)
+	{
+		pMapping->size = mappingSize;
+		pMapping->origin = origin;
+		CSC_ATOMIC_STORE(&pMapping->address, (CSC_SIZE_T)(CSC_DATA_POINTER_TYPE)pBlock);
+	}
+	else
+	{
+		pHeader = (CSC_HugePageAllocatorBlockHeader*)pBlock;
+		pHeader->origin = origin;
+		pHeader->size = mappingSize;
+	}
+
+	// Anonymous mappings are always zero initialized, hence zeroMemory requires no further work.
+	return (CSC_PVOID)(pBlock + headerSize);
+}
+
+
+static CSC_PCVOID CSCMETHOD CSC_HugePageAllocatorGetInterface(_In_ CONST CSC_IBaseInterface* CONST pThis, _In_ CONST EBaseInterfaceType interfaceType)
+{
+	CONST CSC_HugePageAllocator* CONST pAllocator = (CONST CSC_HugePageAllocator* CONST)pThis;
+
+	if (!pThis)
+	{
+		return NULL;
+	}
+
+	switch (interfaceType)
+	{
+	case csc_bit_IAllocator:
+
+		return (CSC_PCVOID)&pAllocator->allocatorInterface;
+
+	default:
+
+		return NULL;
+	}
+}
+
+static CSC_STATUS CSCMETHOD CSC_HugePageAllocatorInit(_Inout_ CSC_IAllocator* CONST pThis)
+{
+	if (!pThis || !CSC_HugePageAllocatorIsValid(CSC_CONTAINING_RECORD(pThis, CSC_HugePageAllocator, allocatorInterface)))
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	return CSC_STATUS_SUCCESS;
+}
+
+static CSC_STATUS CSCMETHOD CSC_HugePageAllocatorCleanup(_Inout_ CSC_IAllocator* CONST pThis)
+{
+	if (!pThis)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	return CSC_HugePageAllocatorDestroy(CSC_CONTAINING_RECORD(pThis, CSC_HugePageAllocator, allocatorInterface));
+}
+
+static CSC_PVOID CSCMETHOD CSC_HugePageAllocatorAlloc(_In_ CONST CSC_IAllocator* CONST pThis, _In_ CONST CSC_SIZE_T size)
+{
+	return CSC_HugePageAllocatorAllocate(pThis, size, (CSC_BOOLEAN)FALSE);
+}
+
+static CSC_PVOID CSCMETHOD CSC_HugePageAllocatorAllocZero(_In_ CONST CSC_IAllocator* CONST pThis, _In_ CONST CSC_SIZE_T size)
+{
+	return CSC_HugePageAllocatorAllocate(pThis, size, (CSC_BOOLEAN)TRUE);
+}
+
+static CSC_STATUS CSCMETHOD CSC_HugePageAllocatorFree(_In_ CONST CSC_IAllocator* CONST pThis, _In_ CONST CSC_PVOID pMemoryBlock)
+{
+	CSC_HugePageAllocator* CONST pAllocator = (CSC_HugePageAllocator* CONST)CSC_CONTAINING_RECORD(pThis, CONST CSC_HugePageAllocator, allocatorInterface);
+	CSC_HugePageAllocatorBlockHeader* pHeader;
+	CSC_HugePageAllocatorMapping* pMapping;
+	CSC_SIZE_T mappingSize;
+	CSC_SIZE_T expected;
+	CSC_SIZE_T origin;
+
+	if (!pThis || !pMemoryBlock || !CSC_HugePageAllocatorIsValid(pAllocator))
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	pMapping = CSC_HugePageAllocatorFindMapping(pAllocator, pMemoryBlock);
+
+	if (pMapping)
+	{
+		// The entry is claimed before the block is unmapped, otherwise a mapping created at the same address by another thread could be found through the stale entry.
+		// The reserved address keeps the entry from being claimed for a new mapping until the block is unmapped, if that fails the address is restored.
+		expected = (CSC_SIZE_T)(CSC_DATA_POINTER_TYPE)pMemoryBlock;
+
+		if (!CSC_ATOMIC_COMPARE_EXCHANGE(&pMapping->address, &expected, CSC_HUGE_PAGE_ALLOCATOR_MAPPING_RESERVED))
+		{
+			return CSC_STATUS_INVALID_PARAMETER;
+		}
+
+		mappingSize = pMapping->size;
+
+		if (munmap(pMemoryBlock, mappingSize))
+		{
+			CSC_ATOMIC_STORE(&pMapping->address, (CSC_SIZE_T)(CSC_DATA_POINTER_TYPE)pMemoryBlock);
+			return CSC_STATUS_GENERAL_FAILURE;
+		}
+
+		CSC_HugePageAllocatorCountUnmapping(pAllocator, pMapping->origin, mappingSize);
+		CSC_ATOMIC_STORE(&pMapping->address, (CSC_SIZE_T)0);
+		return CSC_STATUS_SUCCESS;
+	}
+
+	pHeader = (CSC_HugePageAllocatorBlockHeader*)((CSC_BYTE*)pMemoryBlock - CSC_HUGE_PAGE_ALLOCATOR_HEADER_SIZE);
+
+	switch (pHeader->origin)
+	{
+	case CSC_HUGE_PAGE_ALLOCATOR_BLOCK_PARENT:
+
+		return CSC_IAllocatorFreeSized(pAllocator->pParentAllocator, (CSC_PVOID)pHeader, pHeader->size + CSC_HUGE_PAGE_ALLOCATOR_HEADER_SIZE);
+
+	case CSC_HUGE_PAGE_ALLOCATOR_BLOCK_HUGE_TLB:
+	case CSC_HUGE_PAGE_ALLOCATOR_BLOCK_TRANSPARENT:
+
+		mappingSize = pHeader->size;
+		origin = pHeader->origin;
+
+		if (munmap((CSC_PVOID)pHeader, mappingSize))
+		{
+			return CSC_STATUS_GENERAL_FAILURE;
+		}
+
+		CSC_HugePageAllocatorCountUnmapping(pAllocator, origin, mappingSize);
+		return CSC_STATUS_SUCCESS;
+
+	default:
+
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+}
+
+static CSC_BOOLEAN CSCMETHOD CSC_HugePageAllocatorIsUsable(_In_ CONST CSC_IAllocator* CONST pThis)
+{
+	CONST CSC_HugePageAllocator* CONST pAllocator = CSC_CONTAINING_RECORD(pThis, CONST CSC_HugePageAllocator, allocatorInterface);
+
+	if (!pThis || !CSC_HugePageAllocatorIsValid(pAllocator))
+	{
+		return (CSC_BOOLEAN)FALSE;
+	}
+
+	return CSC_IAllocatorIsUsable(pAllocator->pParentAllocator);
+}
+
+static CSC_SIZE_T CSCMETHOD CSC_HugePageAllocatorGetUsableSize(_In_ CONST CSC_IAllocator* CONST pThis, _In_ CONST CSC_PCVOID pMemoryBlock)
+{
+	CONST CSC_HugePageAllocator* CONST pAllocator = CSC_CONTAINING_RECORD(pThis, CONST CSC_HugePageAllocator, allocatorInterface);
+	CONST CSC_HugePageAllocatorBlockHeader* pHeader;
+	CONST CSC_HugePageAllocatorMapping* pMapping;
+
+	if (!pThis || !pMemoryBlock || !CSC_HugePageAllocatorIsValid(pAllocator))
+	{
+		return (CSC_SIZE_T)0;
+	}
+
+	// Blocks in the mapping table span their whole mapping.
+	pMapping = CSC_HugePageAllocatorFindMapping(pAllocator, pMemoryBlock);
+
+	if (pMapping)
+	{
+		return pMapping->size;
+	}
+
+	pHeader = (CONST CSC_HugePageAllocatorBlockHeader*)((CONST CSC_BYTE*)pMemoryBlock - CSC_HUGE_PAGE_ALLOCATOR_HEADER_SIZE);
+
+	switch (pHeader->origin)
+	{
+	case CSC_HUGE_PAGE_ALLOCATOR_BLOCK_PARENT:
+
+		return pHeader->size;
+
+	// Mapped blocks span whole huge pages, everything behind the header up to the end of the mapping can be used.
+	case CSC_HUGE_PAGE_ALLOCATOR_BLOCK_HUGE_TLB:
+	case CSC_HUGE_PAGE_ALLOCATOR_BLOCK_TRANSPARENT:
+
+		return pHeader->size - CSC_HUGE_PAGE_ALLOCATOR_HEADER_SIZE;
+
+	default:
+
+		return (CSC_SIZE_T)0;
+	}
+}
+
+
+CSC_STATUS CSCMETHOD CSC_HugePageAllocatorInitialize(_Out_ CSC_HugePageAllocator* CONST pThis, _In_ CSC_IAllocator* CONST pParentAllocator, _In_ CONST CSC_SIZE_T hugePageSize, _In_ CONST CSC_SIZE_T largeBlockThreshold, _In_ CONST CSC_DWORD flags)
+{
+	CSC_STATUS status;
+	CSC_SIZE_T pageSize = hugePageSize;
+
+	if (!pThis || !pParentAllocator || !CSC_IAllocatorIsUsable(pParentAllocator))
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	if (!pageSize)
+	{
+		pageSize = CSC_HugePageAllocatorQueryHugePageSize();
+
+		if (!pageSize)
+		{
+			pageSize = CSC_HUGE_PAGE_ALLOCATOR_DEFAULT_PAGE_SIZE;
+		}
+	}
+
+	// The huge page size must be a power of two that is at least as large as a regular page.
+	if ((pageSize & (pageSize - (CSC_SIZE_T)1)) || pageSize < (CSC_SIZE_T)sysconf(_SC_PAGESIZE))
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	status = CSC_MemoryUtilsSetZeroMemory((CSC_PVOID)pThis, sizeof(CSC_HugePageAllocator));
+
+	if (status != CSC_STATUS_SUCCESS)
+	{
+		return status;
+	}
+
+	pThis->baseInterface.pIBaseInterfaceVirtualTable = &g_HugePageAllocatorBaseInterfaceVTable;
+	pThis->allocatorInterface.pIAllocatorVirtualTable = &g_HugePageAllocatorAllocatorVTable;
+	pThis->pParentAllocator = pParentAllocator;
+	pThis->hugePageSize = pageSize;
+	pThis->largeBlockThreshold = (largeBlockThreshold) ? largeBlockThreshold : pageSize;
+	pThis->flags = flags;
+
+	return CSC_STATUS_SUCCESS;
+}
+
+CSC_STATUS CSCMETHOD CSC_HugePageAllocatorDestroy(_Inout_ CSC_HugePageAllocator* CONST pThis)
+{
+	if (!CSC_HugePageAllocatorIsValid(pThis))
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	return CSC_MemoryUtilsSetZeroMemory((CSC_PVOID)pThis, sizeof(CSC_HugePageAllocator));
+}
+
+
+CSC_SIZE_T CSCMETHOD CSC_HugePageAllocatorQueryHugePageSize(void)
+{
+	static CONST CSC_CHAR key[] = "Hugepagesize:";
+	CSC_CHAR buffer[(CSC_SIZE_T)0x1000];
+	CSC_SIZE_T iterator, keyIterator, pageSize = (CSC_SIZE_T)0;
+	ssize_t bytesRead;
+	int fd;
+
+	fd = open("/proc/meminfo", O_RDONLY);
+
+	if (fd < 0)
+	{
+		return (CSC_SIZE_T)0;
+	}
+
+	bytesRead = read(fd, buffer, sizeof(buffer) - (CSC_SIZE_T)1);
+	close(fd);
+
+	if (bytesRead <= 0)
+	{
+		return (CSC_SIZE_T)0;
+	}
+
+	buffer[bytesRead] = (CSC_CHAR)0;
+
+	for (iterator = (CSC_SIZE_T)0; iterator < (CSC_SIZE_T)bytesRead; ++iterator)
+	{
+		for (keyIterator = (CSC_SIZE_T)0; key[keyIterator] && buffer[iterator + keyIterator] == key[keyIterator]; ++keyIterator)
+		{
+		}
+
+		if (key[keyIterator])
+		{
+			continue;
+		}
+
+		// The value is given in kB, e.g. "Hugepagesize:    2048 kB".
+		for (iterator += keyIterator; buffer[iterator] == (CSC_CHAR)' '; ++iterator)
+		{
+		}
+
+		for (; buffer[iterator] >= (CSC_CHAR)'0' && buffer[iterator] <= (CSC_CHAR)'9'; ++iterator)
+		{
+			pageSize = pageSize * (CSC_SIZE_T)10 + (CSC_SIZE_T)(buffer[iterator] - (CSC_CHAR)'0');
+		}
+
+		return pageSize * (CSC_SIZE_T)0x400;
+	}
+
+	return (CSC_SIZE_T)0;
+}
+
+CSC_SIZE_T CSCMETHOD CSC_HugePageAllocatorGetHugePageSize(_In_ CONST CSC_HugePageAllocator* CONST pThis)
+{
+	if (!CSC_HugePageAllocatorIsValid(pThis))
+	{
+		return (CSC_SIZE_T)0;
+	}
+
+	return pThis->hugePageSize;
+}
+
+CSC_SIZE_T CSCMETHOD CSC_HugePageAllocatorGetMappedBytes(_In_ CONST CSC_HugePageAllocator* CONST pThis)
+{
+	if (!CSC_HugePageAllocatorIsValid(pThis))
+	{
+		return (CSC_SIZE_T)0;
+	}
+
+	return CSC_ATOMIC_LOAD(&pThis->mappedBytes);
+}
+
+CSC_SIZE_T CSCMETHOD CSC_HugePageAllocatorGetHugeTlbMappingCount(_In_ CONST CSC_HugePageAllocator* CONST pThis)
+{
+	if (!CSC_HugePageAllocatorIsValid(pThis))
+	{
+		return (CSC_SIZE_T)0;
+	}
+
+	return CSC_ATOMIC_LOAD(&pThis->hugeTlbMappingCount);
+}
+
+CSC_SIZE_T CSCMETHOD CSC_HugePageAllocatorGetTransparentMappingCount(_In_ CONST CSC_HugePageAllocator* CONST pThis)
+{
+	if (!CSC_HugePageAllocatorIsValid(pThis))
+	{
+		return (CSC_SIZE_T)0;
+	}
+
+	return CSC_ATOMIC_LOAD(&pThis->transparentMappingCount);
+}
+
+CSC_IBaseInterface* CSCMETHOD CSC_HugePageAllocatorGetIBaseInterface(_In_ CONST CSC_HugePageAllocator* CONST pThis)
+{
+	if (!CSC_HugePageAllocatorIsValid(pThis))
+	{
+		return (CSC_IBaseInterface*)NULL;
+	}
+
+	return (CSC_IBaseInterface*)&pThis->baseInterface;
+}
+
+CSC_IAllocator* CSCMETHOD CSC_HugePageAllocatorGetIAllocator(_In_ CONST CSC_HugePageAllocator* CONST pThis)
+{
+	if (!CSC_HugePageAllocatorIsValid(pThis))
+	{
+		return (CSC_IAllocator*)NULL;
+	}
+
+	return (CSC_IAllocator*)&pThis->allocatorInterface;
+}
+
+#endif
\ No newline at end of file
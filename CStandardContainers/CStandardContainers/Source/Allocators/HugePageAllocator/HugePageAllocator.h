@@ -0,0 +1,85 @@
+#ifndef CSC_HUGE_PAGE_ALLOCATOR
+#define CSC_HUGE_PAGE_ALLOCATOR
+
+/*
+Description:
+The HugePageAllocator implements the IAllocator interface for very large blocks, for example the buffers of multi-GiB containers.
+Requests of at least the configured threshold are served by mapping anonymous memory backed by huge pages, which reduces the amount of TLB misses on random access.
+The allocator first tries to map explicitly reserved huge pages (MAP_HUGETLB), if none are available it falls back to a huge page aligned mapping advised for transparent huge pages (MADV_HUGEPAGE).
+Sizes of mapped blocks are rounded up to a multiple of the huge page size, mappings can optionally be prefaulted (MAP_POPULATE) to avoid page faults on first access.
+A mapped block starts at the beginning of it's mapping and it's size is kept in a table of the allocator, hence a request of N huge pages maps exactly N huge pages.
+Only if all CSC_HUGE_PAGE_ALLOCATOR_MAPPING_SLOTS entries of the table are in use, the size is stored in a header in front of the block, which may require one more huge page.
+Smaller requests are delegated to a parent allocator.
+Blocks of the parent allocator are preceded by a header of CSC_HUGE_PAGE_ALLOCATOR_HEADER_SIZE bytes that records where the block came from, hence the alignment guaranteed by the parent allocator is kept for up to that many bytes.
+Mapped memory is zero initialized by the kernel, hence zeroed allocations of large blocks come without additional cost.
+The allocator relies on POSIX system calls and is only available in the Linux native configuration.
+*/
+
+// Include the current configuration of the library containing various type definitions and other things.
+#include "../../Configuration/Configuration.h"
+
+#ifdef CSC_CONFIG_LINUX_NATIVE
+
+// Include the IBaseInterface as the allocator can be queried for the interfaces it implements.
+#include "../../Interfaces/IBaseInterface.h"
+// Include the IAllocator interface as the allocator implements it and delegates small requests to another allocator implementing it.
+#include "../../Interfaces/IAllocator.h"
+
+// Definition of the huge page size that is used if the size could not be determined from the system.
+#define CSC_HUGE_PAGE_ALLOCATOR_DEFAULT_PAGE_SIZE (CSC_SIZE_T)0x200000
+// Definition of the size of the header that precedes blocks of the parent allocator and mapped blocks that are not kept in the mapping table.
+#define CSC_HUGE_PAGE_ALLOCATOR_HEADER_SIZE (sizeof(CSC_SIZE_T) * (CSC_SIZE_T)2)
+// Definition of the amount of mapped blocks whose size is kept in the mapping table of the allocator.
+#define CSC_HUGE_PAGE_ALLOCATOR_MAPPING_SLOTS (CSC_SIZE_T)0x40
+
+// Definition of the flags that adjust the behaviour of the allocator.
+// Prefaults the pages of every mapping when it is created.
+#define CSC_HUGE_PAGE_ALLOCATOR_FLAG_PREFAULT (CSC_DWORD)0x1
+// Skips explicit huge pages and only uses transparent huge pages.
+#define CSC_HUGE_PAGE_ALLOCATOR_FLAG_TRANSPARENT_ONLY (CSC_DWORD)0x2
+
+// Definition of an entry of the mapping table, a free entry holds a null address.
+typedef struct _CSC_HugePageAllocatorMapping
+{
+	CSC_ATOMIC CSC_SIZE_T address;
+	CSC_SIZE_T size;
+	CSC_SIZE_T origin;
+} CSC_HugePageAllocatorMapping;
+
+typedef struct _CSC_HugePageAllocator
+{
+	CSC_IBaseInterface baseInterface;
+	CSC_IAllocator allocatorInterface;
+	CSC_IAllocator* pParentAllocator;
+	CSC_SIZE_T hugePageSize;
+	CSC_SIZE_T largeBlockThreshold;
+	CSC_DWORD flags;
+	CSC_ATOMIC CSC_SIZE_T hugeTlbMappingCount;
+	CSC_ATOMIC CSC_SIZE_T transparentMappingCount;
+	CSC_ATOMIC CSC_SIZE_T mappedBytes;
+	CSC_HugePageAllocatorMapping mappings[CSC_HUGE_PAGE_ALLOCATOR_MAPPING_SLOTS];
+} CSC_HugePageAllocator;
+
+// Initializes the allocator with a parent allocator for small requests, which must be usable and outlive the allocator.
+// A hugePageSize of 0 queries the default huge page size of the system, a largeBlockThreshold of 0 uses the huge page size as threshold.
+// Returns CSC_STATUS_SUCCESS on success, otherwise an error code is returned.
+CSC_STATUS CSCMETHOD CSC_HugePageAllocatorInitialize(_Out_ CSC_HugePageAllocator* CONST pThis, _In_ CSC_IAllocator* CONST pParentAllocator, _In_ CONST CSC_SIZE_T hugePageSize, _In_ CONST CSC_SIZE_T largeBlockThreshold, _In_ CONST CSC_DWORD flags);
+// Zeroes out the allocator, blocks that are still allocated must be freed prior to this operation.
+// Returns CSC_STATUS_SUCCESS on success, otherwise an error code is returned.
+CSC_STATUS CSCMETHOD CSC_HugePageAllocatorDestroy(_Inout_ CSC_HugePageAllocator* CONST pThis);
+
+// Queries the default huge page size of the system.
+// Returns 0 if the size could not be determined.
+CSC_SIZE_T CSCMETHOD CSC_HugePageAllocatorQueryHugePageSize(void);
+
+CSC_SIZE_T CSCMETHOD CSC_HugePageAllocatorGetHugePageSize(_In_ CONST CSC_HugePageAllocator* CONST pThis);
+CSC_SIZE_T CSCMETHOD CSC_HugePageAllocatorGetMappedBytes(_In_ CONST CSC_HugePageAllocator* CONST pThis);
+// The mapping counts only include the mappings that are currently mapped, like the mapped bytes they are decremented once a mapping is freed.
+CSC_SIZE_T CSCMETHOD CSC_HugePageAllocatorGetHugeTlbMappingCount(_In_ CONST CSC_HugePageAllocator* CONST pThis);
+CSC_SIZE_T CSCMETHOD CSC_HugePageAllocatorGetTransparentMappingCount(_In_ CONST CSC_HugePageAllocator* CONST pThis);
+CSC_IBaseInterface* CSCMETHOD CSC_HugePageAllocatorGetIBaseInterface(_In_ CONST CSC_HugePageAllocator* CONST pThis);
+CSC_IAllocator* CSCMETHOD CSC_HugePageAllocatorGetIAllocator(_In_ CONST CSC_HugePageAllocator* CONST pThis);
+
+#endif
+
+#endif
\ No newline at end of file
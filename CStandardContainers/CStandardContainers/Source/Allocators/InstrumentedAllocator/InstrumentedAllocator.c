@@ -0,0 +1,481 @@
+#include "InstrumentedAllocator.h"
+#include "../../Utils/MemoryUtils.h"
+
+// Definition of the header that precedes every block handed out by the allocator.
+typedef struct _CSC_InstrumentedAllocatorBlockHeader
+{
+	CSC_SIZE_T size;
+	CSC_SIZE_T tag;
+} CSC_InstrumentedAllocatorBlockHeader;
+
+// Definition of the granularity of the stack addresses that select a stripe, threads whose stacks are further apart usually use different stripes.
+#define CSC_INSTRUMENTED_ALLOCATOR_STACK_SHIFT 16
+// Definition of the multiplier that spreads the stack addresses over the stripes.
+#define CSC_INSTRUMENTED_ALLOCATOR_STRIPE_MULTIPLIER (CSC_SIZE_T)0x9E3779B1
+
+static CSC_PCVOID CSCMETHOD CSC_InstrumentedAllocatorGetInterface(_In_ CONST CSC_IBaseInterface* CONST pThis, _In_ CONST EBaseInterfaceType interfaceType);
+
+static CSC_STATUS CSCMETHOD CSC_InstrumentedAllocatorInit(_Inout_ CSC_IAllocator* CONST pThis);
+static CSC_STATUS CSCMETHOD CSC_InstrumentedAllocatorCleanup(_Inout_ CSC_IAllocator* CONST pThis);
+static CSC_PVOID CSCMETHOD CSC_InstrumentedAllocatorAlloc(_In_ CONST CSC_IAllocator* CONST pThis, _In_ CONST CSC_SIZE_T size);
+static CSC_PVOID CSCMETHOD CSC_InstrumentedAllocatorAllocZero(_In_ CONST CSC_IAllocator* CONST pThis, _In_ CONST CSC_SIZE_T size);
+static CSC_STATUS CSCMETHOD CSC_InstrumentedAllocatorFree(_In_ CONST CSC_IAllocator* CONST pThis, _In_ CONST CSC_PVOID pMemoryBlock);
+static CSC_BOOLEAN CSCMETHOD CSC_InstrumentedAllocatorIsUsable(_In_ CONST CSC_IAllocator* CONST pThis);
+
+static CSC_IBaseInterfaceVirtualTable g_InstrumentedAllocatorBaseInterfaceVTable =
+{
+	CSC_InstrumentedAllocatorGetInterface
+};
+
+static CSC_IAllocatorVirtualTable g_InstrumentedAllocatorAllocatorVTable =
+{
+	CSC_InstrumentedAllocatorInit,
+	CSC_InstrumentedAllocatorCleanup,
+	CSC_InstrumentedAllocatorAlloc,
+	CSC_InstrumentedAllocatorAllocZero,
+	CSC_InstrumentedAllocatorFree,
+	CSC_InstrumentedAllocatorIsUsable,
+	NULL,
+	NULL,
+	NULL,
+	NULL
+};
+
+
+static CSC_SIZE_T CSCMETHOD CSC_InstrumentedAllocatorGetHistogramBucket(_In_ CONST CSC_SIZE_T size)
+{
+	// Zero sized requests are rejected before they are recorded, hence the bit scan always finds a set bit.
+	return CSC_BIT_SCAN_REVERSE(size);
+}
+
+static CSC_InstrumentedAllocatorStripe* CSCMETHOD CSC_InstrumentedAllocatorGetStripe(_Inout_ CSC_InstrumentedAllocator* CONST pThis)
+{
+	// The stack of the calling thread identifies it without any thread local storage, the hash only has to be stable for a thread, not unique.
+	CONST CSC_SIZE_T stackAddress = (CSC_SIZE_T)&pThis >> CSC_INSTRUMENTED_ALLOCATOR_STACK_SHIFT;
+
+	return &pThis->stripes[((stackAddress * CSC_INSTRUMENTED_ALLOCATOR_STRIPE_MULTIPLIER) >> CSC_INSTRUMENTED_ALLOCATOR_STACK_SHIFT) & (CSC_INSTRUMENTED_ALLOCATOR_STRIPES - (CSC_SIZE_T)1)];
+}
+
+static CSC_BOOLEAN CSCMETHOD CSC_InstrumentedAllocatorIsValid(_In_ CONST CSC_InstrumentedAllocator* CONST pThis)
+{
+	if (!pThis || pThis->baseInterface.pIBaseInterfaceVirtualTable != &g_InstrumentedAllocatorBaseInterfaceVTable || pThis->allocatorInterface.pIAllocatorVirtualTable != &g_InstrumentedAllocatorAllocatorVTable || !pThis->pParentAllocator)
+	{
+		return (CSC_BOOLEAN)FALSE;
+	}
+
+	return (CSC_BOOLEAN)TRUE;
+}
+
+static CSC_InstrumentedAllocatorBlockHeader* CSCMETHOD CSC_InstrumentedAllocatorGetHeader(_In_ CONST CSC_PCVOID pMemoryBlock)
+{
+	return (CSC_InstrumentedAllocatorBlockHeader*)((CONST CSC_BYTE*)pMemoryBlock - CSC_INSTRUMENTED_ALLOCATOR_HEADER_SIZE);
+}
+
+static void CSCMETHOD CSC_InstrumentedAllocatorUpdatePeak(_Inout_ CSC_InstrumentedAllocator* CONST pThis, _In_ CONST CSC_SIZE_T liveBytes)
+{
+	CSC_SIZE_T peakBytes = CSC_ATOMIC_LOAD(&pThis->peakBytes);
+
+	while (peakBytes < liveBytes)
+	{
+		if (CSC_ATOMIC_COMPARE_EXCHANGE(&pThis->peakBytes, &peakBytes, liveBytes))
+		{
+			break;
+		}
+	}
+}
+
+static void CSCMETHOD CSC_InstrumentedAllocatorRecordAlloc(_Inout_ CSC_InstrumentedAllocator* CONST pThis, _In_ CONST CSC_SIZE_T size, _In_ CONST CSC_SIZE_T tag)
+{
+	CSC_InstrumentedAllocatorStripe* CONST pStripe = CSC_InstrumentedAllocatorGetStripe(pThis);
+	CSC_InstrumentedAllocatorTagStatistics* CONST pTagStatistics = &pStripe->tagStatistics[tag];
+
+	CSC_ATOMIC_FETCH_ADD(&pStripe->allocCount, (CSC_SIZE_T)1);
+	CSC_ATOMIC_FETCH_ADD(&pStripe->totalBytes, size);
+	CSC_ATOMIC_FETCH_ADD(&pStripe->sizeHistogram[CSC_InstrumentedAllocatorGetHistogramBucket(size)], (CSC_SIZE_T)1);
+
+	CSC_ATOMIC_FETCH_ADD(&pTagStatistics->allocCount, (CSC_SIZE_T)1);
+	CSC_ATOMIC_FETCH_ADD(&pTagStatistics->totalBytes, size);
+	CSC_ATOMIC_FETCH_ADD(&pTagStatistics->liveBytes, size);
+
+	CSC_InstrumentedAllocatorUpdatePeak(pThis, CSC_ATOMIC_FETCH_ADD(&pThis->liveBytes, size) + size);
+}
+
+static void CSCMETHOD CSC_InstrumentedAllocatorRecordFree(_Inout_ CSC_InstrumentedAllocator* CONST pThis, _In_ CONST CSC_SIZE_T size, _In_ CONST CSC_SIZE_T tag)
+{
+	CSC_InstrumentedAllocatorStripe* CONST pStripe = CSC_InstrumentedAllocatorGetStripe(pThis);
+	CSC_InstrumentedAllocatorTagStatistics* CONST pTagStatistics = &pStripe->tagStatistics[tag];
+
+	// The live bytes of a tag are summed over the stripes, hence a stripe may wrap around if the block was allocated on another one.
+	CSC_ATOMIC_FETCH_ADD(&pStripe->freeCount, (CSC_SIZE_T)1);
+	CSC_ATOMIC_FETCH_ADD(&pTagStatistics->freeCount, (CSC_SIZE_T)1);
+	CSC_ATOMIC_FETCH_SUB(&pTagStatistics->liveBytes, size);
+
+	CSC_ATOMIC_FETCH_SUB(&pThis->liveBytes, size);
+}
+
+static void CSCMETHOD CSC_InstrumentedAllocatorFoldBlockCounts(_In_ CONST CSC_InstrumentedAllocator* CONST pThis, _Out_ CSC_SIZE_T* CONST pAllocCount, _Out_ CSC_SIZE_T* CONST pFreeCount)
+{
+	CSC_InstrumentedAllocatorStripe* CONST pStripes = (CSC_InstrumentedAllocatorStripe* CONST)pThis->stripes;
+	CSC_SIZE_T iterator;
+
+	*pAllocCount = (CSC_SIZE_T)0;
+	*pFreeCount = (CSC_SIZE_T)0;
+
+	for (iterator = (CSC_SIZE_T)0; iterator < CSC_INSTRUMENTED_ALLOCATOR_STRIPES; ++iterator)
+	{
+		*pAllocCount += CSC_ATOMIC_LOAD(&pStripes[iterator].allocCount);
+		*pFreeCount += CSC_ATOMIC_LOAD(&pStripes[iterator].freeCount);
+	}
+}
+
+
+static CSC_PCVOID CSCMETHOD CSC_InstrumentedAllocatorGetInterface(_In_ CONST CSC_IBaseInterface* CONST pThis, _In_ CONST EBaseInterfaceType interfaceType)
+{
+	CONST CSC_InstrumentedAllocator* CONST pAllocator = (CONST CSC_InstrumentedAllocator* CONST)pThis;
+
+	if (!pThis)
+	{
+		return NULL;
+	}
+
+	switch (interfaceType)
+	{
+	case csc_bit_IAllocator:
+
+		return (CSC_PCVOID)&pAllocator->allocatorInterface;
+
+	default:
+
+		return NULL;
+	}
+}
+
+static CSC_STATUS CSCMETHOD CSC_InstrumentedAllocatorInit(_Inout_ CSC_IAllocator* CONST pThis)
+{
+	if (!pThis)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	return CSC_InstrumentedAllocatorResetStatistics(CSC_CONTAINING_RECORD(pThis, CSC_InstrumentedAllocator, allocatorInterface));
+}
+
+static CSC_STATUS CSCMETHOD CSC_InstrumentedAllocatorCleanup(_Inout_ CSC_IAllocator* CONST pThis)
+{
+	if (!pThis)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	return CSC_InstrumentedAllocatorDestroy(CSC_CONTAINING_RECORD(pThis, CSC_InstrumentedAllocator, allocatorInterface), (CSC_BOOLEAN)FALSE);
+}
+
+static CSC_PVOID CSCMETHOD CSC_InstrumentedAllocatorAlloc(_In_ CONST CSC_IAllocator* CONST pThis, _In_ CONST CSC_SIZE_T size)
+{
+	CONST CSC_InstrumentedAllocator* CONST pAllocator = CSC_CONTAINING_RECORD(pThis, CONST CSC_InstrumentedAllocator, allocatorInterface);
+
+	if (!pThis)
+	{
+		return NULL;
+	}
+
+	return CSC_InstrumentedAllocatorAllocTagged(pAllocator, size, CSC_ATOMIC_LOAD(&pAllocator->defaultTag), (CSC_BOOLEAN)FALSE);
+}
+
+static CSC_PVOID CSCMETHOD CSC_InstrumentedAllocatorAllocZero(_In_ CONST CSC_IAllocator* CONST pThis, _In_ CONST CSC_SIZE_T size)
+{
+	CONST CSC_InstrumentedAllocator* CONST pAllocator = CSC_CONTAINING_RECORD(pThis, CONST CSC_InstrumentedAllocator, allocatorInterface);
+
+	if (!pThis)
+	{
+		return NULL;
+	}
+
+	return CSC_InstrumentedAllocatorAllocTagged(pAllocator, size, CSC_ATOMIC_LOAD(&pAllocator->defaultTag), (CSC_BOOLEAN)TRUE);
+}
+
+static CSC_STATUS CSCMETHOD CSC_InstrumentedAllocatorFree(_In_ CONST CSC_IAllocator* CONST pThis, _In_ CONST CSC_PVOID pMemoryBlock)
+{
+	CSC_InstrumentedAllocator* CONST pAllocator = (CSC_InstrumentedAllocator* CONST)CSC_CONTAINING_RECORD(pThis, CONST CSC_InstrumentedAllocator, allocatorInterface);
+	CSC_InstrumentedAllocatorBlockHeader* pHeader;
+	CSC_STATUS status;
+	CSC_SIZE_T size, tag;
+
+	if (!pThis || !pMemoryBlock || !CSC_InstrumentedAllocatorIsValid(pAllocator))
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	pHeader = CSC_InstrumentedAllocatorGetHeader(pMemoryBlock);
+	size = pHeader->size;
+	tag = pHeader->tag;
+
+	if (tag >= CSC_INSTRUMENTED_ALLOCATOR_MAX_TAGS)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	status = CSC_IAllocatorFreeSized(pAllocator->pParentAllocator, (CSC_PVOID)pHeader, size + CSC_INSTRUMENTED_ALLOCATOR_HEADER_SIZE);
+
+	if (status == CSC_STATUS_SUCCESS)
+	{
+		CSC_InstrumentedAllocatorRecordFree(pAllocator, size, tag);
+	}
+
+	return status;
+}
+
+static CSC_BOOLEAN CSCMETHOD CSC_InstrumentedAllocatorIsUsable(_In_ CONST CSC_IAllocator* CONST pThis)
+{
+	CONST CSC_InstrumentedAllocator* CONST pAllocator = CSC_CONTAINING_RECORD(pThis, CONST CSC_InstrumentedAllocator, allocatorInterface);
+
+	if (!pThis || !CSC_InstrumentedAllocatorIsValid(pAllocator))
+	{
+		return (CSC_BOOLEAN)FALSE;
+	}
+
+	return CSC_IAllocatorIsUsable(pAllocator->pParentAllocator);
+}
+
+
+CSC_STATUS CSCMETHOD CSC_InstrumentedAllocatorInitialize(_Out_ CSC_InstrumentedAllocator* CONST pThis, _In_ CSC_IAllocator* CONST pParentAllocator)
+{
+	CSC_STATUS status;
+
+	if (!pThis || !pParentAllocator || !CSC_IAllocatorIsUsable(pParentAllocator))
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	status = CSC_MemoryUtilsSetZeroMemory((CSC_PVOID)pThis, sizeof(CSC_InstrumentedAllocator));
+
+	if (status != CSC_STATUS_SUCCESS)
+	{
+		return status;
+	}
+
+	pThis->baseInterface.pIBaseInterfaceVirtualTable = &g_InstrumentedAllocatorBaseInterfaceVTable;
+	pThis->allocatorInterface.pIAllocatorVirtualTable = &g_InstrumentedAllocatorAllocatorVTable;
+	pThis->pParentAllocator = pParentAllocator;
+
+	return CSC_STATUS_SUCCESS;
+}
+
+CSC_STATUS CSCMETHOD CSC_InstrumentedAllocatorDestroy(_Inout_ CSC_InstrumentedAllocator* CONST pThis, _In_ CONST CSC_BOOLEAN force)
+{
+	CSC_SIZE_T allocCount, freeCount;
+
+	if (!CSC_InstrumentedAllocatorIsValid(pThis))
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	CSC_InstrumentedAllocatorFoldBlockCounts(pThis, &allocCount, &freeCount);
+
+	if (!force && allocCount != freeCount)
+	{
+		return CSC_STATUS_GENERAL_FAILURE;
+	}
+
+	return CSC_MemoryUtilsSetZeroMemory((CSC_PVOID)pThis, sizeof(CSC_InstrumentedAllocator));
+}
+
+
+CSC_PVOID CSCMETHOD CSC_InstrumentedAllocatorAllocTagged(_In_ CONST CSC_InstrumentedAllocator* CONST pThis, _In_ CONST CSC_SIZE_T size, _In_ CONST CSC_SIZE_T tag, _In_ CONST CSC_BOOLEAN zeroMemory)
+{
+	CSC_InstrumentedAllocator* CONST pAllocator = (CSC_InstrumentedAllocator* CONST)pThis;
+	CSC_InstrumentedAllocatorBlockHeader* pHeader;
+
+	if (!size || tag >= CSC_INSTRUMENTED_ALLOCATOR_MAX_TAGS || !CSC_InstrumentedAllocatorIsValid(pThis))
+	{
+		return NULL;
+	}
+
+	if (size > ~(CSC_SIZE_T)0 - CSC_INSTRUMENTED_ALLOCATOR_HEADER_SIZE)
+	{
+		CSC_ATOMIC_FETCH_ADD(&pAllocator->failedAllocCount, (CSC_SIZE_T)1);
+		return NULL;
+	}
+
+	if (zeroMemory)
+	{
+		pHeader = (CSC_InstrumentedAllocatorBlockHeader*)CSC_IAllocatorAllocZero(pThis->pParentAllocator, size + CSC_INSTRUMENTED_ALLOCATOR_HEADER_SIZE);
+	}
+	else
+	{
+		pHeader = (CSC_InstrumentedAllocatorBlockHeader*)CSC_IAllocatorAlloc(pThis->pParentAllocator, size + CSC_INSTRUMENTED_ALLOCATOR_HEADER_SIZE);
+	}
+
+	if (!pHeader)
+	{
+		CSC_ATOMIC_FETCH_ADD(&pAllocator->failedAllocCount, (CSC_SIZE_T)1);
+		return NULL;
+	}
+
+	pHeader->size = size;
+	pHeader->tag = tag;
+
+	CSC_InstrumentedAllocatorRecordAlloc(pAllocator, size, tag);
+
+	return (CSC_PVOID)((CSC_BYTE*)pHeader + CSC_INSTRUMENTED_ALLOCATOR_HEADER_SIZE);
+}
+
+CSC_STATUS CSCMETHOD CSC_InstrumentedAllocatorSetDefaultTag(_Inout_ CSC_InstrumentedAllocator* CONST pThis, _In_ CONST CSC_SIZE_T tag)
+{
+	if (tag >= CSC_INSTRUMENTED_ALLOCATOR_MAX_TAGS || !CSC_InstrumentedAllocatorIsValid(pThis))
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	CSC_ATOMIC_STORE(&pThis->defaultTag, tag);
+
+	return CSC_STATUS_SUCCESS;
+}
+
+CSC_SIZE_T CSCMETHOD CSC_InstrumentedAllocatorGetDefaultTag(_In_ CONST CSC_InstrumentedAllocator* CONST pThis)
+{
+	if (!CSC_InstrumentedAllocatorIsValid(pThis))
+	{
+		return CSC_INSTRUMENTED_ALLOCATOR_MAX_TAGS;
+	}
+
+	return CSC_ATOMIC_LOAD(&pThis->defaultTag);
+}
+
+CSC_SIZE_T CSCMETHOD CSC_InstrumentedAllocatorGetBlockTag(_In_ CONST CSC_InstrumentedAllocator* CONST pThis, _In_ CONST CSC_PCVOID pMemoryBlock)
+{
+	if (!pMemoryBlock || !CSC_InstrumentedAllocatorIsValid(pThis))
+	{
+		return CSC_INSTRUMENTED_ALLOCATOR_MAX_TAGS;
+	}
+
+	return CSC_InstrumentedAllocatorGetHeader(pMemoryBlock)->tag;
+}
+
+CSC_SIZE_T CSCMETHOD CSC_InstrumentedAllocatorGetBlockSize(_In_ CONST CSC_InstrumentedAllocator* CONST pThis, _In_ CONST CSC_PCVOID pMemoryBlock)
+{
+	if (!pMemoryBlock || !CSC_InstrumentedAllocatorIsValid(pThis))
+	{
+		return (CSC_SIZE_T)0;
+	}
+
+	return CSC_InstrumentedAllocatorGetHeader(pMemoryBlock)->size;
+}
+
+
+CSC_STATUS CSCMETHOD CSC_InstrumentedAllocatorGetStatistics(_In_ CONST CSC_InstrumentedAllocator* CONST pThis, _Out_ CSC_InstrumentedAllocatorStatistics* CONST pStatistics)
+{
+	CSC_InstrumentedAllocator* CONST pAllocator = (CSC_InstrumentedAllocator* CONST)pThis;
+	CSC_InstrumentedAllocatorStripe* pStripe;
+	CSC_SIZE_T stripe, iterator;
+	CSC_STATUS status;
+
+	if (!pStatistics || !CSC_InstrumentedAllocatorIsValid(pThis))
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	status = CSC_MemoryUtilsSetZeroMemory((CSC_PVOID)pStatistics, sizeof(CSC_InstrumentedAllocatorStatistics));
+
+	if (status != CSC_STATUS_SUCCESS)
+	{
+		return status;
+	}
+
+	pStatistics->failedAllocCount = CSC_ATOMIC_LOAD(&pAllocator->failedAllocCount);
+	pStatistics->liveBytes = CSC_ATOMIC_LOAD(&pAllocator->liveBytes);
+	pStatistics->peakBytes = CSC_ATOMIC_LOAD(&pAllocator->peakBytes);
+
+	for (stripe = (CSC_SIZE_T)0; stripe < CSC_INSTRUMENTED_ALLOCATOR_STRIPES; ++stripe)
+	{
+		pStripe = &pAllocator->stripes[stripe];
+
+		pStatistics->allocCount += CSC_ATOMIC_LOAD(&pStripe->allocCount);
+		pStatistics->freeCount += CSC_ATOMIC_LOAD(&pStripe->freeCount);
+		pStatistics->totalBytes += CSC_ATOMIC_LOAD(&pStripe->totalBytes);
+
+		for (iterator = (CSC_SIZE_T)0; iterator < CSC_INSTRUMENTED_ALLOCATOR_HISTOGRAM_BUCKETS; ++iterator)
+		{
+			pStatistics->sizeHistogram[iterator] += CSC_ATOMIC_LOAD(&pStripe->sizeHistogram[iterator]);
+		}
+
+		for (iterator = (CSC_SIZE_T)0; iterator < CSC_INSTRUMENTED_ALLOCATOR_MAX_TAGS; ++iterator)
+		{
+			pStatistics->tagStatistics[iterator].allocCount += CSC_ATOMIC_LOAD(&pStripe->tagStatistics[iterator].allocCount);
+			pStatistics->tagStatistics[iterator].freeCount += CSC_ATOMIC_LOAD(&pStripe->tagStatistics[iterator].freeCount);
+			pStatistics->tagStatistics[iterator].liveBytes += CSC_ATOMIC_LOAD(&pStripe->tagStatistics[iterator].liveBytes);
+			pStatistics->tagStatistics[iterator].totalBytes += CSC_ATOMIC_LOAD(&pStripe->tagStatistics[iterator].totalBytes);
+		}
+	}
+
+	return CSC_STATUS_SUCCESS;
+}
+
+CSC_STATUS CSCMETHOD CSC_InstrumentedAllocatorResetStatistics(_Inout_ CSC_InstrumentedAllocator* CONST pThis)
+{
+	CSC_InstrumentedAllocatorStripe* pStripe;
+	CSC_SIZE_T stripe, iterator;
+
+	if (!CSC_InstrumentedAllocatorIsValid(pThis))
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	CSC_ATOMIC_STORE(&pThis->failedAllocCount, (CSC_SIZE_T)0);
+	CSC_ATOMIC_STORE(&pThis->peakBytes, CSC_ATOMIC_LOAD(&pThis->liveBytes));
+
+	for (stripe = (CSC_SIZE_T)0; stripe < CSC_INSTRUMENTED_ALLOCATOR_STRIPES; ++stripe)
+	{
+		pStripe = &pThis->stripes[stripe];
+
+		// Outstanding blocks are still going to be freed, hence the counters are rebased instead of zeroed to keep the folded allocCount - freeCount equal to the live block count.
+		CSC_ATOMIC_FETCH_SUB(&pStripe->allocCount, CSC_ATOMIC_LOAD(&pStripe->freeCount));
+		CSC_ATOMIC_STORE(&pStripe->freeCount, (CSC_SIZE_T)0);
+		CSC_ATOMIC_STORE(&pStripe->totalBytes, (CSC_SIZE_T)0);
+
+		for (iterator = (CSC_SIZE_T)0; iterator < CSC_INSTRUMENTED_ALLOCATOR_HISTOGRAM_BUCKETS; ++iterator)
+		{
+			CSC_ATOMIC_STORE(&pStripe->sizeHistogram[iterator], (CSC_SIZE_T)0);
+		}
+
+		for (iterator = (CSC_SIZE_T)0; iterator < CSC_INSTRUMENTED_ALLOCATOR_MAX_TAGS; ++iterator)
+		{
+			CSC_ATOMIC_FETCH_SUB(&pStripe->tagStatistics[iterator].allocCount, CSC_ATOMIC_LOAD(&pStripe->tagStatistics[iterator].freeCount));
+			CSC_ATOMIC_STORE(&pStripe->tagStatistics[iterator].freeCount, (CSC_SIZE_T)0);
+			CSC_ATOMIC_STORE(&pStripe->tagStatistics[iterator].totalBytes, (CSC_SIZE_T)0);
+		}
+	}
+
+	return CSC_STATUS_SUCCESS;
+}
+
+
+CSC_IBaseInterface* CSCMETHOD CSC_InstrumentedAllocatorGetIBaseInterface(_In_ CONST CSC_InstrumentedAllocator* CONST pThis)
+{
+	if (!CSC_InstrumentedAllocatorIsValid(pThis))
+	{
+		return (CSC_IBaseInterface*)NULL;
+	}
+
+	return (CSC_IBaseInterface*)&pThis->baseInterface;
+}
+
+CSC_IAllocator* CSCMETHOD CSC_InstrumentedAllocatorGetIAllocator(_In_ CONST CSC_InstrumentedAllocator* CONST pThis)
+{
+	if (!CSC_InstrumentedAllocatorIsValid(pThis))
+	{
+		return (CSC_IAllocator*)NULL;
+	}
+
+	return (CSC_IAllocator*)&pThis->allocatorInterface;
+}
+
+CSC_IAllocator* CSCMETHOD CSC_InstrumentedAllocatorGetParentAllocator(_In_ CONST CSC_InstrumentedAllocator* CONST pThis)
+{
+	if (!CSC_InstrumentedAllocatorIsValid(pThis))
+	{
+		return (CSC_IAllocator*)NULL;
+	}
+
+	return pThis->pParentAllocator;
+}
\ No newline at end of file
@@ -0,0 +1,121 @@
+#ifndef CSC_INSTRUMENTED_ALLOCATOR
+#define CSC_INSTRUMENTED_ALLOCATOR
+
+/*
+Description:
+The InstrumentedAllocator is a decorator that implements the IAllocator interface on top of an arbitrary parent allocator.
+Every request is forwarded to the parent allocator while the decorator counts allocations, frees, live bytes, peak bytes and keeps a log2 histogram of the requested sizes.
+All counters are updated through the atomic primitives of the configuration, hence the allocator can be shared between threads if the parent allocator supports it.
+Event, byte and histogram counters are split into CSC_INSTRUMENTED_ALLOCATOR_STRIPES cache line separated stripes, a stripe is chosen from the stack address of the calling thread and the stripes are folded when the statistics are read.
+Only the live byte counter is shared by all threads, as the peak has to be derived from the exact amount of live bytes.
+To be able to account frees, every block is preceded by a small header holding the requested size and the tag of the allocation.
+The header consumes CSC_INSTRUMENTED_ALLOCATOR_HEADER_SIZE bytes, which keeps the alignment guaranteed by the parent allocator for up to that many bytes.
+Allocations can be attributed to call sites through tags, which are small indices into a per-tag statistics table.
+Allocations performed through the IAllocator interface use the default tag, which can be changed at any time, explicit tagged allocations use the CSC_InstrumentedAllocatorAllocTagged function.
+*/
+
+// Include the current configuration of the library containing various type definitions and other things.
+#include "../../Configuration/Configuration.h"
+// Include the IBaseInterface as the allocator can be queried for the interfaces it implements.
+#include "../../Interfaces/IBaseInterface.h"
+// Include the IAllocator interface as the allocator implements it and wraps another allocator implementing it.
+#include "../../Interfaces/IAllocator.h"
+
+// Definition of the amount of histogram buckets, one bucket for every power of two a CSC_SIZE_T can hold.
+#define CSC_INSTRUMENTED_ALLOCATOR_HISTOGRAM_BUCKETS (sizeof(CSC_SIZE_T) * (CSC_SIZE_T)8)
+// Definition of the amount of tags that can be tracked, tag 0 is the initial default tag.
+#define CSC_INSTRUMENTED_ALLOCATOR_MAX_TAGS (CSC_SIZE_T)0x20
+// Definition of the size of the header that precedes every allocated block.
+#define CSC_INSTRUMENTED_ALLOCATOR_HEADER_SIZE (sizeof(CSC_SIZE_T) * (CSC_SIZE_T)2)
+// Definition of the amount of counter stripes, must be a power of two.
+#define CSC_INSTRUMENTED_ALLOCATOR_STRIPES (CSC_SIZE_T)0x08
+// Definition of the size of the padding that keeps the stripes on separate cache lines.
+#define CSC_INSTRUMENTED_ALLOCATOR_CACHE_LINE_SIZE (CSC_SIZE_T)0x40
+
+// Definition of the statistics that are tracked per tag.
+typedef struct _CSC_InstrumentedAllocatorTagStatistics
+{
+	CSC_ATOMIC CSC_SIZE_T allocCount;
+	CSC_ATOMIC CSC_SIZE_T freeCount;
+	CSC_ATOMIC CSC_SIZE_T liveBytes;
+	CSC_ATOMIC CSC_SIZE_T totalBytes;
+} CSC_InstrumentedAllocatorTagStatistics;
+
+// Definition of the statistics that are tracked for the whole allocator.
+// A snapshot of this structure can be retrieved through CSC_InstrumentedAllocatorGetStatistics.
+typedef struct _CSC_InstrumentedAllocatorStatistics
+{
+	CSC_ATOMIC CSC_SIZE_T allocCount;
+	CSC_ATOMIC CSC_SIZE_T freeCount;
+	CSC_ATOMIC CSC_SIZE_T failedAllocCount;
+	CSC_ATOMIC CSC_SIZE_T liveBytes;
+	CSC_ATOMIC CSC_SIZE_T peakBytes;
+	CSC_ATOMIC CSC_SIZE_T totalBytes;
+	CSC_ATOMIC CSC_SIZE_T sizeHistogram[CSC_INSTRUMENTED_ALLOCATOR_HISTOGRAM_BUCKETS];
+	CSC_InstrumentedAllocatorTagStatistics tagStatistics[CSC_INSTRUMENTED_ALLOCATOR_MAX_TAGS];
+} CSC_InstrumentedAllocatorStatistics;
+
+// Definition of a stripe of counters, the statistics are the sum over all stripes.
+// Frees may be recorded in another stripe than the matching allocations, hence only the sums of the counters are meaningful.
+typedef struct _CSC_InstrumentedAllocatorStripe
+{
+	CSC_BYTE padding[CSC_INSTRUMENTED_ALLOCATOR_CACHE_LINE_SIZE];
+	CSC_ATOMIC CSC_SIZE_T allocCount;
+	CSC_ATOMIC CSC_SIZE_T freeCount;
+	CSC_ATOMIC CSC_SIZE_T totalBytes;
+	CSC_ATOMIC CSC_SIZE_T sizeHistogram[CSC_INSTRUMENTED_ALLOCATOR_HISTOGRAM_BUCKETS];
+	CSC_InstrumentedAllocatorTagStatistics tagStatistics[CSC_INSTRUMENTED_ALLOCATOR_MAX_TAGS];
+} CSC_InstrumentedAllocatorStripe;
+
+typedef struct _CSC_InstrumentedAllocator
+{
+	CSC_IBaseInterface baseInterface;
+	CSC_IAllocator allocatorInterface;
+	CSC_IAllocator* pParentAllocator;
+	CSC_ATOMIC CSC_SIZE_T defaultTag;
+	CSC_InstrumentedAllocatorStripe stripes[CSC_INSTRUMENTED_ALLOCATOR_STRIPES];
+	CSC_BYTE padding[CSC_INSTRUMENTED_ALLOCATOR_CACHE_LINE_SIZE];
+	CSC_ATOMIC CSC_SIZE_T liveBytes;
+	CSC_ATOMIC CSC_SIZE_T peakBytes;
+	CSC_ATOMIC CSC_SIZE_T failedAllocCount;
+} CSC_InstrumentedAllocator;
+
+// Initializes the allocator as a decorator of the given parent allocator, which must be usable and outlive the decorator.
+// Returns CSC_STATUS_SUCCESS on success, otherwise an error code is returned.
+CSC_STATUS CSCMETHOD CSC_InstrumentedAllocatorInitialize(_Out_ CSC_InstrumentedAllocator* CONST pThis, _In_ CSC_IAllocator* CONST pParentAllocator);
+// Detaches the allocator from it's parent allocator and zeroes out the object.
+// Blocks that are still allocated must not be freed through the decorator anymore, the function fails if there are any unless forced.
+// Returns CSC_STATUS_SUCCESS on success, otherwise an error code is returned.
+CSC_STATUS CSCMETHOD CSC_InstrumentedAllocatorDestroy(_Inout_ CSC_InstrumentedAllocator* CONST pThis, _In_ CONST CSC_BOOLEAN force);
+
+// Allocates a block through the parent allocator and accounts it to the given tag, optionally zeroing the block.
+// Tags greater or equal to CSC_INSTRUMENTED_ALLOCATOR_MAX_TAGS are rejected.
+// Returns a pointer to the allocated memory on success, otherwise a nullptr is returned.
+CSC_PVOID CSCMETHOD CSC_InstrumentedAllocatorAllocTagged(_In_ CONST CSC_InstrumentedAllocator* CONST pThis, _In_ CONST CSC_SIZE_T size, _In_ CONST CSC_SIZE_T tag, _In_ CONST CSC_BOOLEAN zeroMemory);
+// Sets the tag that is used for allocations performed through the IAllocator interface, for example by containers.
+// Returns CSC_STATUS_SUCCESS on success, otherwise an error code is returned.
+CSC_STATUS CSCMETHOD CSC_InstrumentedAllocatorSetDefaultTag(_Inout_ CSC_InstrumentedAllocator* CONST pThis, _In_ CONST CSC_SIZE_T tag);
+// Retrieves the tag that is used for allocations performed through the IAllocator interface.
+// Returns CSC_INSTRUMENTED_ALLOCATOR_MAX_TAGS if the allocator is invalid.
+CSC_SIZE_T CSCMETHOD CSC_InstrumentedAllocatorGetDefaultTag(_In_ CONST CSC_InstrumentedAllocator* CONST pThis);
+// Retrieves the tag that a block allocated through the allocator was accounted to.
+// Returns CSC_INSTRUMENTED_ALLOCATOR_MAX_TAGS if the parameters are invalid.
+CSC_SIZE_T CSCMETHOD CSC_InstrumentedAllocatorGetBlockTag(_In_ CONST CSC_InstrumentedAllocator* CONST pThis, _In_ CONST CSC_PCVOID pMemoryBlock);
+// Retrieves the size that was requested for a block allocated through the allocator.
+// Returns 0 if the parameters are invalid.
+CSC_SIZE_T CSCMETHOD CSC_InstrumentedAllocatorGetBlockSize(_In_ CONST CSC_InstrumentedAllocator* CONST pThis, _In_ CONST CSC_PCVOID pMemoryBlock);
+
+// Copies a snapshot of the current statistics into the supplied structure.
+// The stripes are folded into the snapshot, every counter is read atomically, however the snapshot as a whole is not taken atomically while other threads are using the allocator.
+// Returns CSC_STATUS_SUCCESS on success, otherwise an error code is returned.
+CSC_STATUS CSCMETHOD CSC_InstrumentedAllocatorGetStatistics(_In_ CONST CSC_InstrumentedAllocator* CONST pThis, _Out_ CSC_InstrumentedAllocatorStatistics* CONST pStatistics);
+// Resets the event counters, the histogram and the total byte counters, the peak is reset to the current amount of live bytes.
+// Live byte counters are kept, as they describe blocks that are still allocated.
+// Returns CSC_STATUS_SUCCESS on success, otherwise an error code is returned.
+CSC_STATUS CSCMETHOD CSC_InstrumentedAllocatorResetStatistics(_Inout_ CSC_InstrumentedAllocator* CONST pThis);
+
+CSC_IBaseInterface* CSCMETHOD CSC_InstrumentedAllocatorGetIBaseInterface(_In_ CONST CSC_InstrumentedAllocator* CONST pThis);
+CSC_IAllocator* CSCMETHOD CSC_InstrumentedAllocatorGetIAllocator(_In_ CONST CSC_InstrumentedAllocator* CONST pThis);
+CSC_IAllocator* CSCMETHOD CSC_InstrumentedAllocatorGetParentAllocator(_In_ CONST CSC_InstrumentedAllocator* CONST pThis);
+
+#endif
\ No newline at end of file
@@ -0,0 +1,492 @@
+#include "LockFreeAllocator.h"
+#include "../../Utils/MemoryUtils.h"
+
+// Definition of the layout of the head of the stack and the links, the lower half holds the index of a block plus one, 0 marks the end of the stack.
+#define CSC_LOCK_FREE_ALLOCATOR_INDEX_BITS (sizeof(CSC_SIZE_T) * (CSC_SIZE_T)4)
+#define CSC_LOCK_FREE_ALLOCATOR_INDEX_MASK (((CSC_SIZE_T)1 << CSC_LOCK_FREE_ALLOCATOR_INDEX_BITS) - (CSC_SIZE_T)1)
+#define CSC_LOCK_FREE_ALLOCATOR_VERSION_INCREMENT ((CSC_SIZE_T)1 << CSC_LOCK_FREE_ALLOCATOR_INDEX_BITS)
+
+// Definition of the header that precedes every block.
+// The index is assigned once when the chunk is created, the link holds the encoded index of the next free block while the block is on the stack.
+typedef struct _CSC_LockFreeAllocatorBlockHeader
+{
+	CSC_SIZE_T index;
+	CSC_ATOMIC CSC_SIZE_T next;
+} CSC_LockFreeAllocatorBlockHeader;
+
+static CSC_PCVOID CSCMETHOD CSC_LockFreeAllocatorGetInterface(_In_ CONST CSC_IBaseInterface* CONST pThis, _In_ CONST EBaseInterfaceType interfaceType);
+
+static CSC_STATUS CSCMETHOD CSC_LockFreeAllocatorInit(_Inout_ CSC_IAllocator* CONST pThis);
+static CSC_STATUS CSCMETHOD CSC_LockFreeAllocatorCleanup(_Inout_ CSC_IAllocator* CONST pThis);
+static CSC_PVOID CSCMETHOD CSC_LockFreeAllocatorAlloc(_In_ CONST CSC_IAllocator* CONST pThis, _In_ CONST CSC_SIZE_T size);
+static CSC_PVOID CSCMETHOD CSC_LockFreeAllocatorAllocZero(_In_ CONST CSC_IAllocator* CONST pThis, _In_ CONST CSC_SIZE_T size);
+static CSC_STATUS CSCMETHOD CSC_LockFreeAllocatorFree(_In_ CONST CSC_IAllocator* CONST pThis, _In_ CONST CSC_PVOID pMemoryBlock);
+static CSC_BOOLEAN CSCMETHOD CSC_LockFreeAllocatorIsUsable(_In_ CONST CSC_IAllocator* CONST pThis);
+static CSC_STATUS CSCMETHOD CSC_LockFreeAllocatorAllocBatch(_In_ CONST CSC_IAllocator* CONST pThis, _In_ CONST CSC_SIZE_T size, _In_ CONST CSC_SIZE_T count, _Out_ CSC_PVOID* CONST ppMemoryBlocks);
+static CSC_STATUS CSCMETHOD CSC_LockFreeAllocatorFreeBatch(_In_ CONST CSC_IAllocator* CONST pThis, _In_ CSC_PVOID* CONST ppMemoryBlocks, _In_ CONST CSC_SIZE_T count);
+static CSC_SIZE_T CSCMETHOD CSC_LockFreeAllocatorGetUsableSize(_In_ CONST CSC_IAllocator* CONST pThis, _In_ CONST CSC_PCVOID pMemoryBlock);
+
+static CSC_IBaseInterfaceVirtualTable g_LockFreeAllocatorBaseInterfaceVTable =
+{
+	CSC_LockFreeAllocatorGetInterface
+};
+
+static CSC_IAllocatorVirtualTable g_LockFreeAllocatorAllocatorVTable =
+{
+	CSC_LockFreeAllocatorInit,
+	CSC_LockFreeAllocatorCleanup,
+	CSC_LockFreeAllocatorAlloc,
+	CSC_LockFreeAllocatorAllocZero,
+	CSC_LockFreeAllocatorFree,
+	CSC_LockFreeAllocatorIsUsable,
+	NULL,
+	CSC_LockFreeAllocatorAllocBatch,
+	CSC_LockFreeAllocatorFreeBatch,
+	CSC_LockFreeAllocatorGetUsableSize
+};
+
+
+static CSC_BOOLEAN CSCMETHOD CSC_LockFreeAllocatorIsValid(_In_ CONST CSC_LockFreeAllocator* CONST pThis)
+{
+	if (!pThis || pThis->baseInterface.pIBaseInterfaceVirtualTable != &g_LockFreeAllocatorBaseInterfaceVTable || pThis->allocatorInterface.pIAllocatorVirtualTable != &g_LockFreeAllocatorAllocatorVTable || !pThis->pParentAllocator || !pThis->blockSize)
+	{
+		return (CSC_BOOLEAN)FALSE;
+	}
+
+	return (CSC_BOOLEAN)TRUE;
+}
+
+static CSC_LockFreeAllocatorBlockHeader* CSCMETHOD CSC_LockFreeAllocatorGetHeader(_In_ CONST CSC_LockFreeAllocator* CONST pThis, _In_ CONST CSC_SIZE_T index)
+{
+	CONST CSC_SIZE_T chunk = CSC_ATOMIC_LOAD(&pThis->chunks[index >> pThis->blocksPerChunkShift]);
+
+	return (CSC_LockFreeAllocatorBlockHeader*)(chunk + (index & (((CSC_SIZE_T)1 << pThis->blocksPerChunkShift) - (CSC_SIZE_T)1)) * pThis->blockStride);
+}
+
+static CSC_LockFreeAllocatorBlockHeader* CSCMETHOD CSC_LockFreeAllocatorGetOwnedHeader(_In_ CONST CSC_LockFreeAllocator* CONST pThis, _In_ CONST CSC_PVOID pMemoryBlock)
+{
+	CSC_LockFreeAllocatorBlockHeader* CONST pHeader = (CSC_LockFreeAllocatorBlockHeader*)((CSC_BYTE*)pMemoryBlock - CSC_LOCK_FREE_ALLOCATOR_HEADER_SIZE);
+
+	// The index is only trusted if it maps back to the same header, which rejects blocks that weren't allocated by this allocator.
+	if (pHeader->index >= (CSC_ATOMIC_LOAD(&pThis->chunkCount) << pThis->blocksPerChunkShift) || !CSC_ATOMIC_LOAD(&pThis->chunks[pHeader->index >> pThis->blocksPerChunkShift]) || CSC_LockFreeAllocatorGetHeader(pThis, pHeader->index) != pHeader)
+	{
+		return NULL;
+	}
+
+	return pHeader;
+}
+
+static void CSCMETHOD CSC_LockFreeAllocatorPushChain(_Inout_ CSC_LockFreeAllocator* CONST pThis, _In_ CONST CSC_SIZE_T firstIndex, _Inout_ CSC_LockFreeAllocatorBlockHeader* CONST pLastHeader)
+{
+	CSC_SIZE_T head = CSC_ATOMIC_LOAD(&pThis->freeListHead);
+
+	do
+	{
+		CSC_ATOMIC_STORE(&pLastHeader->next, head & CSC_LOCK_FREE_ALLOCATOR_INDEX_MASK);
+	} while (!CSC_ATOMIC_COMPARE_EXCHANGE(&pThis->freeListHead, &head, ((head & ~CSC_LOCK_FREE_ALLOCATOR_INDEX_MASK) + CSC_LOCK_FREE_ALLOCATOR_VERSION_INCREMENT) | (firstIndex + (CSC_SIZE_T)1)));
+}
+
+static CSC_SIZE_T CSCMETHOD CSC_LockFreeAllocatorPopChain(_Inout_ CSC_LockFreeAllocator* CONST pThis, _In_ CONST CSC_SIZE_T count, _Out_ CSC_PVOID* CONST ppMemoryBlocks)
+{
+	CSC_LockFreeAllocatorBlockHeader* pHeader;
+	CSC_SIZE_T head = CSC_ATOMIC_LOAD(&pThis->freeListHead);
+	CSC_SIZE_T next, iterator, poppedCount;
+
+	for (;;)
+	{
+		if (!(head & CSC_LOCK_FREE_ALLOCATOR_INDEX_MASK))
+		{
+			return (CSC_SIZE_T)0;
+		}
+
+		// The links may be rewritten by other threads while walking, chunks are never released though and a changed stack always changes the version, hence the exchange fails in that case.
+		pHeader = CSC_LockFreeAllocatorGetHeader(pThis, (head & CSC_LOCK_FREE_ALLOCATOR_INDEX_MASK) - (CSC_SIZE_T)1);
+		next = CSC_ATOMIC_LOAD(&pHeader->next);
+
+		for (iterator = (CSC_SIZE_T)1; iterator < count && next; ++iterator)
+		{
+			pHeader = CSC_LockFreeAllocatorGetHeader(pThis, next - (CSC_SIZE_T)1);
+			next = CSC_ATOMIC_LOAD(&pHeader->next);
+		}
+
+		if (CSC_ATOMIC_COMPARE_EXCHANGE(&pThis->freeListHead, &head, ((head & ~CSC_LOCK_FREE_ALLOCATOR_INDEX_MASK) + CSC_LOCK_FREE_ALLOCATOR_VERSION_INCREMENT) | next))
+		{
+			break;
+		}
+	}
+
+	// The popped chain is owned exclusively now and can be walked safely.
+	next = head & CSC_LOCK_FREE_ALLOCATOR_INDEX_MASK;
+
+	for (poppedCount = iterator, iterator = (CSC_SIZE_T)0; iterator < poppedCount; ++iterator)
+	{
+		pHeader = CSC_LockFreeAllocatorGetHeader(pThis, next - (CSC_SIZE_T)1);
+		next = CSC_ATOMIC_LOAD(&pHeader->next);
+		ppMemoryBlocks[iterator] = (CSC_PVOID)((CSC_BYTE*)pHeader + CSC_LOCK_FREE_ALLOCATOR_HEADER_SIZE);
+	}
+
+	return poppedCount;
+}
+
+static CSC_BOOLEAN CSCMETHOD CSC_LockFreeAllocatorAllocateChunk(_Inout_ CSC_LockFreeAllocator* CONST pThis)
+{
+	CONST CSC_SIZE_T blocksPerChunk = (CSC_SIZE_T)1 << pThis->blocksPerChunkShift;
+	CSC_LockFreeAllocatorBlockHeader* pHeader = NULL;
+	CSC_SIZE_T chunkIndex = CSC_ATOMIC_LOAD(&pThis->chunkCount);
+	CSC_BYTE* pChunk;
+	CSC_SIZE_T iterator;
+
+	if (chunkIndex >= CSC_LOCK_FREE_ALLOCATOR_MAX_CHUNKS)
+	{
+		return (CSC_BOOLEAN)FALSE;
+	}
+
+	// Allocate the chunk before a slot in the chunk table is reserved, so that a failed allocation never leaves a reserved slot without a chunk behind.
+	pChunk = (CSC_BYTE*)CSC_IAllocatorAlloc(pThis->pParentAllocator, pThis->blockStride * blocksPerChunk);
+
+	if (!pChunk)
+	{
+		return (CSC_BOOLEAN)FALSE;
+	}
+
+	// Concurrent refills never share a slot, if the table was filled up in the meantime the chunk is returned to the parent allocator.
+	do
+	{
+		if (chunkIndex >= CSC_LOCK_FREE_ALLOCATOR_MAX_CHUNKS)
+		{
+			CSC_IAllocatorFreeSized(pThis->pParentAllocator, (CSC_PVOID)pChunk, pThis->blockStride * blocksPerChunk);
+			return (CSC_BOOLEAN)FALSE;
+		}
+	} while (!CSC_ATOMIC_COMPARE_EXCHANGE(&pThis->chunkCount, &chunkIndex, chunkIndex + (CSC_SIZE_T)1));
+
+	for (iterator = (CSC_SIZE_T)0; iterator < blocksPerChunk; ++iterator)
+	{
+		pHeader = (CSC_LockFreeAllocatorBlockHeader*)(pChunk + iterator * pThis->blockStride);
+		pHeader->index = (chunkIndex << pThis->blocksPerChunkShift) + iterator;
+		pHeader->next = pHeader->index + (CSC_SIZE_T)2;
+	}
+
+	CSC_ATOMIC_STORE(&pThis->chunks[chunkIndex], (CSC_SIZE_T)pChunk);
+	CSC_LockFreeAllocatorPushChain(pThis, chunkIndex << pThis->blocksPerChunkShift, pHeader);
+
+	return (CSC_BOOLEAN)TRUE;
+}
+
+static CSC_PVOID CSCMETHOD CSC_LockFreeAllocatorAllocate(_In_ CONST CSC_IAllocator* CONST pThis, _In_ CONST CSC_SIZE_T size, _In_ CONST CSC_BOOLEAN zeroMemory)
+{
+	CSC_LockFreeAllocator* CONST pAllocator = (CSC_LockFreeAllocator* CONST)CSC_CONTAINING_RECORD(pThis, CONST CSC_LockFreeAllocator, allocatorInterface);
+	CSC_PVOID pMemoryBlock;
+
+	if (!pThis || !size || !CSC_LockFreeAllocatorIsValid(pAllocator) || size > pAllocator->blockSize)
+	{
+		return NULL;
+	}
+
+	while (!CSC_LockFreeAllocatorPopChain(pAllocator, (CSC_SIZE_T)1, &pMemoryBlock))
+	{
+		if (!CSC_LockFreeAllocatorAllocateChunk(pAllocator))
+		{
+			return NULL;
+		}
+	}
+
+	if (zeroMemory)
+	{
+		CSC_MemoryUtilsSetZeroMemory(pMemoryBlock, size);
+	}
+
+	return pMemoryBlock;
+}
+
+
+static CSC_PCVOID CSCMETHOD CSC_LockFreeAllocatorGetInterface(_In_ CONST CSC_IBaseInterface* CONST pThis, _In_ CONST EBaseInterfaceType interfaceType)
+{
+	CONST CSC_LockFreeAllocator* CONST pAllocator = (CONST CSC_LockFreeAllocator* CONST)pThis;
+
+	if (!pThis)
+	{
+		return NULL;
+	}
+
+	switch (interfaceType)
+	{
+	case csc_bit_IAllocator:
+
+		return (CSC_PCVOID)&pAllocator->allocatorInterface;
+
+	default:
+
+		return NULL;
+	}
+}
+
+static CSC_STATUS CSCMETHOD CSC_LockFreeAllocatorInit(_Inout_ CSC_IAllocator* CONST pThis)
+{
+	if (!pThis || !CSC_LockFreeAllocatorIsValid(CSC_CONTAINING_RECORD(pThis, CSC_LockFreeAllocator, allocatorInterface)))
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	return CSC_STATUS_SUCCESS;
+}
+
+static CSC_STATUS CSCMETHOD CSC_LockFreeAllocatorCleanup(_Inout_ CSC_IAllocator* CONST pThis)
+{
+	if (!pThis)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	return CSC_LockFreeAllocatorDestroy(CSC_CONTAINING_RECORD(pThis, CSC_LockFreeAllocator, allocatorInterface));
+}
+
+static CSC_PVOID CSCMETHOD CSC_LockFreeAllocatorAlloc(_In_ CONST CSC_IAllocator* CONST pThis, _In_ CONST CSC_SIZE_T size)
+{
+	return CSC_LockFreeAllocatorAllocate(pThis, size, (CSC_BOOLEAN)FALSE);
+}
+
+static CSC_PVOID CSCMETHOD CSC_LockFreeAllocatorAllocZero(_In_ CONST CSC_IAllocator* CONST pThis, _In_ CONST CSC_SIZE_T size)
+{
+	return CSC_LockFreeAllocatorAllocate(pThis, size, (CSC_BOOLEAN)TRUE);
+}
+
+static CSC_STATUS CSCMETHOD CSC_LockFreeAllocatorFree(_In_ CONST CSC_IAllocator* CONST pThis, _In_ CONST CSC_PVOID pMemoryBlock)
+{
+	CSC_LockFreeAllocator* CONST pAllocator = (CSC_LockFreeAllocator* CONST)CSC_CONTAINING_RECORD(pThis, CONST CSC_LockFreeAllocator, allocatorInterface);
+	CSC_LockFreeAllocatorBlockHeader* pHeader;
+
+	if (!pThis || !pMemoryBlock || !CSC_LockFreeAllocatorIsValid(pAllocator))
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	pHeader = CSC_LockFreeAllocatorGetOwnedHeader(pAllocator, pMemoryBlock);
+
+	if (!pHeader)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	CSC_LockFreeAllocatorPushChain(pAllocator, pHeader->index, pHeader);
+
+	return CSC_STATUS_SUCCESS;
+}
+
+static CSC_BOOLEAN CSCMETHOD CSC_LockFreeAllocatorIsUsable(_In_ CONST CSC_IAllocator* CONST pThis)
+{
+	CONST CSC_LockFreeAllocator* CONST pAllocator = CSC_CONTAINING_RECORD(pThis, CONST CSC_LockFreeAllocator, allocatorInterface);
+
+	if (!pThis || !CSC_LockFreeAllocatorIsValid(pAllocator))
+	{
+		return (CSC_BOOLEAN)FALSE;
+	}
+
+	return CSC_IAllocatorIsUsable(pAllocator->pParentAllocator);
+}
+
+static CSC_STATUS CSCMETHOD CSC_LockFreeAllocatorAllocBatch(_In_ CONST CSC_IAllocator* CONST pThis, _In_ CONST CSC_SIZE_T size, _In_ CONST CSC_SIZE_T count, _Out_ CSC_PVOID* CONST ppMemoryBlocks)
+{
+	CSC_LockFreeAllocator* CONST pAllocator = (CSC_LockFreeAllocator* CONST)CSC_CONTAINING_RECORD(pThis, CONST CSC_LockFreeAllocator, allocatorInterface);
+	CSC_SIZE_T poppedCount = (CSC_SIZE_T)0;
+
+	if (!pThis || !size || !count || !ppMemoryBlocks || !CSC_LockFreeAllocatorIsValid(pAllocator) || size > pAllocator->blockSize)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	// Every pop detaches as many blocks as are available with a single exchange.
+	while (poppedCount < count)
+	{
+		poppedCount += CSC_LockFreeAllocatorPopChain(pAllocator, count - poppedCount, ppMemoryBlocks + poppedCount);
+
+		if (poppedCount < count && !CSC_LockFreeAllocatorAllocateChunk(pAllocator))
+		{
+			if (poppedCount)
+			{
+				CSC_LockFreeAllocatorFreeBatch(pThis, ppMemoryBlocks, poppedCount);
+			}
+
+			return CSC_STATUS_MEMORY_NOT_ALLOCATED;
+		}
+	}
+
+	return CSC_STATUS_SUCCESS;
+}
+
+static CSC_STATUS CSCMETHOD CSC_LockFreeAllocatorFreeBatch(_In_ CONST CSC_IAllocator* CONST pThis, _In_ CSC_PVOID* CONST ppMemoryBlocks, _In_ CONST CSC_SIZE_T count)
+{
+	CSC_LockFreeAllocator* CONST pAllocator = (CSC_LockFreeAllocator* CONST)CSC_CONTAINING_RECORD(pThis, CONST CSC_LockFreeAllocator, allocatorInterface);
+	CSC_LockFreeAllocatorBlockHeader* pFirstHeader = NULL;
+	CSC_LockFreeAllocatorBlockHeader* pLastHeader = NULL;
+	CSC_LockFreeAllocatorBlockHeader* pHeader;
+	CSC_STATUS status = CSC_STATUS_SUCCESS;
+	CSC_SIZE_T iterator;
+
+	if (!pThis || !count || !ppMemoryBlocks || !CSC_LockFreeAllocatorIsValid(pAllocator))
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	// Link the blocks privately first, so that the whole batch is pushed with a single exchange.
+	for (iterator = (CSC_SIZE_T)0; iterator < count; ++iterator)
+	{
+		if (!ppMemoryBlocks[iterator])
+		{
+			continue;
+		}
+
+		pHeader = CSC_LockFreeAllocatorGetOwnedHeader(pAllocator, ppMemoryBlocks[iterator]);
+
+		if (!pHeader)
+		{
+			status = CSC_STATUS_INVALID_PARAMETER;
+			continue;
+		}
+
+		if (pLastHeader)
+		{
+			CSC_ATOMIC_STORE(&pLastHeader->next, pHeader->index + (CSC_SIZE_T)1);
+		}
+		else
+		{
+			pFirstHeader = pHeader;
+		}
+
+		pLastHeader = pHeader;
+	}
+
+	if (pFirstHeader)
+	{
+		CSC_LockFreeAllocatorPushChain(pAllocator, pFirstHeader->index, pLastHeader);
+	}
+
+	return status;
+}
+
+static CSC_SIZE_T CSCMETHOD CSC_LockFreeAllocatorGetUsableSize(_In_ CONST CSC_IAllocator* CONST pThis, _In_ CONST CSC_PCVOID pMemoryBlock)
+{
+	CONST CSC_LockFreeAllocator* CONST pAllocator = CSC_CONTAINING_RECORD(pThis, CONST CSC_LockFreeAllocator, allocatorInterface);
+
+	if (!pThis || !pMemoryBlock || !CSC_LockFreeAllocatorIsValid(pAllocator))
+	{
+		return (CSC_SIZE_T)0;
+	}
+
+	return pAllocator->blockSize;
+}
+
+
+CSC_STATUS CSCMETHOD CSC_LockFreeAllocatorInitialize(_Out_ CSC_LockFreeAllocator* CONST pThis, _In_ CSC_IAllocator* CONST pParentAllocator, _In_ CONST CSC_SIZE_T blockSize, _In_ CONST CSC_SIZE_T blocksPerChunk)
+{
+	CSC_STATUS status;
+	CSC_SIZE_T blocksPerChunkShift = (CSC_SIZE_T)0;
+	CONST CSC_SIZE_T chunkBlockCount = (blocksPerChunk) ? blocksPerChunk : CSC_LOCK_FREE_ALLOCATOR_DEFAULT_BLOCKS_PER_CHUNK;
+
+	if (!pThis || !pParentAllocator || !blockSize || !CSC_IAllocatorIsUsable(pParentAllocator))
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	// All indices of all chunks must fit into the index half of the head.
+	while (((CSC_SIZE_T)1 << blocksPerChunkShift) < chunkBlockCount)
+	{
+		if (((CSC_SIZE_T)1 << blocksPerChunkShift) > CSC_LOCK_FREE_ALLOCATOR_INDEX_MASK / CSC_LOCK_FREE_ALLOCATOR_MAX_CHUNKS)
+		{
+			return CSC_STATUS_INVALID_PARAMETER;
+		}
+
+		++blocksPerChunkShift;
+	}
+
+	if (((CSC_SIZE_T)1 << blocksPerChunkShift) > CSC_LOCK_FREE_ALLOCATOR_INDEX_MASK / CSC_LOCK_FREE_ALLOCATOR_MAX_CHUNKS || blockSize > (~(CSC_SIZE_T)0 >> blocksPerChunkShift) / (CSC_SIZE_T)2 - CSC_LOCK_FREE_ALLOCATOR_HEADER_SIZE)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	status = CSC_MemoryUtilsSetZeroMemory((CSC_PVOID)pThis, sizeof(CSC_LockFreeAllocator));
+
+	if (status != CSC_STATUS_SUCCESS)
+	{
+		return status;
+	}
+
+	pThis->baseInterface.pIBaseInterfaceVirtualTable = &g_LockFreeAllocatorBaseInterfaceVTable;
+	pThis->allocatorInterface.pIAllocatorVirtualTable = &g_LockFreeAllocatorAllocatorVTable;
+	pThis->pParentAllocator = pParentAllocator;
+	pThis->blockSize = (blockSize + (CSC_SIZE_T)0xF) & ~(CSC_SIZE_T)0xF;
+	pThis->blockStride = pThis->blockSize + CSC_LOCK_FREE_ALLOCATOR_HEADER_SIZE;
+	pThis->blocksPerChunkShift = blocksPerChunkShift;
+
+	return CSC_STATUS_SUCCESS;
+}
+
+CSC_STATUS CSCMETHOD CSC_LockFreeAllocatorDestroy(_Inout_ CSC_LockFreeAllocator* CONST pThis)
+{
+	CSC_SIZE_T iterator;
+
+	if (!CSC_LockFreeAllocatorIsValid(pThis))
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	for (iterator = (CSC_SIZE_T)0; iterator < pThis->chunkCount; ++iterator)
+	{
+		if (pThis->chunks[iterator])
+		{
+			CSC_IAllocatorFreeSized(pThis->pParentAllocator, (CSC_PVOID)pThis->chunks[iterator], pThis->blockStride << pThis->blocksPerChunkShift);
+		}
+	}
+
+	return CSC_MemoryUtilsSetZeroMemory((CSC_PVOID)pThis, sizeof(CSC_LockFreeAllocator));
+}
+
+
+CSC_SIZE_T CSCMETHOD CSC_LockFreeAllocatorGetBlockSize(_In_ CONST CSC_LockFreeAllocator* CONST pThis)
+{
+	if (!CSC_LockFreeAllocatorIsValid(pThis))
+	{
+		return (CSC_SIZE_T)0;
+	}
+
+	return pThis->blockSize;
+}
+
+CSC_SIZE_T CSCMETHOD CSC_LockFreeAllocatorGetBlocksPerChunk(_In_ CONST CSC_LockFreeAllocator* CONST pThis)
+{
+	if (!CSC_LockFreeAllocatorIsValid(pThis))
+	{
+		return (CSC_SIZE_T)0;
+	}
+
+	return (CSC_SIZE_T)1 << pThis->blocksPerChunkShift;
+}
+
+CSC_SIZE_T CSCMETHOD CSC_LockFreeAllocatorGetChunkCount(_In_ CONST CSC_LockFreeAllocator* CONST pThis)
+{
+	if (!CSC_LockFreeAllocatorIsValid(pThis))
+	{
+		return (CSC_SIZE_T)0;
+	}
+
+	return CSC_ATOMIC_LOAD(&pThis->chunkCount);
+}
+
+CSC_IBaseInterface* CSCMETHOD CSC_LockFreeAllocatorGetIBaseInterface(_In_ CONST CSC_LockFreeAllocator* CONST pThis)
+{
+	if (!CSC_LockFreeAllocatorIsValid(pThis))
+	{
+		return (CSC_IBaseInterface*)NULL;
+	}
+
+	return (CSC_IBaseInterface*)&pThis->baseInterface;
+}
+
+CSC_IAllocator* CSCMETHOD CSC_LockFreeAllocatorGetIAllocator(_In_ CONST CSC_LockFreeAllocator* CONST pThis)
+{
+	if (!CSC_LockFreeAllocatorIsValid(pThis))
+	{
+		return (CSC_IAllocator*)NULL;
+	}
+
+	return (CSC_IAllocator*)&pThis->allocatorInterface;
+}
\ No newline at end of file
@@ -0,0 +1,57 @@
+#ifndef CSC_LOCK_FREE_ALLOCATOR
+#define CSC_LOCK_FREE_ALLOCATOR
+
+/*
+Description:
+The LockFreeAllocator implements the IAllocator interface for blocks of a single fixed size, for example nodes that are passed between producer and consumer threads.
+Free blocks are kept on a lock-free stack (Treiber stack), hence allocations and frees never take a lock and only consist of a compare and exchange operation on the head of the stack.
+Blocks are carved out of chunks that are requested from the parent allocator whenever the stack runs empty, chunks are only returned to the parent allocator when the allocator is destroyed.
+Instead of a pointer the head of the stack holds the index of the first free block together with a version counter that is incremented by every operation, which prevents the ABA problem without a double width compare and exchange.
+The lower half of the bits of a CSC_SIZE_T is used for the index and the upper half for the version, which limits the amount of blocks to CSC_LOCK_FREE_ALLOCATOR_MAX_CHUNKS times the blocks per chunk.
+Every block is preceded by a header of CSC_LOCK_FREE_ALLOCATOR_HEADER_SIZE bytes that holds it's index and the link of the stack, hence the contents of free blocks are never touched.
+The allocator is only thread safe if the configuration supports atomic operations (CSC_ATOMICS_SUPPORTED).
+*/
+
+// Include the current configuration of the library containing various type definitions and other things.
+#include "../../Configuration/Configuration.h"
+// Include the IBaseInterface as the allocator can be queried for the interfaces it implements.
+#include "../../Interfaces/IBaseInterface.h"
+// Include the IAllocator interface as the allocator implements it and requests it's chunks from another allocator implementing it.
+#include "../../Interfaces/IAllocator.h"
+
+// Definition of the maximum amount of chunks that can be requested from the parent allocator.
+#define CSC_LOCK_FREE_ALLOCATOR_MAX_CHUNKS (CSC_SIZE_T)0x100
+// Definition of the amount of blocks per chunk that is used if no other value is supplied.
+#define CSC_LOCK_FREE_ALLOCATOR_DEFAULT_BLOCKS_PER_CHUNK (CSC_SIZE_T)0x100
+// Definition of the size of the header that precedes every block.
+#define CSC_LOCK_FREE_ALLOCATOR_HEADER_SIZE (sizeof(CSC_SIZE_T) * (CSC_SIZE_T)2)
+
+typedef struct _CSC_LockFreeAllocator
+{
+	CSC_IBaseInterface baseInterface;
+	CSC_IAllocator allocatorInterface;
+	CSC_IAllocator* pParentAllocator;
+	CSC_SIZE_T blockSize;
+	CSC_SIZE_T blockStride;
+	CSC_SIZE_T blocksPerChunkShift;
+	CSC_ATOMIC CSC_SIZE_T freeListHead;
+	CSC_ATOMIC CSC_SIZE_T chunkCount;
+	CSC_ATOMIC CSC_SIZE_T chunks[CSC_LOCK_FREE_ALLOCATOR_MAX_CHUNKS];
+} CSC_LockFreeAllocator;
+
+// Initializes the allocator for blocks of up to blockSize bytes with a parent allocator, which must be usable and outlive the allocator.
+// The block size is rounded up to a multiple of 16 bytes, blocksPerChunk is rounded up to a power of two and a value of 0 uses CSC_LOCK_FREE_ALLOCATOR_DEFAULT_BLOCKS_PER_CHUNK.
+// Returns CSC_STATUS_SUCCESS on success, otherwise an error code is returned.
+CSC_STATUS CSCMETHOD CSC_LockFreeAllocatorInitialize(_Out_ CSC_LockFreeAllocator* CONST pThis, _In_ CSC_IAllocator* CONST pParentAllocator, _In_ CONST CSC_SIZE_T blockSize, _In_ CONST CSC_SIZE_T blocksPerChunk);
+// Returns all chunks to the parent allocator and zeroes out the object.
+// No other thread may use the allocator during or after this operation, blocks that are still allocated become invalid.
+// Returns CSC_STATUS_SUCCESS on success, otherwise an error code is returned.
+CSC_STATUS CSCMETHOD CSC_LockFreeAllocatorDestroy(_Inout_ CSC_LockFreeAllocator* CONST pThis);
+
+CSC_SIZE_T CSCMETHOD CSC_LockFreeAllocatorGetBlockSize(_In_ CONST CSC_LockFreeAllocator* CONST pThis);
+CSC_SIZE_T CSCMETHOD CSC_LockFreeAllocatorGetBlocksPerChunk(_In_ CONST CSC_LockFreeAllocator* CONST pThis);
+CSC_SIZE_T CSCMETHOD CSC_LockFreeAllocatorGetChunkCount(_In_ CONST CSC_LockFreeAllocator* CONST pThis);
+CSC_IBaseInterface* CSCMETHOD CSC_LockFreeAllocatorGetIBaseInterface(_In_ CONST CSC_LockFreeAllocator* CONST pThis);
+CSC_IAllocator* CSCMETHOD CSC_LockFreeAllocatorGetIAllocator(_In_ CONST CSC_LockFreeAllocator* CONST pThis);
+
+#endif
\ No newline at end of file
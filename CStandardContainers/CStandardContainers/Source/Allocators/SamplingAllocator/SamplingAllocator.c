@@ -0,0 +1,674 @@
+#include "SamplingAllocator.h"
+
+#ifdef CSC_CONFIG_LINUX_NATIVE
+
+#include "../../Utils/MemoryUtils.h"
+
+#include <execinfo.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+
+// Definition of the amount of random bits that are used to draw the distance to the next sample.
+#define CSC_SAMPLING_ALLOCATOR_RANDOM_BITS (CSC_SIZE_T)26
+// Definition of the size of the buffer that is used to write profiles.
+#define CSC_SAMPLING_ALLOCATOR_WRITE_BUFFER_SIZE (CSC_SIZE_T)0x400
+
+// Definition of the header that precedes every block handed out by the allocator.
+// The sample member is the index of the sample of the block plus 1, or 0 if the block hasn't been sampled.
+typedef struct _CSC_SamplingAllocatorBlockHeader
+{
+	CSC_SIZE_T size;
+	CSC_SIZE_T sample;
+} CSC_SamplingAllocatorBlockHeader;
+
+// Definition of the buffered writer that is used to write profiles to a file descriptor.
+typedef struct _CSC_SamplingAllocatorWriter
+{
+	int fileDescriptor;
+	CSC_STATUS status;
+	CSC_SIZE_T length;
+	char buffer[CSC_SAMPLING_ALLOCATOR_WRITE_BUFFER_SIZE];
+} CSC_SamplingAllocatorWriter;
+
+static CSC_PCVOID CSCMETHOD CSC_SamplingAllocatorGetInterface(_In_ CONST CSC_IBaseInterface* CONST pThis, _In_ CONST EBaseInterfaceType interfaceType);
+
+static CSC_STATUS CSCMETHOD CSC_SamplingAllocatorInit(_Inout_ CSC_IAllocator* CONST pThis);
+static CSC_STATUS CSCMETHOD CSC_SamplingAllocatorCleanup(_Inout_ CSC_IAllocator* CONST pThis);
+static CSC_PVOID CSCMETHOD CSC_SamplingAllocatorAlloc(_In_ CONST CSC_IAllocator* CONST pThis, _In_ CONST CSC_SIZE_T size);
+static CSC_PVOID CSCMETHOD CSC_SamplingAllocatorAllocZero(_In_ CONST CSC_IAllocator* CONST pThis, _In_ CONST CSC_SIZE_T size);
+static CSC_STATUS CSCMETHOD CSC_SamplingAllocatorFree(_In_ CONST CSC_IAllocator* CONST pThis, _In_ CONST CSC_PVOID pMemoryBlock);
+static CSC_BOOLEAN CSCMETHOD CSC_SamplingAllocatorIsUsable(_In_ CONST CSC_IAllocator* CONST pThis);
+
+static CSC_IBaseInterfaceVirtualTable g_SamplingAllocatorBaseInterfaceVTable =
+{
+	CSC_SamplingAllocatorGetInterface
+};
+
+static CSC_IAllocatorVirtualTable g_SamplingAllocatorAllocatorVTable =
+{
+	CSC_SamplingAllocatorInit,
+	CSC_SamplingAllocatorCleanup,
+	CSC_SamplingAllocatorAlloc,
+	CSC_SamplingAllocatorAllocZero,
+	CSC_SamplingAllocatorFree,
+	CSC_SamplingAllocatorIsUsable,
+	NULL,
+	NULL,
+	NULL,
+	NULL
+};
+
+
+static CSC_BOOLEAN CSCMETHOD CSC_SamplingAllocatorIsValid(_In_ CONST CSC_SamplingAllocator* CONST pThis)
+{
+	if (!pThis || pThis->baseInterface.pIBaseInterfaceVirtualTable != &g_SamplingAllocatorBaseInterfaceVTable || pThis->allocatorInterface.pIAllocatorVirtualTable != &g_SamplingAllocatorAllocatorVTable || !pThis->pParentAllocator || !pThis->pSamples)
+	{
+		return (CSC_BOOLEAN)FALSE;
+	}
+
+	return (CSC_BOOLEAN)TRUE;
+}
+
+static CSC_SamplingAllocatorBlockHeader* CSCMETHOD CSC_SamplingAllocatorGetHeader(_In_ CONST CSC_PCVOID pMemoryBlock)
+{
+	return (CSC_SamplingAllocatorBlockHeader*)((CONST CSC_BYTE*)pMemoryBlock - CSC_SAMPLING_ALLOCATOR_HEADER_SIZE);
+}
+
+// Mixes a counter into 32 random bits, every caller gets it's own counter value, hence no lock is needed.
+static CSC_SIZE_T CSCMETHOD CSC_SamplingAllocatorGetRandom(_Inout_ CSC_SamplingAllocator* CONST pThis)
+{
+	CSC_SIZE_T value = (CSC_ATOMIC_FETCH_ADD(&pThis->randomState, (CSC_SIZE_T)0x9E3779B9) + (CSC_SIZE_T)0x9E3779B9) & (CSC_SIZE_T)0xFFFFFFFF;
+
+	value ^= value >> 16;
+	value = (value * (CSC_SIZE_T)0x85EBCA6B) & (CSC_SIZE_T)0xFFFFFFFF;
+	value ^= value >> 13;
+	value = (value * (CSC_SIZE_T)0xC2B2AE35) & (CSC_SIZE_T)0xFFFFFFFF;
+	value ^= value >> 16;
+
+	return value;
+}
+
+// Draws the distance to the next sample from an exponential distribution with the sample rate as mean, which is -ln(u) * sampleRate for a uniform u in (0, 1].
+// The logarithm is approximated linearly between powers of two, which is accurate enough for sampling and doesn't require the math library.
+static CSC_SIZE_T CSCMETHOD CSC_SamplingAllocatorGetSampleInterval(_Inout_ CSC_SamplingAllocator* CONST pThis)
+{
+	CONST CSC_SIZE_T value = (CSC_SamplingAllocatorGetRandom(pThis) >> ((CSC_SIZE_T)32 - CSC_SAMPLING_ALLOCATOR_RANDOM_BITS)) + (CSC_SIZE_T)1;
+	CSC_SIZE_T exponent = (CSC_SIZE_T)0;
+	double logarithm;
+
+	while ((value >> exponent) > (CSC_SIZE_T)1)
+	{
+		++exponent;
+	}
+
+	logarithm = (double)exponent + (double)(value - ((CSC_SIZE_T)1 << exponent)) / (double)((CSC_SIZE_T)1 << exponent);
+
+	return (CSC_SIZE_T)(((double)CSC_SAMPLING_ALLOCATOR_RANDOM_BITS - logarithm) * 0.6931471805599453 * (double)pThis->sampleRate) + (CSC_SIZE_T)1;
+}
+
+// Adds the size to the allocated bytes and checks whether the allocation crosses the next sample point.
+// The counters may wrap around, hence they are compared by their distance.
+static CSC_BOOLEAN CSCMETHOD CSC_SamplingAllocatorShouldSample(_Inout_ CSC_SamplingAllocator* CONST pThis, _In_ CONST CSC_SIZE_T size)
+{
+	CONST CSC_SIZE_T allocatedBytes = CSC_ATOMIC_FETCH_ADD(&pThis->allocatedBytes, size) + size;
+	CSC_SIZE_T nextSample = CSC_ATOMIC_LOAD(&pThis->nextSample);
+	CSC_SIZE_T interval;
+
+	if (allocatedBytes - nextSample > (~(CSC_SIZE_T)0 >> 1))
+	{
+		return (CSC_BOOLEAN)FALSE;
+	}
+
+	interval = CSC_SamplingAllocatorGetSampleInterval(pThis);
+
+	// Only the thread that moves the sample point takes the sample, allocations of other threads crossing the same point are not sampled.
+	while (allocatedBytes - nextSample <= (~(CSC_SIZE_T)0 >> 1))
+	{
+		if (CSC_ATOMIC_COMPARE_EXCHANGE(&pThis->nextSample, &nextSample, allocatedBytes + interval))
+		{
+			return (CSC_BOOLEAN)TRUE;
+		}
+	}
+
+	return (CSC_BOOLEAN)FALSE;
+}
+
+// Claims an entry of the sample table by probing from a hash of the block address, the entry is marked as busy while the call stack is recorded.
+// Returns the index of the entry plus 1, or 0 if the table is full.
+static CSC_SIZE_T CSCMETHOD CSC_SamplingAllocatorAddSample(_Inout_ CSC_SamplingAllocator* CONST pThis, _In_ CONST CSC_PCVOID pMemoryBlock, _In_ CONST CSC_SIZE_T size)
+{
+	CONST CSC_SIZE_T mask = pThis->maxSamples - (CSC_SIZE_T)1;
+	CONST CSC_SIZE_T start = (((CSC_SIZE_T)(CSC_DATA_POINTER_TYPE)pMemoryBlock >> 4) * (CSC_SIZE_T)0x9E3779B1) & mask;
+	CSC_SamplingAllocatorSample* pSample;
+	CSC_SIZE_T iterator, expected;
+	int frameCount;
+
+	for (iterator = (CSC_SIZE_T)0; iterator < pThis->maxSamples; ++iterator)
+	{
+		pSample = &pThis->pSamples[(start + iterator) & mask];
+		expected = (CSC_SIZE_T)0;
+
+		if (CSC_ATOMIC_LOAD(&pSample->block) || !CSC_ATOMIC_COMPARE_EXCHANGE(&pSample->block, &expected, (CSC_SIZE_T)1))
+		{
+			continue;
+		}
+
+		frameCount = backtrace(pSample->pFrames, (int)CSC_SAMPLING_ALLOCATOR_MAX_FRAMES);
+
+		pSample->size = size;
+		pSample->frameCount = (frameCount > 0) ? (CSC_SIZE_T)frameCount : (CSC_SIZE_T)0;
+
+		CSC_ATOMIC_STORE(&pSample->block, (CSC_SIZE_T)(CSC_DATA_POINTER_TYPE)pMemoryBlock);
+		CSC_ATOMIC_FETCH_ADD(&pThis->liveSampleCount, (CSC_SIZE_T)1);
+		CSC_ATOMIC_FETCH_ADD(&pThis->totalSampleCount, (CSC_SIZE_T)1);
+
+		return ((start + iterator) & mask) + (CSC_SIZE_T)1;
+	}
+
+	CSC_ATOMIC_FETCH_ADD(&pThis->droppedSampleCount, (CSC_SIZE_T)1);
+
+	return (CSC_SIZE_T)0;
+}
+
+static CSC_PVOID CSCMETHOD CSC_SamplingAllocatorAllocate(_In_ CONST CSC_IAllocator* CONST pThis, _In_ CONST CSC_SIZE_T size, _In_ CONST CSC_BOOLEAN zeroMemory)
+{
+	CSC_SamplingAllocator* CONST pAllocator = (CSC_SamplingAllocator* CONST)CSC_CONTAINING_RECORD(pThis, CONST CSC_SamplingAllocator, allocatorInterface);
+	CSC_SamplingAllocatorBlockHeader* pHeader;
+	CSC_PVOID pMemoryBlock;
+
+	if (!pThis || !size || !CSC_SamplingAllocatorIsValid(pAllocator) || size > ~(CSC_SIZE_T)0 - CSC_SAMPLING_ALLOCATOR_HEADER_SIZE)
+	{
+		return NULL;
+	}
+
+	if (zeroMemory)
+	{
+		pHeader = (CSC_SamplingAllocatorBlockHeader*)CSC_IAllocatorAllocZero(pAllocator->pParentAllocator, size + CSC_SAMPLING_ALLOCATOR_HEADER_SIZE);
+	}
+	else
+	{
+		pHeader = (CSC_SamplingAllocatorBlockHeader*)CSC_IAllocatorAlloc(pAllocator->pParentAllocator, size + CSC_SAMPLING_ALLOCATOR_HEADER_SIZE);
+	}
+
+	if (!pHeader)
+	{
+		return NULL;
+	}
+
+	pMemoryBlock = (CSC_PVOID)((CSC_BYTE*)pHeader + CSC_SAMPLING_ALLOCATOR_HEADER_SIZE);
+
+	pHeader->size = size;
+	pHeader->sample = (CSC_SamplingAllocatorShouldSample(pAllocator, size)) ? CSC_SamplingAllocatorAddSample(pAllocator, pMemoryBlock, size) : (CSC_SIZE_T)0;
+
+	return pMemoryBlock;
+}
+
+static void CSCMETHOD CSC_SamplingAllocatorFlush(_Inout_ CSC_SamplingAllocatorWriter* CONST pWriter)
+{
+	CSC_SIZE_T offset = (CSC_SIZE_T)0;
+	ssize_t written;
+
+	while (pWriter->status == CSC_STATUS_SUCCESS && offset < pWriter->length)
+	{
+		written = write(pWriter->fileDescriptor, pWriter->buffer + offset, pWriter->length - offset);
+
+		if (written < 0 && errno == EINTR)
+		{
+			continue;
+		}
+
+		if (written <= 0)
+		{
+			pWriter->status = CSC_STATUS_GENERAL_FAILURE;
+			break;
+		}
+
+		offset += (CSC_SIZE_T)written;
+	}
+
+	pWriter->length = (CSC_SIZE_T)0;
+}
+
+static void CSCMETHOD CSC_SamplingAllocatorWriteString(_Inout_ CSC_SamplingAllocatorWriter* CONST pWriter, _In_ CONST char* pString)
+{
+	for (; *pString; ++pString)
+	{
+		if (pWriter->length == CSC_SAMPLING_ALLOCATOR_WRITE_BUFFER_SIZE)
+		{
+			CSC_SamplingAllocatorFlush(pWriter);
+		}
+
+		pWriter->buffer[pWriter->length++] = *pString;
+	}
+}
+
+static void CSCMETHOD CSC_SamplingAllocatorWriteNumber(_Inout_ CSC_SamplingAllocatorWriter* CONST pWriter, _In_ CSC_SIZE_T value, _In_ CONST CSC_SIZE_T base)
+{
+	char digits[sizeof(CSC_SIZE_T) * 8 + 1];
+	CSC_SIZE_T index = sizeof(digits) - (CSC_SIZE_T)1;
+
+	digits[index] = '\0';
+
+	do
+	{
+		digits[--index] = "0123456789abcdef"[value % base];
+		value /= base;
+	} while (value);
+
+	if (base == (CSC_SIZE_T)16)
+	{
+		CSC_SamplingAllocatorWriteString(pWriter, "0x");
+	}
+
+	CSC_SamplingAllocatorWriteString(pWriter, &digits[index]);
+}
+
+// Copies a consistent snapshot of a sample, entries that are unused, busy or replaced while they are copied are skipped.
+// Returns TRUE if the snapshot is valid, otherwise FALSE is returned.
+static CSC_BOOLEAN CSCMETHOD CSC_SamplingAllocatorCopySample(_In_ CONST CSC_SamplingAllocatorSample* CONST pSource, _Out_ CSC_SamplingAllocatorSample* CONST pSample)
+{
+	CSC_SamplingAllocatorSample* CONST pEntry = (CSC_SamplingAllocatorSample* CONST)pSource;
+	CSC_SIZE_T iterator;
+
+	pSample->block = CSC_ATOMIC_LOAD(&pEntry->block);
+
+	if (pSample->block <= (CSC_SIZE_T)1)
+	{
+		return (CSC_BOOLEAN)FALSE;
+	}
+
+	pSample->size = pEntry->size;
+	pSample->frameCount = (pEntry->frameCount < CSC_SAMPLING_ALLOCATOR_MAX_FRAMES) ? pEntry->frameCount : CSC_SAMPLING_ALLOCATOR_MAX_FRAMES;
+
+	for (iterator = (CSC_SIZE_T)0; iterator < pSample->frameCount; ++iterator)
+	{
+		pSample->pFrames[iterator] = pEntry->pFrames[iterator];
+	}
+
+	return (CSC_BOOLEAN)(CSC_ATOMIC_LOAD(&pEntry->block) == pSample->block);
+}
+
+// Appends the memory mappings of the process, which pprof needs to symbolize the addresses of the legacy format.
+static void CSCMETHOD CSC_SamplingAllocatorWriteMappings(_Inout_ CSC_SamplingAllocatorWriter* CONST pWriter)
+{
+	CONST int mapsFileDescriptor = open("/proc/self/maps", O_RDONLY);
+	ssize_t bytesRead;
+
+	if (mapsFileDescriptor < 0)
+	{
+		return;
+	}
+
+	CSC_SamplingAllocatorFlush(pWriter);
+
+	while (pWriter->status == CSC_STATUS_SUCCESS)
+	{
+		bytesRead = read(mapsFileDescriptor, pWriter->buffer, CSC_SAMPLING_ALLOCATOR_WRITE_BUFFER_SIZE);
+
+		if (bytesRead < 0 && errno == EINTR)
+		{
+			continue;
+		}
+
+		if (bytesRead <= 0)
+		{
+			break;
+		}
+
+		pWriter->length = (CSC_SIZE_T)bytesRead;
+		CSC_SamplingAllocatorFlush(pWriter);
+	}
+
+	close(mapsFileDescriptor);
+}
+
+
+static CSC_PCVOID CSCMETHOD CSC_SamplingAllocatorGetInterface(_In_ CONST CSC_IBaseInterface* CONST pThis, _In_ CONST EBaseInterfaceType interfaceType)
+{
+	CONST CSC_SamplingAllocator* CONST pAllocator = (CONST CSC_SamplingAllocator* CONST)pThis;
+
+	if (!pThis)
+	{
+		return NULL;
+	}
+
+	switch (interfaceType)
+	{
+	case csc_bit_IAllocator:
+
+		return (CSC_PCVOID)&pAllocator->allocatorInterface;
+
+	default:
+
+		return NULL;
+	}
+}
+
+static CSC_STATUS CSCMETHOD CSC_SamplingAllocatorInit(_Inout_ CSC_IAllocator* CONST pThis)
+{
+	if (!pThis || !CSC_SamplingAllocatorIsValid(CSC_CONTAINING_RECORD(pThis, CSC_SamplingAllocator, allocatorInterface)))
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	return CSC_STATUS_SUCCESS;
+}
+
+static CSC_STATUS CSCMETHOD CSC_SamplingAllocatorCleanup(_Inout_ CSC_IAllocator* CONST pThis)
+{
+	if (!pThis)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	return CSC_SamplingAllocatorDestroy(CSC_CONTAINING_RECORD(pThis, CSC_SamplingAllocator, allocatorInterface));
+}
+
+static CSC_PVOID CSCMETHOD CSC_SamplingAllocatorAlloc(_In_ CONST CSC_IAllocator* CONST pThis, _In_ CONST CSC_SIZE_T size)
+{
+	return CSC_SamplingAllocatorAllocate(pThis, size, (CSC_BOOLEAN)FALSE);
+}
+
+static CSC_PVOID CSCMETHOD CSC_SamplingAllocatorAllocZero(_In_ CONST CSC_IAllocator* CONST pThis, _In_ CONST CSC_SIZE_T size)
+{
+	return CSC_SamplingAllocatorAllocate(pThis, size, (CSC_BOOLEAN)TRUE);
+}
+
+static CSC_STATUS CSCMETHOD CSC_SamplingAllocatorFree(_In_ CONST CSC_IAllocator* CONST pThis, _In_ CONST CSC_PVOID pMemoryBlock)
+{
+	CSC_SamplingAllocator* CONST pAllocator = (CSC_SamplingAllocator* CONST)CSC_CONTAINING_RECORD(pThis, CONST CSC_SamplingAllocator, allocatorInterface);
+	CSC_SamplingAllocatorBlockHeader* pHeader;
+
+	if (!pThis || !pMemoryBlock || !CSC_SamplingAllocatorIsValid(pAllocator))
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	pHeader = CSC_SamplingAllocatorGetHeader(pMemoryBlock);
+
+	if (pHeader->sample > pAllocator->maxSamples)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	// The sample is removed before the block is returned, otherwise the address could already be sampled again by another thread.
+	if (pHeader->sample)
+	{
+		CSC_ATOMIC_STORE(&pAllocator->pSamples[pHeader->sample - (CSC_SIZE_T)1].block, (CSC_SIZE_T)0);
+		CSC_ATOMIC_FETCH_SUB(&pAllocator->liveSampleCount, (CSC_SIZE_T)1);
+	}
+
+	return CSC_IAllocatorFreeSized(pAllocator->pParentAllocator, (CSC_PVOID)pHeader, pHeader->size + CSC_SAMPLING_ALLOCATOR_HEADER_SIZE);
+}
+
+static CSC_BOOLEAN CSCMETHOD CSC_SamplingAllocatorIsUsable(_In_ CONST CSC_IAllocator* CONST pThis)
+{
+	CONST CSC_SamplingAllocator* CONST pAllocator = CSC_CONTAINING_RECORD(pThis, CONST CSC_SamplingAllocator, allocatorInterface);
+
+	if (!pThis || !CSC_SamplingAllocatorIsValid(pAllocator))
+	{
+		return (CSC_BOOLEAN)FALSE;
+	}
+
+	return CSC_IAllocatorIsUsable(pAllocator->pParentAllocator);
+}
+
+
+CSC_STATUS CSCMETHOD CSC_SamplingAllocatorInitialize(_Out_ CSC_SamplingAllocator* CONST pThis, _In_ CSC_IAllocator* CONST pParentAllocator, _In_ CONST CSC_SIZE_T sampleRate, _In_ CONST CSC_SIZE_T maxSamples, _In_ CONST int dumpFileDescriptor, _In_ CONST ESamplingAllocatorProfileFormat dumpFormat)
+{
+	CSC_SIZE_T sampleCount = (CSC_SIZE_T)1;
+	CSC_PVOID pFrames[1];
+	CSC_STATUS status;
+
+	if (!pThis || !pParentAllocator || !CSC_IAllocatorIsUsable(pParentAllocator) || dumpFileDescriptor < CSC_SAMPLING_ALLOCATOR_NO_DUMP || (dumpFormat != csc_sapf_Text && dumpFormat != csc_sapf_Pprof))
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	while (sampleCount < ((maxSamples) ? maxSamples : CSC_SAMPLING_ALLOCATOR_DEFAULT_MAX_SAMPLES))
+	{
+		if (sampleCount > (~(CSC_SIZE_T)0 >> 1) / sizeof(CSC_SamplingAllocatorSample))
+		{
+			return CSC_STATUS_INVALID_PARAMETER;
+		}
+
+		sampleCount <<= 1;
+	}
+
+	status = CSC_MemoryUtilsSetZeroMemory((CSC_PVOID)pThis, sizeof(CSC_SamplingAllocator));
+
+	if (status != CSC_STATUS_SUCCESS)
+	{
+		return status;
+	}
+
+	pThis->pSamples = (CSC_SamplingAllocatorSample*)CSC_IAllocatorAllocZero(pParentAllocator, sampleCount * sizeof(CSC_SamplingAllocatorSample));
+
+	if (!pThis->pSamples)
+	{
+		return CSC_STATUS_MEMORY_NOT_ALLOCATED;
+	}
+
+	// The first call of backtrace loads the unwinder, which may allocate memory, hence it is done here instead of during the first sampled allocation.
+	backtrace(pFrames, 1);
+
+	pThis->baseInterface.pIBaseInterfaceVirtualTable = &g_SamplingAllocatorBaseInterfaceVTable;
+	pThis->allocatorInterface.pIAllocatorVirtualTable = &g_SamplingAllocatorAllocatorVTable;
+	pThis->pParentAllocator = pParentAllocator;
+	pThis->maxSamples = sampleCount;
+	pThis->sampleRate = (sampleRate) ? sampleRate : CSC_SAMPLING_ALLOCATOR_DEFAULT_SAMPLE_RATE;
+	pThis->dumpFileDescriptor = dumpFileDescriptor;
+	pThis->dumpFormat = dumpFormat;
+	pThis->randomState = (CSC_SIZE_T)(CSC_DATA_POINTER_TYPE)pThis->pSamples;
+	pThis->nextSample = CSC_SamplingAllocatorGetSampleInterval(pThis);
+
+	return CSC_STATUS_SUCCESS;
+}
+
+CSC_STATUS CSCMETHOD CSC_SamplingAllocatorDestroy(_Inout_ CSC_SamplingAllocator* CONST pThis)
+{
+	CSC_STATUS dumpStatus = CSC_STATUS_SUCCESS;
+	CSC_STATUS status;
+
+	if (!CSC_SamplingAllocatorIsValid(pThis))
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	// The remaining samples describe blocks that have never been freed, which are reported before the table is released.
+	if (pThis->dumpFileDescriptor != CSC_SAMPLING_ALLOCATOR_NO_DUMP)
+	{
+		dumpStatus = CSC_SamplingAllocatorDumpProfile(pThis, pThis->dumpFileDescriptor, pThis->dumpFormat);
+	}
+
+	status = CSC_IAllocatorFreeSized(pThis->pParentAllocator, (CSC_PVOID)pThis->pSamples, pThis->maxSamples * sizeof(CSC_SamplingAllocatorSample));
+
+	if (status != CSC_STATUS_SUCCESS)
+	{
+		return status;
+	}
+
+	status = CSC_MemoryUtilsSetZeroMemory((CSC_PVOID)pThis, sizeof(CSC_SamplingAllocator));
+
+	if (status != CSC_STATUS_SUCCESS)
+	{
+		return status;
+	}
+
+	return dumpStatus;
+}
+
+
+CSC_STATUS CSCMETHOD CSC_SamplingAllocatorDumpProfile(_In_ CONST CSC_SamplingAllocator* CONST pThis, _In_ CONST int fileDescriptor, _In_ CONST ESamplingAllocatorProfileFormat format)
+{
+	CSC_SamplingAllocatorWriter writer;
+	CSC_SamplingAllocatorSample sample;
+	CSC_SIZE_T sampleCount = (CSC_SIZE_T)0;
+	CSC_SIZE_T sampledBytes = (CSC_SIZE_T)0;
+	CSC_SIZE_T iterator, frame;
+
+	if (fileDescriptor < 0 || (format != csc_sapf_Text && format != csc_sapf_Pprof) || !CSC_SamplingAllocatorIsValid(pThis))
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	writer.fileDescriptor = fileDescriptor;
+	writer.status = CSC_STATUS_SUCCESS;
+	writer.length = (CSC_SIZE_T)0;
+
+	for (iterator = (CSC_SIZE_T)0; iterator < pThis->maxSamples; ++iterator)
+	{
+		if (CSC_SamplingAllocatorCopySample(&pThis->pSamples[iterator], &sample))
+		{
+			++sampleCount;
+			sampledBytes += sample.size;
+		}
+	}
+
+	if (format == csc_sapf_Text)
+	{
+		CSC_SamplingAllocatorWriteString(&writer, "Heap profile: ");
+		CSC_SamplingAllocatorWriteNumber(&writer, sampleCount, (CSC_SIZE_T)10);
+		CSC_SamplingAllocatorWriteString(&writer, " live samples holding ");
+		CSC_SamplingAllocatorWriteNumber(&writer, sampledBytes, (CSC_SIZE_T)10);
+		CSC_SamplingAllocatorWriteString(&writer, " bytes, one sample per ");
+		CSC_SamplingAllocatorWriteNumber(&writer, pThis->sampleRate, (CSC_SIZE_T)10);
+		CSC_SamplingAllocatorWriteString(&writer, " allocated bytes on average, ");
+		CSC_SamplingAllocatorWriteNumber(&writer, CSC_ATOMIC_LOAD(&pThis->droppedSampleCount), (CSC_SIZE_T)10);
+		CSC_SamplingAllocatorWriteString(&writer, " samples dropped\n");
+	}
+	else
+	{
+		CSC_SamplingAllocatorWriteString(&writer, "heap profile: ");
+		CSC_SamplingAllocatorWriteNumber(&writer, sampleCount, (CSC_SIZE_T)10);
+		CSC_SamplingAllocatorWriteString(&writer, ": ");
+		CSC_SamplingAllocatorWriteNumber(&writer, sampledBytes, (CSC_SIZE_T)10);
+		CSC_SamplingAllocatorWriteString(&writer, " [ ");
+		CSC_SamplingAllocatorWriteNumber(&writer, sampleCount, (CSC_SIZE_T)10);
+		CSC_SamplingAllocatorWriteString(&writer, ": ");
+		CSC_SamplingAllocatorWriteNumber(&writer, sampledBytes, (CSC_SIZE_T)10);
+		CSC_SamplingAllocatorWriteString(&writer, "] @ heap_v2/");
+		CSC_SamplingAllocatorWriteNumber(&writer, pThis->sampleRate, (CSC_SIZE_T)10);
+		CSC_SamplingAllocatorWriteString(&writer, "\n");
+	}
+
+	for (iterator = (CSC_SIZE_T)0; iterator < pThis->maxSamples && writer.status == CSC_STATUS_SUCCESS; ++iterator)
+	{
+		if (!CSC_SamplingAllocatorCopySample(&pThis->pSamples[iterator], &sample))
+		{
+			continue;
+		}
+
+		if (format == csc_sapf_Text)
+		{
+			CSC_SamplingAllocatorWriteString(&writer, "\n");
+			CSC_SamplingAllocatorWriteNumber(&writer, sample.size, (CSC_SIZE_T)10);
+			CSC_SamplingAllocatorWriteString(&writer, " bytes at ");
+			CSC_SamplingAllocatorWriteNumber(&writer, sample.block, (CSC_SIZE_T)16);
+			CSC_SamplingAllocatorWriteString(&writer, "\n");
+			CSC_SamplingAllocatorFlush(&writer);
+
+			backtrace_symbols_fd(sample.pFrames, (int)sample.frameCount, fileDescriptor);
+		}
+		else
+		{
+			CSC_SamplingAllocatorWriteString(&writer, "1: ");
+			CSC_SamplingAllocatorWriteNumber(&writer, sample.size, (CSC_SIZE_T)10);
+			CSC_SamplingAllocatorWriteString(&writer, " [1: ");
+			CSC_SamplingAllocatorWriteNumber(&writer, sample.size, (CSC_SIZE_T)10);
+			CSC_SamplingAllocatorWriteString(&writer, "] @");
+
+			for (frame = (CSC_SIZE_T)0; frame < sample.frameCount; ++frame)
+			{
+				CSC_SamplingAllocatorWriteString(&writer, " ");
+				CSC_SamplingAllocatorWriteNumber(&writer, (CSC_SIZE_T)(CSC_DATA_POINTER_TYPE)sample.pFrames[frame], (CSC_SIZE_T)16);
+			}
+
+			CSC_SamplingAllocatorWriteString(&writer, "\n");
+		}
+	}
+
+	if (format == csc_sapf_Pprof)
+	{
+		CSC_SamplingAllocatorWriteString(&writer, "\nMAPPED_LIBRARIES:\n");
+		CSC_SamplingAllocatorWriteMappings(&writer);
+	}
+
+	CSC_SamplingAllocatorFlush(&writer);
+
+	return writer.status;
+}
+
+
+CSC_SIZE_T CSCMETHOD CSC_SamplingAllocatorGetSampleRate(_In_ CONST CSC_SamplingAllocator* CONST pThis)
+{
+	if (!CSC_SamplingAllocatorIsValid(pThis))
+	{
+		return (CSC_SIZE_T)0;
+	}
+
+	return pThis->sampleRate;
+}
+
+CSC_SIZE_T CSCMETHOD CSC_SamplingAllocatorGetLiveSampleCount(_In_ CONST CSC_SamplingAllocator* CONST pThis)
+{
+	if (!CSC_SamplingAllocatorIsValid(pThis))
+	{
+		return (CSC_SIZE_T)0;
+	}
+
+	return CSC_ATOMIC_LOAD(&pThis->liveSampleCount);
+}
+
+CSC_SIZE_T CSCMETHOD CSC_SamplingAllocatorGetTotalSampleCount(_In_ CONST CSC_SamplingAllocator* CONST pThis)
+{
+	if (!CSC_SamplingAllocatorIsValid(pThis))
+	{
+		return (CSC_SIZE_T)0;
+	}
+
+	return CSC_ATOMIC_LOAD(&pThis->totalSampleCount);
+}
+
+CSC_SIZE_T CSCMETHOD CSC_SamplingAllocatorGetDroppedSampleCount(_In_ CONST CSC_SamplingAllocator* CONST pThis)
+{
+	if (!CSC_SamplingAllocatorIsValid(pThis))
+	{
+		return (CSC_SIZE_T)0;
+	}
+
+	return CSC_ATOMIC_LOAD(&pThis->droppedSampleCount);
+}
+
+CSC_IBaseInterface* CSCMETHOD CSC_SamplingAllocatorGetIBaseInterface(_In_ CONST CSC_SamplingAllocator* CONST pThis)
+{
+	if (!CSC_SamplingAllocatorIsValid(pThis))
+	{
+		return (CSC_IBaseInterface*)NULL;
+	}
+
+	return (CSC_IBaseInterface*)&pThis->baseInterface;
+}
+
+CSC_IAllocator* CSCMETHOD CSC_SamplingAllocatorGetIAllocator(_In_ CONST CSC_SamplingAllocator* CONST pThis)
+{
+	if (!CSC_SamplingAllocatorIsValid(pThis))
+	{
+		return (CSC_IAllocator*)NULL;
+	}
+
+	return (CSC_IAllocator*)&pThis->allocatorInterface;
+}
+
+CSC_IAllocator* CSCMETHOD CSC_SamplingAllocatorGetParentAllocator(_In_ CONST CSC_SamplingAllocator* CONST pThis)
+{
+	if (!CSC_SamplingAllocatorIsValid(pThis))
+	{
+		return (CSC_IAllocator*)NULL;
+	}
+
+	return pThis->pParentAllocator;
+}
+
+#endif
\ No newline at end of file
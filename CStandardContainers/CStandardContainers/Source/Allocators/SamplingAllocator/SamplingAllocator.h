@@ -0,0 +1,98 @@
+#ifndef CSC_SAMPLING_ALLOCATOR
+#define CSC_SAMPLING_ALLOCATOR
+
+/*
+Description:
+The SamplingAllocator is a decorator that implements the IAllocator interface on top of an arbitrary parent allocator to find the call sites that leak or hoard memory in long running processes.
+Instead of tracing every request, the allocator samples roughly one allocation per sample rate bytes and records the call stack of the sampled allocations.
+The distance between two samples is drawn from an exponential distribution (a Poisson process over the allocated bytes), hence every byte has the same chance to be sampled and large allocations are sampled more likely than small ones.
+Samples of blocks that are still allocated are kept in a lock-free table of fixed capacity, a sample is removed as soon as it's block is freed, samples are dropped while the table is full.
+The live samples can be written as a heap profile to a file descriptor at any time and are written to the dump file descriptor when the allocator is cleaned up, which reports the blocks that have never been freed.
+Profiles are either written as text with symbolized call stacks or in the legacy heap profile format that is understood by pprof, which scales the samples back to the estimated amount of allocated bytes.
+To find the sample of a block when it is freed, every block is preceded by a header of CSC_SAMPLING_ALLOCATOR_HEADER_SIZE bytes, which keeps the alignment guaranteed by the parent allocator for up to that many bytes.
+The allocator can be shared between threads if the parent allocator supports it and the configuration supports atomic operations (CSC_ATOMICS_SUPPORTED).
+The allocator relies on the backtrace functions of the C library and is only available in the Linux native configuration.
+*/
+
+// Include the current configuration of the library containing various type definitions and other things.
+#include "../../Configuration/Configuration.h"
+
+#ifdef CSC_CONFIG_LINUX_NATIVE
+
+// Include the IBaseInterface as the allocator can be queried for the interfaces it implements.
+#include "../../Interfaces/IBaseInterface.h"
+// Include the IAllocator interface as the allocator implements it and wraps another allocator implementing it.
+#include "../../Interfaces/IAllocator.h"
+
+// Definition of the maximum amount of frames that are recorded per sample.
+#define CSC_SAMPLING_ALLOCATOR_MAX_FRAMES (CSC_SIZE_T)0x20
+// Definition of the average amount of bytes between two samples that is used if no other value is supplied.
+#define CSC_SAMPLING_ALLOCATOR_DEFAULT_SAMPLE_RATE (CSC_SIZE_T)0x80000
+// Definition of the capacity of the sample table that is used if no other value is supplied.
+#define CSC_SAMPLING_ALLOCATOR_DEFAULT_MAX_SAMPLES (CSC_SIZE_T)0x1000
+// Definition of the size of the header that precedes every allocated block.
+#define CSC_SAMPLING_ALLOCATOR_HEADER_SIZE (sizeof(CSC_SIZE_T) * (CSC_SIZE_T)2)
+// Definition of the dump file descriptor that disables the dump during the cleanup.
+#define CSC_SAMPLING_ALLOCATOR_NO_DUMP -1
+
+// Definition of the formats a heap profile can be written in.
+typedef enum _ESamplingAllocatorProfileFormat
+{
+	csc_sapf_Text = 0,
+	csc_sapf_Pprof
+} ESamplingAllocatorProfileFormat;
+
+// Definition of an entry of the sample table.
+// The block member is 0 for unused entries, 1 while an entry is being filled and the address of the sampled block otherwise.
+typedef struct _CSC_SamplingAllocatorSample
+{
+	CSC_ATOMIC CSC_SIZE_T block;
+	CSC_SIZE_T size;
+	CSC_SIZE_T frameCount;
+	CSC_PVOID pFrames[CSC_SAMPLING_ALLOCATOR_MAX_FRAMES];
+} CSC_SamplingAllocatorSample;
+
+typedef struct _CSC_SamplingAllocator
+{
+	CSC_IBaseInterface baseInterface;
+	CSC_IAllocator allocatorInterface;
+	CSC_IAllocator* pParentAllocator;
+	CSC_SamplingAllocatorSample* pSamples;
+	CSC_SIZE_T maxSamples;
+	CSC_SIZE_T sampleRate;
+	int dumpFileDescriptor;
+	ESamplingAllocatorProfileFormat dumpFormat;
+	CSC_ATOMIC CSC_SIZE_T allocatedBytes;
+	CSC_ATOMIC CSC_SIZE_T nextSample;
+	CSC_ATOMIC CSC_SIZE_T randomState;
+	CSC_ATOMIC CSC_SIZE_T liveSampleCount;
+	CSC_ATOMIC CSC_SIZE_T totalSampleCount;
+	CSC_ATOMIC CSC_SIZE_T droppedSampleCount;
+} CSC_SamplingAllocator;
+
+// Initializes the allocator as a decorator of the given parent allocator, which must be usable and outlive the decorator.
+// A sampleRate of 0 uses CSC_SAMPLING_ALLOCATOR_DEFAULT_SAMPLE_RATE, maxSamples is rounded up to a power of two and a value of 0 uses CSC_SAMPLING_ALLOCATOR_DEFAULT_MAX_SAMPLES.
+// The live samples are written in the given format to dumpFileDescriptor when the allocator is cleaned up, unless it is CSC_SAMPLING_ALLOCATOR_NO_DUMP.
+// Returns CSC_STATUS_SUCCESS on success, otherwise an error code is returned.
+CSC_STATUS CSCMETHOD CSC_SamplingAllocatorInitialize(_Out_ CSC_SamplingAllocator* CONST pThis, _In_ CSC_IAllocator* CONST pParentAllocator, _In_ CONST CSC_SIZE_T sampleRate, _In_ CONST CSC_SIZE_T maxSamples, _In_ CONST int dumpFileDescriptor, _In_ CONST ESamplingAllocatorProfileFormat dumpFormat);
+// Writes the live samples to the dump file descriptor, returns the sample table to the parent allocator and zeroes out the object.
+// Blocks that are still allocated must not be freed through the decorator anymore.
+// Returns CSC_STATUS_SUCCESS on success, otherwise an error code is returned.
+CSC_STATUS CSCMETHOD CSC_SamplingAllocatorDestroy(_Inout_ CSC_SamplingAllocator* CONST pThis);
+
+// Writes a heap profile of the live samples in the given format to a file descriptor.
+// Samples that are added or removed by other threads during the operation may or may not be part of the profile.
+// Returns CSC_STATUS_SUCCESS on success, otherwise an error code is returned.
+CSC_STATUS CSCMETHOD CSC_SamplingAllocatorDumpProfile(_In_ CONST CSC_SamplingAllocator* CONST pThis, _In_ CONST int fileDescriptor, _In_ CONST ESamplingAllocatorProfileFormat format);
+
+CSC_SIZE_T CSCMETHOD CSC_SamplingAllocatorGetSampleRate(_In_ CONST CSC_SamplingAllocator* CONST pThis);
+CSC_SIZE_T CSCMETHOD CSC_SamplingAllocatorGetLiveSampleCount(_In_ CONST CSC_SamplingAllocator* CONST pThis);
+CSC_SIZE_T CSCMETHOD CSC_SamplingAllocatorGetTotalSampleCount(_In_ CONST CSC_SamplingAllocator* CONST pThis);
+CSC_SIZE_T CSCMETHOD CSC_SamplingAllocatorGetDroppedSampleCount(_In_ CONST CSC_SamplingAllocator* CONST pThis);
+CSC_IBaseInterface* CSCMETHOD CSC_SamplingAllocatorGetIBaseInterface(_In_ CONST CSC_SamplingAllocator* CONST pThis);
+CSC_IAllocator* CSCMETHOD CSC_SamplingAllocatorGetIAllocator(_In_ CONST CSC_SamplingAllocator* CONST pThis);
+CSC_IAllocator* CSCMETHOD CSC_SamplingAllocatorGetParentAllocator(_In_ CONST CSC_SamplingAllocator* CONST pThis);
+
+#endif
+
+#endif
\ No newline at end of file
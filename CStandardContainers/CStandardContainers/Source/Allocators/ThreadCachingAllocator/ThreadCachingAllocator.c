@@ -0,0 +1,778 @@
+#include "ThreadCachingAllocator.h"
+
+#ifdef CSC_CONFIG_LINUX_NATIVE
+
+#include "../../Utils/MemoryUtils.h"
+
+// Definition of the amount of small size classes that are spaced 16 bytes apart.
+#define CSC_THREAD_CACHING_ALLOCATOR_LINEAR_CLASS_COUNT (CSC_SIZE_T)16
+// Definition of the size of the first power of two size class.
+#define CSC_THREAD_CACHING_ALLOCATOR_FIRST_POWER_CLASS_SIZE (CSC_SIZE_T)0x200
+// Definition of the size a span should not exceed, limits the batch size of the larger size classes.
+#define CSC_THREAD_CACHING_ALLOCATOR_MAX_SPAN_SIZE (CSC_SIZE_T)0x40000
+
+// Definition of the header that precedes every block handed out by the allocator.
+// For small blocks the size is the size of the size class and the owner is the thread cache that handed the block out.
+// For large blocks the size is the requested size and the owner is a null pointer.
+typedef struct _CSC_ThreadCachingAllocatorBlockHeader
+{
+	CSC_SIZE_T size;
+	CSC_ThreadCachingAllocatorThreadCache* pOwnerCache;
+} CSC_ThreadCachingAllocatorBlockHeader;
+
+// Definition of the header that precedes every span requested from the parent allocator.
+typedef struct _CSC_ThreadCachingAllocatorSpanHeader
+{
+	CSC_PVOID pNextSpan;
+	CSC_SIZE_T size;
+} CSC_ThreadCachingAllocatorSpanHeader;
+
+static CSC_PCVOID CSCMETHOD CSC_ThreadCachingAllocatorGetInterface(_In_ CONST CSC_IBaseInterface* CONST pThis, _In_ CONST EBaseInterfaceType interfaceType);
+
+static CSC_STATUS CSCMETHOD CSC_ThreadCachingAllocatorInit(_Inout_ CSC_IAllocator* CONST pThis);
+static CSC_STATUS CSCMETHOD CSC_ThreadCachingAllocatorCleanup(_Inout_ CSC_IAllocator* CONST pThis);
+static CSC_PVOID CSCMETHOD CSC_ThreadCachingAllocatorAlloc(_In_ CONST CSC_IAllocator* CONST pThis, _In_ CONST CSC_SIZE_T size);
+static CSC_PVOID CSCMETHOD CSC_ThreadCachingAllocatorAllocZero(_In_ CONST CSC_IAllocator* CONST pThis, _In_ CONST CSC_SIZE_T size);
+static CSC_STATUS CSCMETHOD CSC_ThreadCachingAllocatorFree(_In_ CONST CSC_IAllocator* CONST pThis, _In_ CONST CSC_PVOID pMemoryBlock);
+static CSC_BOOLEAN CSCMETHOD CSC_ThreadCachingAllocatorIsUsable(_In_ CONST CSC_IAllocator* CONST pThis);
+static CSC_STATUS CSCMETHOD CSC_ThreadCachingAllocatorAllocBatch(_In_ CONST CSC_IAllocator* CONST pThis, _In_ CONST CSC_SIZE_T size, _In_ CONST CSC_SIZE_T count, _Out_ CSC_PVOID* CONST ppMemoryBlocks);
+static CSC_STATUS CSCMETHOD CSC_ThreadCachingAllocatorFreeBatch(_In_ CONST CSC_IAllocator* CONST pThis, _In_ CSC_PVOID* CONST ppMemoryBlocks, _In_ CONST CSC_SIZE_T count);
+static CSC_SIZE_T CSCMETHOD CSC_ThreadCachingAllocatorGetUsableSize(_In_ CONST CSC_IAllocator* CONST pThis, _In_ CONST CSC_PCVOID pMemoryBlock);
+
+static CSC_IBaseInterfaceVirtualTable g_ThreadCachingAllocatorBaseInterfaceVTable =
+{
+	CSC_ThreadCachingAllocatorGetInterface
+};
+
+static CSC_IAllocatorVirtualTable g_ThreadCachingAllocatorAllocatorVTable =
+{
+	CSC_ThreadCachingAllocatorInit,
+	CSC_ThreadCachingAllocatorCleanup,
+	CSC_ThreadCachingAllocatorAlloc,
+	CSC_ThreadCachingAllocatorAllocZero,
+	CSC_ThreadCachingAllocatorFree,
+	CSC_ThreadCachingAllocatorIsUsable,
+	NULL,
+	CSC_ThreadCachingAllocatorAllocBatch,
+	CSC_ThreadCachingAllocatorFreeBatch,
+	CSC_ThreadCachingAllocatorGetUsableSize
+};
+
+
+static CSC_BOOLEAN CSCMETHOD CSC_ThreadCachingAllocatorIsValid(_In_ CONST CSC_ThreadCachingAllocator* CONST pThis)
+{
+	if (!pThis || pThis->baseInterface.pIBaseInterfaceVirtualTable != &g_ThreadCachingAllocatorBaseInterfaceVTable || pThis->allocatorInterface.pIAllocatorVirtualTable != &g_ThreadCachingAllocatorAllocatorVTable || !pThis->pParentAllocator || !pThis->batchSize)
+	{
+		return (CSC_BOOLEAN)FALSE;
+	}
+
+	return (CSC_BOOLEAN)TRUE;
+}
+
+static CSC_ThreadCachingAllocatorBlockHeader* CSCMETHOD CSC_ThreadCachingAllocatorGetHeader(_In_ CONST CSC_PCVOID pMemoryBlock)
+{
+	return (CSC_ThreadCachingAllocatorBlockHeader*)((CONST CSC_BYTE*)pMemoryBlock - CSC_THREAD_CACHING_ALLOCATOR_HEADER_SIZE);
+}
+
+static CSC_SIZE_T CSCMETHOD CSC_ThreadCachingAllocatorGetClassIndex(_In_ CONST CSC_SIZE_T size)
+{
+	CSC_SIZE_T classIndex = CSC_THREAD_CACHING_ALLOCATOR_LINEAR_CLASS_COUNT;
+	CSC_SIZE_T classSize = CSC_THREAD_CACHING_ALLOCATOR_FIRST_POWER_CLASS_SIZE;
+
+	if (size <= (CSC_THREAD_CACHING_ALLOCATOR_LINEAR_CLASS_COUNT << 4))
+	{
+		return (size - (CSC_SIZE_T)1) >> 4;
+	}
+
+	while (classSize < size)
+	{
+		classSize <<= 1;
+		++classIndex;
+	}
+
+	return classIndex;
+}
+
+static CSC_SIZE_T CSCMETHOD CSC_ThreadCachingAllocatorGetClassSize(_In_ CONST CSC_SIZE_T classIndex)
+{
+	if (classIndex < CSC_THREAD_CACHING_ALLOCATOR_LINEAR_CLASS_COUNT)
+	{
+		return (classIndex + (CSC_SIZE_T)1) << 4;
+	}
+
+	return CSC_THREAD_CACHING_ALLOCATOR_FIRST_POWER_CLASS_SIZE << (classIndex - CSC_THREAD_CACHING_ALLOCATOR_LINEAR_CLASS_COUNT);
+}
+
+static CSC_SIZE_T CSCMETHOD CSC_ThreadCachingAllocatorGetBatchCount(_In_ CONST CSC_ThreadCachingAllocator* CONST pThis, _In_ CONST CSC_SIZE_T classIndex)
+{
+	CONST CSC_SIZE_T blockStride = CSC_ThreadCachingAllocatorGetClassSize(classIndex) + CSC_THREAD_CACHING_ALLOCATOR_HEADER_SIZE;
+	CONST CSC_SIZE_T maxBatchCount = CSC_THREAD_CACHING_ALLOCATOR_MAX_SPAN_SIZE / blockStride;
+
+	if (!maxBatchCount)
+	{
+		return (CSC_SIZE_T)1;
+	}
+
+	return (pThis->batchSize < maxBatchCount) ? pThis->batchSize : maxBatchCount;
+}
+
+static void CSCMETHOD CSC_ThreadCachingAllocatorPushLocal(_Inout_ CSC_ThreadCachingAllocatorThreadCache* CONST pCache, _In_ CONST CSC_SIZE_T classIndex, _In_ CONST CSC_PVOID pMemoryBlock)
+{
+	*(CSC_PVOID*)pMemoryBlock = pCache->pFreeLists[classIndex];
+	pCache->pFreeLists[classIndex] = pMemoryBlock;
+	++pCache->freeCounts[classIndex];
+}
+
+static void CSCMETHOD CSC_ThreadCachingAllocatorDrainRemoteFrees(_Inout_ CSC_ThreadCachingAllocatorThreadCache* CONST pCache)
+{
+	CSC_SIZE_T remoteFreeList = CSC_ATOMIC_LOAD(&pCache->remoteFreeList);
+	CSC_PVOID pMemoryBlock;
+
+	if (!remoteFreeList)
+	{
+		return;
+	}
+
+	// Only the owner detaches the queue, and it always detaches the whole queue, hence the exchange is not subject to the ABA problem.
+	while (!CSC_ATOMIC_COMPARE_EXCHANGE(&pCache->remoteFreeList, &remoteFreeList, (CSC_SIZE_T)0))
+	{
+	}
+
+	while (remoteFreeList)
+	{
+		pMemoryBlock = (CSC_PVOID)remoteFreeList;
+		remoteFreeList = (CSC_SIZE_T)*(CSC_PVOID*)pMemoryBlock;
+
+		CSC_ThreadCachingAllocatorPushLocal(pCache, CSC_ThreadCachingAllocatorGetClassIndex(CSC_ThreadCachingAllocatorGetHeader(pMemoryBlock)->size), pMemoryBlock);
+	}
+}
+
+static void CSCMETHOD CSC_ThreadCachingAllocatorFlushClass(_Inout_ CSC_ThreadCachingAllocator* CONST pThis, _Inout_ CSC_ThreadCachingAllocatorThreadCache* CONST pCache, _In_ CONST CSC_SIZE_T classIndex, _In_ CONST CSC_SIZE_T blockCount)
+{
+	CSC_ThreadCachingAllocatorCentralList* CONST pCentralList = &pThis->centralLists[classIndex];
+	CSC_PVOID pFirstBlock = pCache->pFreeLists[classIndex];
+	CSC_PVOID pLastBlock = pFirstBlock;
+	CSC_SIZE_T iterator;
+
+	if (!blockCount || !pFirstBlock)
+	{
+		return;
+	}
+
+	// Detach the chain locally, so that the central lock is only held for the splice.
+	for (iterator = (CSC_SIZE_T)1; iterator < blockCount && *(CSC_PVOID*)pLastBlock; ++iterator)
+	{
+		pLastBlock = *(CSC_PVOID*)pLastBlock;
+	}
+
+	pCache->pFreeLists[classIndex] = *(CSC_PVOID*)pLastBlock;
+	pCache->freeCounts[classIndex] -= iterator;
+
+	pthread_mutex_lock(&pCentralList->lock);
+
+	*(CSC_PVOID*)pLastBlock = pCentralList->pFirstBlock;
+	pCentralList->pFirstBlock = pFirstBlock;
+	pCentralList->blockCount += iterator;
+
+	pthread_mutex_unlock(&pCentralList->lock);
+}
+
+static void CSCMETHOD CSC_ThreadCachingAllocatorFlushCache(_Inout_ CSC_ThreadCachingAllocator* CONST pThis, _Inout_ CSC_ThreadCachingAllocatorThreadCache* CONST pCache)
+{
+	CSC_SIZE_T classIndex;
+
+	CSC_ThreadCachingAllocatorDrainRemoteFrees(pCache);
+
+	for (classIndex = (CSC_SIZE_T)0; classIndex < CSC_THREAD_CACHING_ALLOCATOR_SIZE_CLASS_COUNT; ++classIndex)
+	{
+		CSC_ThreadCachingAllocatorFlushClass(pThis, pCache, classIndex, pCache->freeCounts[classIndex]);
+	}
+}
+
+static void CSC_ThreadCachingAllocatorReleaseThreadCache(void* pContext)
+{
+	CSC_ThreadCachingAllocatorThreadCache* CONST pCache = (CSC_ThreadCachingAllocatorThreadCache*)pContext;
+
+	// Called on thread exit, the cache stays linked to the allocator and is adopted by the next thread that needs a cache.
+	CSC_ThreadCachingAllocatorFlushCache(pCache->pAllocator, pCache);
+	CSC_ATOMIC_STORE(&pCache->isActive, (CSC_SIZE_T)0);
+}
+
+static CSC_ThreadCachingAllocatorThreadCache* CSCMETHOD CSC_ThreadCachingAllocatorAcquireThreadCache(_Inout_ CSC_ThreadCachingAllocator* CONST pThis)
+{
+	CSC_ThreadCachingAllocatorThreadCache* pCache = (CSC_ThreadCachingAllocatorThreadCache*)pthread_getspecific(pThis->threadCacheKey);
+
+	if (pCache)
+	{
+		return pCache;
+	}
+
+	pthread_mutex_lock(&pThis->lock);
+
+	for (pCache = pThis->pFirstCache; pCache; pCache = pCache->pNextCache)
+	{
+		if (!CSC_ATOMIC_LOAD(&pCache->isActive))
+		{
+			break;
+		}
+	}
+
+	if (!pCache)
+	{
+		pCache = (CSC_ThreadCachingAllocatorThreadCache*)CSC_IAllocatorAllocZero(pThis->pParentAllocator, sizeof(CSC_ThreadCachingAllocatorThreadCache));
+
+		if (!pCache)
+		{
+			pthread_mutex_unlock(&pThis->lock);
+			return NULL;
+		}
+
+		pCache->pAllocator = pThis;
+		pCache->pNextCache = pThis->pFirstCache;
+		pThis->pFirstCache = pCache;
+	}
+
+	CSC_ATOMIC_STORE(&pCache->isActive, (CSC_SIZE_T)1);
+
+	pthread_mutex_unlock(&pThis->lock);
+
+	if (pthread_setspecific(pThis->threadCacheKey, (CONST void*)pCache))
+	{
+		CSC_ATOMIC_STORE(&pCache->isActive, (CSC_SIZE_T)0);
+		return NULL;
+	}
+
+	return pCache;
+}
+
+static CSC_BOOLEAN CSCMETHOD CSC_ThreadCachingAllocatorAllocateSpan(_Inout_ CSC_ThreadCachingAllocator* CONST pThis, _Inout_ CSC_ThreadCachingAllocatorThreadCache* CONST pCache, _In_ CONST CSC_SIZE_T classIndex, _In_ CONST CSC_SIZE_T blockCount)
+{
+	CONST CSC_SIZE_T classSize = CSC_ThreadCachingAllocatorGetClassSize(classIndex);
+	CONST CSC_SIZE_T blockStride = classSize + CSC_THREAD_CACHING_ALLOCATOR_HEADER_SIZE;
+	CONST CSC_SIZE_T spanSize = CSC_THREAD_CACHING_ALLOCATOR_HEADER_SIZE + blockStride * blockCount;
+	CSC_ThreadCachingAllocatorSpanHeader* pSpan;
+	CSC_ThreadCachingAllocatorBlockHeader* pHeader;
+	CSC_SIZE_T iterator;
+
+	pSpan = (CSC_ThreadCachingAllocatorSpanHeader*)CSC_IAllocatorAlloc(pThis->pParentAllocator, spanSize);
+
+	if (!pSpan)
+	{
+		return (CSC_BOOLEAN)FALSE;
+	}
+
+	pSpan->size = spanSize;
+
+	pthread_mutex_lock(&pThis->lock);
+
+	pSpan->pNextSpan = pThis->pFirstSpan;
+	pThis->pFirstSpan = (CSC_PVOID)pSpan;
+
+	pthread_mutex_unlock(&pThis->lock);
+
+	CSC_ATOMIC_FETCH_ADD(&pThis->spanBytes, spanSize);
+
+	// Push the blocks in reverse order, so that they are handed out in ascending address order.
+	for (iterator = blockCount; iterator; --iterator)
+	{
+		pHeader = (CSC_ThreadCachingAllocatorBlockHeader*)((CSC_BYTE*)pSpan + CSC_THREAD_CACHING_ALLOCATOR_HEADER_SIZE + (iterator - (CSC_SIZE_T)1) * blockStride);
+		pHeader->size = classSize;
+		pHeader->pOwnerCache = pCache;
+
+		CSC_ThreadCachingAllocatorPushLocal(pCache, classIndex, (CSC_PVOID)((CSC_BYTE*)pHeader + CSC_THREAD_CACHING_ALLOCATOR_HEADER_SIZE));
+	}
+
+	return (CSC_BOOLEAN)TRUE;
+}
+
+static CSC_BOOLEAN CSCMETHOD CSC_ThreadCachingAllocatorRefill(_Inout_ CSC_ThreadCachingAllocator* CONST pThis, _Inout_ CSC_ThreadCachingAllocatorThreadCache* CONST pCache, _In_ CONST CSC_SIZE_T classIndex)
+{
+	CSC_ThreadCachingAllocatorCentralList* CONST pCentralList = &pThis->centralLists[classIndex];
+	CONST CSC_SIZE_T batchCount = CSC_ThreadCachingAllocatorGetBatchCount(pThis, classIndex);
+	CSC_PVOID pFirstBlock, pLastBlock;
+	CSC_SIZE_T iterator;
+
+	// Blocks freed by other threads are reclaimed first, as they don't require any locking.
+	CSC_ThreadCachingAllocatorDrainRemoteFrees(pCache);
+
+	if (pCache->pFreeLists[classIndex])
+	{
+		return (CSC_BOOLEAN)TRUE;
+	}
+
+	pthread_mutex_lock(&pCentralList->lock);
+
+	pFirstBlock = pCentralList->pFirstBlock;
+
+	if (pFirstBlock)
+	{
+		pLastBlock = pFirstBlock;
+
+		for (iterator = (CSC_SIZE_T)1; iterator < batchCount && *(CSC_PVOID*)pLastBlock; ++iterator)
+		{
+			pLastBlock = *(CSC_PVOID*)pLastBlock;
+		}
+
+		pCentralList->pFirstBlock = *(CSC_PVOID*)pLastBlock;
+		pCentralList->blockCount -= iterator;
+	}
+
+	pthread_mutex_unlock(&pCentralList->lock);
+
+	if (!pFirstBlock)
+	{
+		return CSC_ThreadCachingAllocatorAllocateSpan(pThis, pCache, classIndex, batchCount);
+	}
+
+	*(CSC_PVOID*)pLastBlock = NULL;
+	pCache->pFreeLists[classIndex] = pFirstBlock;
+	pCache->freeCounts[classIndex] = iterator;
+
+	return (CSC_BOOLEAN)TRUE;
+}
+
+static CSC_PVOID CSCMETHOD CSC_ThreadCachingAllocatorAllocate(_In_ CONST CSC_IAllocator* CONST pThis, _In_ CONST CSC_SIZE_T size, _In_ CONST CSC_BOOLEAN zeroMemory)
+{
+	CSC_ThreadCachingAllocator* CONST pAllocator = (CSC_ThreadCachingAllocator* CONST)CSC_CONTAINING_RECORD(pThis, CONST CSC_ThreadCachingAllocator, allocatorInterface);
+	CSC_ThreadCachingAllocatorThreadCache* pCache;
+	CSC_ThreadCachingAllocatorBlockHeader* pHeader;
+	CSC_PVOID pMemoryBlock;
+	CSC_SIZE_T classIndex;
+
+	if (!pThis || !size || !CSC_ThreadCachingAllocatorIsValid(pAllocator) || size > ~(CSC_SIZE_T)0 - CSC_THREAD_CACHING_ALLOCATOR_HEADER_SIZE)
+	{
+		return NULL;
+	}
+
+	if (size > CSC_THREAD_CACHING_ALLOCATOR_MAX_SMALL_SIZE)
+	{
+		if (zeroMemory)
+		{
+			pHeader = (CSC_ThreadCachingAllocatorBlockHeader*)CSC_IAllocatorAllocZero(pAllocator->pParentAllocator, size + CSC_THREAD_CACHING_ALLOCATOR_HEADER_SIZE);
+		}
+		else
+		{
+			pHeader = (CSC_ThreadCachingAllocatorBlockHeader*)CSC_IAllocatorAlloc(pAllocator->pParentAllocator, size + CSC_THREAD_CACHING_ALLOCATOR_HEADER_SIZE);
+		}
+
+		if (!pHeader)
+		{
+			return NULL;
+		}
+
+		pHeader->size = size;
+		pHeader->pOwnerCache = NULL;
+
+		return (CSC_PVOID)((CSC_BYTE*)pHeader + CSC_THREAD_CACHING_ALLOCATOR_HEADER_SIZE);
+	}
+
+	pCache = CSC_ThreadCachingAllocatorAcquireThreadCache(pAllocator);
+
+	if (!pCache)
+	{
+		return NULL;
+	}
+
+	classIndex = CSC_ThreadCachingAllocatorGetClassIndex(size);
+
+	if (!pCache->pFreeLists[classIndex] && !CSC_ThreadCachingAllocatorRefill(pAllocator, pCache, classIndex))
+	{
+		return NULL;
+	}
+
+	pMemoryBlock = pCache->pFreeLists[classIndex];
+	pCache->pFreeLists[classIndex] = *(CSC_PVOID*)pMemoryBlock;
+	--pCache->freeCounts[classIndex];
+
+	// Blocks may have been handed out by another cache before, hence the owner is updated on every allocation.
+	CSC_ThreadCachingAllocatorGetHeader(pMemoryBlock)->pOwnerCache = pCache;
+
+	if (zeroMemory)
+	{
+		CSC_MemoryUtilsSetZeroMemory(pMemoryBlock, size);
+	}
+
+	return pMemoryBlock;
+}
+
+static CSC_STATUS CSCMETHOD CSC_ThreadCachingAllocatorFreeBlock(_Inout_ CSC_ThreadCachingAllocator* CONST pThis, _In_opt_ CSC_ThreadCachingAllocatorThreadCache* CONST pCurrentCache, _In_ CONST CSC_PVOID pMemoryBlock)
+{
+	CSC_ThreadCachingAllocatorBlockHeader* CONST pHeader = CSC_ThreadCachingAllocatorGetHeader(pMemoryBlock);
+	CSC_ThreadCachingAllocatorThreadCache* CONST pOwnerCache = pHeader->pOwnerCache;
+	CSC_SIZE_T classIndex, batchCount, remoteFreeList;
+
+	if (!pOwnerCache)
+	{
+		return CSC_IAllocatorFreeSized(pThis->pParentAllocator, (CSC_PVOID)pHeader, pHeader->size + CSC_THREAD_CACHING_ALLOCATOR_HEADER_SIZE);
+	}
+
+	if (!pHeader->size || pHeader->size > CSC_THREAD_CACHING_ALLOCATOR_MAX_SMALL_SIZE || pOwnerCache->pAllocator != pThis)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	classIndex = CSC_ThreadCachingAllocatorGetClassIndex(pHeader->size);
+
+	if (pOwnerCache == pCurrentCache)
+	{
+		CSC_ThreadCachingAllocatorPushLocal(pOwnerCache, classIndex, pMemoryBlock);
+
+		// Keep up to two batches cached, so that alternating allocations and frees don't move the same batch back and forth.
+		batchCount = CSC_ThreadCachingAllocatorGetBatchCount(pThis, classIndex);
+
+		if (pOwnerCache->freeCounts[classIndex] > batchCount * (CSC_SIZE_T)2)
+		{
+			CSC_ThreadCachingAllocatorFlushClass(pThis, pOwnerCache, classIndex, batchCount);
+		}
+
+		return CSC_STATUS_SUCCESS;
+	}
+
+	// The block belongs to another thread, push it onto the remote free queue of it's owner.
+	remoteFreeList = CSC_ATOMIC_LOAD(&pOwnerCache->remoteFreeList);
+
+	do
+	{
+		*(CSC_PVOID*)pMemoryBlock = (CSC_PVOID)remoteFreeList;
+	} while (!CSC_ATOMIC_COMPARE_EXCHANGE(&pOwnerCache->remoteFreeList, &remoteFreeList, (CSC_SIZE_T)pMemoryBlock));
+
+	CSC_ATOMIC_FETCH_ADD(&pThis->remoteFreeCount, (CSC_SIZE_T)1);
+
+	return CSC_STATUS_SUCCESS;
+}
+
+
+static CSC_PCVOID CSCMETHOD CSC_ThreadCachingAllocatorGetInterface(_In_ CONST CSC_IBaseInterface* CONST pThis, _In_ CONST EBaseInterfaceType interfaceType)
+{
+	CONST CSC_ThreadCachingAllocator* CONST pAllocator = (CONST CSC_ThreadCachingAllocator* CONST)pThis;
+
+	if (!pThis)
+	{
+		return NULL;
+	}
+
+	switch (interfaceType)
+	{
+	case csc_bit_IAllocator:
+
+		return (CSC_PCVOID)&pAllocator->allocatorInterface;
+
+	default:
+
+		return NULL;
+	}
+}
+
+static CSC_STATUS CSCMETHOD CSC_ThreadCachingAllocatorInit(_Inout_ CSC_IAllocator* CONST pThis)
+{
+	if (!pThis || !CSC_ThreadCachingAllocatorIsValid(CSC_CONTAINING_RECORD(pThis, CSC_ThreadCachingAllocator, allocatorInterface)))
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	return CSC_STATUS_SUCCESS;
+}
+
+static CSC_STATUS CSCMETHOD CSC_ThreadCachingAllocatorCleanup(_Inout_ CSC_IAllocator* CONST pThis)
+{
+	if (!pThis)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	return CSC_ThreadCachingAllocatorDestroy(CSC_CONTAINING_RECORD(pThis, CSC_ThreadCachingAllocator, allocatorInterface));
+}
+
+static CSC_PVOID CSCMETHOD CSC_ThreadCachingAllocatorAlloc(_In_ CONST CSC_IAllocator* CONST pThis, _In_ CONST CSC_SIZE_T size)
+{
+	return CSC_ThreadCachingAllocatorAllocate(pThis, size, (CSC_BOOLEAN)FALSE);
+}
+
+static CSC_PVOID CSCMETHOD CSC_ThreadCachingAllocatorAllocZero(_In_ CONST CSC_IAllocator* CONST pThis, _In_ CONST CSC_SIZE_T size)
+{
+	return CSC_ThreadCachingAllocatorAllocate(pThis, size, (CSC_BOOLEAN)TRUE);
+}
+
+static CSC_STATUS CSCMETHOD CSC_ThreadCachingAllocatorFree(_In_ CONST CSC_IAllocator* CONST pThis, _In_ CONST CSC_PVOID pMemoryBlock)
+{
+	CSC_ThreadCachingAllocator* CONST pAllocator = (CSC_ThreadCachingAllocator* CONST)CSC_CONTAINING_RECORD(pThis, CONST CSC_ThreadCachingAllocator, allocatorInterface);
+
+	if (!pThis || !pMemoryBlock || !CSC_ThreadCachingAllocatorIsValid(pAllocator))
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	return CSC_ThreadCachingAllocatorFreeBlock(pAllocator, (CSC_ThreadCachingAllocatorThreadCache*)pthread_getspecific(pAllocator->threadCacheKey), pMemoryBlock);
+}
+
+static CSC_BOOLEAN CSCMETHOD CSC_ThreadCachingAllocatorIsUsable(_In_ CONST CSC_IAllocator* CONST pThis)
+{
+	CONST CSC_ThreadCachingAllocator* CONST pAllocator = CSC_CONTAINING_RECORD(pThis, CONST CSC_ThreadCachingAllocator, allocatorInterface);
+
+	if (!pThis || !CSC_ThreadCachingAllocatorIsValid(pAllocator))
+	{
+		return (CSC_BOOLEAN)FALSE;
+	}
+
+	return CSC_IAllocatorIsUsable(pAllocator->pParentAllocator);
+}
+
+static CSC_STATUS CSCMETHOD CSC_ThreadCachingAllocatorAllocBatch(_In_ CONST CSC_IAllocator* CONST pThis, _In_ CONST CSC_SIZE_T size, _In_ CONST CSC_SIZE_T count, _Out_ CSC_PVOID* CONST ppMemoryBlocks)
+{
+	CSC_ThreadCachingAllocator* CONST pAllocator = (CSC_ThreadCachingAllocator* CONST)CSC_CONTAINING_RECORD(pThis, CONST CSC_ThreadCachingAllocator, allocatorInterface);
+	CSC_ThreadCachingAllocatorThreadCache* pCache;
+	CSC_SIZE_T iterator, classIndex;
+
+	if (!pThis || !size || !count || !ppMemoryBlocks || !CSC_ThreadCachingAllocatorIsValid(pAllocator))
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	pCache = CSC_ThreadCachingAllocatorAcquireThreadCache(pAllocator);
+
+	if (!pCache)
+	{
+		return CSC_STATUS_MEMORY_NOT_ALLOCATED;
+	}
+
+	classIndex = (size <= CSC_THREAD_CACHING_ALLOCATOR_MAX_SMALL_SIZE) ? CSC_ThreadCachingAllocatorGetClassIndex(size) : (CSC_SIZE_T)0;
+
+	for (iterator = (CSC_SIZE_T)0; iterator < count; ++iterator)
+	{
+		if (size > CSC_THREAD_CACHING_ALLOCATOR_MAX_SMALL_SIZE)
+		{
+			ppMemoryBlocks[iterator] = CSC_ThreadCachingAllocatorAllocate(pThis, size, (CSC_BOOLEAN)FALSE);
+		}
+		else if (pCache->pFreeLists[classIndex] || CSC_ThreadCachingAllocatorRefill(pAllocator, pCache, classIndex))
+		{
+			// The cache is looked up once for the whole batch, every block is then a plain pop from the local free list.
+			ppMemoryBlocks[iterator] = pCache->pFreeLists[classIndex];
+			pCache->pFreeLists[classIndex] = *(CSC_PVOID*)ppMemoryBlocks[iterator];
+			--pCache->freeCounts[classIndex];
+
+			CSC_ThreadCachingAllocatorGetHeader(ppMemoryBlocks[iterator])->pOwnerCache = pCache;
+		}
+		else
+		{
+			ppMemoryBlocks[iterator] = NULL;
+		}
+
+		if (!ppMemoryBlocks[iterator])
+		{
+			while (iterator)
+			{
+				--iterator;
+				CSC_ThreadCachingAllocatorFreeBlock(pAllocator, pCache, ppMemoryBlocks[iterator]);
+				ppMemoryBlocks[iterator] = NULL;
+			}
+
+			return CSC_STATUS_MEMORY_NOT_ALLOCATED;
+		}
+	}
+
+	return CSC_STATUS_SUCCESS;
+}
+
+static CSC_STATUS CSCMETHOD CSC_ThreadCachingAllocatorFreeBatch(_In_ CONST CSC_IAllocator* CONST pThis, _In_ CSC_PVOID* CONST ppMemoryBlocks, _In_ CONST CSC_SIZE_T count)
+{
+	CSC_ThreadCachingAllocator* CONST pAllocator = (CSC_ThreadCachingAllocator* CONST)CSC_CONTAINING_RECORD(pThis, CONST CSC_ThreadCachingAllocator, allocatorInterface);
+	CSC_ThreadCachingAllocatorThreadCache* pCurrentCache;
+	CSC_STATUS status, firstStatus = CSC_STATUS_SUCCESS;
+	CSC_SIZE_T iterator;
+
+	if (!pThis || !count || !ppMemoryBlocks || !CSC_ThreadCachingAllocatorIsValid(pAllocator))
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	pCurrentCache = (CSC_ThreadCachingAllocatorThreadCache*)pthread_getspecific(pAllocator->threadCacheKey);
+
+	for (iterator = (CSC_SIZE_T)0; iterator < count; ++iterator)
+	{
+		if (!ppMemoryBlocks[iterator])
+		{
+			continue;
+		}
+
+		status = CSC_ThreadCachingAllocatorFreeBlock(pAllocator, pCurrentCache, ppMemoryBlocks[iterator]);
+
+		if (status != CSC_STATUS_SUCCESS && firstStatus == CSC_STATUS_SUCCESS)
+		{
+			firstStatus = status;
+		}
+	}
+
+	return firstStatus;
+}
+
+static CSC_SIZE_T CSCMETHOD CSC_ThreadCachingAllocatorGetUsableSize(_In_ CONST CSC_IAllocator* CONST pThis, _In_ CONST CSC_PCVOID pMemoryBlock)
+{
+	CONST CSC_ThreadCachingAllocator* CONST pAllocator = CSC_CONTAINING_RECORD(pThis, CONST CSC_ThreadCachingAllocator, allocatorInterface);
+
+	if (!pThis)
+	{
+		return (CSC_SIZE_T)0;
+	}
+
+	return CSC_ThreadCachingAllocatorGetBlockSize(pAllocator, pMemoryBlock);
+}
+
+
+CSC_STATUS CSCMETHOD CSC_ThreadCachingAllocatorInitialize(_Out_ CSC_ThreadCachingAllocator* CONST pThis, _In_ CSC_IAllocator* CONST pParentAllocator, _In_ CONST CSC_SIZE_T batchSize)
+{
+	CSC_STATUS status;
+	CSC_SIZE_T classIndex;
+
+	if (!pThis || !pParentAllocator || !CSC_IAllocatorIsUsable(pParentAllocator))
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	status = CSC_MemoryUtilsSetZeroMemory((CSC_PVOID)pThis, sizeof(CSC_ThreadCachingAllocator));
+
+	if (status != CSC_STATUS_SUCCESS)
+	{
+		return status;
+	}
+
+	if (pthread_key_create(&pThis->threadCacheKey, CSC_ThreadCachingAllocatorReleaseThreadCache))
+	{
+		return CSC_STATUS_GENERAL_FAILURE;
+	}
+
+	pthread_mutex_init(&pThis->lock, NULL);
+
+	for (classIndex = (CSC_SIZE_T)0; classIndex < CSC_THREAD_CACHING_ALLOCATOR_SIZE_CLASS_COUNT; ++classIndex)
+	{
+		pthread_mutex_init(&pThis->centralLists[classIndex].lock, NULL);
+	}
+
+	pThis->baseInterface.pIBaseInterfaceVirtualTable = &g_ThreadCachingAllocatorBaseInterfaceVTable;
+	pThis->allocatorInterface.pIAllocatorVirtualTable = &g_ThreadCachingAllocatorAllocatorVTable;
+	pThis->pParentAllocator = pParentAllocator;
+	pThis->batchSize = (batchSize) ? batchSize : CSC_THREAD_CACHING_ALLOCATOR_DEFAULT_BATCH_SIZE;
+
+	return CSC_STATUS_SUCCESS;
+}
+
+CSC_STATUS CSCMETHOD CSC_ThreadCachingAllocatorDestroy(_Inout_ CSC_ThreadCachingAllocator* CONST pThis)
+{
+	CSC_ThreadCachingAllocatorThreadCache* pCache;
+	CSC_ThreadCachingAllocatorSpanHeader* pSpan;
+	CSC_SIZE_T classIndex;
+
+	if (!CSC_ThreadCachingAllocatorIsValid(pThis))
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	// Deleting the key prevents the release routine from running for threads that exit afterwards.
+	pthread_key_delete(pThis->threadCacheKey);
+
+	while (pThis->pFirstCache)
+	{
+		pCache = pThis->pFirstCache;
+		pThis->pFirstCache = pCache->pNextCache;
+
+		CSC_IAllocatorFreeSized(pThis->pParentAllocator, (CSC_PVOID)pCache, sizeof(CSC_ThreadCachingAllocatorThreadCache));
+	}
+
+	while (pThis->pFirstSpan)
+	{
+		pSpan = (CSC_ThreadCachingAllocatorSpanHeader*)pThis->pFirstSpan;
+		pThis->pFirstSpan = pSpan->pNextSpan;
+
+		CSC_IAllocatorFreeSized(pThis->pParentAllocator, (CSC_PVOID)pSpan, pSpan->size);
+	}
+
+	pthread_mutex_destroy(&pThis->lock);
+
+	for (classIndex = (CSC_SIZE_T)0; classIndex < CSC_THREAD_CACHING_ALLOCATOR_SIZE_CLASS_COUNT; ++classIndex)
+	{
+		pthread_mutex_destroy(&pThis->centralLists[classIndex].lock);
+	}
+
+	return CSC_MemoryUtilsSetZeroMemory((CSC_PVOID)pThis, sizeof(CSC_ThreadCachingAllocator));
+}
+
+
+CSC_STATUS CSCMETHOD CSC_ThreadCachingAllocatorFlushThreadCache(_In_ CONST CSC_ThreadCachingAllocator* CONST pThis)
+{
+	CSC_ThreadCachingAllocatorThreadCache* pCache;
+
+	if (!CSC_ThreadCachingAllocatorIsValid(pThis))
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	pCache = (CSC_ThreadCachingAllocatorThreadCache*)pthread_getspecific(pThis->threadCacheKey);
+
+	if (pCache)
+	{
+		CSC_ThreadCachingAllocatorFlushCache((CSC_ThreadCachingAllocator*)pThis, pCache);
+	}
+
+	return CSC_STATUS_SUCCESS;
+}
+
+CSC_SIZE_T CSCMETHOD CSC_ThreadCachingAllocatorGetBlockSize(_In_ CONST CSC_ThreadCachingAllocator* CONST pThis, _In_ CONST CSC_PCVOID pMemoryBlock)
+{
+	if (!pMemoryBlock || !CSC_ThreadCachingAllocatorIsValid(pThis))
+	{
+		return (CSC_SIZE_T)0;
+	}
+
+	return CSC_ThreadCachingAllocatorGetHeader(pMemoryBlock)->size;
+}
+
+CSC_SIZE_T CSCMETHOD CSC_ThreadCachingAllocatorGetBatchSize(_In_ CONST CSC_ThreadCachingAllocator* CONST pThis)
+{
+	if (!CSC_ThreadCachingAllocatorIsValid(pThis))
+	{
+		return (CSC_SIZE_T)0;
+	}
+
+	return pThis->batchSize;
+}
+
+CSC_SIZE_T CSCMETHOD CSC_ThreadCachingAllocatorGetSpanBytes(_In_ CONST CSC_ThreadCachingAllocator* CONST pThis)
+{
+	if (!CSC_ThreadCachingAllocatorIsValid(pThis))
+	{
+		return (CSC_SIZE_T)0;
+	}
+
+	return CSC_ATOMIC_LOAD(&pThis->spanBytes);
+}
+
+CSC_SIZE_T CSCMETHOD CSC_ThreadCachingAllocatorGetRemoteFreeCount(_In_ CONST CSC_ThreadCachingAllocator* CONST pThis)
+{
+	if (!CSC_ThreadCachingAllocatorIsValid(pThis))
+	{
+		return (CSC_SIZE_T)0;
+	}
+
+	return CSC_ATOMIC_LOAD(&pThis->remoteFreeCount);
+}
+
+CSC_IBaseInterface* CSCMETHOD CSC_ThreadCachingAllocatorGetIBaseInterface(_In_ CONST CSC_ThreadCachingAllocator* CONST pThis)
+{
+	if (!CSC_ThreadCachingAllocatorIsValid(pThis))
+	{
+		return (CSC_IBaseInterface*)NULL;
+	}
+
+	return (CSC_IBaseInterface*)&pThis->baseInterface;
+}
+
+CSC_IAllocator* CSCMETHOD CSC_ThreadCachingAllocatorGetIAllocator(_In_ CONST CSC_ThreadCachingAllocator* CONST pThis)
+{
+	if (!CSC_ThreadCachingAllocatorIsValid(pThis))
+	{
+		return (CSC_IAllocator*)NULL;
+	}
+
+	return (CSC_IAllocator*)&pThis->allocatorInterface;
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,99 @@
+#ifndef CSC_THREAD_CACHING_ALLOCATOR
+#define CSC_THREAD_CACHING_ALLOCATOR
+
+/*
+Description:
+The ThreadCachingAllocator implements the IAllocator interface on top of a parent allocator for workloads where many threads allocate and free concurrently.
+Small requests are rounded up to one of CSC_THREAD_CACHING_ALLOCATOR_SIZE_CLASS_COUNT size classes and served from a free list that is private to the calling thread, which requires no synchronization at all.
+Empty thread caches are refilled from a central pool in batches, full thread caches flush a batch back to it, hence the locks of the central pool are only taken once per batch.
+The central pool carves new blocks out of spans that are requested from the parent allocator, spans are only returned to the parent allocator when the allocator is destroyed.
+Every small block is owned by the thread cache that handed it out, blocks freed by other threads are pushed onto a lock-free remote free queue of the owning cache and reclaimed by the owner on it's next refill.
+Caches of exited threads keep their blocks in the central pool and are adopted by new threads together with their pending remote frees.
+Requests larger than CSC_THREAD_CACHING_ALLOCATOR_MAX_SMALL_SIZE are forwarded to the parent allocator, which must be thread safe if the allocator is shared between threads.
+Every block is preceded by a header of CSC_THREAD_CACHING_ALLOCATOR_HEADER_SIZE bytes, hence the alignment guaranteed by the parent allocator is kept for up to that many bytes.
+The allocator relies on POSIX threads and is only available in the Linux native configuration.
+*/
+
+// Include the current configuration of the library containing various type definitions and other things.
+#include "../../Configuration/Configuration.h"
+
+#ifdef CSC_CONFIG_LINUX_NATIVE
+
+// Include the IBaseInterface as the allocator can be queried for the interfaces it implements.
+#include "../../Interfaces/IBaseInterface.h"
+// Include the IAllocator interface as the allocator implements it and requests it's memory from another allocator implementing it.
+#include "../../Interfaces/IAllocator.h"
+
+// Include the POSIX threads header for the thread specific storage and the locks of the central pool.
+#include <pthread.h>
+
+// Definition of the amount of size classes, 16 classes in steps of 16 bytes up to 256 bytes followed by 7 power of two classes up to 32 KiB.
+#define CSC_THREAD_CACHING_ALLOCATOR_SIZE_CLASS_COUNT (CSC_SIZE_T)23
+// Definition of the largest request that is served from the size classes.
+#define CSC_THREAD_CACHING_ALLOCATOR_MAX_SMALL_SIZE (CSC_SIZE_T)0x8000
+// Definition of the size of the header that precedes every allocated block.
+#define CSC_THREAD_CACHING_ALLOCATOR_HEADER_SIZE (sizeof(CSC_SIZE_T) * (CSC_SIZE_T)2)
+// Definition of the amount of blocks that are moved between a thread cache and the central pool at once, if no other value is supplied.
+#define CSC_THREAD_CACHING_ALLOCATOR_DEFAULT_BATCH_SIZE (CSC_SIZE_T)0x20
+
+// Definition of the cache that is private to a single thread.
+// The remote free list is the only member that is accessed by other threads.
+typedef struct _CSC_ThreadCachingAllocatorThreadCache
+{
+	struct _CSC_ThreadCachingAllocator* pAllocator;
+	struct _CSC_ThreadCachingAllocatorThreadCache* pNextCache;
+	CSC_ATOMIC CSC_SIZE_T remoteFreeList;
+	CSC_ATOMIC CSC_SIZE_T isActive;
+	CSC_PVOID pFreeLists[CSC_THREAD_CACHING_ALLOCATOR_SIZE_CLASS_COUNT];
+	CSC_SIZE_T freeCounts[CSC_THREAD_CACHING_ALLOCATOR_SIZE_CLASS_COUNT];
+} CSC_ThreadCachingAllocatorThreadCache;
+
+// Definition of a free list of the central pool, which is shared between all threads.
+typedef struct _CSC_ThreadCachingAllocatorCentralList
+{
+	pthread_mutex_t lock;
+	CSC_PVOID pFirstBlock;
+	CSC_SIZE_T blockCount;
+} CSC_ThreadCachingAllocatorCentralList;
+
+typedef struct _CSC_ThreadCachingAllocator
+{
+	CSC_IBaseInterface baseInterface;
+	CSC_IAllocator allocatorInterface;
+	CSC_IAllocator* pParentAllocator;
+	CSC_SIZE_T batchSize;
+	pthread_key_t threadCacheKey;
+	pthread_mutex_t lock;
+	CSC_ThreadCachingAllocatorThreadCache* pFirstCache;
+	CSC_PVOID pFirstSpan;
+	CSC_ATOMIC CSC_SIZE_T spanBytes;
+	CSC_ATOMIC CSC_SIZE_T remoteFreeCount;
+	CSC_ThreadCachingAllocatorCentralList centralLists[CSC_THREAD_CACHING_ALLOCATOR_SIZE_CLASS_COUNT];
+} CSC_ThreadCachingAllocator;
+
+// Initializes the allocator with a parent allocator, which must be usable and outlive the allocator.
+// A batchSize of 0 uses CSC_THREAD_CACHING_ALLOCATOR_DEFAULT_BATCH_SIZE, the object must not be moved in memory after initialization.
+// Returns CSC_STATUS_SUCCESS on success, otherwise an error code is returned.
+CSC_STATUS CSCMETHOD CSC_ThreadCachingAllocatorInitialize(_Out_ CSC_ThreadCachingAllocator* CONST pThis, _In_ CSC_IAllocator* CONST pParentAllocator, _In_ CONST CSC_SIZE_T batchSize);
+// Returns all spans and thread caches to the parent allocator and zeroes out the object.
+// No other thread may use the allocator during or after this operation, blocks that are still allocated become invalid.
+// Returns CSC_STATUS_SUCCESS on success, otherwise an error code is returned.
+CSC_STATUS CSCMETHOD CSC_ThreadCachingAllocatorDestroy(_Inout_ CSC_ThreadCachingAllocator* CONST pThis);
+
+// Moves all blocks cached by the calling thread, including it's pending remote frees, to the central pool.
+// Useful before a thread goes idle for a long time, threads that exit are flushed automatically.
+// Returns CSC_STATUS_SUCCESS on success, otherwise an error code is returned.
+CSC_STATUS CSCMETHOD CSC_ThreadCachingAllocatorFlushThreadCache(_In_ CONST CSC_ThreadCachingAllocator* CONST pThis);
+// Retrieves the usable size of a block allocated through the allocator, which is the size of it's size class for small blocks.
+// Returns 0 if the parameters are invalid.
+CSC_SIZE_T CSCMETHOD CSC_ThreadCachingAllocatorGetBlockSize(_In_ CONST CSC_ThreadCachingAllocator* CONST pThis, _In_ CONST CSC_PCVOID pMemoryBlock);
+
+CSC_SIZE_T CSCMETHOD CSC_ThreadCachingAllocatorGetBatchSize(_In_ CONST CSC_ThreadCachingAllocator* CONST pThis);
+CSC_SIZE_T CSCMETHOD CSC_ThreadCachingAllocatorGetSpanBytes(_In_ CONST CSC_ThreadCachingAllocator* CONST pThis);
+CSC_SIZE_T CSCMETHOD CSC_ThreadCachingAllocatorGetRemoteFreeCount(_In_ CONST CSC_ThreadCachingAllocator* CONST pThis);
+CSC_IBaseInterface* CSCMETHOD CSC_ThreadCachingAllocatorGetIBaseInterface(_In_ CONST CSC_ThreadCachingAllocator* CONST pThis);
+CSC_IAllocator* CSCMETHOD CSC_ThreadCachingAllocatorGetIAllocator(_In_ CONST CSC_ThreadCachingAllocator* CONST pThis);
+
+#endif
+
+#endif
\ No newline at end of file
@@ -36,6 +36,7 @@ Same principle applies to taking advantage of size based optimization in the Mem
 // Only one configuration can be active at a time.
 #define CSC_CONFIG_DEFAULT
 //#define CSC_CONFIG_WINDOWS_NATIVE
+//#define CSC_CONFIG_LINUX_NATIVE
 
 // Beginning of the default configuration.
 // Can be used as a template to implement custom configurations.
@@ -162,6 +163,119 @@ typedef unsigned char CSC_BOOLEAN;
 #define CSC_MEMORY_UTILS_USE_RECURSION FALSE
 #define CSC_MEMORY_UTILS_USE_SIZE_BASED_OPTIMIZATION FALSE
 
+// Macro definitions for retrieving the offset of a data member and the base address of an object from the address of one of it's data members.
+// Objects implementing multiple interfaces use these to get from an interface pointer back to the object.
+#define CSC_FIELD_OFFSET(type, field) ((CSC_SIZE_T)&(((type*)0)->field))
+#define CSC_CONTAINING_RECORD(address, type, field) ((type*)((CSC_BYTE*)(address) - CSC_FIELD_OFFSET(type, field)))
+
+// Definition of the storage class of functions that are defined in headers, like the generated functions of typed containers.
+#if defined(__GNUC__) || defined(__clang__)
+#define CSC_INLINE static __inline__
+#elif defined(_MSC_VER)
+#define CSC_INLINE static __inline
+#else
+#define CSC_INLINE static
+#endif
+
+// Definition of the hint to load the cache line holding an address ahead of it's use, the hint never faults and is ignored by compilers without support for it.
+#if defined(__GNUC__) || defined(__clang__)
+#define CSC_PREFETCH(address) __builtin_prefetch((CONST void*)(address))
+#else
+#define CSC_PREFETCH(address) ((void)(address))
+#endif
+
+// Definition of the bit scans used by bitmaps, which operate on CSC_SIZE_T values.
+// The scans return the index of the lowest and the highest set bit of a non-zero value, the population count returns the number of set bits.
+#if defined(__GNUC__) || defined(__clang__)
+#define CSC_BIT_SCAN_FORWARD(value) (CSC_SIZE_T)__builtin_ctzll((unsigned long long)(value))
+#define CSC_BIT_SCAN_REVERSE(value) ((CSC_SIZE_T)63 - (CSC_SIZE_T)__builtin_clzll((unsigned long long)(value)))
+#define CSC_POPULATION_COUNT(value) (CSC_SIZE_T)__builtin_popcountll((unsigned long long)(value))
+#else
+#define CSC_BIT_SCAN_FORWARD(value) CSC_BitScanForward((CSC_SIZE_T)(value))
+#define CSC_BIT_SCAN_REVERSE(value) CSC_BitScanReverse((CSC_SIZE_T)(value))
+#define CSC_POPULATION_COUNT(value) CSC_PopulationCount((CSC_SIZE_T)(value))
+
+CSC_INLINE CSC_SIZE_T CSC_BitScanForward(_In_ CSC_SIZE_T value)
+{
+	CSC_SIZE_T index = (CSC_SIZE_T)0;
+
+	while (!(value & (CSC_SIZE_T)1))
+	{
+		value >>= 1;
+		++index;
+	}
+
+	return index;
+}
+
+CSC_INLINE CSC_SIZE_T CSC_BitScanReverse(_In_ CSC_SIZE_T value)
+{
+	CSC_SIZE_T index = (CSC_SIZE_T)0;
+
+	while (value >>= 1)
+	{
+		++index;
+	}
+
+	return index;
+}
+
+CSC_INLINE CSC_SIZE_T CSC_PopulationCount(_In_ CSC_SIZE_T value)
+{
+	CSC_SIZE_T count = (CSC_SIZE_T)0;
+
+	for (; value; value &= value - (CSC_SIZE_T)1)
+	{
+		++count;
+	}
+
+	return count;
+}
+#endif
+
+// Definition of the 16-byte vectors used by the MemoryUtils to exchange and shuffle bytes in vector registers, the loads and stores don't require any alignment.
+// CSC_VECTOR_SHUFFLE takes sixteen constant byte indices into the vector and compiles to byte shuffles like pshufb or tbl, compilers without vector extensions fall back to the plain loops.
+#if defined(__clang__)
+#define CSC_VECTOR_SUPPORTED TRUE
+#define CSC_VECTOR_SIZE (CSC_SIZE_T)16
+typedef CSC_BYTE CSC_VECTOR __attribute__((vector_size(16)));
+typedef CSC_BYTE CSC_UNALIGNED_VECTOR __attribute__((vector_size(16), aligned(1), may_alias));
+#define CSC_VECTOR_LOAD(pSource) (*(CONST CSC_UNALIGNED_VECTOR*)(pSource))
+#define CSC_VECTOR_STORE(pDst, vector) (*(CSC_UNALIGNED_VECTOR*)(pDst) = (vector))
+#define CSC_VECTOR_SHUFFLE(vector, ...) __builtin_shufflevector((vector), (vector), __VA_ARGS__)
+#elif defined(__GNUC__)
+#define CSC_VECTOR_SUPPORTED TRUE
+#define CSC_VECTOR_SIZE (CSC_SIZE_T)16
+typedef CSC_BYTE CSC_VECTOR __attribute__((vector_size(16)));
+typedef CSC_BYTE CSC_UNALIGNED_VECTOR __attribute__((vector_size(16), aligned(1), may_alias));
+#define CSC_VECTOR_LOAD(pSource) (*(CONST CSC_UNALIGNED_VECTOR*)(pSource))
+#define CSC_VECTOR_STORE(pDst, vector) (*(CSC_UNALIGNED_VECTOR*)(pDst) = (vector))
+#define CSC_VECTOR_SHUFFLE(vector, ...) __builtin_shuffle((vector), (CSC_VECTOR){ __VA_ARGS__ })
+#else
+#define CSC_VECTOR_SUPPORTED FALSE
+#endif
+
+// Definition of the atomic primitives used by objects that may be shared between threads.
+// The primitives operate on naturally aligned CSC_SIZE_T values, which should be declared with the CSC_ATOMIC qualifier.
+// GCC and Clang provide builtins that don't require any runtime library, other compilers fall back to plain operations that are not thread safe.
+#define CSC_ATOMIC volatile
+
+#if defined(__GNUC__) || defined(__clang__)
+#define CSC_ATOMICS_SUPPORTED TRUE
+#define CSC_ATOMIC_LOAD(pTarget) __atomic_load_n((pTarget), __ATOMIC_ACQUIRE)
+#define CSC_ATOMIC_STORE(pTarget, value) __atomic_store_n((pTarget), (value), __ATOMIC_RELEASE)
+#define CSC_ATOMIC_FETCH_ADD(pTarget, value) __atomic_fetch_add((pTarget), (value), __ATOMIC_ACQ_REL)
+#define CSC_ATOMIC_FETCH_SUB(pTarget, value) __atomic_fetch_sub((pTarget), (value), __ATOMIC_ACQ_REL)
+#define CSC_ATOMIC_COMPARE_EXCHANGE(pTarget, pExpected, desired) (CSC_BOOLEAN)__atomic_compare_exchange_n((pTarget), (pExpected), (desired), 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)
+#else
+#define CSC_ATOMICS_SUPPORTED FALSE
+#define CSC_ATOMIC_LOAD(pTarget) (*(pTarget))
+#define CSC_ATOMIC_STORE(pTarget, value) (*(pTarget) = (value))
+#define CSC_ATOMIC_FETCH_ADD(pTarget, value) ((*(pTarget) += (value)) - (value))
+#define CSC_ATOMIC_FETCH_SUB(pTarget, value) ((*(pTarget) -= (value)) + (value))
+#define CSC_ATOMIC_COMPARE_EXCHANGE(pTarget, pExpected, desired) ((*(pTarget) == *(pExpected)) ? (*(pTarget) = (desired), (CSC_BOOLEAN)TRUE) : (*(pExpected) = *(pTarget), (CSC_BOOLEAN)FALSE))
+#endif
+
 #endif
 
 
@@ -222,7 +336,172 @@ typedef BOOLEAN CSC_BOOLEAN;
 #define CSC_MEMORY_UTILS_USE_RECURSION FALSE
 #define CSC_MEMORY_UTILS_USE_SIZE_BASED_OPTIMIZATION TRUE
 
+#define CSC_FIELD_OFFSET(type, field) FIELD_OFFSET(type, field)
+#define CSC_CONTAINING_RECORD(address, type, field) CONTAINING_RECORD(address, type, field)
+
+#define CSC_INLINE static __forceinline
+#define CSC_PREFETCH(address) PreFetchCacheLine(PF_TEMPORAL_LEVEL_1, (address))
+
+#define CSC_BIT_SCAN_FORWARD(value) CSC_BitScanForward((CSC_SIZE_T)(value))
+#define CSC_BIT_SCAN_REVERSE(value) CSC_BitScanReverse((CSC_SIZE_T)(value))
+#define CSC_POPULATION_COUNT(value) CSC_PopulationCount((CSC_SIZE_T)(value))
+
+static __forceinline CSC_SIZE_T CSC_BitScanForward(_In_ CONST CSC_SIZE_T value)
+{
+	DWORD index;
+
+#ifdef _WIN64
+	BitScanForward64(&index, (DWORD64)value);
+#else
+	BitScanForward(&index, (DWORD)value);
+#endif
+
+	return (CSC_SIZE_T)index;
+}
+
+static __forceinline CSC_SIZE_T CSC_BitScanReverse(_In_ CONST CSC_SIZE_T value)
+{
+	DWORD index;
+
+#ifdef _WIN64
+	BitScanReverse64(&index, (DWORD64)value);
+#else
+	BitScanReverse(&index, (DWORD)value);
+#endif
+
+	return (CSC_SIZE_T)index;
+}
+
+// The population count is computed in software, as the POPCNT instruction isn't available on every supported processor.
+static __forceinline CSC_SIZE_T CSC_PopulationCount(_In_ CSC_SIZE_T value)
+{
+	CSC_SIZE_T count = (CSC_SIZE_T)0;
+
+	for (; value; value &= value - (CSC_SIZE_T)1)
+	{
+		++count;
+	}
+
+	return count;
+}
+
+#define CSC_VECTOR_SUPPORTED FALSE
+
+#define CSC_ATOMIC volatile
+
+#define CSC_ATOMICS_SUPPORTED TRUE
+#define CSC_ATOMIC_LOAD(pTarget) (CSC_SIZE_T)InterlockedCompareExchangePointer((PVOID volatile*)(pTarget), NULL, NULL)
+#define CSC_ATOMIC_STORE(pTarget, value) InterlockedExchangePointer((PVOID volatile*)(pTarget), (PVOID)(CSC_SIZE_T)(value))
+#define CSC_ATOMIC_FETCH_ADD(pTarget, value) (CSC_SIZE_T)InterlockedExchangeAddSizeT((pTarget), (CSC_SIZE_T)(value))
+#define CSC_ATOMIC_FETCH_SUB(pTarget, value) (CSC_SIZE_T)InterlockedExchangeAddSizeT((pTarget), (CSC_SIZE_T)0 - (CSC_SIZE_T)(value))
+#define CSC_ATOMIC_COMPARE_EXCHANGE(pTarget, pExpected, desired) CSC_AtomicCompareExchange((CSC_SIZE_T volatile*)(pTarget), (CSC_SIZE_T*)(pExpected), (CSC_SIZE_T)(desired))
+
+static __forceinline CSC_BOOLEAN CSC_AtomicCompareExchange(_Inout_ CSC_SIZE_T volatile* CONST pTarget, _Inout_ CSC_SIZE_T* CONST pExpected, _In_ CONST CSC_SIZE_T desired)
+{
+	CONST CSC_SIZE_T previous = (CSC_SIZE_T)InterlockedCompareExchangePointer((PVOID volatile*)pTarget, (PVOID)desired, (PVOID)*pExpected);
+
+	if (previous == *pExpected)
+	{
+		return (CSC_BOOLEAN)TRUE;
+	}
+
+	*pExpected = previous;
+	return (CSC_BOOLEAN)FALSE;
+}
+
+#endif
+
+// Beginning of the Linux native configuration.
+// Supports x86-64 and AArch64 architectures built with GCC or Clang.
+// Objects relying on POSIX system calls, like memory mapping or threads, are only available in this configuration.
+#ifdef CSC_CONFIG_LINUX_NATIVE
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define CSCAPI
+#define CSCMETHOD
+
+#define CONST const
+
+#define _In_
+#define _In_opt_
+#define _Inout_
+#define _Out_
+#define _Out_opt_
+
+#define _When_(x, y)
+
+#define CSC_DATA_BUS_WIDTH CSC_DATA_BUS_WIDTH_64BIT
+#define CSC_ADDRESS_BUS_WIDTH_CODE CSC_ADDRESS_BUS_WIDTH_CODE_64BIT
+#define CSC_ADDRESS_BUS_WIDTH_DATA CSC_ADDRESS_BUS_WIDTH_DATA_64BIT
+
+typedef unsigned long long CSC_UINT;
+typedef signed long long CSC_INT;
+
+typedef uintptr_t CSC_CODE_POINTER_TYPE;
+typedef uintptr_t CSC_DATA_POINTER_TYPE;
+
+typedef size_t CSC_SIZE_T;
+
+typedef unsigned char CSC_CHAR;
+typedef unsigned short CSC_WCHAR;
+
+typedef uint8_t CSC_BYTE;
+typedef uint16_t CSC_WORD;
+typedef uint32_t CSC_DWORD;
+typedef uint64_t CSC_QWORD;
+
+typedef void* CSC_PVOID;
+typedef CONST void* CSC_PCVOID;
+
+typedef signed long CSC_STATUS;
+typedef unsigned char CSC_BOOLEAN;
+
+#define CSC_STATUS_SUCCESS 0l
+#define CSC_STATUS_GENERAL_FAILURE -1l
+#define CSC_STATUS_INVALID_PARAMETER -2l
+#define CSC_STATUS_INVALID_HANDLE -3l
+#define CSC_STATUS_MEMORY_NOT_ALLOCATED -4l
+
+#define FALSE 0
+#define TRUE 1
+
+#define CSC_MEMORY_UTILS_USE_UNALIGNED_ACCESS TRUE
+#define CSC_MEMORY_UTILS_USE_RECURSION FALSE
+#define CSC_MEMORY_UTILS_USE_SIZE_BASED_OPTIMIZATION TRUE
+
+#define CSC_FIELD_OFFSET(type, field) ((CSC_SIZE_T)offsetof(type, field))
+#define CSC_CONTAINING_RECORD(address, type, field) ((type*)((CSC_BYTE*)(address) - CSC_FIELD_OFFSET(type, field)))
+
+#define CSC_INLINE static inline
+#define CSC_PREFETCH(address) __builtin_prefetch((CONST void*)(address))
+
+#define CSC_BIT_SCAN_FORWARD(value) (CSC_SIZE_T)__builtin_ctzll((unsigned long long)(value))
+#define CSC_BIT_SCAN_REVERSE(value) ((CSC_SIZE_T)63 - (CSC_SIZE_T)__builtin_clzll((unsigned long long)(value)))
+#define CSC_POPULATION_COUNT(value) (CSC_SIZE_T)__builtin_popcountll((unsigned long long)(value))
+
+#define CSC_VECTOR_SUPPORTED TRUE
+#define CSC_VECTOR_SIZE (CSC_SIZE_T)16
+typedef CSC_BYTE CSC_VECTOR __attribute__((vector_size(16)));
+typedef CSC_BYTE CSC_UNALIGNED_VECTOR __attribute__((vector_size(16), aligned(1), may_alias));
+#define CSC_VECTOR_LOAD(pSource) (*(CONST CSC_UNALIGNED_VECTOR*)(pSource))
+#define CSC_VECTOR_STORE(pDst, vector) (*(CSC_UNALIGNED_VECTOR*)(pDst) = (vector))
+#if defined(__clang__)
+#define CSC_VECTOR_SHUFFLE(vector, ...) __builtin_shufflevector((vector), (vector), __VA_ARGS__)
+#else
+#define CSC_VECTOR_SHUFFLE(vector, ...) __builtin_shuffle((vector), (CSC_VECTOR){ __VA_ARGS__ })
 #endif
 
+#define CSC_ATOMIC volatile
+
+#define CSC_ATOMICS_SUPPORTED TRUE
+#define CSC_ATOMIC_LOAD(pTarget) __atomic_load_n((pTarget), __ATOMIC_ACQUIRE)
+#define CSC_ATOMIC_STORE(pTarget, value) __atomic_store_n((pTarget), (value), __ATOMIC_RELEASE)
+#define CSC_ATOMIC_FETCH_ADD(pTarget, value) __atomic_fetch_add((pTarget), (value), __ATOMIC_ACQ_REL)
+#define CSC_ATOMIC_FETCH_SUB(pTarget, value) __atomic_fetch_sub((pTarget), (value), __ATOMIC_ACQ_REL)
+#define CSC_ATOMIC_COMPARE_EXCHANGE(pTarget, pExpected, desired) (CSC_BOOLEAN)__atomic_compare_exchange_n((pTarget), (pExpected), (desired), 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)
+
 #endif
 
+#endif
\ No newline at end of file
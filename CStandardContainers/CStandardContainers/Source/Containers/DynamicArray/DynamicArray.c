@@ -0,0 +1,3964 @@
+// Request the GNU extensions of the system headers, which contain mremap.
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+
+#include "DynamicArray.h"
+#include "../../Utils/MemoryUtils.h"
+#include "../../Utils/SortUtils.h"
+#include "../../Utils/SearchUtils.h"
+#include "../../Utils/ParallelUtils.h"
+
+#ifdef CSC_CONFIG_LINUX_NATIVE
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+// Definition of the header at the beginning of the files of file-backed arrays.
+typedef struct _CSC_DynamicArrayFileHeader
+{
+	CSC_QWORD signature;
+	CSC_QWORD elementSize;
+	CSC_QWORD elementCount;
+	CSC_QWORD capacity;
+} CSC_DynamicArrayFileHeader;
+#endif
+
+// Definition of the record in front of the elements of a serialized array.
+typedef struct _CSC_DynamicArraySerializationHeader
+{
+	CSC_QWORD elementSize;
+	CSC_QWORD elementCount;
+	CSC_QWORD flags;
+} CSC_DynamicArraySerializationHeader;
+
+static CSC_PCVOID CSCMETHOD CSC_DynamicArrayGetInterface(_In_ CONST CSC_IBaseInterface* CONST pThis, _In_ CONST EBaseInterfaceType interfaceType);
+
+static CSC_STATUS CSCMETHOD CSC_DynamicArrayIContainerInitialize(_Out_ CSC_IContainer* CONST pThis, _In_ CONST CSC_SIZE_T elementSize, _In_ CSC_IAllocator* CONST pIAllocator);
+static CSC_STATUS CSCMETHOD CSC_DynamicArrayIContainerInitializeInline(_Out_ CSC_IContainer* CONST pThis, _In_ CONST CSC_SIZE_T elementSize, _In_ CSC_IAllocator* CONST pIAllocator);
+static CSC_STATUS CSCMETHOD CSC_DynamicArrayIContainerErase(_Inout_ CSC_IContainer* CONST pThis);
+static CSC_STATUS CSCMETHOD CSC_DynamicArrayIContainerDestroy(_Inout_ CSC_IContainer* CONST pThis);
+static CSC_STATUS CSCMETHOD CSC_DynamicArrayIContainerCopy(_Inout_ CSC_IContainer* CONST pThis, _In_ CONST CSC_IContainer* CONST pOther);
+static CSC_STATUS CSCMETHOD CSC_DynamicArrayIContainerMove(_Inout_ CSC_IContainer* CONST pThis, _Inout_ CSC_IContainer* CONST pOther);
+static CSC_STATUS CSCMETHOD CSC_DynamicArrayIContainerInsertRange(_Inout_ CSC_IContainer* CONST pThis, _In_ CONST CSC_SIZE_T insertIndex, _In_ CONST CSC_SIZE_T numOfElements, _In_opt_ CONST CSC_PCVOID pElements);
+static CSC_STATUS CSCMETHOD CSC_DynamicArrayIContainerRemoveRange(_Inout_ CSC_IContainer* CONST pThis, _In_ CONST CSC_SIZE_T removeIndex, _In_ CONST CSC_SIZE_T numOfElements);
+static CSC_STATUS CSCMETHOD CSC_DynamicArrayIContainerSwapValues(_Inout_ CSC_IContainer* CONST pThis, _In_ CONST CSC_SIZE_T firstIndex, _In_ CONST CSC_SIZE_T secondIndex);
+static CSC_PVOID CSCMETHOD CSC_DynamicArrayIContainerAccessElement(_In_ CONST CSC_IContainer* CONST pThis, _In_ CONST CSC_SIZE_T index);
+static CSC_STATUS CSCMETHOD CSC_DynamicArrayIContainerIsValid(_In_ CONST CSC_IContainer* CONST pThis);
+static CSC_STATUS CSCMETHOD CSC_DynamicArrayIContainerIsEmpty(_In_ CONST CSC_IContainer* CONST pThis);
+static CSC_STATUS CSCMETHOD CSC_DynamicArrayIContainerIsElementContainer(_In_ CONST CSC_IContainer* CONST pThis);
+static CSC_SIZE_T CSCMETHOD CSC_DynamicArrayIContainerGetSize(_In_ CONST CSC_IContainer* CONST pThis);
+static CSC_SIZE_T CSCMETHOD CSC_DynamicArrayIContainerGetElementSize(_In_ CONST CSC_IContainer* CONST pThis);
+static CSC_SIZE_T CSCMETHOD CSC_DynamicArrayIContainerGetMaxElements(_In_ CONST CSC_IContainer* CONST pThis);
+static CSC_IAllocator* CSCMETHOD CSC_DynamicArrayIContainerGetIAllocator(_In_ CONST CSC_IContainer* CONST pThis);
+static CSC_IContainerVirtualTable* CSCMETHOD CSC_DynamicArrayIContainerGetNestedContainerVTable(_In_ CONST CSC_IContainer* CONST pThis);
+static CSC_STATUS CSCMETHOD CSC_DynamicArrayIContainerSerialize(_In_ CONST CSC_IContainer* CONST pThis, _Inout_ CSC_SerializationWriter* CONST pWriter);
+static CSC_STATUS CSCMETHOD CSC_DynamicArrayIContainerDeserialize(_Out_ CSC_IContainer* CONST pThis, _Inout_ CSC_SerializationReader* CONST pReader, _In_ CSC_IAllocator* CONST pIAllocator, _In_opt_ CSC_IContainerVirtualTable* CONST pNestedContainerVTable);
+static CSC_STATUS CSCMETHOD CSC_DynamicArrayIContainerDeserializeInline(_Out_ CSC_IContainer* CONST pThis, _Inout_ CSC_SerializationReader* CONST pReader, _In_ CSC_IAllocator* CONST pIAllocator, _In_opt_ CSC_IContainerVirtualTable* CONST pNestedContainerVTable);
+
+static CSC_STATUS CSCMETHOD CSC_DynamicArrayIIterableRegisterIterator(_Inout_ CSC_IIterable* CONST pThis, _In_ CONST CSC_IIterator* CONST pIIterator);
+static CSC_STATUS CSCMETHOD CSC_DynamicArrayIIterableUnregisterIterator(_Inout_ CSC_IIterable* CONST pThis, _In_ CONST CSC_IIterator* CONST pIIterator);
+static CSC_PVOID CSCMETHOD CSC_DynamicArrayIIterableFirstElement(_In_ CONST CSC_IIterable* CONST pThis);
+static CSC_PVOID CSCMETHOD CSC_DynamicArrayIIterableNextElement(_In_ CONST CSC_IIterable* CONST pThis, _In_ CSC_SIZE_T currentIndex, _In_ CSC_PVOID pCurrentElement);
+static CSC_PVOID CSCMETHOD CSC_DynamicArrayIIterableLastElement(_In_ CONST CSC_IIterable* CONST pThis);
+static CSC_PVOID CSCMETHOD CSC_DynamicArrayIIterablePreviousElement(_In_ CONST CSC_IIterable* CONST pThis, _In_ CSC_SIZE_T currentIndex, _In_ CSC_PVOID pCurrentElement);
+static CSC_PVOID CSCMETHOD CSC_DynamicArrayIIterableGetElementAt(_In_ CONST CSC_IIterable* CONST pThis, _In_ CONST CSC_SIZE_T index, _In_opt_ CONST CSC_SIZE_T currentIndex, _In_opt_ CONST CSC_PVOID pCurrentElement);
+static CSC_SIZE_T CSCMETHOD CSC_DynamicArrayIIterableGetElementCount(_In_ CONST CSC_IIterable* CONST pThis);
+static CSC_SIZE_T CSCMETHOD CSC_DynamicArrayIIterableGetEpoch(_In_ CONST CSC_IIterable* CONST pThis);
+static CSC_PCVOID CSCMETHOD CSC_DynamicArrayIIterableGetContiguousChunk(_In_ CONST CSC_IIterable* CONST pThis, _In_ CONST CSC_SIZE_T startIndex, _Out_ CSC_SIZE_T* CONST pNumOfElements);
+
+static void CSCMETHOD CSC_DynamicArrayDestroyNested(_Inout_ CSC_DynamicArray* CONST pThis, _In_ CONST CSC_IAllocator* CONST pIAllocator, _Out_ CSC_PVOID* CONST ppBlock, _Out_ CSC_SIZE_T* CONST pBlockSize);
+static CSC_STATUS CSCMETHOD CSC_DynamicArrayConstructNestedCopies(_In_ CONST CSC_DynamicArray* CONST pThis, _Out_ CONST CSC_PVOID pDst, _In_ CONST CSC_DynamicArray* CONST pSource, _In_ CONST CSC_SIZE_T numOfElements);
+
+static CSC_IBaseInterfaceVirtualTable g_DynamicArrayBaseInterfaceVTable =
+{
+	CSC_DynamicArrayGetInterface
+};
+
+static CSC_IContainerVirtualTable g_DynamicArrayContainerVTable =
+{
+	CSC_DynamicArrayIContainerInitialize,
+	CSC_DynamicArrayIContainerErase,
+	CSC_DynamicArrayIContainerDestroy,
+	CSC_DynamicArrayIContainerCopy,
+	CSC_DynamicArrayIContainerMove,
+	CSC_DynamicArrayIContainerInsertRange,
+	CSC_DynamicArrayIContainerRemoveRange,
+	CSC_DynamicArrayIContainerSwapValues,
+	CSC_DynamicArrayIContainerAccessElement,
+	CSC_DynamicArrayIContainerIsValid,
+	CSC_DynamicArrayIContainerIsEmpty,
+	CSC_DynamicArrayIContainerIsElementContainer,
+	CSC_DynamicArrayIContainerGetSize,
+	CSC_DynamicArrayIContainerGetElementSize,
+	CSC_DynamicArrayIContainerGetMaxElements,
+	CSC_DynamicArrayIContainerGetIAllocator,
+	CSC_DynamicArrayIContainerGetNestedContainerVTable,
+	CSC_DynamicArrayIContainerSerialize,
+	CSC_DynamicArrayIContainerDeserialize,
+	(CSC_BOOLEAN)TRUE
+};
+
+// The virtual table of arrays with inline storage only differs in the initialization methods, which are invoked when such arrays are nested.
+static CSC_IContainerVirtualTable g_DynamicArrayInlineContainerVTable =
+{
+	CSC_DynamicArrayIContainerInitializeInline,
+	CSC_DynamicArrayIContainerErase,
+	CSC_DynamicArrayIContainerDestroy,
+	CSC_DynamicArrayIContainerCopy,
+	CSC_DynamicArrayIContainerMove,
+	CSC_DynamicArrayIContainerInsertRange,
+	CSC_DynamicArrayIContainerRemoveRange,
+	CSC_DynamicArrayIContainerSwapValues,
+	CSC_DynamicArrayIContainerAccessElement,
+	CSC_DynamicArrayIContainerIsValid,
+	CSC_DynamicArrayIContainerIsEmpty,
+	CSC_DynamicArrayIContainerIsElementContainer,
+	CSC_DynamicArrayIContainerGetSize,
+	CSC_DynamicArrayIContainerGetElementSize,
+	CSC_DynamicArrayIContainerGetMaxElements,
+	CSC_DynamicArrayIContainerGetIAllocator,
+	CSC_DynamicArrayIContainerGetNestedContainerVTable,
+	CSC_DynamicArrayIContainerSerialize,
+	CSC_DynamicArrayIContainerDeserializeInline,
+	(CSC_BOOLEAN)TRUE
+};
+
+static CSC_IIterableVirtualTable g_DynamicArrayIterableVTable =
+{
+	CSC_DynamicArrayIIterableRegisterIterator,
+	CSC_DynamicArrayIIterableUnregisterIterator,
+	CSC_DynamicArrayIIterableFirstElement,
+	CSC_DynamicArrayIIterableNextElement,
+	CSC_DynamicArrayIIterableLastElement,
+	CSC_DynamicArrayIIterablePreviousElement,
+	CSC_DynamicArrayIIterableGetElementAt,
+	CSC_DynamicArrayIIterableGetElementCount,
+	CSC_DynamicArrayIIterableGetEpoch,
+	CSC_DynamicArrayIIterableGetContiguousChunk
+};
+
+
+static CSC_SIZE_T CSCMETHOD CSC_DynamicArrayCalculateMaxElements(_In_ CONST CSC_SIZE_T elementSize)
+{
+	// The byte size of the buffer is limited to half of the address space, hence byte offsets never overflow.
+	return (~(CSC_SIZE_T)0 >> 1) / elementSize;
+}
+
+static CSC_SIZE_T CSCMETHOD CSC_DynamicArrayGetInlineCapacity(_In_ CONST CSC_DynamicArray* CONST pThis)
+{
+	return pThis->inlineCapacity / pThis->elementSize;
+}
+
+// Retrieves the buffer that currently holds the elements.
+// Inline storage directly follows the object and is not referenced by pData, hence arrays can be moved bytewise like any other container.
+static CSC_BYTE* CSCMETHOD CSC_DynamicArrayGetBuffer(_In_ CONST CSC_DynamicArray* CONST pThis)
+{
+	if (pThis->pData)
+	{
+		return (CSC_BYTE*)pThis->pData;
+	}
+
+	if (!pThis->reservedSpace)
+	{
+		return NULL;
+	}
+
+	return (CSC_BYTE*)pThis + sizeof(CSC_DynamicArray);
+}
+
+static CSC_PVOID CSCMETHOD CSC_DynamicArrayGetElement(_In_ CONST CSC_DynamicArray* CONST pThis, _In_ CONST CSC_SIZE_T index)
+{
+	return (CSC_PVOID)(CSC_DynamicArrayGetBuffer(pThis) + index * pThis->elementSize);
+}
+
+static CSC_SIZE_T CSCMETHOD CSC_DynamicArrayGetHeaderSize(_In_ CONST CSC_DynamicArray* CONST pThis)
+{
+	return (pThis->isCopyOnWrite) ? CSC_DYNAMIC_ARRAY_SHARED_HEADER_SIZE : (CSC_SIZE_T)0;
+}
+
+// Retrieves the reference count of the buffer of a copy-on-write array, which is stored in the header in front of the buffer.
+static CSC_ATOMIC CSC_SIZE_T* CSCMETHOD CSC_DynamicArrayGetReferenceCount(_In_ CONST CSC_DynamicArray* CONST pThis)
+{
+	return (CSC_ATOMIC CSC_SIZE_T*)((CSC_BYTE*)pThis->pData - CSC_DYNAMIC_ARRAY_SHARED_HEADER_SIZE);
+}
+
+// Checks whether the buffer is shared with other arrays, in which case it must not be modified.
+// Only the owner of the last reference can modify the buffer, hence the reference count can't be raised concurrently once it dropped to 1.
+static CSC_BOOLEAN CSCMETHOD CSC_DynamicArrayIsShared(_In_ CONST CSC_DynamicArray* CONST pThis)
+{
+	if (!pThis->isCopyOnWrite || !pThis->pData || CSC_ATOMIC_LOAD(CSC_DynamicArrayGetReferenceCount(pThis)) == (CSC_SIZE_T)1)
+	{
+		return (CSC_BOOLEAN)FALSE;
+	}
+
+	return (CSC_BOOLEAN)TRUE;
+}
+
+// Calculates the capacity that the usable size of a block, which was allocated with the given size, provides behind a header of headerSize bytes.
+static CSC_SIZE_T CSCMETHOD CSC_DynamicArrayCalculateBlockCapacity(_In_ CONST CSC_DynamicArray* CONST pThis, _In_ CONST CSC_PCVOID pBlock, _In_ CONST CSC_SIZE_T size, _In_ CONST CSC_SIZE_T headerSize)
+{
+	CONST CSC_SIZE_T capacity = (CSC_IAllocatorGetUsableSize(pThis->pIAllocator, pBlock, size) - headerSize) / pThis->elementSize;
+
+	if (capacity > CSC_DynamicArrayCalculateMaxElements(pThis->elementSize))
+	{
+		return CSC_DynamicArrayCalculateMaxElements(pThis->elementSize);
+	}
+
+	return capacity;
+}
+
+// Allocates a buffer for at least the requested amount of elements and stores the capacity that the usable size of the allocation provides.
+// The buffer is preceded by a header of headerSize bytes, a non empty header holds the reference count of the buffer, which starts at 1.
+static CSC_PVOID CSCMETHOD CSC_DynamicArrayAllocateBuffer(_In_ CONST CSC_DynamicArray* CONST pThis, _In_ CONST CSC_SIZE_T capacity, _In_ CONST CSC_SIZE_T headerSize, _Out_ CSC_SIZE_T* CONST pCapacity)
+{
+	CSC_BYTE* pBlock;
+
+	pBlock = (CSC_BYTE*)CSC_IAllocatorAlloc(pThis->pIAllocator, headerSize + capacity * pThis->elementSize);
+
+	if (!pBlock)
+	{
+		return NULL;
+	}
+
+	*pCapacity = CSC_DynamicArrayCalculateBlockCapacity(pThis, pBlock, headerSize + capacity * pThis->elementSize, headerSize);
+
+	if (headerSize)
+	{
+		CSC_ATOMIC_STORE((CSC_ATOMIC CSC_SIZE_T*)pBlock, (CSC_SIZE_T)1);
+	}
+
+	return (CSC_PVOID)(pBlock + headerSize);
+}
+
+static void CSCMETHOD CSC_DynamicArrayFreeBuffer(_In_ CONST CSC_DynamicArray* CONST pThis, _In_ CONST CSC_PVOID pData, _In_ CONST CSC_SIZE_T capacity, _In_ CONST CSC_SIZE_T headerSize)
+{
+	CSC_IAllocatorFreeSized(pThis->pIAllocator, (CSC_BYTE*)pData - headerSize, headerSize + capacity * pThis->elementSize);
+}
+
+#ifdef CSC_CONFIG_LINUX_NATIVE
+static CSC_DynamicArrayFileHeader* CSCMETHOD CSC_DynamicArrayGetFileHeader(_In_ CONST CSC_DynamicArray* CONST pThis)
+{
+	return (CSC_DynamicArrayFileHeader*)((CSC_BYTE*)pThis->pData - CSC_DYNAMIC_ARRAY_FILE_HEADER_SIZE);
+}
+
+// Calculates the size of the mapping of a file-backed array, which is rounded up to whole pages.
+// Returns 0 if the size exceeds the maximum size of a buffer.
+static CSC_SIZE_T CSCMETHOD CSC_DynamicArrayCalculateMappingSize(_In_ CONST CSC_DynamicArray* CONST pThis, _In_ CONST CSC_SIZE_T capacity)
+{
+	if (capacity > CSC_DynamicArrayCalculateMaxElements(pThis->elementSize))
+	{
+		return (CSC_SIZE_T)0;
+	}
+
+	return (CSC_DYNAMIC_ARRAY_FILE_HEADER_SIZE + capacity * pThis->elementSize + CSC_DYNAMIC_ARRAY_PAGE_SIZE - (CSC_SIZE_T)1) & ~(CSC_DYNAMIC_ARRAY_PAGE_SIZE - (CSC_SIZE_T)1);
+}
+
+// Resizes the file of a file-backed array and remaps it, the mapping is moved by the kernel if it can't be extended in place, which never copies the elements.
+// The file is extended before the mapping grows and truncated after the mapping shrinks, hence no page of the mapping lies beyond the end of the file.
+static CSC_STATUS CSCMETHOD CSC_DynamicArrayRemapFile(_Inout_ CSC_DynamicArray* CONST pThis, _In_ CONST CSC_SIZE_T capacity)
+{
+	CSC_PVOID pMapping;
+	CONST CSC_SIZE_T oldMappingSize = CSC_DynamicArrayCalculateMappingSize(pThis, pThis->reservedSpace);
+	CONST CSC_SIZE_T newMappingSize = CSC_DynamicArrayCalculateMappingSize(pThis, capacity);
+
+	if (!newMappingSize)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	if (newMappingSize == oldMappingSize)
+	{
+		return CSC_STATUS_SUCCESS;
+	}
+
+	if (newMappingSize > oldMappingSize && ftruncate((int)pThis->fileDescriptor, (off_t)newMappingSize))
+	{
+		return CSC_STATUS_MEMORY_NOT_ALLOCATED;
+	}
+
+	pMapping = mremap((CSC_BYTE*)pThis->pData - CSC_DYNAMIC_ARRAY_FILE_HEADER_SIZE, oldMappingSize, newMappingSize, MREMAP_MAYMOVE);
+
+	if (pMapping == MAP_FAILED)
+	{
+		if (newMappingSize > oldMappingSize)
+		{
+			ftruncate((int)pThis->fileDescriptor, (off_t)oldMappingSize);
+		}
+
+		return CSC_STATUS_MEMORY_NOT_ALLOCATED;
+	}
+
+	if (newMappingSize < oldMappingSize)
+	{
+		ftruncate((int)pThis->fileDescriptor, (off_t)newMappingSize);
+	}
+
+	pThis->pData = (CSC_PVOID)((CSC_BYTE*)pMapping + CSC_DYNAMIC_ARRAY_FILE_HEADER_SIZE);
+	pThis->reservedSpace = (newMappingSize - CSC_DYNAMIC_ARRAY_FILE_HEADER_SIZE) / pThis->elementSize;
+	CSC_DynamicArrayGetFileHeader(pThis)->capacity = (CSC_QWORD)pThis->reservedSpace;
+
+	return CSC_STATUS_SUCCESS;
+}
+
+// Writes the element count to the header, unmaps the file and closes it, the elements remain in the file.
+static void CSCMETHOD CSC_DynamicArrayUnmapFile(_Inout_ CSC_DynamicArray* CONST pThis)
+{
+	CSC_DynamicArrayGetFileHeader(pThis)->elementCount = (CSC_QWORD)pThis->elementCount;
+	munmap((CSC_BYTE*)pThis->pData - CSC_DYNAMIC_ARRAY_FILE_HEADER_SIZE, CSC_DynamicArrayCalculateMappingSize(pThis, pThis->reservedSpace));
+	close((int)pThis->fileDescriptor);
+
+	pThis->pData = NULL;
+	pThis->elementCount = (CSC_SIZE_T)0;
+	pThis->reservedSpace = (CSC_SIZE_T)0;
+	pThis->isFileBacked = (CSC_BOOLEAN)FALSE;
+}
+
+// Maps the file of a file-backed array, an empty file is initialized with a header of an empty array.
+static CSC_STATUS CSCMETHOD CSC_DynamicArrayMapFile(_Inout_ CSC_DynamicArray* CONST pThis)
+{
+	struct stat fileStatus;
+	CSC_DynamicArrayFileHeader header;
+	CSC_BYTE* pMapping;
+	CSC_SIZE_T mappingSize;
+
+	if (fstat((int)pThis->fileDescriptor, &fileStatus))
+	{
+		return CSC_STATUS_GENERAL_FAILURE;
+	}
+
+	CSC_MemoryUtilsSetZeroMemory(&header, sizeof(header));
+
+	if (fileStatus.st_size)
+	{
+		if ((CSC_SIZE_T)fileStatus.st_size < CSC_DYNAMIC_ARRAY_FILE_HEADER_SIZE || pread((int)pThis->fileDescriptor, &header, sizeof(header), 0) != (ssize_t)sizeof(header))
+		{
+			return CSC_STATUS_INVALID_PARAMETER;
+		}
+
+		if (header.signature != CSC_DYNAMIC_ARRAY_FILE_SIGNATURE || header.elementSize != (CSC_QWORD)pThis->elementSize || header.elementCount > header.capacity || header.capacity > (CSC_QWORD)CSC_DynamicArrayCalculateMaxElements(pThis->elementSize))
+		{
+			return CSC_STATUS_INVALID_PARAMETER;
+		}
+	}
+
+	mappingSize = CSC_DynamicArrayCalculateMappingSize(pThis, (CSC_SIZE_T)header.capacity);
+
+	if (!mappingSize || ((CSC_SIZE_T)fileStatus.st_size < mappingSize && ftruncate((int)pThis->fileDescriptor, (off_t)mappingSize)))
+	{
+		return CSC_STATUS_MEMORY_NOT_ALLOCATED;
+	}
+
+	pMapping = (CSC_BYTE*)mmap(NULL, mappingSize, PROT_READ | PROT_WRITE, MAP_SHARED, (int)pThis->fileDescriptor, 0);
+
+	if ((CSC_PVOID)pMapping == MAP_FAILED)
+	{
+		return CSC_STATUS_MEMORY_NOT_ALLOCATED;
+	}
+
+	pThis->pData = (CSC_PVOID)(pMapping + CSC_DYNAMIC_ARRAY_FILE_HEADER_SIZE);
+	pThis->elementCount = (CSC_SIZE_T)header.elementCount;
+	pThis->reservedSpace = (mappingSize - CSC_DYNAMIC_ARRAY_FILE_HEADER_SIZE) / pThis->elementSize;
+
+	header.signature = CSC_DYNAMIC_ARRAY_FILE_SIGNATURE;
+	header.elementSize = (CSC_QWORD)pThis->elementSize;
+	header.capacity = (CSC_QWORD)pThis->reservedSpace;
+	CSC_MemoryUtilsCopyMemory(pMapping, &header, sizeof(header));
+
+	return CSC_STATUS_SUCCESS;
+}
+#endif
+
+static CSC_IContainer* CSCMETHOD CSC_DynamicArrayGetElementContainer(_In_ CONST CSC_PCVOID pElement)
+{
+	// Nested containers place their IContainer interface directly behind their IBaseInterface.
+	return (CSC_IContainer*)((CONST CSC_BYTE*)pElement + sizeof(CSC_IBaseInterface));
+}
+
+// Elements remain valid after their bytes have been copied, unless they are containers that don't declare themselves trivially relocatable.
+static CSC_BOOLEAN CSCMETHOD CSC_DynamicArrayIsRelocatable(_In_ CONST CSC_DynamicArray* CONST pThis)
+{
+	return (!pThis->pNestedContainerVTable || pThis->pNestedContainerVTable->isTriviallyRelocatable) ? (CSC_BOOLEAN)TRUE : (CSC_BOOLEAN)FALSE;
+}
+
+// Moves an element container to uninitialized memory, the destination is initialized with the allocator of the source and the source is destroyed afterwards.
+static CSC_STATUS CSCMETHOD CSC_DynamicArrayRelocateElement(_In_ CONST CSC_DynamicArray* CONST pThis, _Out_ CONST CSC_PVOID pDst, _Inout_ CONST CSC_PVOID pSrc)
+{
+	CSC_IContainer* CONST pDstContainer = CSC_DynamicArrayGetElementContainer(pDst);
+	CSC_IContainer* CONST pSrcContainer = CSC_DynamicArrayGetElementContainer(pSrc);
+	CONST CSC_IContainerVirtualTable* CONST pVTable = pThis->pNestedContainerVTable;
+	CSC_STATUS status;
+
+	status = pVTable->pInitialize(pDstContainer, pVTable->pGetElementSize(pSrcContainer), pVTable->pGetIAllocator(pSrcContainer));
+
+	if (status != CSC_STATUS_SUCCESS)
+	{
+		return status;
+	}
+
+	status = pVTable->pMove(pDstContainer, pSrcContainer);
+
+	if (status != CSC_STATUS_SUCCESS)
+	{
+		pVTable->pDestroy(pDstContainer);
+		return status;
+	}
+
+	pVTable->pDestroy(pSrcContainer);
+
+	return CSC_STATUS_SUCCESS;
+}
+
+// Moves elements to another place, the ranges may overlap and the source range is considered uninitialized afterwards.
+// Trivially relocatable elements are moved with a single copy, other element containers are moved one by one in the order that doesn't overwrite the remaining source elements.
+static CSC_STATUS CSCMETHOD CSC_DynamicArrayRelocateElements(_In_ CONST CSC_DynamicArray* CONST pThis, _Out_ CONST CSC_PVOID pDst, _Inout_ CONST CSC_PVOID pSrc, _In_ CONST CSC_SIZE_T numOfElements)
+{
+	CSC_STATUS status;
+	CSC_SIZE_T iterator;
+	CSC_SIZE_T offset;
+
+	if (!numOfElements || pDst == pSrc)
+	{
+		return CSC_STATUS_SUCCESS;
+	}
+
+	if (CSC_DynamicArrayIsRelocatable(pThis))
+	{
+		return CSC_MemoryUtilsCopyMemory(pDst, pSrc, numOfElements * pThis->elementSize);
+	}
+
+	for (iterator = (CSC_SIZE_T)0; iterator < numOfElements; ++iterator)
+	{
+		offset = (((CSC_BYTE*)pDst < (CSC_BYTE*)pSrc) ? iterator : numOfElements - iterator - (CSC_SIZE_T)1) * pThis->elementSize;
+		status = CSC_DynamicArrayRelocateElement(pThis, (CSC_BYTE*)pDst + offset, (CSC_BYTE*)pSrc + offset);
+
+		if (status != CSC_STATUS_SUCCESS)
+		{
+			return status;
+		}
+	}
+
+	return CSC_STATUS_SUCCESS;
+}
+
+static CSC_BOOLEAN CSCMETHOD CSC_DynamicArrayIsOwnElement(_In_ CONST CSC_DynamicArray* CONST pThis, _In_opt_ CONST CSC_PCVOID pElement)
+{
+	if (!pElement || !pThis->elementCount || (CONST CSC_BYTE*)pElement < CSC_DynamicArrayGetBuffer(pThis) || (CONST CSC_BYTE*)pElement >= CSC_DynamicArrayGetBuffer(pThis) + pThis->elementCount * pThis->elementSize)
+	{
+		return (CSC_BOOLEAN)FALSE;
+	}
+
+	return (CSC_BOOLEAN)TRUE;
+}
+
+// Validates an array that is about to be modified or whose elements are about to be read.
+// The slots of a pending emplacement are uninitialized and the elements behind them are moved, hence such operations are rejected until the emplacement is committed.
+static CSC_STATUS CSCMETHOD CSC_DynamicArrayIsModifiable(_In_ CONST CSC_DynamicArray* CONST pThis)
+{
+	if (CSC_DynamicArrayIsValid(pThis) != CSC_STATUS_SUCCESS || pThis->emplaceCount)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	return CSC_STATUS_SUCCESS;
+}
+
+// Retrieves the amount of elements, which excludes removed slots that haven't been compacted yet.
+static CSC_SIZE_T CSCMETHOD CSC_DynamicArrayGetElementCount(_In_ CONST CSC_DynamicArray* CONST pThis)
+{
+	return pThis->elementCount - pThis->tombstoneCount;
+}
+
+static CSC_BOOLEAN CSCMETHOD CSC_DynamicArrayIsTombstone(_In_ CONST CSC_DynamicArray* CONST pThis, _In_ CONST CSC_SIZE_T slot)
+{
+	if (slot / CSC_DYNAMIC_ARRAY_TOMBSTONE_BITS >= pThis->tombstoneWords || !(pThis->pTombstones[slot / CSC_DYNAMIC_ARRAY_TOMBSTONE_BITS] & ((CSC_SIZE_T)1 << (slot % CSC_DYNAMIC_ARRAY_TOMBSTONE_BITS))))
+	{
+		return (CSC_BOOLEAN)FALSE;
+	}
+
+	return (CSC_BOOLEAN)TRUE;
+}
+
+// Retrieves the first slot at or behind the given slot that is either removed or holds an element, the slot count is returned if there is none.
+// Bits of slots behind the last slot are never set and slots that aren't covered by the bitmap hold elements, hence the scan ends at the last word that covers a slot.
+static CSC_SIZE_T CSCMETHOD CSC_DynamicArrayFindSlot(_In_ CONST CSC_DynamicArray* CONST pThis, _In_ CONST CSC_SIZE_T slot, _In_ CONST CSC_BOOLEAN isTombstone)
+{
+	CONST CSC_SIZE_T lastWord = (pThis->elementCount + CSC_DYNAMIC_ARRAY_TOMBSTONE_BITS - (CSC_SIZE_T)1) / CSC_DYNAMIC_ARRAY_TOMBSTONE_BITS;
+	CONST CSC_SIZE_T endWord = (lastWord < pThis->tombstoneWords) ? lastWord : pThis->tombstoneWords;
+	CSC_SIZE_T wordIndex = slot / CSC_DYNAMIC_ARRAY_TOMBSTONE_BITS;
+	CSC_SIZE_T word;
+
+	if (slot >= pThis->elementCount)
+	{
+		return pThis->elementCount;
+	}
+
+	if (wordIndex >= endWord)
+	{
+		return (isTombstone) ? pThis->elementCount : slot;
+	}
+
+	word = (isTombstone) ? pThis->pTombstones[wordIndex] : ~pThis->pTombstones[wordIndex];
+	word &= ~(CSC_SIZE_T)0 << (slot % CSC_DYNAMIC_ARRAY_TOMBSTONE_BITS);
+
+	while (!word)
+	{
+		if (++wordIndex == endWord)
+		{
+			return (isTombstone || wordIndex * CSC_DYNAMIC_ARRAY_TOMBSTONE_BITS >= pThis->elementCount) ? pThis->elementCount : wordIndex * CSC_DYNAMIC_ARRAY_TOMBSTONE_BITS;
+		}
+
+		word = (isTombstone) ? pThis->pTombstones[wordIndex] : ~pThis->pTombstones[wordIndex];
+	}
+
+	wordIndex = wordIndex * CSC_DYNAMIC_ARRAY_TOMBSTONE_BITS + CSC_BIT_SCAN_FORWARD(word);
+
+	return (wordIndex < pThis->elementCount) ? wordIndex : pThis->elementCount;
+}
+
+// Retrieves the last slot in front of the given slot that holds an element.
+// Returns CSC_CONTAINER_INVALID_INDEX if there is none.
+static CSC_SIZE_T CSCMETHOD CSC_DynamicArrayFindPreviousElement(_In_ CONST CSC_DynamicArray* CONST pThis, _In_ CONST CSC_SIZE_T slot)
+{
+	CSC_SIZE_T wordIndex;
+	CSC_SIZE_T word;
+
+	if (!slot)
+	{
+		return CSC_CONTAINER_INVALID_INDEX;
+	}
+
+	wordIndex = (slot - (CSC_SIZE_T)1) / CSC_DYNAMIC_ARRAY_TOMBSTONE_BITS;
+
+	if (wordIndex >= pThis->tombstoneWords)
+	{
+		return slot - (CSC_SIZE_T)1;
+	}
+
+	word = ~pThis->pTombstones[wordIndex] & (~(CSC_SIZE_T)0 >> (CSC_DYNAMIC_ARRAY_TOMBSTONE_BITS - (CSC_SIZE_T)1 - (slot - (CSC_SIZE_T)1) % CSC_DYNAMIC_ARRAY_TOMBSTONE_BITS));
+
+	while (!word)
+	{
+		if (!wordIndex)
+		{
+			return CSC_CONTAINER_INVALID_INDEX;
+		}
+
+		word = ~pThis->pTombstones[--wordIndex];
+	}
+
+	return wordIndex * CSC_DYNAMIC_ARRAY_TOMBSTONE_BITS + CSC_BIT_SCAN_REVERSE(word);
+}
+
+// Retrieves the Fenwick tree over the population counts of the words of the bitmap, which directly follows the bitmap in the same allocation.
+// The node with the one based number i sums up the counts of the words behind i - (i & -i) up to and including the word i - 1 and is stored at index i - 1.
+static CSC_SIZE_T* CSCMETHOD CSC_DynamicArrayGetTombstoneTree(_In_ CONST CSC_DynamicArray* CONST pThis)
+{
+	return pThis->pTombstones + pThis->tombstoneWords;
+}
+
+// Marks the slot as removed or as holding an element and updates the nodes of the Fenwick tree that cover it's word.
+static void CSCMETHOD CSC_DynamicArraySetTombstone(_Inout_ CSC_DynamicArray* CONST pThis, _In_ CONST CSC_SIZE_T slot, _In_ CONST CSC_BOOLEAN isTombstone)
+{
+	CSC_SIZE_T* CONST pTree = CSC_DynamicArrayGetTombstoneTree(pThis);
+	CSC_SIZE_T node;
+
+	if (isTombstone)
+	{
+		pThis->pTombstones[slot / CSC_DYNAMIC_ARRAY_TOMBSTONE_BITS] |= (CSC_SIZE_T)1 << (slot % CSC_DYNAMIC_ARRAY_TOMBSTONE_BITS);
+	}
+	else
+	{
+		pThis->pTombstones[slot / CSC_DYNAMIC_ARRAY_TOMBSTONE_BITS] &= ~((CSC_SIZE_T)1 << (slot % CSC_DYNAMIC_ARRAY_TOMBSTONE_BITS));
+	}
+
+	for (node = slot / CSC_DYNAMIC_ARRAY_TOMBSTONE_BITS + (CSC_SIZE_T)1; node <= pThis->tombstoneWords; node += node & ((CSC_SIZE_T)0 - node))
+	{
+		if (isTombstone)
+		{
+			++pTree[node - (CSC_SIZE_T)1];
+		}
+		else
+		{
+			--pTree[node - (CSC_SIZE_T)1];
+		}
+	}
+}
+
+// Counts the removed slots in front of the given slot, the counts of the whole words in front of it's word are summed up through the Fenwick tree.
+static CSC_SIZE_T CSCMETHOD CSC_DynamicArrayCountTombstones(_In_ CONST CSC_DynamicArray* CONST pThis, _In_ CONST CSC_SIZE_T slot)
+{
+	CONST CSC_SIZE_T* CONST pTree = CSC_DynamicArrayGetTombstoneTree(pThis);
+	CONST CSC_SIZE_T wordIndex = slot / CSC_DYNAMIC_ARRAY_TOMBSTONE_BITS;
+	CSC_SIZE_T count = (CSC_SIZE_T)0;
+	CSC_SIZE_T node;
+
+	if (slot >= pThis->elementCount || wordIndex >= pThis->tombstoneWords)
+	{
+		return pThis->tombstoneCount;
+	}
+
+	for (node = wordIndex; node; node -= node & ((CSC_SIZE_T)0 - node))
+	{
+		count += pTree[node - (CSC_SIZE_T)1];
+	}
+
+	return count + CSC_POPULATION_COUNT(pThis->pTombstones[wordIndex] & (((CSC_SIZE_T)1 << (slot % CSC_DYNAMIC_ARRAY_TOMBSTONE_BITS)) - (CSC_SIZE_T)1));
+}
+
+// Retrieves the slot of the element at the given index in O(log n), the Fenwick tree is descended from the largest node to skip the words that hold fewer elements than the remaining index.
+static CSC_SIZE_T CSCMETHOD CSC_DynamicArrayGetSlot(_In_ CONST CSC_DynamicArray* CONST pThis, _In_ CONST CSC_SIZE_T index)
+{
+	CONST CSC_SIZE_T* pTree;
+	CSC_SIZE_T remainingIndex = index;
+	CSC_SIZE_T wordIndex = (CSC_SIZE_T)0;
+	CSC_SIZE_T step;
+	CSC_SIZE_T count;
+	CSC_SIZE_T word;
+
+	if (!pThis->tombstoneCount)
+	{
+		return index;
+	}
+
+	pTree = CSC_DynamicArrayGetTombstoneTree(pThis);
+
+	for (step = (CSC_SIZE_T)1 << CSC_BIT_SCAN_REVERSE(pThis->tombstoneWords); step; step >>= 1)
+	{
+		if (wordIndex + step > pThis->tombstoneWords)
+		{
+			continue;
+		}
+
+		// The node covers the step words behind the words that were skipped so far, it's count of elements follows from the count of removed slots.
+		count = step * CSC_DYNAMIC_ARRAY_TOMBSTONE_BITS - pTree[wordIndex + step - (CSC_SIZE_T)1];
+
+		if (count <= remainingIndex)
+		{
+			wordIndex += step;
+			remainingIndex -= count;
+		}
+	}
+
+	if (wordIndex == pThis->tombstoneWords)
+	{
+		return pThis->tombstoneWords * CSC_DYNAMIC_ARRAY_TOMBSTONE_BITS + remainingIndex;
+	}
+
+	for (word = ~pThis->pTombstones[wordIndex]; remainingIndex; --remainingIndex)
+	{
+		word &= word - (CSC_SIZE_T)1;
+	}
+
+	return wordIndex * CSC_DYNAMIC_ARRAY_TOMBSTONE_BITS + CSC_BIT_SCAN_FORWARD(word);
+}
+
+// Insertions, removals and reallocations only advance the epoch, registered iterators compare it with the epoch they were validated at once they are used again.
+static void CSCMETHOD CSC_DynamicArrayAdvanceEpoch(_Inout_ CSC_DynamicArray* CONST pThis)
+{
+	++pThis->epoch;
+}
+
+// Replacing the elements as a whole invalidates the iteration of every registered iterator, as their positions don't refer to the same elements anymore.
+static void CSCMETHOD CSC_DynamicArrayNotifyReplacement(_Inout_ CSC_DynamicArray* CONST pThis)
+{
+	CSC_IIterator* pIIterator;
+
+	CSC_DynamicArrayAdvanceEpoch(pThis);
+
+	for (pIIterator = pThis->pFirstIterator; pIIterator; pIIterator = pIIterator->pNextIterator)
+	{
+		CSC_IIteratorInvalidateIteration(pIIterator);
+		pIIterator->epoch = pThis->epoch;
+	}
+}
+
+// Checks whether the elements are arrays themselves, whose buffers the array allocates and frees in batches.
+static CSC_BOOLEAN CSCMETHOD CSC_DynamicArrayHasNestedArrays(_In_ CONST CSC_DynamicArray* CONST pThis)
+{
+	if (pThis->pNestedContainerVTable != &g_DynamicArrayContainerVTable && pThis->pNestedContainerVTable != &g_DynamicArrayInlineContainerVTable)
+	{
+		return (CSC_BOOLEAN)FALSE;
+	}
+
+	return (CSC_BOOLEAN)TRUE;
+}
+
+// Checks whether copies of the nested array are made through CSC_DynamicArrayConstructNestedCopies.
+// Copies that share the buffer of the source or fit into their inline storage don't allocate, hence they are made one by one.
+static CSC_BOOLEAN CSCMETHOD CSC_DynamicArrayIsBatchCopy(_In_ CONST CSC_DynamicArray* CONST pThis, _In_ CONST CSC_DynamicArray* CONST pSource)
+{
+	if (!CSC_DynamicArrayHasNestedArrays(pThis) || CSC_DynamicArrayIsModifiable(pSource) != CSC_STATUS_SUCCESS)
+	{
+		return (CSC_BOOLEAN)FALSE;
+	}
+
+	if (pThis->pNestedContainerVTable == &g_DynamicArrayInlineContainerVTable)
+	{
+		return (CSC_BOOLEAN)(CSC_DynamicArrayGetElementCount(pSource) > CSC_DYNAMIC_ARRAY_INLINE_SIZE / pSource->elementSize);
+	}
+
+	return (CSC_BOOLEAN)(!pSource->isCopyOnWrite && CSC_DynamicArrayGetElementCount(pSource));
+}
+
+static void CSCMETHOD CSC_DynamicArrayDestroyElements(_Inout_ CSC_DynamicArray* CONST pThis, _In_ CONST CSC_SIZE_T firstIndex, _In_ CONST CSC_SIZE_T numOfElements)
+{
+	CSC_PVOID blocks[CSC_DYNAMIC_ARRAY_BATCH_SIZE];
+	CSC_SIZE_T blockSizes[CSC_DYNAMIC_ARRAY_BATCH_SIZE];
+	CSC_SIZE_T blockCount = (CSC_SIZE_T)0;
+	CSC_SIZE_T iterator;
+	CSC_BOOLEAN hasNestedArrays;
+
+	if (!pThis->pNestedContainerVTable)
+	{
+		return;
+	}
+
+	hasNestedArrays = CSC_DynamicArrayHasNestedArrays(pThis);
+
+	// The elements of removed slots have been destroyed on removal.
+	for (iterator = (CSC_SIZE_T)0; iterator < numOfElements; ++iterator)
+	{
+		if (pThis->tombstoneCount && CSC_DynamicArrayIsTombstone(pThis, firstIndex + iterator))
+		{
+			continue;
+		}
+
+		if (!hasNestedArrays)
+		{
+			pThis->pNestedContainerVTable->pDestroy(CSC_DynamicArrayGetElementContainer(CSC_DynamicArrayGetElement(pThis, firstIndex + iterator)));
+			continue;
+		}
+
+		// Nested arrays hand over their buffers, which are freed through a single batch call per CSC_DYNAMIC_ARRAY_BATCH_SIZE buffers.
+		// Allocators without a batch free method receive the size of every buffer through their sized free method instead.
+		CSC_DynamicArrayDestroyNested(CSC_CONTAINING_RECORD(CSC_DynamicArrayGetElementContainer(CSC_DynamicArrayGetElement(pThis, firstIndex + iterator)), CSC_DynamicArray, containerInterface), pThis->pIAllocator, &blocks[blockCount], &blockSizes[blockCount]);
+
+		if (blocks[blockCount] && ++blockCount == CSC_DYNAMIC_ARRAY_BATCH_SIZE)
+		{
+			CSC_IAllocatorFreeBatchSized(pThis->pIAllocator, blocks, blockSizes, blockCount);
+			blockCount = (CSC_SIZE_T)0;
+		}
+	}
+
+	if (blockCount)
+	{
+		CSC_IAllocatorFreeBatchSized(pThis->pIAllocator, blocks, blockSizes, blockCount);
+	}
+}
+
+// Fills uninitialized slots with copies of either a single value or an array of values, a null pointer as source zeroes the slots.
+// Nested containers are initialized with the allocator of the array, all copies made so far are destroyed if one of them fails.
+static CSC_STATUS CSCMETHOD CSC_DynamicArrayConstructElements(_In_ CONST CSC_DynamicArray* CONST pThis, _Out_ CONST CSC_PVOID pDst, _In_opt_ CONST CSC_PCVOID pSource, _In_ CONST CSC_SIZE_T numOfElements, _In_ CONST CSC_BOOLEAN isArray)
+{
+	CSC_STATUS status;
+	CSC_SIZE_T iterator;
+	CSC_IContainer* pDstContainer;
+	CONST CSC_IContainer* pSrcContainer;
+
+	if (!numOfElements)
+	{
+		return CSC_STATUS_SUCCESS;
+	}
+
+	if (!pThis->pNestedContainerVTable)
+	{
+		if (!pSource)
+		{
+			return CSC_MemoryUtilsSetZeroMemory(pDst, numOfElements * pThis->elementSize);
+		}
+
+		if (isArray)
+		{
+			return CSC_MemoryUtilsCopyMemory(pDst, pSource, numOfElements * pThis->elementSize);
+		}
+
+		return CSC_MemoryUtilsSetArrayValue(pDst, pSource, pThis->elementSize, numOfElements);
+	}
+
+	if (!pSource)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	if (!isArray && CSC_DynamicArrayIsBatchCopy(pThis, (CONST CSC_DynamicArray*)pSource))
+	{
+		return CSC_DynamicArrayConstructNestedCopies(pThis, pDst, (CONST CSC_DynamicArray*)pSource, numOfElements);
+	}
+
+	for (iterator = (CSC_SIZE_T)0; iterator < numOfElements; ++iterator)
+	{
+		pDstContainer = CSC_DynamicArrayGetElementContainer((CSC_BYTE*)pDst + iterator * pThis->elementSize);
+		pSrcContainer = CSC_DynamicArrayGetElementContainer((isArray) ? (CONST CSC_BYTE*)pSource + iterator * pThis->elementSize : (CONST CSC_BYTE*)pSource);
+
+		status = pThis->pNestedContainerVTable->pInitialize(pDstContainer, pThis->pNestedContainerVTable->pGetElementSize(pSrcContainer), pThis->pIAllocator);
+
+		if (status == CSC_STATUS_SUCCESS)
+		{
+			status = pThis->pNestedContainerVTable->pCopy(pDstContainer, pSrcContainer);
+
+			if (status != CSC_STATUS_SUCCESS)
+			{
+				pThis->pNestedContainerVTable->pDestroy(pDstContainer);
+			}
+		}
+
+		if (status != CSC_STATUS_SUCCESS)
+		{
+			while (iterator)
+			{
+				--iterator;
+				pThis->pNestedContainerVTable->pDestroy(CSC_DynamicArrayGetElementContainer((CSC_BYTE*)pDst + iterator * pThis->elementSize));
+			}
+
+			return status;
+		}
+	}
+
+	return CSC_STATUS_SUCCESS;
+}
+
+// Fills uninitialized slots with copies of the elements of another array, whose removed slots are skipped run by run, hence the source doesn't have to be compacted.
+// All copies made so far are destroyed if one of them fails.
+static CSC_STATUS CSCMETHOD CSC_DynamicArrayConstructRemainingElements(_In_ CONST CSC_DynamicArray* CONST pThis, _Out_ CONST CSC_PVOID pDst, _In_ CONST CSC_DynamicArray* CONST pSource)
+{
+	CSC_STATUS status = CSC_STATUS_SUCCESS;
+	CSC_SIZE_T copyCount = (CSC_SIZE_T)0;
+	CSC_SIZE_T runIndex;
+	CSC_SIZE_T runEnd;
+
+	for (runIndex = CSC_DynamicArrayFindSlot(pSource, (CSC_SIZE_T)0, (CSC_BOOLEAN)FALSE); runIndex < pSource->elementCount; runIndex = CSC_DynamicArrayFindSlot(pSource, runEnd, (CSC_BOOLEAN)FALSE))
+	{
+		runEnd = CSC_DynamicArrayFindSlot(pSource, runIndex, (CSC_BOOLEAN)TRUE);
+		status = CSC_DynamicArrayConstructElements(pThis, (CSC_BYTE*)pDst + copyCount * pThis->elementSize, CSC_DynamicArrayGetElement(pSource, runIndex), runEnd - runIndex, (CSC_BOOLEAN)TRUE);
+
+		if (status != CSC_STATUS_SUCCESS)
+		{
+			break;
+		}
+
+		copyCount += runEnd - runIndex;
+	}
+
+	if (status != CSC_STATUS_SUCCESS && pThis->pNestedContainerVTable)
+	{
+		while (copyCount)
+		{
+			--copyCount;
+			pThis->pNestedContainerVTable->pDestroy(CSC_DynamicArrayGetElementContainer((CSC_BYTE*)pDst + copyCount * pThis->elementSize));
+		}
+	}
+
+	return status;
+}
+
+// Moves the elements to a new buffer that can hold at least the requested amount of elements, a capacity of 0 releases the buffer.
+// The capacity is raised to the usable size that the allocator reports for the new buffer.
+// Arrays with inline storage move their elements back to it as soon as they fit.
+static CSC_STATUS CSCMETHOD CSC_DynamicArrayReallocate(_Inout_ CSC_DynamicArray* CONST pThis, _In_ CONST CSC_SIZE_T capacity)
+{
+	CSC_STATUS status;
+	CSC_PVOID pData = NULL;
+	CSC_SIZE_T newCapacity = (CSC_SIZE_T)0;
+	CONST CSC_SIZE_T inlineCapacity = CSC_DynamicArrayGetInlineCapacity(pThis);
+	CONST CSC_BOOLEAN isShared = CSC_DynamicArrayIsShared(pThis);
+
+	if (capacity < pThis->elementCount)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+#ifdef CSC_CONFIG_LINUX_NATIVE
+	if (pThis->isFileBacked)
+	{
+		status = CSC_DynamicArrayRemapFile(pThis, capacity);
+
+		if (status == CSC_STATUS_SUCCESS)
+		{
+			CSC_DynamicArrayAdvanceEpoch(pThis);
+		}
+
+		return status;
+	}
+#endif
+
+	if (inlineCapacity && capacity <= inlineCapacity)
+	{
+		if (!pThis->pData)
+		{
+			return CSC_STATUS_SUCCESS;
+		}
+
+		if (pThis->elementCount)
+		{
+			CSC_DynamicArrayRelocateElements(pThis, (CSC_BYTE*)pThis + sizeof(CSC_DynamicArray), pThis->pData, pThis->elementCount);
+		}
+
+		CSC_IAllocatorFreeSized(pThis->pIAllocator, pThis->pData, pThis->reservedSpace * pThis->elementSize);
+		pThis->pData = NULL;
+		pThis->reservedSpace = inlineCapacity;
+		CSC_DynamicArrayAdvanceEpoch(pThis);
+
+		return CSC_STATUS_SUCCESS;
+	}
+
+	if (capacity == pThis->reservedSpace && !isShared)
+	{
+		return CSC_STATUS_SUCCESS;
+	}
+
+	if (capacity)
+	{
+		pData = CSC_DynamicArrayAllocateBuffer(pThis, capacity, CSC_DynamicArrayGetHeaderSize(pThis), &newCapacity);
+
+		if (!pData)
+		{
+			return CSC_STATUS_MEMORY_NOT_ALLOCATED;
+		}
+
+		if (pThis->elementCount)
+		{
+			// The elements of a shared buffer still belong to the other arrays, hence they are copied instead of moved.
+			if (isShared)
+			{
+				status = CSC_DynamicArrayConstructElements(pThis, pData, CSC_DynamicArrayGetBuffer(pThis), pThis->elementCount, (CSC_BOOLEAN)TRUE);
+			}
+			else
+			{
+				status = CSC_DynamicArrayRelocateElements(pThis, pData, CSC_DynamicArrayGetBuffer(pThis), pThis->elementCount);
+			}
+
+			if (status != CSC_STATUS_SUCCESS)
+			{
+				CSC_DynamicArrayFreeBuffer(pThis, pData, newCapacity, CSC_DynamicArrayGetHeaderSize(pThis));
+				return status;
+			}
+		}
+	}
+
+	// A shared buffer is only released by the array that drops the last reference, which has to destroy the elements it copied.
+	if (pThis->pData && (!isShared || CSC_ATOMIC_FETCH_SUB(CSC_DynamicArrayGetReferenceCount(pThis), (CSC_SIZE_T)1) == (CSC_SIZE_T)1))
+	{
+		if (isShared)
+		{
+			CSC_DynamicArrayDestroyElements(pThis, (CSC_SIZE_T)0, pThis->elementCount);
+		}
+
+		CSC_DynamicArrayFreeBuffer(pThis, pThis->pData, pThis->reservedSpace, CSC_DynamicArrayGetHeaderSize(pThis));
+	}
+
+	pThis->pData = pData;
+	pThis->reservedSpace = newCapacity;
+	CSC_DynamicArrayAdvanceEpoch(pThis);
+
+	return CSC_STATUS_SUCCESS;
+}
+
+// Copies a shared buffer, afterwards the array is the only owner of it's buffer.
+static CSC_STATUS CSCMETHOD CSC_DynamicArrayMakeUnique(_Inout_ CSC_DynamicArray* CONST pThis)
+{
+	if (!CSC_DynamicArrayIsShared(pThis))
+	{
+		return CSC_STATUS_SUCCESS;
+	}
+
+	return CSC_DynamicArrayReallocate(pThis, pThis->reservedSpace);
+}
+
+static CSC_SIZE_T CSCMETHOD CSC_DynamicArrayCalculateGrowth(_In_ CONST CSC_DynamicArray* CONST pThis, _In_ CONST CSC_SIZE_T requiredCapacity)
+{
+	CONST CSC_SIZE_T maxElements = CSC_DynamicArrayCalculateMaxElements(pThis->elementSize);
+	CSC_SIZE_T capacity;
+	CSC_SIZE_T size;
+
+	if (pThis->growthPolicy == csc_dagp_Factor1_5)
+	{
+		capacity = pThis->reservedSpace + (pThis->reservedSpace >> 1);
+	}
+	else
+	{
+		capacity = pThis->reservedSpace << 1;
+	}
+
+	if (capacity > maxElements || capacity < pThis->reservedSpace)
+	{
+		capacity = maxElements;
+	}
+
+	if (capacity < CSC_DYNAMIC_ARRAY_MIN_CAPACITY)
+	{
+		capacity = (maxElements < CSC_DYNAMIC_ARRAY_MIN_CAPACITY) ? maxElements : CSC_DYNAMIC_ARRAY_MIN_CAPACITY;
+	}
+
+	if (capacity < requiredCapacity)
+	{
+		capacity = requiredCapacity;
+	}
+
+	if (pThis->growthPolicy == csc_dagp_PageRounded)
+	{
+		size = capacity * pThis->elementSize;
+
+		if (size > CSC_DYNAMIC_ARRAY_PAGE_SIZE)
+		{
+			size = (size + CSC_DYNAMIC_ARRAY_PAGE_SIZE - (CSC_SIZE_T)1) & ~(CSC_DYNAMIC_ARRAY_PAGE_SIZE - (CSC_SIZE_T)1);
+
+			if (size / pThis->elementSize <= maxElements)
+			{
+				capacity = size / pThis->elementSize;
+			}
+		}
+	}
+
+	return capacity;
+}
+
+// Ensures the capacity for the required amount of elements, afterwards the array is the only owner of it's buffer.
+static CSC_STATUS CSCMETHOD CSC_DynamicArrayGrow(_Inout_ CSC_DynamicArray* CONST pThis, _In_ CONST CSC_SIZE_T requiredCapacity)
+{
+	if (requiredCapacity <= pThis->reservedSpace)
+	{
+		return CSC_DynamicArrayMakeUnique(pThis);
+	}
+
+	if (requiredCapacity > CSC_DynamicArrayCalculateMaxElements(pThis->elementSize))
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	return CSC_DynamicArrayReallocate(pThis, CSC_DynamicArrayCalculateGrowth(pThis, requiredCapacity));
+}
+
+// Releases unused memory after a removal, lazy removals only shrink the buffer once it is mostly unused.
+// A failure to reallocate is ignored since the elements have been removed anyway.
+static void CSCMETHOD CSC_DynamicArrayShrink(_Inout_ CSC_DynamicArray* CONST pThis, _In_ CONST CSC_BOOLEAN lazy)
+{
+	CSC_SIZE_T capacity = pThis->elementCount;
+
+	if (lazy)
+	{
+		if (pThis->reservedSpace <= CSC_DYNAMIC_ARRAY_MIN_CAPACITY || pThis->elementCount >= pThis->reservedSpace / CSC_DYNAMIC_ARRAY_LAZY_SHRINK_DIVISOR)
+		{
+			return;
+		}
+
+		capacity = pThis->elementCount << 1;
+
+		if (capacity < CSC_DYNAMIC_ARRAY_MIN_CAPACITY)
+		{
+			capacity = CSC_DYNAMIC_ARRAY_MIN_CAPACITY;
+		}
+	}
+
+	if (capacity < pThis->reservedSpace)
+	{
+		CSC_DynamicArrayReallocate(pThis, capacity);
+	}
+}
+
+// Extends the bitmap of removed slots to the capacity of the array, bits of slots that weren't covered before are cleared.
+// The Fenwick tree that follows the bitmap is rebuilt in linear time by adding every node to the next node that covers it.
+static CSC_STATUS CSCMETHOD CSC_DynamicArrayReserveTombstones(_Inout_ CSC_DynamicArray* CONST pThis)
+{
+	CSC_SIZE_T* pTombstones;
+	CSC_SIZE_T* pTree;
+	CONST CSC_SIZE_T tombstoneWords = (pThis->reservedSpace + CSC_DYNAMIC_ARRAY_TOMBSTONE_BITS - (CSC_SIZE_T)1) / CSC_DYNAMIC_ARRAY_TOMBSTONE_BITS;
+	CSC_SIZE_T node;
+
+	if (pThis->elementCount <= pThis->tombstoneWords * CSC_DYNAMIC_ARRAY_TOMBSTONE_BITS)
+	{
+		return CSC_STATUS_SUCCESS;
+	}
+
+	pTombstones = (CSC_SIZE_T*)CSC_IAllocatorAllocZero(pThis->pIAllocator, (CSC_SIZE_T)2 * tombstoneWords * sizeof(CSC_SIZE_T));
+
+	if (!pTombstones)
+	{
+		return CSC_STATUS_MEMORY_NOT_ALLOCATED;
+	}
+
+	if (pThis->pTombstones)
+	{
+		CSC_MemoryUtilsCopyMemory(pTombstones, pThis->pTombstones, pThis->tombstoneWords * sizeof(CSC_SIZE_T));
+		CSC_IAllocatorFreeSized(pThis->pIAllocator, pThis->pTombstones, (CSC_SIZE_T)2 * pThis->tombstoneWords * sizeof(CSC_SIZE_T));
+	}
+
+	pThis->pTombstones = pTombstones;
+	pThis->tombstoneWords = tombstoneWords;
+	pTree = CSC_DynamicArrayGetTombstoneTree(pThis);
+
+	for (node = (CSC_SIZE_T)1; node <= tombstoneWords; ++node)
+	{
+		pTree[node - (CSC_SIZE_T)1] += CSC_POPULATION_COUNT(pTombstones[node - (CSC_SIZE_T)1]);
+
+		if (node + (node & ((CSC_SIZE_T)0 - node)) <= tombstoneWords)
+		{
+			pTree[node + (node & ((CSC_SIZE_T)0 - node)) - (CSC_SIZE_T)1] += pTree[node - (CSC_SIZE_T)1];
+		}
+	}
+
+	return CSC_STATUS_SUCCESS;
+}
+
+static void CSCMETHOD CSC_DynamicArrayClearTombstones(_Inout_ CSC_DynamicArray* CONST pThis)
+{
+	if (pThis->tombstoneCount)
+	{
+		CSC_MemoryUtilsSetZeroMemory(pThis->pTombstones, (CSC_SIZE_T)2 * pThis->tombstoneWords * sizeof(CSC_SIZE_T));
+		pThis->tombstoneCount = (CSC_SIZE_T)0;
+	}
+}
+
+static void CSCMETHOD CSC_DynamicArrayFreeTombstones(_Inout_ CSC_DynamicArray* CONST pThis)
+{
+	if (pThis->pTombstones)
+	{
+		CSC_IAllocatorFreeSized(pThis->pIAllocator, pThis->pTombstones, (CSC_SIZE_T)2 * pThis->tombstoneWords * sizeof(CSC_SIZE_T));
+	}
+
+	pThis->pTombstones = NULL;
+	pThis->tombstoneWords = (CSC_SIZE_T)0;
+	pThis->tombstoneCount = (CSC_SIZE_T)0;
+}
+
+// Moves the runs of elements between removed slots in front of each other, the runs are found through bit scans and moved as a whole.
+// Only functions that modify the array compact it, functions that receive the array as constant walk the runs of remaining elements instead or fail while slots are removed.
+// Buffers with removed slots are never shared, since removals copy a shared buffer and such buffers aren't shared with copies of the array.
+// Slots are only marked as removed in arrays of trivially relocatable elements, hence the runs are copied bytewise.
+static void CSCMETHOD CSC_DynamicArrayMakeContiguous(_Inout_ CSC_DynamicArray* CONST pThis)
+{
+	CSC_SIZE_T writeIndex;
+	CSC_SIZE_T runIndex;
+	CSC_SIZE_T runEnd;
+
+	if (!pThis->tombstoneCount)
+	{
+		return;
+	}
+
+	writeIndex = CSC_DynamicArrayFindSlot(pThis, (CSC_SIZE_T)0, (CSC_BOOLEAN)TRUE);
+	runEnd = writeIndex;
+
+	while (runEnd < pThis->elementCount)
+	{
+		runIndex = CSC_DynamicArrayFindSlot(pThis, runEnd, (CSC_BOOLEAN)FALSE);
+		runEnd = CSC_DynamicArrayFindSlot(pThis, runIndex, (CSC_BOOLEAN)TRUE);
+
+		if (runEnd > runIndex)
+		{
+			CSC_MemoryUtilsCopyMemory(CSC_DynamicArrayGetElement(pThis, writeIndex), CSC_DynamicArrayGetElement(pThis, runIndex), (runEnd - runIndex) * pThis->elementSize);
+			writeIndex += runEnd - runIndex;
+		}
+	}
+
+	CSC_DynamicArrayClearTombstones(pThis);
+	pThis->elementCount = writeIndex;
+	CSC_DynamicArrayAdvanceEpoch(pThis);
+}
+
+// Completes a removal that marked slots as removed, removed slots at the end are cut off and the array is compacted once too many slots are removed.
+static void CSCMETHOD CSC_DynamicArrayFinishRemoval(_Inout_ CSC_DynamicArray* CONST pThis, _In_ CONST CSC_BOOLEAN lazy)
+{
+	CONST CSC_SIZE_T lastElement = CSC_DynamicArrayFindPreviousElement(pThis, pThis->elementCount);
+	CONST CSC_SIZE_T elementCount = (lastElement == CSC_CONTAINER_INVALID_INDEX) ? (CSC_SIZE_T)0 : lastElement + (CSC_SIZE_T)1;
+	CSC_SIZE_T iterator;
+
+	// The last slot always holds an element, hence arrays without elements don't have any slots.
+	for (iterator = elementCount; iterator < pThis->elementCount; ++iterator)
+	{
+		CSC_DynamicArraySetTombstone(pThis, iterator, (CSC_BOOLEAN)FALSE);
+	}
+
+	pThis->tombstoneCount -= pThis->elementCount - elementCount;
+	pThis->elementCount = elementCount;
+
+	if (pThis->tombstoneCount && pThis->tombstoneCount * CSC_DYNAMIC_ARRAY_COMPACTION_DIVISOR >= pThis->elementCount)
+	{
+		CSC_DynamicArrayMakeContiguous(pThis);
+	}
+
+	CSC_DynamicArrayShrink(pThis, lazy);
+}
+
+// Inserts copies of either a single value or an array of values, the source may point into the array itself.
+static CSC_STATUS CSCMETHOD CSC_DynamicArrayInsertElements(_Inout_ CSC_DynamicArray* CONST pThis, _In_ CONST CSC_SIZE_T insertIndex, _In_ CONST CSC_SIZE_T numOfElements, _In_opt_ CONST CSC_PCVOID pSource, _In_ CONST CSC_BOOLEAN isArray)
+{
+	CSC_STATUS status;
+	CSC_BOOLEAN isOwnElement;
+	CSC_SIZE_T sourceOffset = (CSC_SIZE_T)0;
+	CSC_SIZE_T frontCount = (CSC_SIZE_T)0;
+	CSC_SIZE_T insertSlot;
+	CSC_SIZE_T tailCount;
+	CSC_BYTE* pDst;
+
+	if (insertIndex > CSC_DynamicArrayGetElementCount(pThis) || !numOfElements || numOfElements > CSC_DynamicArrayCalculateMaxElements(pThis->elementSize) - pThis->elementCount || (!pSource && pThis->pNestedContainerVTable))
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	// Sources within the array are moved by the reallocation and the shift of the tail, hence they are tracked by their offset.
+	isOwnElement = CSC_DynamicArrayIsOwnElement(pThis, pSource);
+
+	if (isOwnElement)
+	{
+		sourceOffset = (CSC_SIZE_T)((CONST CSC_BYTE*)pSource - CSC_DynamicArrayGetBuffer(pThis));
+
+		if (sourceOffset % pThis->elementSize)
+		{
+			return CSC_STATUS_INVALID_PARAMETER;
+		}
+
+		sourceOffset /= pThis->elementSize;
+
+		// The source is located through it's index once the array has been compacted, hence a range may span removed slots but must not begin at one.
+		if (pThis->tombstoneCount)
+		{
+			if (CSC_DynamicArrayIsTombstone(pThis, sourceOffset))
+			{
+				return CSC_STATUS_INVALID_PARAMETER;
+			}
+
+			sourceOffset -= CSC_DynamicArrayCountTombstones(pThis, sourceOffset);
+		}
+
+		if (isArray && numOfElements > CSC_DynamicArrayGetElementCount(pThis) - sourceOffset)
+		{
+			return CSC_STATUS_INVALID_PARAMETER;
+		}
+	}
+
+	// Elements are appended behind removed slots, insertions in front of the last element require contiguous elements.
+	if (pThis->tombstoneCount && (isOwnElement || insertIndex < CSC_DynamicArrayGetElementCount(pThis)))
+	{
+		CSC_DynamicArrayMakeContiguous(pThis);
+	}
+
+	insertSlot = insertIndex + pThis->tombstoneCount;
+	status = CSC_DynamicArrayGrow(pThis, pThis->elementCount + numOfElements);
+
+	if (status != CSC_STATUS_SUCCESS)
+	{
+		return status;
+	}
+
+	tailCount = pThis->elementCount - insertSlot;
+	pDst = (CSC_BYTE*)CSC_DynamicArrayGetElement(pThis, insertSlot);
+
+	if (tailCount)
+	{
+		CSC_DynamicArrayRelocateElements(pThis, CSC_DynamicArrayGetElement(pThis, insertSlot + numOfElements), pDst, tailCount);
+	}
+
+	if (!isOwnElement)
+	{
+		status = CSC_DynamicArrayConstructElements(pThis, pDst, pSource, numOfElements, isArray);
+	}
+	else
+	{
+		// Source elements in front of the insertion stayed in place, the remaining ones were shifted behind the gap.
+		if (sourceOffset < insertSlot)
+		{
+			frontCount = (isArray) ? insertSlot - sourceOffset : numOfElements;
+
+			if (frontCount > numOfElements)
+			{
+				frontCount = numOfElements;
+			}
+
+			status = CSC_DynamicArrayConstructElements(pThis, pDst, CSC_DynamicArrayGetElement(pThis, sourceOffset), frontCount, isArray);
+			sourceOffset = insertSlot;
+		}
+		else
+		{
+			status = CSC_STATUS_SUCCESS;
+		}
+
+		if (status == CSC_STATUS_SUCCESS && frontCount < numOfElements)
+		{
+			status = CSC_DynamicArrayConstructElements(pThis, pDst + frontCount * pThis->elementSize, CSC_DynamicArrayGetElement(pThis, sourceOffset + numOfElements), numOfElements - frontCount, isArray);
+
+			if (status != CSC_STATUS_SUCCESS)
+			{
+				CSC_DynamicArrayDestroyElements(pThis, insertSlot, frontCount);
+			}
+		}
+	}
+
+	if (status != CSC_STATUS_SUCCESS)
+	{
+		if (tailCount)
+		{
+			CSC_DynamicArrayRelocateElements(pThis, pDst, CSC_DynamicArrayGetElement(pThis, insertSlot + numOfElements), tailCount);
+		}
+
+		return status;
+	}
+
+	pThis->elementCount += numOfElements;
+	CSC_DynamicArrayAdvanceEpoch(pThis);
+
+	return CSC_STATUS_SUCCESS;
+}
+
+// Removes a range of elements, the elements are destroyed unless their ownership has been passed to the caller.
+static CSC_STATUS CSCMETHOD CSC_DynamicArrayRemoveElements(_Inout_ CSC_DynamicArray* CONST pThis, _In_ CONST CSC_SIZE_T removeIndex, _In_ CONST CSC_SIZE_T numOfElements, _In_ CONST CSC_BOOLEAN destroyElements, _In_ CONST CSC_BOOLEAN lazy)
+{
+	CSC_STATUS status;
+	CSC_SIZE_T tailCount;
+	CSC_SIZE_T slot;
+	CSC_SIZE_T iterator;
+
+	if (!numOfElements || removeIndex >= CSC_DynamicArrayGetElementCount(pThis) || numOfElements > CSC_DynamicArrayGetElementCount(pThis) - removeIndex)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	status = CSC_DynamicArrayMakeUnique(pThis);
+
+	if (status != CSC_STATUS_SUCCESS)
+	{
+		return status;
+	}
+
+	// Arrays in deferred compaction mode only mark the slots of the removed elements, the elements behind them stay in place.
+	// If the bitmap can't be extended or the elements can only be moved one by one, the elements are removed right away like in any other array.
+	if (pThis->isDeferredCompaction && CSC_DynamicArrayIsRelocatable(pThis) && CSC_DynamicArrayReserveTombstones(pThis) == CSC_STATUS_SUCCESS)
+	{
+		slot = CSC_DynamicArrayGetSlot(pThis, removeIndex);
+
+		for (iterator = (CSC_SIZE_T)0; iterator < numOfElements; ++iterator)
+		{
+			slot = CSC_DynamicArrayFindSlot(pThis, slot, (CSC_BOOLEAN)FALSE);
+
+			if (destroyElements)
+			{
+				CSC_DynamicArrayDestroyElements(pThis, slot, (CSC_SIZE_T)1);
+			}
+
+			CSC_DynamicArraySetTombstone(pThis, slot, (CSC_BOOLEAN)TRUE);
+			++slot;
+		}
+
+		pThis->tombstoneCount += numOfElements;
+		CSC_DynamicArrayAdvanceEpoch(pThis);
+		CSC_DynamicArrayFinishRemoval(pThis, lazy);
+
+		return CSC_STATUS_SUCCESS;
+	}
+
+	CSC_DynamicArrayMakeContiguous(pThis);
+
+	if (destroyElements)
+	{
+		CSC_DynamicArrayDestroyElements(pThis, removeIndex, numOfElements);
+	}
+
+	tailCount = pThis->elementCount - removeIndex - numOfElements;
+
+	if (tailCount)
+	{
+		CSC_DynamicArrayRelocateElements(pThis, CSC_DynamicArrayGetElement(pThis, removeIndex), CSC_DynamicArrayGetElement(pThis, removeIndex + numOfElements), tailCount);
+	}
+
+	pThis->elementCount -= numOfElements;
+	CSC_DynamicArrayAdvanceEpoch(pThis);
+	CSC_DynamicArrayShrink(pThis, lazy);
+
+	return CSC_STATUS_SUCCESS;
+}
+
+// Completes a compaction that moved the remaining elements in front of writeIndex.
+// A single removal is reported if the removed elements were adjacent, otherwise the iteration is invalidated.
+static void CSCMETHOD CSC_DynamicArrayFinishCompaction(_Inout_ CSC_DynamicArray* CONST pThis, _In_ CONST CSC_SIZE_T writeIndex, _In_ CONST CSC_SIZE_T firstRemovedIndex, _In_ CONST CSC_SIZE_T lastRemovedIndex)
+{
+	CONST CSC_SIZE_T numOfRemoved = pThis->elementCount - writeIndex;
+
+	pThis->elementCount = writeIndex;
+
+	if (lastRemovedIndex - firstRemovedIndex + (CSC_SIZE_T)1 == numOfRemoved)
+	{
+		CSC_DynamicArrayAdvanceEpoch(pThis);
+	}
+	else
+	{
+		CSC_DynamicArrayNotifyReplacement(pThis);
+	}
+
+	CSC_DynamicArrayShrink(pThis, (CSC_BOOLEAN)FALSE);
+}
+
+// Opens a gap of uninitialized slots at the given index, which are added to the array once they are committed.
+static CSC_PVOID CSCMETHOD CSC_DynamicArrayEmplaceElements(_Inout_ CSC_DynamicArray* CONST pThis, _In_ CONST CSC_SIZE_T insertIndex, _In_ CONST CSC_SIZE_T numOfElements)
+{
+	CSC_SIZE_T insertSlot;
+	CSC_SIZE_T tailCount;
+
+	if (pThis->emplaceCount || insertIndex > CSC_DynamicArrayGetElementCount(pThis) || !numOfElements || numOfElements > CSC_DynamicArrayCalculateMaxElements(pThis->elementSize) - pThis->elementCount)
+	{
+		return NULL;
+	}
+
+	if (pThis->tombstoneCount && insertIndex < CSC_DynamicArrayGetElementCount(pThis))
+	{
+		CSC_DynamicArrayMakeContiguous(pThis);
+	}
+
+	if (CSC_DynamicArrayGrow(pThis, pThis->elementCount + numOfElements) != CSC_STATUS_SUCCESS)
+	{
+		return NULL;
+	}
+
+	insertSlot = insertIndex + pThis->tombstoneCount;
+	tailCount = pThis->elementCount - insertSlot;
+
+	if (tailCount)
+	{
+		CSC_DynamicArrayRelocateElements(pThis, CSC_DynamicArrayGetElement(pThis, insertSlot + numOfElements), CSC_DynamicArrayGetElement(pThis, insertSlot), tailCount);
+	}
+
+	pThis->emplaceIndex = insertSlot;
+	pThis->emplaceCount = numOfElements;
+
+	return CSC_DynamicArrayGetElement(pThis, insertSlot);
+}
+
+static CSC_STATUS CSCMETHOD CSC_DynamicArrayPopElement(_Inout_ CSC_DynamicArray* CONST pThis, _In_ CONST CSC_SIZE_T index, _Out_opt_ CONST CSC_PVOID pValue, _In_ CONST CSC_BOOLEAN lazy)
+{
+	CSC_STATUS status;
+
+	if (!pThis->elementCount)
+	{
+		return CSC_STATUS_GENERAL_FAILURE;
+	}
+
+	status = CSC_DynamicArrayMakeUnique(pThis);
+
+	if (status != CSC_STATUS_SUCCESS)
+	{
+		return status;
+	}
+
+	// The popped element is moved to the value, which passes the ownership of nested containers to the caller.
+	if (pValue)
+	{
+		status = CSC_DynamicArrayRelocateElements(pThis, pValue, CSC_DynamicArrayGetElement(pThis, CSC_DynamicArrayGetSlot(pThis, index)), (CSC_SIZE_T)1);
+
+		if (status != CSC_STATUS_SUCCESS)
+		{
+			return status;
+		}
+	}
+
+	return CSC_DynamicArrayRemoveElements(pThis, index, (CSC_SIZE_T)1, (pValue) ? (CSC_BOOLEAN)FALSE : (CSC_BOOLEAN)TRUE, lazy);
+}
+
+// Destroys a nested array of an array that uses the given allocator, the buffer and it's size are stored in ppBlock and pBlockSize instead of being freed, hence the enclosing array can free the buffers of it's elements at once.
+// Arrays whose buffer can't be handed over, since it is shared, mapped from a file or owned by another allocator, are destroyed as usual and store a null pointer.
+static void CSCMETHOD CSC_DynamicArrayDestroyNested(_Inout_ CSC_DynamicArray* CONST pThis, _In_ CONST CSC_IAllocator* CONST pIAllocator, _Out_ CSC_PVOID* CONST ppBlock, _Out_ CSC_SIZE_T* CONST pBlockSize)
+{
+	*ppBlock = NULL;
+	*pBlockSize = (CSC_SIZE_T)0;
+
+	if (CSC_DynamicArrayIsModifiable(pThis) != CSC_STATUS_SUCCESS || !pThis->pData || pThis->pIAllocator != pIAllocator || pThis->isFileBacked || pThis->pFirstIterator || CSC_DynamicArrayIsShared(pThis))
+	{
+		CSC_DynamicArrayDestroy(pThis);
+		return;
+	}
+
+	CSC_DynamicArrayDestroyElements(pThis, (CSC_SIZE_T)0, pThis->elementCount);
+	*ppBlock = (CSC_BYTE*)pThis->pData - CSC_DynamicArrayGetHeaderSize(pThis);
+	*pBlockSize = CSC_DynamicArrayGetHeaderSize(pThis) + pThis->reservedSpace * pThis->elementSize;
+	CSC_DynamicArrayFreeTombstones(pThis);
+	CSC_DynamicArrayZeroMemory(pThis);
+}
+
+// Fills uninitialized slots with copies of a nested array, the buffers of the copies are allocated through a single batch call per CSC_DYNAMIC_ARRAY_BATCH_SIZE copies.
+// All copies made so far are destroyed if one of them fails.
+static CSC_STATUS CSCMETHOD CSC_DynamicArrayConstructNestedCopies(_In_ CONST CSC_DynamicArray* CONST pThis, _Out_ CONST CSC_PVOID pDst, _In_ CONST CSC_DynamicArray* CONST pSource, _In_ CONST CSC_SIZE_T numOfElements)
+{
+	CSC_PVOID blocks[CSC_DYNAMIC_ARRAY_BATCH_SIZE];
+	CSC_SIZE_T blockSizes[CSC_DYNAMIC_ARRAY_BATCH_SIZE];
+	CSC_STATUS status = CSC_STATUS_SUCCESS;
+	CSC_DynamicArray* pCopy;
+	CSC_SIZE_T copyCount = (CSC_SIZE_T)0;
+	CSC_SIZE_T batchCount;
+	CSC_SIZE_T blockIndex;
+	CSC_SIZE_T blockSize;
+
+	// Removed slots of the source are skipped while it's elements are copied, hence the copies only hold the remaining elements.
+	blockSize = CSC_DynamicArrayGetElementCount(pSource) * pSource->elementSize;
+
+	for (blockIndex = (CSC_SIZE_T)0; blockIndex < CSC_DYNAMIC_ARRAY_BATCH_SIZE; ++blockIndex)
+	{
+		blockSizes[blockIndex] = blockSize;
+	}
+
+	while (copyCount < numOfElements && status == CSC_STATUS_SUCCESS)
+	{
+		batchCount = (numOfElements - copyCount < CSC_DYNAMIC_ARRAY_BATCH_SIZE) ? numOfElements - copyCount : CSC_DYNAMIC_ARRAY_BATCH_SIZE;
+		status = CSC_IAllocatorAllocBatch(pThis->pIAllocator, blockSize, batchCount, blocks);
+
+		if (status != CSC_STATUS_SUCCESS)
+		{
+			break;
+		}
+
+		for (blockIndex = (CSC_SIZE_T)0; blockIndex < batchCount && status == CSC_STATUS_SUCCESS; ++blockIndex)
+		{
+			pCopy = CSC_CONTAINING_RECORD(CSC_DynamicArrayGetElementContainer((CSC_BYTE*)pDst + copyCount * pThis->elementSize), CSC_DynamicArray, containerInterface);
+			status = pThis->pNestedContainerVTable->pInitialize(&pCopy->containerInterface, pSource->elementSize, pThis->pIAllocator);
+
+			if (status != CSC_STATUS_SUCCESS)
+			{
+				break;
+			}
+
+			pCopy->pNestedContainerVTable = pSource->pNestedContainerVTable;
+			pCopy->growthPolicy = pSource->growthPolicy;
+			pCopy->isDeferredCompaction = pSource->isDeferredCompaction;
+			pCopy->pData = blocks[blockIndex];
+			pCopy->reservedSpace = CSC_DynamicArrayCalculateBlockCapacity(pCopy, pCopy->pData, blockSize, (CSC_SIZE_T)0);
+			blocks[blockIndex] = NULL;
+
+			status = CSC_DynamicArrayConstructRemainingElements(pCopy, pCopy->pData, pSource);
+
+			if (status != CSC_STATUS_SUCCESS)
+			{
+				CSC_DynamicArrayDestroy(pCopy);
+				break;
+			}
+
+			pCopy->elementCount = CSC_DynamicArrayGetElementCount(pSource);
+			++copyCount;
+		}
+
+		// Blocks that weren't handed over to a copy are freed if a copy failed.
+		if (status != CSC_STATUS_SUCCESS)
+		{
+			CSC_IAllocatorFreeBatchSized(pThis->pIAllocator, blocks + blockIndex, blockSizes + blockIndex, batchCount - blockIndex);
+		}
+	}
+
+	if (status != CSC_STATUS_SUCCESS)
+	{
+		while (copyCount)
+		{
+			--copyCount;
+			pThis->pNestedContainerVTable->pDestroy(CSC_DynamicArrayGetElementContainer((CSC_BYTE*)pDst + copyCount * pThis->elementSize));
+		}
+	}
+
+	return status;
+}
+
+// Releases the elements and the buffer of the array.
+// Arrays that share their buffer only drop their reference, the elements and the buffer are released by the array that drops the last reference.
+static void CSCMETHOD CSC_DynamicArrayRelease(_Inout_ CSC_DynamicArray* CONST pThis)
+{
+#ifdef CSC_CONFIG_LINUX_NATIVE
+	// File-backed arrays keep their mapping until they are destroyed, hence only the file is truncated.
+	if (pThis->isFileBacked)
+	{
+		pThis->elementCount = (CSC_SIZE_T)0;
+		CSC_DynamicArrayReallocate(pThis, (CSC_SIZE_T)0);
+		return;
+	}
+#endif
+
+	if (!CSC_DynamicArrayIsShared(pThis) || CSC_ATOMIC_FETCH_SUB(CSC_DynamicArrayGetReferenceCount(pThis), (CSC_SIZE_T)1) == (CSC_SIZE_T)1)
+	{
+		CSC_DynamicArrayDestroyElements(pThis, (CSC_SIZE_T)0, pThis->elementCount);
+
+		if (pThis->pData)
+		{
+			CSC_DynamicArrayFreeBuffer(pThis, pThis->pData, pThis->reservedSpace, CSC_DynamicArrayGetHeaderSize(pThis));
+		}
+	}
+
+	CSC_DynamicArrayFreeTombstones(pThis);
+	pThis->elementCount = (CSC_SIZE_T)0;
+	pThis->pData = NULL;
+	pThis->reservedSpace = CSC_DynamicArrayGetInlineCapacity(pThis);
+}
+
+// Destroys all elements but keeps the buffer, a shared buffer is released instead since it's elements belong to the other arrays as well.
+static void CSCMETHOD CSC_DynamicArrayDiscardElements(_Inout_ CSC_DynamicArray* CONST pThis)
+{
+	if (CSC_DynamicArrayIsShared(pThis))
+	{
+		CSC_DynamicArrayRelease(pThis);
+		return;
+	}
+
+	CSC_DynamicArrayDestroyElements(pThis, (CSC_SIZE_T)0, pThis->elementCount);
+	CSC_DynamicArrayClearTombstones(pThis);
+	pThis->elementCount = (CSC_SIZE_T)0;
+}
+
+// Shares the buffer of a copy-on-write array with an array that doesn't hold any buffer.
+// Returns FALSE if the buffer can't be shared, in which case the elements have to be copied.
+static CSC_BOOLEAN CSCMETHOD CSC_DynamicArrayShareBuffer(_Inout_ CSC_DynamicArray* CONST pThis, _In_ CONST CSC_DynamicArray* CONST pSrc)
+{
+	// Uninitialized slots of a pending emplacement are written after the copy and the bitmap of removed slots isn't shared, hence such buffers are never shared.
+	if (!pSrc->isCopyOnWrite || !pSrc->pData || pSrc->emplaceCount || pSrc->tombstoneCount || pThis->inlineCapacity || pThis->pData || pThis->pIAllocator != pSrc->pIAllocator)
+	{
+		return (CSC_BOOLEAN)FALSE;
+	}
+
+	CSC_ATOMIC_FETCH_ADD(CSC_DynamicArrayGetReferenceCount(pSrc), (CSC_SIZE_T)1);
+
+	pThis->pData = pSrc->pData;
+	pThis->elementCount = pSrc->elementCount;
+	pThis->reservedSpace = pSrc->reservedSpace;
+	pThis->isCopyOnWrite = (CSC_BOOLEAN)TRUE;
+
+	return (CSC_BOOLEAN)TRUE;
+}
+
+// Replaces the contents of the array with copies of either a single value or an array of values.
+static CSC_STATUS CSCMETHOD CSC_DynamicArrayAssignElements(_Inout_ CSC_DynamicArray* CONST pThis, _In_ CONST CSC_SIZE_T numOfElements, _In_opt_ CONST CSC_PCVOID pSource, _In_ CONST CSC_BOOLEAN isArray)
+{
+	CSC_STATUS status;
+	CONST CSC_BOOLEAN isOwnElement = CSC_DynamicArrayIsOwnElement(pThis, pSource);
+	CSC_SIZE_T sourceOffset = (CSC_SIZE_T)0;
+	CSC_SIZE_T sourceSlot;
+
+	if (numOfElements > CSC_DynamicArrayCalculateMaxElements(pThis->elementSize) || (!pSource && pThis->pNestedContainerVTable))
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	// Plain data within the array is kept in place until it has been copied, nested containers would be destroyed before they are copied.
+	if (isOwnElement)
+	{
+		if (pThis->pNestedContainerVTable)
+		{
+			return CSC_STATUS_INVALID_PARAMETER;
+		}
+
+		sourceOffset = (CSC_SIZE_T)((CONST CSC_BYTE*)pSource - CSC_DynamicArrayGetBuffer(pThis));
+
+		// The source is moved by the compaction, hence it must not contain removed slots.
+		if (pThis->tombstoneCount)
+		{
+			sourceSlot = sourceOffset / pThis->elementSize;
+
+			if (CSC_DynamicArrayCountTombstones(pThis, sourceSlot + ((isArray) ? numOfElements : (CSC_SIZE_T)1)) != CSC_DynamicArrayCountTombstones(pThis, sourceSlot))
+			{
+				return CSC_STATUS_INVALID_PARAMETER;
+			}
+
+			sourceOffset -= CSC_DynamicArrayCountTombstones(pThis, sourceSlot) * pThis->elementSize;
+			CSC_DynamicArrayMakeContiguous(pThis);
+		}
+
+		status = CSC_DynamicArrayMakeUnique(pThis);
+
+		if (status != CSC_STATUS_SUCCESS)
+		{
+			return status;
+		}
+	}
+	else
+	{
+		CSC_DynamicArrayDiscardElements(pThis);
+	}
+
+	if (numOfElements > pThis->reservedSpace)
+	{
+		status = CSC_DynamicArrayReallocate(pThis, numOfElements);
+
+		if (status != CSC_STATUS_SUCCESS)
+		{
+			if (!isOwnElement)
+			{
+				CSC_DynamicArrayNotifyReplacement(pThis);
+			}
+
+			return status;
+		}
+	}
+
+	status = CSC_DynamicArrayConstructElements(pThis, CSC_DynamicArrayGetBuffer(pThis), (isOwnElement) ? (CSC_PCVOID)(CSC_DynamicArrayGetBuffer(pThis) + sourceOffset) : pSource, numOfElements, isArray);
+	pThis->elementCount = (status == CSC_STATUS_SUCCESS) ? numOfElements : (CSC_SIZE_T)0;
+	CSC_DynamicArrayNotifyReplacement(pThis);
+
+	return status;
+}
+
+// Replaces the contents of the array with copies of the elements of another array that has removed slots, which is left untouched.
+static CSC_STATUS CSCMETHOD CSC_DynamicArrayAssignRemainingElements(_Inout_ CSC_DynamicArray* CONST pThis, _In_ CONST CSC_DynamicArray* CONST pSrc)
+{
+	CSC_STATUS status;
+	CONST CSC_SIZE_T numOfElements = CSC_DynamicArrayGetElementCount(pSrc);
+
+	CSC_DynamicArrayDiscardElements(pThis);
+
+	if (numOfElements > pThis->reservedSpace)
+	{
+		status = CSC_DynamicArrayReallocate(pThis, numOfElements);
+
+		if (status != CSC_STATUS_SUCCESS)
+		{
+			CSC_DynamicArrayNotifyReplacement(pThis);
+			return status;
+		}
+	}
+
+	status = CSC_DynamicArrayConstructRemainingElements(pThis, CSC_DynamicArrayGetBuffer(pThis), pSrc);
+	pThis->elementCount = (status == CSC_STATUS_SUCCESS) ? numOfElements : (CSC_SIZE_T)0;
+	CSC_DynamicArrayNotifyReplacement(pThis);
+
+	return status;
+}
+
+// Checks whether the elements of another array can be inserted into the array.
+static CSC_BOOLEAN CSCMETHOD CSC_DynamicArrayIsCompatible(_In_ CONST CSC_DynamicArray* CONST pThis, _In_ CONST CSC_DynamicArray* CONST pOther)
+{
+	if (CSC_DynamicArrayIsModifiable(pOther) != CSC_STATUS_SUCCESS || pThis->elementSize != pOther->elementSize || pThis->pNestedContainerVTable != pOther->pNestedContainerVTable)
+	{
+		return (CSC_BOOLEAN)FALSE;
+	}
+
+	return (CSC_BOOLEAN)TRUE;
+}
+
+static CSC_STATUS CSCMETHOD CSC_DynamicArrayInitializeStorage(_Out_ CSC_DynamicArray* CONST pThis, _In_ CONST CSC_SIZE_T elementSize, _In_ CONST CSC_SIZE_T inlineCapacity, _In_ CONST CSC_IAllocator* CONST pIAllocator, _In_ CONST CSC_IContainerVirtualTable* CONST pNestedContainerVTable)
+{
+	if (!pThis || !elementSize || !pIAllocator || !CSC_IAllocatorIsUsable(pIAllocator))
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	// Trivially relocatable element containers are moved bytewise, the other ones are moved one by one through their move method.
+	if (pNestedContainerVTable && (!pNestedContainerVTable->pInitialize || !pNestedContainerVTable->pDestroy || !pNestedContainerVTable->pCopy || !pNestedContainerVTable->pGetElementSize || elementSize < sizeof(CSC_IBaseInterface) + sizeof(CSC_IContainer)))
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	if (pNestedContainerVTable && !pNestedContainerVTable->isTriviallyRelocatable && (!pNestedContainerVTable->pMove || !pNestedContainerVTable->pGetIAllocator))
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	CSC_MemoryUtilsSetZeroMemory(pThis, sizeof(*pThis));
+
+	pThis->baseInterface.pIBaseInterfaceVirtualTable = &g_DynamicArrayBaseInterfaceVTable;
+	pThis->containerInterface.pIContainerVirtualTable = (inlineCapacity) ? &g_DynamicArrayInlineContainerVTable : &g_DynamicArrayContainerVTable;
+	pThis->iterableInterface.pIIterableVirtualTable = &g_DynamicArrayIterableVTable;
+	pThis->pIAllocator = (CSC_IAllocator*)pIAllocator;
+	pThis->pNestedContainerVTable = (CSC_IContainerVirtualTable*)pNestedContainerVTable;
+	pThis->elementSize = elementSize;
+	pThis->growthPolicy = csc_dagp_Factor2;
+	pThis->inlineCapacity = inlineCapacity;
+	pThis->reservedSpace = CSC_DynamicArrayGetInlineCapacity(pThis);
+
+	return CSC_STATUS_SUCCESS;
+}
+
+// Initializes the array from the reader, the capacity is reserved once and the elements are read directly into their slots.
+// Element containers are committed once they have been deserialized completely, hence destroying the array on failure releases exactly those.
+static CSC_STATUS CSCMETHOD CSC_DynamicArrayDeserializeStorage(_Out_ CSC_DynamicArray* CONST pThis, _Inout_ CSC_SerializationReader* CONST pReader, _In_ CONST CSC_SIZE_T inlineCapacity, _In_ CONST CSC_IAllocator* CONST pIAllocator, _In_opt_ CONST CSC_IContainerVirtualTable* CONST pNestedContainerVTable)
+{
+	CSC_STATUS status;
+	CSC_DynamicArraySerializationHeader header;
+	CSC_BOOLEAN isNested;
+	CSC_BYTE* pElements;
+	CSC_SIZE_T totalSize;
+	CSC_SIZE_T offset = (CSC_SIZE_T)0;
+	CSC_SIZE_T iterator = (CSC_SIZE_T)0;
+	CSC_QWORD blockSize;
+
+	if (!pThis || !pReader)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	status = CSC_SerializationUtilsRead(pReader, &header, sizeof(header));
+
+	if (status != CSC_STATUS_SUCCESS)
+	{
+		return status;
+	}
+
+	isNested = (header.flags & CSC_DYNAMIC_ARRAY_SERIALIZATION_FLAG_NESTED) ? (CSC_BOOLEAN)TRUE : (CSC_BOOLEAN)FALSE;
+
+	if (!header.elementSize || (CSC_QWORD)(CSC_SIZE_T)header.elementSize != header.elementSize || header.elementCount > (CSC_QWORD)CSC_DynamicArrayCalculateMaxElements((CSC_SIZE_T)header.elementSize) || (header.flags & ~CSC_DYNAMIC_ARRAY_SERIALIZATION_FLAG_NESTED))
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	if (isNested && (!pNestedContainerVTable || !pNestedContainerVTable->pDeserialize))
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	status = CSC_DynamicArrayInitializeStorage(pThis, (CSC_SIZE_T)header.elementSize, inlineCapacity, pIAllocator, (isNested) ? pNestedContainerVTable : NULL);
+
+	if (status != CSC_STATUS_SUCCESS || !header.elementCount)
+	{
+		return status;
+	}
+
+	status = CSC_DynamicArrayReserve(pThis, (CSC_SIZE_T)header.elementCount);
+	pElements = (status == CSC_STATUS_SUCCESS) ? (CSC_BYTE*)CSC_DynamicArrayExtendUninitialized(pThis, (CSC_SIZE_T)header.elementCount) : NULL;
+
+	if (!pElements)
+	{
+		CSC_DynamicArrayDestroy(pThis);
+		return CSC_STATUS_MEMORY_NOT_ALLOCATED;
+	}
+
+	if (isNested)
+	{
+		for (; iterator < (CSC_SIZE_T)header.elementCount && status == CSC_STATUS_SUCCESS; ++iterator)
+		{
+			status = pNestedContainerVTable->pDeserialize(CSC_DynamicArrayGetElementContainer(pElements + iterator * pThis->elementSize), pReader, pThis->pIAllocator, pThis->pNestedContainerVTable);
+		}
+
+		if (status != CSC_STATUS_SUCCESS)
+		{
+			--iterator;
+		}
+	}
+	else
+	{
+		totalSize = (CSC_SIZE_T)header.elementCount * pThis->elementSize;
+
+		while (offset < totalSize)
+		{
+			status = CSC_SerializationUtilsRead(pReader, &blockSize, sizeof(blockSize));
+
+			if (status == CSC_STATUS_SUCCESS && (!blockSize || blockSize > (CSC_QWORD)CSC_SERIALIZATION_UTILS_MAX_BLOCK_SIZE || blockSize > (CSC_QWORD)(totalSize - offset)))
+			{
+				status = CSC_STATUS_INVALID_PARAMETER;
+			}
+
+			if (status == CSC_STATUS_SUCCESS)
+			{
+				status = CSC_SerializationUtilsRead(pReader, pElements + offset, (CSC_SIZE_T)blockSize);
+			}
+
+			if (status != CSC_STATUS_SUCCESS)
+			{
+				break;
+			}
+
+			offset += (CSC_SIZE_T)blockSize;
+		}
+
+		iterator = (status == CSC_STATUS_SUCCESS) ? (CSC_SIZE_T)header.elementCount : (CSC_SIZE_T)0;
+	}
+
+	CSC_DynamicArrayCommitEmplace(pThis, iterator);
+
+	if (status != CSC_STATUS_SUCCESS)
+	{
+		CSC_DynamicArrayDestroy(pThis);
+	}
+
+	return status;
+}
+
+
+static CSC_PCVOID CSCMETHOD CSC_DynamicArrayGetInterface(_In_ CONST CSC_IBaseInterface* CONST pThis, _In_ CONST EBaseInterfaceType interfaceType)
+{
+	CONST CSC_DynamicArray* CONST pArray = (CONST CSC_DynamicArray* CONST)pThis;
+
+	if (!pThis)
+	{
+		return NULL;
+	}
+
+	switch (interfaceType)
+	{
+	case csc_bit_IContainer:
+
+		return (CSC_PCVOID)&pArray->containerInterface;
+
+	case csc_bit_IIterable:
+
+		return (CSC_PCVOID)&pArray->iterableInterface;
+
+	default:
+
+		return NULL;
+	}
+}
+
+static CSC_STATUS CSCMETHOD CSC_DynamicArrayIContainerInitialize(_Out_ CSC_IContainer* CONST pThis, _In_ CONST CSC_SIZE_T elementSize, _In_ CSC_IAllocator* CONST pIAllocator)
+{
+	if (!pThis)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	return CSC_DynamicArrayInitialize(CSC_CONTAINING_RECORD(pThis, CSC_DynamicArray, containerInterface), elementSize, pIAllocator, NULL);
+}
+
+static CSC_STATUS CSCMETHOD CSC_DynamicArrayIContainerInitializeInline(_Out_ CSC_IContainer* CONST pThis, _In_ CONST CSC_SIZE_T elementSize, _In_ CSC_IAllocator* CONST pIAllocator)
+{
+	if (!pThis)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	return CSC_DynamicArrayInitializeInline(CSC_CONTAINING_RECORD(pThis, CSC_DynamicArray, containerInterface), elementSize, pIAllocator, NULL);
+}
+
+static CSC_STATUS CSCMETHOD CSC_DynamicArrayIContainerErase(_Inout_ CSC_IContainer* CONST pThis)
+{
+	if (!pThis)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	return CSC_DynamicArrayErase(CSC_CONTAINING_RECORD(pThis, CSC_DynamicArray, containerInterface));
+}
+
+static CSC_STATUS CSCMETHOD CSC_DynamicArrayIContainerDestroy(_Inout_ CSC_IContainer* CONST pThis)
+{
+	if (!pThis)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	return CSC_DynamicArrayDestroy(CSC_CONTAINING_RECORD(pThis, CSC_DynamicArray, containerInterface));
+}
+
+static CSC_STATUS CSCMETHOD CSC_DynamicArrayIContainerCopy(_Inout_ CSC_IContainer* CONST pThis, _In_ CONST CSC_IContainer* CONST pOther)
+{
+	if (!pThis || !pOther || (pOther->pIContainerVirtualTable != &g_DynamicArrayContainerVTable && pOther->pIContainerVirtualTable != &g_DynamicArrayInlineContainerVTable))
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	return CSC_DynamicArrayCopy(CSC_CONTAINING_RECORD(pThis, CSC_DynamicArray, containerInterface), CSC_CONTAINING_RECORD(pOther, CONST CSC_DynamicArray, containerInterface));
+}
+
+static CSC_STATUS CSCMETHOD CSC_DynamicArrayIContainerMove(_Inout_ CSC_IContainer* CONST pThis, _Inout_ CSC_IContainer* CONST pOther)
+{
+	if (!pThis || !pOther || (pOther->pIContainerVirtualTable != &g_DynamicArrayContainerVTable && pOther->pIContainerVirtualTable != &g_DynamicArrayInlineContainerVTable))
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	return CSC_DynamicArrayMove(CSC_CONTAINING_RECORD(pThis, CSC_DynamicArray, containerInterface), CSC_CONTAINING_RECORD(pOther, CSC_DynamicArray, containerInterface));
+}
+
+static CSC_STATUS CSCMETHOD CSC_DynamicArrayIContainerInsertRange(_Inout_ CSC_IContainer* CONST pThis, _In_ CONST CSC_SIZE_T insertIndex, _In_ CONST CSC_SIZE_T numOfElements, _In_opt_ CONST CSC_PCVOID pElements)
+{
+	if (!pThis)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	return CSC_DynamicArrayInsertRange(CSC_CONTAINING_RECORD(pThis, CSC_DynamicArray, containerInterface), insertIndex, pElements, numOfElements);
+}
+
+static CSC_STATUS CSCMETHOD CSC_DynamicArrayIContainerRemoveRange(_Inout_ CSC_IContainer* CONST pThis, _In_ CONST CSC_SIZE_T removeIndex, _In_ CONST CSC_SIZE_T numOfElements)
+{
+	if (!pThis)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	return CSC_DynamicArrayRemoveRange(CSC_CONTAINING_RECORD(pThis, CSC_DynamicArray, containerInterface), removeIndex, numOfElements);
+}
+
+static CSC_STATUS CSCMETHOD CSC_DynamicArrayIContainerSwapValues(_Inout_ CSC_IContainer* CONST pThis, _In_ CONST CSC_SIZE_T firstIndex, _In_ CONST CSC_SIZE_T secondIndex)
+{
+	CSC_STATUS status;
+	CSC_DynamicArray* pArray;
+	CSC_PVOID pFirst;
+	CSC_PVOID pSecond;
+	CSC_PVOID pTemporary;
+
+	if (!pThis)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	pArray = CSC_CONTAINING_RECORD(pThis, CSC_DynamicArray, containerInterface);
+
+	if (CSC_DynamicArrayIsValid(pArray) != CSC_STATUS_SUCCESS || firstIndex >= CSC_DynamicArrayGetElementCount(pArray) || secondIndex >= CSC_DynamicArrayGetElementCount(pArray))
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	status = CSC_DynamicArrayMakeUnique(pArray);
+
+	if (status != CSC_STATUS_SUCCESS)
+	{
+		return status;
+	}
+
+	pFirst = CSC_DynamicArrayGetElement(pArray, CSC_DynamicArrayGetSlot(pArray, firstIndex));
+	pSecond = CSC_DynamicArrayGetElement(pArray, CSC_DynamicArrayGetSlot(pArray, secondIndex));
+
+	if (CSC_DynamicArrayIsRelocatable(pArray) || pFirst == pSecond)
+	{
+		return CSC_MemoryUtilsSwapValues(pFirst, pSecond, pArray->elementSize, pArray->pIAllocator);
+	}
+
+	// Element containers that aren't trivially relocatable are swapped through a temporary container.
+	pTemporary = CSC_IAllocatorAlloc(pArray->pIAllocator, pArray->elementSize);
+
+	if (!pTemporary)
+	{
+		return CSC_STATUS_MEMORY_NOT_ALLOCATED;
+	}
+
+	status = CSC_DynamicArrayRelocateElement(pArray, pTemporary, pFirst);
+
+	if (status == CSC_STATUS_SUCCESS)
+	{
+		status = CSC_DynamicArrayRelocateElement(pArray, pFirst, pSecond);
+		CSC_DynamicArrayRelocateElement(pArray, (status == CSC_STATUS_SUCCESS) ? pSecond : pFirst, pTemporary);
+	}
+
+	CSC_IAllocatorFreeSized(pArray->pIAllocator, pTemporary, pArray->elementSize);
+
+	return status;
+}
+
+static CSC_PVOID CSCMETHOD CSC_DynamicArrayIContainerAccessElement(_In_ CONST CSC_IContainer* CONST pThis, _In_ CONST CSC_SIZE_T index)
+{
+	if (!pThis)
+	{
+		return NULL;
+	}
+
+	return CSC_DynamicArrayAccessElement(CSC_CONTAINING_RECORD(pThis, CONST CSC_DynamicArray, containerInterface), index);
+}
+
+static CSC_STATUS CSCMETHOD CSC_DynamicArrayIContainerIsValid(_In_ CONST CSC_IContainer* CONST pThis)
+{
+	if (!pThis)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	return CSC_DynamicArrayIsValid(CSC_CONTAINING_RECORD(pThis, CONST CSC_DynamicArray, containerInterface));
+}
+
+static CSC_STATUS CSCMETHOD CSC_DynamicArrayIContainerIsEmpty(_In_ CONST CSC_IContainer* CONST pThis)
+{
+	if (!pThis)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	return CSC_DynamicArrayIsEmpty(CSC_CONTAINING_RECORD(pThis, CONST CSC_DynamicArray, containerInterface));
+}
+
+static CSC_STATUS CSCMETHOD CSC_DynamicArrayIContainerIsElementContainer(_In_ CONST CSC_IContainer* CONST pThis)
+{
+	CONST CSC_DynamicArray* pArray;
+
+	if (!pThis)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	pArray = CSC_CONTAINING_RECORD(pThis, CONST CSC_DynamicArray, containerInterface);
+
+	if (CSC_DynamicArrayIsValid(pArray) != CSC_STATUS_SUCCESS)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	return (pArray->pNestedContainerVTable) ? CSC_STATUS_SUCCESS : CSC_STATUS_GENERAL_FAILURE;
+}
+
+static CSC_SIZE_T CSCMETHOD CSC_DynamicArrayIContainerGetSize(_In_ CONST CSC_IContainer* CONST pThis)
+{
+	if (!pThis)
+	{
+		return CSC_CONTAINER_INVALID_LENGTH;
+	}
+
+	return CSC_DynamicArrayGetSize(CSC_CONTAINING_RECORD(pThis, CONST CSC_DynamicArray, containerInterface));
+}
+
+static CSC_SIZE_T CSCMETHOD CSC_DynamicArrayIContainerGetElementSize(_In_ CONST CSC_IContainer* CONST pThis)
+{
+	if (!pThis)
+	{
+		return (CSC_SIZE_T)0;
+	}
+
+	return CSC_DynamicArrayGetElementSize(CSC_CONTAINING_RECORD(pThis, CONST CSC_DynamicArray, containerInterface));
+}
+
+static CSC_SIZE_T CSCMETHOD CSC_DynamicArrayIContainerGetMaxElements(_In_ CONST CSC_IContainer* CONST pThis)
+{
+	if (!pThis)
+	{
+		return CSC_CONTAINER_INVALID_LENGTH;
+	}
+
+	return CSC_DynamicArrayGetMaxElements(CSC_CONTAINING_RECORD(pThis, CONST CSC_DynamicArray, containerInterface));
+}
+
+static CSC_IAllocator* CSCMETHOD CSC_DynamicArrayIContainerGetIAllocator(_In_ CONST CSC_IContainer* CONST pThis)
+{
+	if (!pThis)
+	{
+		return NULL;
+	}
+
+	return CSC_DynamicArrayGetIAllocator(CSC_CONTAINING_RECORD(pThis, CONST CSC_DynamicArray, containerInterface));
+}
+
+static CSC_IContainerVirtualTable* CSCMETHOD CSC_DynamicArrayIContainerGetNestedContainerVTable(_In_ CONST CSC_IContainer* CONST pThis)
+{
+	if (!pThis)
+	{
+		return NULL;
+	}
+
+	return CSC_DynamicArrayGetNestedContainerVTable(CSC_CONTAINING_RECORD(pThis, CONST CSC_DynamicArray, containerInterface));
+}
+
+static CSC_STATUS CSCMETHOD CSC_DynamicArrayIContainerSerialize(_In_ CONST CSC_IContainer* CONST pThis, _Inout_ CSC_SerializationWriter* CONST pWriter)
+{
+	if (!pThis)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	return CSC_DynamicArraySerialize(CSC_CONTAINING_RECORD(pThis, CONST CSC_DynamicArray, containerInterface), pWriter);
+}
+
+static CSC_STATUS CSCMETHOD CSC_DynamicArrayIContainerDeserialize(_Out_ CSC_IContainer* CONST pThis, _Inout_ CSC_SerializationReader* CONST pReader, _In_ CSC_IAllocator* CONST pIAllocator, _In_opt_ CSC_IContainerVirtualTable* CONST pNestedContainerVTable)
+{
+	if (!pThis)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	return CSC_DynamicArrayDeserialize(CSC_CONTAINING_RECORD(pThis, CSC_DynamicArray, containerInterface), pReader, pIAllocator, pNestedContainerVTable);
+}
+
+static CSC_STATUS CSCMETHOD CSC_DynamicArrayIContainerDeserializeInline(_Out_ CSC_IContainer* CONST pThis, _Inout_ CSC_SerializationReader* CONST pReader, _In_ CSC_IAllocator* CONST pIAllocator, _In_opt_ CSC_IContainerVirtualTable* CONST pNestedContainerVTable)
+{
+	if (!pThis)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	return CSC_DynamicArrayDeserializeInline(CSC_CONTAINING_RECORD(pThis, CSC_DynamicArray, containerInterface), pReader, pIAllocator, pNestedContainerVTable);
+}
+
+// Iterators are linked in front of the list, registering an iterator that is already registered with the array leaves it unchanged.
+static CSC_STATUS CSCMETHOD CSC_DynamicArrayIIterableRegisterIterator(_Inout_ CSC_IIterable* CONST pThis, _In_ CONST CSC_IIterator* CONST pIIterator)
+{
+	CSC_DynamicArray* pArray;
+	CSC_IIterator* pRegisteredIterator;
+	CSC_IIterator* CONST pNewIterator = (CSC_IIterator*)pIIterator;
+
+	if (!pThis || !pIIterator)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	pArray = CSC_CONTAINING_RECORD(pThis, CSC_DynamicArray, iterableInterface);
+
+	if (CSC_DynamicArrayIsValid(pArray) != CSC_STATUS_SUCCESS)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	// Linked iterators are either registered with the array or with another iterable.
+	if (pNewIterator->pNextIterator || pNewIterator->pPreviousIterator || pArray->pFirstIterator == pNewIterator)
+	{
+		for (pRegisteredIterator = pArray->pFirstIterator; pRegisteredIterator; pRegisteredIterator = pRegisteredIterator->pNextIterator)
+		{
+			if (pRegisteredIterator == pNewIterator)
+			{
+				return CSC_STATUS_SUCCESS;
+			}
+		}
+
+		return CSC_STATUS_GENERAL_FAILURE;
+	}
+
+	pNewIterator->pNextIterator = pArray->pFirstIterator;
+	pNewIterator->epoch = pArray->epoch;
+
+	if (pArray->pFirstIterator)
+	{
+		pArray->pFirstIterator->pPreviousIterator = pNewIterator;
+	}
+
+	pArray->pFirstIterator = pNewIterator;
+
+	return CSC_STATUS_SUCCESS;
+}
+
+// Unlinking only requires the neighbours of the iterator, hence unregistering is an O(1) operation.
+static CSC_STATUS CSCMETHOD CSC_DynamicArrayIIterableUnregisterIterator(_Inout_ CSC_IIterable* CONST pThis, _In_ CONST CSC_IIterator* CONST pIIterator)
+{
+	CSC_DynamicArray* pArray;
+	CSC_IIterator* CONST pOldIterator = (CSC_IIterator*)pIIterator;
+
+	if (!pThis || !pIIterator)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	pArray = CSC_CONTAINING_RECORD(pThis, CSC_DynamicArray, iterableInterface);
+
+	if (CSC_DynamicArrayIsValid(pArray) != CSC_STATUS_SUCCESS)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	if ((pOldIterator->pPreviousIterator) ? pOldIterator->pPreviousIterator->pNextIterator != pOldIterator : pArray->pFirstIterator != pOldIterator)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	if (pOldIterator->pPreviousIterator)
+	{
+		pOldIterator->pPreviousIterator->pNextIterator = pOldIterator->pNextIterator;
+	}
+	else
+	{
+		pArray->pFirstIterator = pOldIterator->pNextIterator;
+	}
+
+	if (pOldIterator->pNextIterator)
+	{
+		pOldIterator->pNextIterator->pPreviousIterator = pOldIterator->pPreviousIterator;
+	}
+
+	pOldIterator->pNextIterator = NULL;
+	pOldIterator->pPreviousIterator = NULL;
+
+	return CSC_STATUS_SUCCESS;
+}
+
+// The iteration only reads the elements, hence the adapters retrieve them like CSC_DynamicArrayReadElement and never copy a shared buffer, which also can't fail midway.
+static CSC_PVOID CSCMETHOD CSC_DynamicArrayIIterableFirstElement(_In_ CONST CSC_IIterable* CONST pThis)
+{
+	if (!pThis)
+	{
+		return NULL;
+	}
+
+	return (CSC_PVOID)CSC_DynamicArrayReadElement(CSC_CONTAINING_RECORD(pThis, CONST CSC_DynamicArray, iterableInterface), (CSC_SIZE_T)0);
+}
+
+static CSC_PVOID CSCMETHOD CSC_DynamicArrayIIterableNextElement(_In_ CONST CSC_IIterable* CONST pThis, _In_ CSC_SIZE_T currentIndex, _In_ CSC_PVOID pCurrentElement)
+{
+	CONST CSC_DynamicArray* pArray;
+	CSC_SIZE_T slot;
+
+	if (!pThis || currentIndex == CSC_ITERATOR_INVALID_INDEX)
+	{
+		return NULL;
+	}
+
+	pArray = CSC_CONTAINING_RECORD(pThis, CONST CSC_DynamicArray, iterableInterface);
+
+	// Arrays with removed slots continue at the slot of the current element, the removed slots behind it are skipped through a bit scan instead of locating the next index.
+	if (CSC_DynamicArrayIsModifiable(pArray) == CSC_STATUS_SUCCESS && pArray->tombstoneCount && CSC_DynamicArrayIsOwnElement(pArray, pCurrentElement))
+	{
+		slot = CSC_DynamicArrayFindSlot(pArray, (CSC_SIZE_T)((CONST CSC_BYTE*)pCurrentElement - CSC_DynamicArrayGetBuffer(pArray)) / pArray->elementSize + (CSC_SIZE_T)1, (CSC_BOOLEAN)FALSE);
+
+		return (slot < pArray->elementCount) ? CSC_DynamicArrayGetElement(pArray, slot) : NULL;
+	}
+
+	return (CSC_PVOID)CSC_DynamicArrayReadElement(pArray, currentIndex + (CSC_SIZE_T)1);
+}
+
+static CSC_PVOID CSCMETHOD CSC_DynamicArrayIIterableLastElement(_In_ CONST CSC_IIterable* CONST pThis)
+{
+	CONST CSC_DynamicArray* pArray;
+
+	if (!pThis)
+	{
+		return NULL;
+	}
+
+	pArray = CSC_CONTAINING_RECORD(pThis, CONST CSC_DynamicArray, iterableInterface);
+
+	if (CSC_DynamicArrayIsModifiable(pArray) != CSC_STATUS_SUCCESS || !pArray->elementCount)
+	{
+		return NULL;
+	}
+
+	return (CSC_PVOID)CSC_DynamicArrayReadElement(pArray, CSC_DynamicArrayGetElementCount(pArray) - (CSC_SIZE_T)1);
+}
+
+static CSC_PVOID CSCMETHOD CSC_DynamicArrayIIterablePreviousElement(_In_ CONST CSC_IIterable* CONST pThis, _In_ CSC_SIZE_T currentIndex, _In_ CSC_PVOID pCurrentElement)
+{
+	CONST CSC_DynamicArray* pArray;
+	CSC_SIZE_T slot;
+
+	if (!pThis || !currentIndex || currentIndex == CSC_ITERATOR_INVALID_INDEX)
+	{
+		return NULL;
+	}
+
+	pArray = CSC_CONTAINING_RECORD(pThis, CONST CSC_DynamicArray, iterableInterface);
+
+	if (CSC_DynamicArrayIsModifiable(pArray) == CSC_STATUS_SUCCESS && pArray->tombstoneCount && CSC_DynamicArrayIsOwnElement(pArray, pCurrentElement))
+	{
+		slot = CSC_DynamicArrayFindPreviousElement(pArray, (CSC_SIZE_T)((CONST CSC_BYTE*)pCurrentElement - CSC_DynamicArrayGetBuffer(pArray)) / pArray->elementSize);
+
+		return (slot != CSC_CONTAINER_INVALID_INDEX) ? CSC_DynamicArrayGetElement(pArray, slot) : NULL;
+	}
+
+	return (CSC_PVOID)CSC_DynamicArrayReadElement(pArray, currentIndex - (CSC_SIZE_T)1);
+}
+
+static CSC_PVOID CSCMETHOD CSC_DynamicArrayIIterableGetElementAt(_In_ CONST CSC_IIterable* CONST pThis, _In_ CONST CSC_SIZE_T index, _In_opt_ CONST CSC_SIZE_T currentIndex, _In_opt_ CONST CSC_PVOID pCurrentElement)
+{
+	(void)currentIndex;
+	(void)pCurrentElement;
+
+	if (!pThis)
+	{
+		return NULL;
+	}
+
+	return (CSC_PVOID)CSC_DynamicArrayReadElement(CSC_CONTAINING_RECORD(pThis, CONST CSC_DynamicArray, iterableInterface), index);
+}
+
+static CSC_SIZE_T CSCMETHOD CSC_DynamicArrayIIterableGetElementCount(_In_ CONST CSC_IIterable* CONST pThis)
+{
+	CONST CSC_DynamicArray* pArray;
+
+	if (!pThis)
+	{
+		return CSC_ITERATOR_INVALID_LENGTH;
+	}
+
+	pArray = CSC_CONTAINING_RECORD(pThis, CONST CSC_DynamicArray, iterableInterface);
+
+	if (CSC_DynamicArrayIsModifiable(pArray) != CSC_STATUS_SUCCESS)
+	{
+		return CSC_ITERATOR_INVALID_LENGTH;
+	}
+
+	return CSC_DynamicArrayGetElementCount(pArray);
+}
+
+static CSC_SIZE_T CSCMETHOD CSC_DynamicArrayIIterableGetEpoch(_In_ CONST CSC_IIterable* CONST pThis)
+{
+	if (!pThis)
+	{
+		return (CSC_SIZE_T)0;
+	}
+
+	return CSC_CONTAINING_RECORD(pThis, CONST CSC_DynamicArray, iterableInterface)->epoch;
+}
+
+static CSC_PCVOID CSCMETHOD CSC_DynamicArrayIIterableGetContiguousChunk(_In_ CONST CSC_IIterable* CONST pThis, _In_ CONST CSC_SIZE_T startIndex, _Out_ CSC_SIZE_T* CONST pNumOfElements)
+{
+	if (!pThis)
+	{
+		return NULL;
+	}
+
+	return CSC_DynamicArrayGetContiguousChunk(CSC_CONTAINING_RECORD(pThis, CONST CSC_DynamicArray, iterableInterface), startIndex, pNumOfElements);
+}
+
+
+CSC_STATUS CSCMETHOD CSC_DynamicArrayInitialize(_Out_ CSC_DynamicArray* CONST pThis, _In_ CONST CSC_SIZE_T elementSize, _In_ CONST CSC_IAllocator* CONST pIAllocator, _In_ CONST CSC_IContainerVirtualTable* CONST pNestedContainerVTable)
+{
+	return CSC_DynamicArrayInitializeStorage(pThis, elementSize, (CSC_SIZE_T)0, pIAllocator, pNestedContainerVTable);
+}
+
+CSC_STATUS CSCMETHOD CSC_DynamicArrayInitializeInline(_Out_ CSC_DynamicArray* CONST pThis, _In_ CONST CSC_SIZE_T elementSize, _In_ CONST CSC_IAllocator* CONST pIAllocator, _In_ CONST CSC_IContainerVirtualTable* CONST pNestedContainerVTable)
+{
+	return CSC_DynamicArrayInitializeStorage(pThis, elementSize, CSC_DYNAMIC_ARRAY_INLINE_SIZE, pIAllocator, pNestedContainerVTable);
+}
+
+CSC_STATUS CSCMETHOD CSC_DynamicArrayInitializeWithSize(_Out_ CSC_DynamicArray* CONST pThis, _In_ CONST CSC_SIZE_T elementSize, _In_ CONST CSC_SIZE_T numOfElements, _In_opt_ CONST CSC_PCVOID pDefaultValue, _In_ CONST CSC_IAllocator* CONST pIAllocator, _In_ CONST CSC_IContainerVirtualTable* CONST pNestedContainerVTable)
+{
+	CSC_STATUS status = CSC_DynamicArrayInitialize(pThis, elementSize, pIAllocator, pNestedContainerVTable);
+
+	if (status != CSC_STATUS_SUCCESS)
+	{
+		return status;
+	}
+
+	status = CSC_DynamicArrayAssignElements(pThis, numOfElements, pDefaultValue, (CSC_BOOLEAN)FALSE);
+
+	if (status != CSC_STATUS_SUCCESS)
+	{
+		CSC_DynamicArrayDestroy(pThis);
+	}
+
+	return status;
+}
+
+CSC_STATUS CSCMETHOD CSC_DynamicArrayInitializeWithValue(_Out_ CSC_DynamicArray* CONST pThis, _In_ CONST CSC_SIZE_T elementSize, _In_ CONST CSC_SIZE_T numOfElements, _In_ CONST CSC_PCVOID pValue, _In_ CONST CSC_IAllocator* CONST pIAllocator, _In_ CONST CSC_IContainerVirtualTable* CONST pNestedContainerVTable)
+{
+	if (!pValue)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	return CSC_DynamicArrayInitializeWithSize(pThis, elementSize, numOfElements, pValue, pIAllocator, pNestedContainerVTable);
+}
+
+CSC_STATUS CSCMETHOD CSC_DynamicArrayInitializeWithCopy(_Out_ CSC_DynamicArray* CONST pThis, _In_ CONST CSC_DynamicArray* CONST pSrc)
+{
+	CSC_STATUS status;
+
+	if (!pThis || pThis == pSrc || CSC_DynamicArrayIsModifiable(pSrc) != CSC_STATUS_SUCCESS)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	status = CSC_DynamicArrayInitialize(pThis, pSrc->elementSize, pSrc->pIAllocator, pSrc->pNestedContainerVTable);
+
+	if (status != CSC_STATUS_SUCCESS)
+	{
+		return status;
+	}
+
+	pThis->growthPolicy = pSrc->growthPolicy;
+	pThis->isCopyOnWrite = pSrc->isCopyOnWrite;
+	pThis->isDeferredCompaction = pSrc->isDeferredCompaction;
+
+	if (CSC_DynamicArrayShareBuffer(pThis, pSrc))
+	{
+		return CSC_STATUS_SUCCESS;
+	}
+
+	if (pSrc->tombstoneCount)
+	{
+		status = CSC_DynamicArrayAssignRemainingElements(pThis, pSrc);
+	}
+	else
+	{
+		status = CSC_DynamicArrayAssignElements(pThis, pSrc->elementCount, CSC_DynamicArrayGetBuffer(pSrc), (CSC_BOOLEAN)TRUE);
+	}
+
+	if (status != CSC_STATUS_SUCCESS)
+	{
+		CSC_DynamicArrayDestroy(pThis);
+	}
+
+	return status;
+}
+
+CSC_STATUS CSCMETHOD CSC_DynamicArrayInitializeWithArray(_Out_ CSC_DynamicArray* CONST pThis, _In_ CONST CSC_PCVOID pFirst, _In_ CONST CSC_SIZE_T numOfElements, _In_ CONST CSC_SIZE_T elementSize, _In_ CONST CSC_IAllocator* CONST pIAllocator, _In_ CONST CSC_IContainerVirtualTable* CONST pNestedContainerVTable)
+{
+	CSC_STATUS status;
+
+	if (!pFirst && numOfElements)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	status = CSC_DynamicArrayInitialize(pThis, elementSize, pIAllocator, pNestedContainerVTable);
+
+	if (status != CSC_STATUS_SUCCESS)
+	{
+		return status;
+	}
+
+	status = CSC_DynamicArrayAssignElements(pThis, numOfElements, pFirst, (CSC_BOOLEAN)TRUE);
+
+	if (status != CSC_STATUS_SUCCESS)
+	{
+		CSC_DynamicArrayDestroy(pThis);
+	}
+
+	return status;
+}
+
+#ifdef CSC_CONFIG_LINUX_NATIVE
+CSC_STATUS CSCMETHOD CSC_DynamicArrayInitializeFromFile(_Out_ CSC_DynamicArray* CONST pThis, _In_ CONST CSC_CHAR* CONST pFileName, _In_ CONST CSC_SIZE_T elementSize, _In_ CONST CSC_IAllocator* CONST pIAllocator)
+{
+	CSC_STATUS status;
+	int fileDescriptor;
+
+	if (!pFileName)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	status = CSC_DynamicArrayInitialize(pThis, elementSize, pIAllocator, NULL);
+
+	if (status != CSC_STATUS_SUCCESS)
+	{
+		return status;
+	}
+
+	fileDescriptor = open((CONST char*)pFileName, O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+
+	if (fileDescriptor < 0)
+	{
+		CSC_DynamicArrayZeroMemory(pThis);
+		return CSC_STATUS_GENERAL_FAILURE;
+	}
+
+	pThis->fileDescriptor = (CSC_INT)fileDescriptor;
+	status = CSC_DynamicArrayMapFile(pThis);
+
+	if (status != CSC_STATUS_SUCCESS)
+	{
+		close(fileDescriptor);
+		CSC_DynamicArrayZeroMemory(pThis);
+		return status;
+	}
+
+	pThis->isFileBacked = (CSC_BOOLEAN)TRUE;
+
+	return CSC_STATUS_SUCCESS;
+}
+
+CSC_STATUS CSCMETHOD CSC_DynamicArrayFlush(_Inout_ CSC_DynamicArray* CONST pThis)
+{
+	if (CSC_DynamicArrayIsValid(pThis) != CSC_STATUS_SUCCESS || !pThis->isFileBacked)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	CSC_DynamicArrayGetFileHeader(pThis)->elementCount = (CSC_QWORD)pThis->elementCount;
+
+	if (msync((CSC_BYTE*)pThis->pData - CSC_DYNAMIC_ARRAY_FILE_HEADER_SIZE, CSC_DynamicArrayCalculateMappingSize(pThis, pThis->reservedSpace), MS_SYNC))
+	{
+		return CSC_STATUS_GENERAL_FAILURE;
+	}
+
+	return CSC_STATUS_SUCCESS;
+}
+#endif
+
+CSC_STATUS CSCMETHOD CSC_DynamicArrayDeserialize(_Out_ CSC_DynamicArray* CONST pThis, _Inout_ CSC_SerializationReader* CONST pReader, _In_ CONST CSC_IAllocator* CONST pIAllocator, _In_opt_ CONST CSC_IContainerVirtualTable* CONST pNestedContainerVTable)
+{
+	return CSC_DynamicArrayDeserializeStorage(pThis, pReader, (CSC_SIZE_T)0, pIAllocator, pNestedContainerVTable);
+}
+
+CSC_STATUS CSCMETHOD CSC_DynamicArrayDeserializeInline(_Out_ CSC_DynamicArray* CONST pThis, _Inout_ CSC_SerializationReader* CONST pReader, _In_ CONST CSC_IAllocator* CONST pIAllocator, _In_opt_ CONST CSC_IContainerVirtualTable* CONST pNestedContainerVTable)
+{
+	return CSC_DynamicArrayDeserializeStorage(pThis, pReader, CSC_DYNAMIC_ARRAY_INLINE_SIZE, pIAllocator, pNestedContainerVTable);
+}
+
+CSC_STATUS CSCMETHOD CSC_DynamicArraySerialize(_In_ CONST CSC_DynamicArray* CONST pThis, _Inout_ CSC_SerializationWriter* CONST pWriter)
+{
+	CSC_STATUS status;
+	CSC_DynamicArraySerializationHeader header;
+	CONST CSC_BYTE* pElements;
+	CSC_SIZE_T totalSize;
+	CSC_SIZE_T runIndex;
+	CSC_SIZE_T runEnd = (CSC_SIZE_T)0;
+	CSC_SIZE_T iterator;
+	CSC_QWORD blockSize;
+
+	if (CSC_DynamicArrayIsModifiable(pThis) != CSC_STATUS_SUCCESS || !pWriter || (pThis->pNestedContainerVTable && !pThis->pNestedContainerVTable->pSerialize))
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	header.elementSize = (CSC_QWORD)pThis->elementSize;
+	header.elementCount = (CSC_QWORD)CSC_DynamicArrayGetElementCount(pThis);
+	header.flags = (pThis->pNestedContainerVTable) ? CSC_DYNAMIC_ARRAY_SERIALIZATION_FLAG_NESTED : (CSC_QWORD)0;
+
+	status = CSC_SerializationUtilsWriteValue(pWriter, &header, sizeof(header));
+
+	// The elements are written run by run, removed slots are skipped, hence the record is the same as for the compacted array.
+	for (runIndex = CSC_DynamicArrayFindSlot(pThis, (CSC_SIZE_T)0, (CSC_BOOLEAN)FALSE); runIndex < pThis->elementCount && status == CSC_STATUS_SUCCESS; runIndex = CSC_DynamicArrayFindSlot(pThis, runEnd, (CSC_BOOLEAN)FALSE))
+	{
+		runEnd = CSC_DynamicArrayFindSlot(pThis, runIndex, (CSC_BOOLEAN)TRUE);
+		pElements = (CONST CSC_BYTE*)CSC_DynamicArrayGetElement(pThis, runIndex);
+
+		if (pThis->pNestedContainerVTable)
+		{
+			for (iterator = (CSC_SIZE_T)0; iterator < runEnd - runIndex && status == CSC_STATUS_SUCCESS; ++iterator)
+			{
+				status = pThis->pNestedContainerVTable->pSerialize(CSC_DynamicArrayGetElementContainer(pElements + iterator * pThis->elementSize), pWriter);
+			}
+
+			continue;
+		}
+
+		// Shared buffers are read in place, the writer only references them until it is flushed.
+		totalSize = (runEnd - runIndex) * pThis->elementSize;
+
+		for (iterator = (CSC_SIZE_T)0; iterator < totalSize && status == CSC_STATUS_SUCCESS; iterator += (CSC_SIZE_T)blockSize)
+		{
+			blockSize = (CSC_QWORD)((totalSize - iterator < CSC_SERIALIZATION_UTILS_MAX_BLOCK_SIZE) ? totalSize - iterator : CSC_SERIALIZATION_UTILS_MAX_BLOCK_SIZE);
+			status = CSC_SerializationUtilsWriteValue(pWriter, &blockSize, sizeof(blockSize));
+
+			if (status == CSC_STATUS_SUCCESS)
+			{
+				status = CSC_SerializationUtilsWrite(pWriter, pElements + iterator, (CSC_SIZE_T)blockSize);
+			}
+		}
+	}
+
+	return status;
+}
+
+CSC_STATUS CSCMETHOD CSC_DynamicArrayResize(_Inout_ CSC_DynamicArray* CONST pThis, _In_ CONST CSC_SIZE_T numOfElements, _In_opt_ CONST CSC_PCVOID pDefaultValue)
+{
+	if (CSC_DynamicArrayIsModifiable(pThis) != CSC_STATUS_SUCCESS)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	CSC_DynamicArrayMakeContiguous(pThis);
+
+	if (numOfElements > pThis->elementCount)
+	{
+		return CSC_DynamicArrayInsertElements(pThis, pThis->elementCount, numOfElements - pThis->elementCount, pDefaultValue, (CSC_BOOLEAN)FALSE);
+	}
+
+	if (numOfElements < pThis->elementCount)
+	{
+		return CSC_DynamicArrayRemoveElements(pThis, numOfElements, pThis->elementCount - numOfElements, (CSC_BOOLEAN)TRUE, (CSC_BOOLEAN)FALSE);
+	}
+
+	return CSC_STATUS_SUCCESS;
+}
+
+CSC_STATUS CSCMETHOD CSC_DynamicArrayLazyResize(_Inout_ CSC_DynamicArray* CONST pThis, _In_ CONST CSC_SIZE_T numOfElements, _In_opt_ CONST CSC_PCVOID pDefaultValue)
+{
+	if (CSC_DynamicArrayIsModifiable(pThis) != CSC_STATUS_SUCCESS)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	CSC_DynamicArrayMakeContiguous(pThis);
+
+	if (numOfElements > pThis->elementCount)
+	{
+		return CSC_DynamicArrayInsertElements(pThis, pThis->elementCount, numOfElements - pThis->elementCount, pDefaultValue, (CSC_BOOLEAN)FALSE);
+	}
+
+	if (numOfElements < pThis->elementCount)
+	{
+		return CSC_DynamicArrayRemoveElements(pThis, numOfElements, pThis->elementCount - numOfElements, (CSC_BOOLEAN)TRUE, (CSC_BOOLEAN)TRUE);
+	}
+
+	return CSC_STATUS_SUCCESS;
+}
+
+CSC_STATUS CSCMETHOD CSC_DynamicArrayReserve(_Inout_ CSC_DynamicArray* CONST pThis, _In_ CONST CSC_SIZE_T numOfElements)
+{
+	if (CSC_DynamicArrayIsModifiable(pThis) != CSC_STATUS_SUCCESS || numOfElements > CSC_DynamicArrayCalculateMaxElements(pThis->elementSize))
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	if (numOfElements <= pThis->reservedSpace)
+	{
+		return CSC_STATUS_SUCCESS;
+	}
+
+	return CSC_DynamicArrayReallocate(pThis, numOfElements);
+}
+
+CSC_STATUS CSCMETHOD CSC_DynamicArrayShrinkToFit(_Inout_ CSC_DynamicArray* CONST pThis)
+{
+	if (CSC_DynamicArrayIsModifiable(pThis) != CSC_STATUS_SUCCESS)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	CSC_DynamicArrayMakeContiguous(pThis);
+
+	if (pThis->elementCount == pThis->reservedSpace)
+	{
+		return CSC_STATUS_SUCCESS;
+	}
+
+	return CSC_DynamicArrayReallocate(pThis, pThis->elementCount);
+}
+
+CSC_STATUS CSCMETHOD CSC_DynamicArraySetCopyOnWrite(_Inout_ CSC_DynamicArray* CONST pThis, _In_ CONST CSC_BOOLEAN isCopyOnWrite)
+{
+	CSC_STATUS status;
+	CSC_PVOID pData;
+	CSC_SIZE_T newCapacity;
+
+	if (CSC_DynamicArrayIsModifiable(pThis) != CSC_STATUS_SUCCESS || pThis->inlineCapacity || pThis->isFileBacked)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	if ((isCopyOnWrite) ? pThis->isCopyOnWrite : !pThis->isCopyOnWrite)
+	{
+		return CSC_STATUS_SUCCESS;
+	}
+
+	status = CSC_DynamicArrayMakeUnique(pThis);
+
+	if (status != CSC_STATUS_SUCCESS)
+	{
+		return status;
+	}
+
+	// The header in front of the buffer is only present in copy-on-write mode, hence an existing buffer is moved to an allocation of the new layout.
+	if (pThis->pData)
+	{
+		pData = CSC_DynamicArrayAllocateBuffer(pThis, pThis->reservedSpace, (isCopyOnWrite) ? CSC_DYNAMIC_ARRAY_SHARED_HEADER_SIZE : (CSC_SIZE_T)0, &newCapacity);
+
+		if (!pData)
+		{
+			return CSC_STATUS_MEMORY_NOT_ALLOCATED;
+		}
+
+		if (pThis->elementCount)
+		{
+			status = CSC_DynamicArrayRelocateElements(pThis, pData, pThis->pData, pThis->elementCount);
+
+			if (status != CSC_STATUS_SUCCESS)
+			{
+				CSC_DynamicArrayFreeBuffer(pThis, pData, newCapacity, (isCopyOnWrite) ? CSC_DYNAMIC_ARRAY_SHARED_HEADER_SIZE : (CSC_SIZE_T)0);
+				return status;
+			}
+		}
+
+		CSC_DynamicArrayFreeBuffer(pThis, pThis->pData, pThis->reservedSpace, CSC_DynamicArrayGetHeaderSize(pThis));
+		pThis->pData = pData;
+		pThis->reservedSpace = newCapacity;
+		CSC_DynamicArrayAdvanceEpoch(pThis);
+	}
+
+	pThis->isCopyOnWrite = (isCopyOnWrite) ? (CSC_BOOLEAN)TRUE : (CSC_BOOLEAN)FALSE;
+
+	return CSC_STATUS_SUCCESS;
+}
+
+CSC_STATUS CSCMETHOD CSC_DynamicArraySetGrowthPolicy(_Inout_ CSC_DynamicArray* CONST pThis, _In_ CONST EDynamicArrayGrowthPolicy growthPolicy)
+{
+	if (CSC_DynamicArrayIsValid(pThis) != CSC_STATUS_SUCCESS || (growthPolicy != csc_dagp_Factor2 && growthPolicy != csc_dagp_Factor1_5 && growthPolicy != csc_dagp_PageRounded))
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	pThis->growthPolicy = growthPolicy;
+
+	return CSC_STATUS_SUCCESS;
+}
+
+CSC_STATUS CSCMETHOD CSC_DynamicArraySetDeferredCompaction(_Inout_ CSC_DynamicArray* CONST pThis, _In_ CONST CSC_BOOLEAN isDeferredCompaction)
+{
+	if (CSC_DynamicArrayIsModifiable(pThis) != CSC_STATUS_SUCCESS || pThis->isFileBacked)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	// Pending removals are compacted when the mode is left, as the slots can't be tracked afterwards.
+	if (!isDeferredCompaction)
+	{
+		CSC_DynamicArrayMakeContiguous(pThis);
+		CSC_DynamicArrayFreeTombstones(pThis);
+	}
+
+	pThis->isDeferredCompaction = (isDeferredCompaction) ? (CSC_BOOLEAN)TRUE : (CSC_BOOLEAN)FALSE;
+
+	return CSC_STATUS_SUCCESS;
+}
+
+CSC_STATUS CSCMETHOD CSC_DynamicArrayCompact(_Inout_ CSC_DynamicArray* CONST pThis)
+{
+	if (CSC_DynamicArrayIsModifiable(pThis) != CSC_STATUS_SUCCESS)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	CSC_DynamicArrayMakeContiguous(pThis);
+	CSC_DynamicArrayShrink(pThis, (CSC_BOOLEAN)FALSE);
+
+	return CSC_STATUS_SUCCESS;
+}
+
+CSC_STATUS CSCMETHOD CSC_DynamicArrayDestroy(_Inout_ CSC_DynamicArray* CONST pThis)
+{
+	CSC_IIterator* pIIterator;
+
+	if (CSC_DynamicArrayIsValid(pThis) != CSC_STATUS_SUCCESS)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	// A pending emplacement is cancelled first, as it's slots don't hold elements that could be released.
+	if (pThis->emplaceCount)
+	{
+		CSC_DynamicArrayCommitEmplace(pThis, (CSC_SIZE_T)0);
+	}
+
+#ifdef CSC_CONFIG_LINUX_NATIVE
+	// The elements of file-backed arrays remain in their file.
+	if (pThis->isFileBacked)
+	{
+		CSC_DynamicArrayUnmapFile(pThis);
+	}
+	else
+#endif
+	{
+		CSC_DynamicArrayRelease(pThis);
+	}
+
+	// The iterators are unlinked before they are notified, hence they may be registered with another iterable right away.
+	while (pThis->pFirstIterator)
+	{
+		pIIterator = pThis->pFirstIterator;
+		pThis->pFirstIterator = pIIterator->pNextIterator;
+		pIIterator->pNextIterator = NULL;
+		pIIterator->pPreviousIterator = NULL;
+		CSC_IIteratorOnDestruction(pIIterator);
+	}
+
+	return CSC_DynamicArrayZeroMemory(pThis);
+}
+
+CSC_STATUS CSCMETHOD CSC_DynamicArrayErase(_Inout_ CSC_DynamicArray* CONST pThis)
+{
+	CSC_SIZE_T elementCount;
+
+	if (CSC_DynamicArrayIsValid(pThis) != CSC_STATUS_SUCCESS)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	// A pending emplacement is cancelled first, as it's slots don't hold elements that could be released.
+	if (pThis->emplaceCount)
+	{
+		CSC_DynamicArrayCommitEmplace(pThis, (CSC_SIZE_T)0);
+	}
+
+	elementCount = CSC_DynamicArrayGetElementCount(pThis);
+	CSC_DynamicArrayRelease(pThis);
+
+	if (elementCount)
+	{
+		CSC_DynamicArrayAdvanceEpoch(pThis);
+	}
+
+	return CSC_STATUS_SUCCESS;
+}
+
+CSC_STATUS CSCMETHOD CSC_DynamicArrayClear(_Inout_ CSC_DynamicArray* CONST pThis)
+{
+	CSC_SIZE_T elementCount;
+
+	if (CSC_DynamicArrayIsModifiable(pThis) != CSC_STATUS_SUCCESS)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	elementCount = CSC_DynamicArrayGetElementCount(pThis);
+	CSC_DynamicArrayDiscardElements(pThis);
+
+	if (elementCount)
+	{
+		CSC_DynamicArrayAdvanceEpoch(pThis);
+	}
+
+	return CSC_STATUS_SUCCESS;
+}
+
+CSC_STATUS CSCMETHOD CSC_DynamicArrayZeroMemory(_Out_ CSC_DynamicArray* CONST pThis)
+{
+	if (!pThis)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	return CSC_MemoryUtilsSetZeroMemory(pThis, sizeof(*pThis));
+}
+
+CSC_STATUS CSCMETHOD CSC_DynamicArrayPushValue(_Inout_ CSC_DynamicArray* CONST pThis, _In_opt_ CONST CSC_PCVOID pValue)
+{
+	if (CSC_DynamicArrayIsModifiable(pThis) != CSC_STATUS_SUCCESS)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	return CSC_DynamicArrayInsertElements(pThis, CSC_DynamicArrayGetElementCount(pThis), (CSC_SIZE_T)1, pValue, (CSC_BOOLEAN)FALSE);
+}
+
+CSC_PVOID CSCMETHOD CSC_DynamicArrayEmplaceBack(_Inout_ CSC_DynamicArray* CONST pThis)
+{
+	if (CSC_DynamicArrayIsValid(pThis) != CSC_STATUS_SUCCESS)
+	{
+		return NULL;
+	}
+
+	return CSC_DynamicArrayEmplaceElements(pThis, CSC_DynamicArrayGetElementCount(pThis), (CSC_SIZE_T)1);
+}
+
+CSC_PVOID CSCMETHOD CSC_DynamicArrayEmplaceAt(_Inout_ CSC_DynamicArray* CONST pThis, _In_ CONST CSC_SIZE_T insertIndex)
+{
+	if (CSC_DynamicArrayIsValid(pThis) != CSC_STATUS_SUCCESS)
+	{
+		return NULL;
+	}
+
+	return CSC_DynamicArrayEmplaceElements(pThis, insertIndex, (CSC_SIZE_T)1);
+}
+
+CSC_PVOID CSCMETHOD CSC_DynamicArrayExtendUninitialized(_Inout_ CSC_DynamicArray* CONST pThis, _In_ CONST CSC_SIZE_T numOfElements)
+{
+	if (CSC_DynamicArrayIsValid(pThis) != CSC_STATUS_SUCCESS)
+	{
+		return NULL;
+	}
+
+	return CSC_DynamicArrayEmplaceElements(pThis, CSC_DynamicArrayGetElementCount(pThis), numOfElements);
+}
+
+CSC_STATUS CSCMETHOD CSC_DynamicArrayCommitEmplace(_Inout_ CSC_DynamicArray* CONST pThis, _In_ CONST CSC_SIZE_T numOfElements)
+{
+	CSC_SIZE_T tailCount;
+
+	if (CSC_DynamicArrayIsValid(pThis) != CSC_STATUS_SUCCESS || !pThis->emplaceCount || numOfElements > pThis->emplaceCount)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	// Slots that haven't been used are closed by moving the tail back in front.
+	tailCount = pThis->elementCount - pThis->emplaceIndex;
+
+	if (tailCount && numOfElements < pThis->emplaceCount)
+	{
+		CSC_DynamicArrayRelocateElements(pThis, CSC_DynamicArrayGetElement(pThis, pThis->emplaceIndex + numOfElements), CSC_DynamicArrayGetElement(pThis, pThis->emplaceIndex + pThis->emplaceCount), tailCount);
+	}
+
+	pThis->elementCount += numOfElements;
+	pThis->emplaceCount = (CSC_SIZE_T)0;
+
+	if (numOfElements)
+	{
+		CSC_DynamicArrayAdvanceEpoch(pThis);
+	}
+
+	return CSC_STATUS_SUCCESS;
+}
+
+CSC_STATUS CSCMETHOD CSC_DynamicArrayPopValue(_Inout_ CSC_DynamicArray* CONST pThis, _When_(return == STATUS_SUCCESS, _Out_opt_) CONST CSC_PVOID pValue)
+{
+	if (CSC_DynamicArrayIsModifiable(pThis) != CSC_STATUS_SUCCESS)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	return CSC_DynamicArrayPopElement(pThis, CSC_DynamicArrayGetElementCount(pThis) - (CSC_SIZE_T)1, pValue, (CSC_BOOLEAN)FALSE);
+}
+
+CSC_STATUS CSCMETHOD CSC_DynamicArrayLazyPopValue(_Inout_ CSC_DynamicArray* CONST pThis, _When_(return == STATUS_SUCCESS, _Out_opt_) CONST CSC_PVOID pValue)
+{
+	if (CSC_DynamicArrayIsModifiable(pThis) != CSC_STATUS_SUCCESS)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	return CSC_DynamicArrayPopElement(pThis, CSC_DynamicArrayGetElementCount(pThis) - (CSC_SIZE_T)1, pValue, (CSC_BOOLEAN)TRUE);
+}
+
+CSC_STATUS CSCMETHOD CSC_DynamicArrayPopFront(_Inout_ CSC_DynamicArray* CONST pThis, _When_(return == STATUS_SUCCESS, _Out_opt_) CONST CSC_PVOID pValue)
+{
+	if (CSC_DynamicArrayIsModifiable(pThis) != CSC_STATUS_SUCCESS)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	return CSC_DynamicArrayPopElement(pThis, (CSC_SIZE_T)0, pValue, (CSC_BOOLEAN)FALSE);
+}
+
+CSC_STATUS CSCMETHOD CSC_DynamicArrayLazyPopFront(_Inout_ CSC_DynamicArray* CONST pThis, _When_(return == STATUS_SUCCESS, _Out_opt_) CONST CSC_PVOID pValue)
+{
+	if (CSC_DynamicArrayIsModifiable(pThis) != CSC_STATUS_SUCCESS)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	return CSC_DynamicArrayPopElement(pThis, (CSC_SIZE_T)0, pValue, (CSC_BOOLEAN)TRUE);
+}
+
+CSC_PVOID CSCMETHOD CSC_DynamicArrayAccessElement(_In_ CONST CSC_DynamicArray* CONST pThis, _In_ CONST CSC_SIZE_T index)
+{
+	if (CSC_DynamicArrayIsModifiable(pThis) != CSC_STATUS_SUCCESS || index >= CSC_DynamicArrayGetElementCount(pThis))
+	{
+		return NULL;
+	}
+
+	// The element may be written through the returned pointer, hence a shared buffer is copied even though the array itself is passed as constant.
+	if (CSC_DynamicArrayMakeUnique((CSC_DynamicArray*)pThis) != CSC_STATUS_SUCCESS)
+	{
+		return NULL;
+	}
+
+	return CSC_DynamicArrayGetElement(pThis, CSC_DynamicArrayGetSlot(pThis, index));
+}
+
+CSC_PCVOID CSCMETHOD CSC_DynamicArrayReadElement(_In_ CONST CSC_DynamicArray* CONST pThis, _In_ CONST CSC_SIZE_T index)
+{
+	if (CSC_DynamicArrayIsModifiable(pThis) != CSC_STATUS_SUCCESS || index >= CSC_DynamicArrayGetElementCount(pThis))
+	{
+		return NULL;
+	}
+
+	return CSC_DynamicArrayGetElement(pThis, CSC_DynamicArrayGetSlot(pThis, index));
+}
+
+CSC_PCVOID CSCMETHOD CSC_DynamicArrayGetContiguousChunk(_In_ CONST CSC_DynamicArray* CONST pThis, _In_ CONST CSC_SIZE_T startIndex, _Out_ CSC_SIZE_T* CONST pNumOfElements)
+{
+	CSC_SIZE_T slot;
+
+	if (!pNumOfElements)
+	{
+		return NULL;
+	}
+
+	*pNumOfElements = (CSC_SIZE_T)0;
+
+	if (CSC_DynamicArrayIsModifiable(pThis) != CSC_STATUS_SUCCESS || startIndex >= CSC_DynamicArrayGetElementCount(pThis))
+	{
+		return NULL;
+	}
+
+	slot = CSC_DynamicArrayGetSlot(pThis, startIndex);
+	*pNumOfElements = ((pThis->tombstoneCount) ? CSC_DynamicArrayFindSlot(pThis, slot, (CSC_BOOLEAN)TRUE) : pThis->elementCount) - slot;
+
+	return CSC_DynamicArrayGetElement(pThis, slot);
+}
+
+CSC_STATUS CSCMETHOD CSC_DynamicArrayAssign(_Inout_ CSC_DynamicArray* CONST pThis, _In_ CONST CSC_SIZE_T numOfElements, _In_ CONST CSC_PCVOID pValue)
+{
+	if (CSC_DynamicArrayIsModifiable(pThis) != CSC_STATUS_SUCCESS || !pValue)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	return CSC_DynamicArrayAssignElements(pThis, numOfElements, pValue, (CSC_BOOLEAN)FALSE);
+}
+
+CSC_STATUS CSCMETHOD CSC_DynamicArrayAssignBlock(_Inout_ CSC_DynamicArray* CONST pThis, _In_ CONST CSC_SIZE_T firstIndex, _In_ CONST CSC_SIZE_T numOfElements, _In_ CONST CSC_PCVOID pValue)
+{
+	CSC_STATUS status;
+	CSC_SIZE_T iterator;
+
+	if (CSC_DynamicArrayIsModifiable(pThis) != CSC_STATUS_SUCCESS || !pValue || !numOfElements || firstIndex >= CSC_DynamicArrayGetElementCount(pThis) || numOfElements > CSC_DynamicArrayGetElementCount(pThis) - firstIndex)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	CSC_DynamicArrayMakeContiguous(pThis);
+	status = CSC_DynamicArrayMakeUnique(pThis);
+
+	if (status != CSC_STATUS_SUCCESS)
+	{
+		return status;
+	}
+
+	if (!pThis->pNestedContainerVTable)
+	{
+		return CSC_MemoryUtilsSetArrayValue(CSC_DynamicArrayGetElement(pThis, firstIndex), pValue, pThis->elementSize, numOfElements);
+	}
+
+	for (iterator = (CSC_SIZE_T)0; iterator < numOfElements; ++iterator)
+	{
+		status = pThis->pNestedContainerVTable->pCopy(CSC_DynamicArrayGetElementContainer(CSC_DynamicArrayGetElement(pThis, firstIndex + iterator)), CSC_DynamicArrayGetElementContainer(pValue));
+
+		if (status != CSC_STATUS_SUCCESS)
+		{
+			return status;
+		}
+	}
+
+	return CSC_STATUS_SUCCESS;
+}
+
+CSC_STATUS CSCMETHOD CSC_DynamicArrayAssignRange(_Inout_ CSC_DynamicArray* CONST pThis, _In_ CONST CSC_SIZE_T firstIndex, _In_ CONST CSC_SIZE_T lastIndex, _In_ CONST CSC_PCVOID pValue)
+{
+	if (firstIndex > lastIndex || lastIndex == CSC_CONTAINER_INVALID_INDEX)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	return CSC_DynamicArrayAssignBlock(pThis, firstIndex, lastIndex - firstIndex + (CSC_SIZE_T)1, pValue);
+}
+
+CSC_STATUS CSCMETHOD CSC_DynamicArrayCopy(_Inout_ CSC_DynamicArray* CONST pThis, _In_ CONST CSC_DynamicArray* CONST pSrc)
+{
+	if (CSC_DynamicArrayIsModifiable(pThis) != CSC_STATUS_SUCCESS || CSC_DynamicArrayIsModifiable(pSrc) != CSC_STATUS_SUCCESS)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	if (pThis == pSrc)
+	{
+		return CSC_STATUS_SUCCESS;
+	}
+
+	// The buffer can't be reused for a different element size, as the size passed to FreeSized must match the allocation.
+	// The elements are released with the old virtual table before the element type is changed.
+	// Arrays without inline storage take over the copy-on-write mode of the source, their buffer is released if the buffer of the source can be shared.
+	// The element type of file-backed arrays is fixed by their file, the elements of the source are copied into the file.
+	if (pThis->isFileBacked && (pThis->elementSize != pSrc->elementSize || pSrc->pNestedContainerVTable))
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	if (pThis->elementSize != pSrc->elementSize || pThis->pNestedContainerVTable != pSrc->pNestedContainerVTable || (!pThis->inlineCapacity && !pThis->isFileBacked && (pThis->isCopyOnWrite != pSrc->isCopyOnWrite || pSrc->isCopyOnWrite)))
+	{
+		CSC_DynamicArrayRelease(pThis);
+		pThis->elementSize = pSrc->elementSize;
+		pThis->pNestedContainerVTable = pSrc->pNestedContainerVTable;
+		pThis->reservedSpace = CSC_DynamicArrayGetInlineCapacity(pThis);
+		pThis->isCopyOnWrite = (pThis->inlineCapacity) ? (CSC_BOOLEAN)FALSE : pSrc->isCopyOnWrite;
+
+		if (CSC_DynamicArrayShareBuffer(pThis, pSrc))
+		{
+			CSC_DynamicArrayNotifyReplacement(pThis);
+			return CSC_STATUS_SUCCESS;
+		}
+	}
+
+	// The source is passed as constant, hence it's removed slots are skipped instead of compacting it.
+	if (pSrc->tombstoneCount)
+	{
+		return CSC_DynamicArrayAssignRemainingElements(pThis, pSrc);
+	}
+
+	return CSC_DynamicArrayAssignElements(pThis, pSrc->elementCount, CSC_DynamicArrayGetBuffer(pSrc), (CSC_BOOLEAN)TRUE);
+}
+
+CSC_STATUS CSCMETHOD CSC_DynamicArrayMove(_Inout_ CSC_DynamicArray* CONST pThis, _Inout_ CSC_DynamicArray* CONST pSrc)
+{
+	CSC_STATUS status;
+	CSC_BOOLEAN canTakeOver;
+	CSC_SIZE_T elementCount;
+
+	if (CSC_DynamicArrayIsModifiable(pThis) != CSC_STATUS_SUCCESS || CSC_DynamicArrayIsModifiable(pSrc) != CSC_STATUS_SUCCESS)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	if (pThis == pSrc)
+	{
+		return CSC_STATUS_SUCCESS;
+	}
+
+	if (pThis->isFileBacked && (pThis->elementSize != pSrc->elementSize || pSrc->pNestedContainerVTable))
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	CSC_DynamicArrayMakeContiguous(pSrc);
+	elementCount = pSrc->elementCount;
+
+	// The buffer can only be taken over if it has been allocated by the same allocator, otherwise the elements are moved to a new buffer.
+	// Buffers of copy-on-write arrays can't be taken over by arrays with inline storage, elements that are moved must not be shared with other arrays.
+	// Mappings of file-backed arrays are never taken over, neither can file-backed arrays take over a buffer.
+	canTakeOver = (pSrc->pData && pThis->pIAllocator == pSrc->pIAllocator && (!pSrc->isCopyOnWrite || !pThis->inlineCapacity) && !pThis->isFileBacked && !pSrc->isFileBacked) ? (CSC_BOOLEAN)TRUE : (CSC_BOOLEAN)FALSE;
+
+	if (!canTakeOver)
+	{
+		status = CSC_DynamicArrayMakeUnique(pSrc);
+
+		if (status != CSC_STATUS_SUCCESS)
+		{
+			return status;
+		}
+	}
+
+	CSC_DynamicArrayRelease(pThis);
+
+	if (!pThis->isFileBacked)
+	{
+		pThis->elementSize = pSrc->elementSize;
+		pThis->pNestedContainerVTable = pSrc->pNestedContainerVTable;
+		pThis->reservedSpace = CSC_DynamicArrayGetInlineCapacity(pThis);
+	}
+
+	if (canTakeOver)
+	{
+		pThis->pData = pSrc->pData;
+		pThis->elementCount = pSrc->elementCount;
+		pThis->reservedSpace = pSrc->reservedSpace;
+		pThis->isCopyOnWrite = pSrc->isCopyOnWrite;
+		pSrc->pData = NULL;
+		pSrc->reservedSpace = (CSC_SIZE_T)0;
+	}
+	else if (elementCount)
+	{
+		status = CSC_DynamicArrayReallocate(pThis, elementCount);
+
+		if (status != CSC_STATUS_SUCCESS)
+		{
+			CSC_DynamicArrayNotifyReplacement(pThis);
+			return status;
+		}
+
+		CSC_DynamicArrayRelocateElements(pThis, CSC_DynamicArrayGetBuffer(pThis), CSC_DynamicArrayGetBuffer(pSrc), elementCount);
+		pThis->elementCount = elementCount;
+	}
+
+	pSrc->elementCount = (CSC_SIZE_T)0;
+	CSC_DynamicArrayRelease(pSrc);
+	CSC_DynamicArrayNotifyReplacement(pThis);
+
+	if (elementCount)
+	{
+		CSC_DynamicArrayAdvanceEpoch(pSrc);
+	}
+
+	return CSC_STATUS_SUCCESS;
+}
+
+CSC_STATUS CSCMETHOD CSC_DynamicArrayCopyArray(_Inout_ CSC_DynamicArray* CONST pThis, _In_ CONST CSC_PCVOID pFirst, _In_ CONST CSC_SIZE_T numOfElements, _In_ CONST CSC_SIZE_T elementSize)
+{
+	if (CSC_DynamicArrayIsModifiable(pThis) != CSC_STATUS_SUCCESS || elementSize != pThis->elementSize || (!pFirst && numOfElements))
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	return CSC_DynamicArrayAssignElements(pThis, numOfElements, pFirst, (CSC_BOOLEAN)TRUE);
+}
+
+CSC_STATUS CSCMETHOD CSC_DynamicArrayInsertElement(_Inout_ CSC_DynamicArray* CONST pThis, _In_ CONST CSC_SIZE_T insertIndex, _In_opt_ CONST CSC_PCVOID pValue)
+{
+	if (CSC_DynamicArrayIsModifiable(pThis) != CSC_STATUS_SUCCESS)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	return CSC_DynamicArrayInsertElements(pThis, insertIndex, (CSC_SIZE_T)1, pValue, (CSC_BOOLEAN)FALSE);
+}
+
+CSC_STATUS CSCMETHOD CSC_DynamicArrayInsertRange(_Inout_ CSC_DynamicArray* CONST pThis, _In_ CONST CSC_SIZE_T insertIndex, _In_opt_ CONST CSC_PCVOID pFirst, _In_ CONST CSC_SIZE_T numOfElements)
+{
+	if (CSC_DynamicArrayIsModifiable(pThis) != CSC_STATUS_SUCCESS)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	return CSC_DynamicArrayInsertElements(pThis, insertIndex, numOfElements, pFirst, (CSC_BOOLEAN)TRUE);
+}
+
+CSC_STATUS CSCMETHOD CSC_DynamicArrayInsertArray(_Inout_ CSC_DynamicArray* CONST pThis, _In_ CONST CSC_SIZE_T insertIndex, _In_ CONST CSC_DynamicArray* CONST pSrc)
+{
+	CSC_STATUS status;
+	CSC_SIZE_T numOfElements;
+	CSC_PVOID pDst;
+
+	if (CSC_DynamicArrayIsModifiable(pThis) != CSC_STATUS_SUCCESS || !CSC_DynamicArrayIsCompatible(pThis, pSrc) || insertIndex > CSC_DynamicArrayGetElementCount(pThis))
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	// Inserting the array into itself modifies it anyway, hence it is compacted like for any other insertion.
+	if (pSrc == pThis)
+	{
+		CSC_DynamicArrayMakeContiguous(pThis);
+	}
+
+	numOfElements = CSC_DynamicArrayGetElementCount(pSrc);
+
+	if (!numOfElements)
+	{
+		return CSC_STATUS_SUCCESS;
+	}
+
+	if (!pSrc->tombstoneCount)
+	{
+		return CSC_DynamicArrayInsertElements(pThis, insertIndex, numOfElements, CSC_DynamicArrayGetBuffer(pSrc), (CSC_BOOLEAN)TRUE);
+	}
+
+	// The removed slots of another array are skipped while it's elements are copied into a gap that is committed once all copies have been made.
+	if (numOfElements > CSC_DynamicArrayCalculateMaxElements(pThis->elementSize) - pThis->elementCount)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	pDst = CSC_DynamicArrayEmplaceElements(pThis, insertIndex, numOfElements);
+
+	if (!pDst)
+	{
+		return CSC_STATUS_MEMORY_NOT_ALLOCATED;
+	}
+
+	status = CSC_DynamicArrayConstructRemainingElements(pThis, pDst, pSrc);
+	CSC_DynamicArrayCommitEmplace(pThis, (status == CSC_STATUS_SUCCESS) ? numOfElements : (CSC_SIZE_T)0);
+
+	return status;
+}
+
+CSC_STATUS CSCMETHOD CSC_DynamicArrayAppendCopy(_Inout_ CSC_DynamicArray* CONST pThis, _In_ CONST CSC_DynamicArray* CONST pSrc)
+{
+	if (CSC_DynamicArrayIsModifiable(pThis) != CSC_STATUS_SUCCESS)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	return CSC_DynamicArrayInsertArray(pThis, CSC_DynamicArrayGetElementCount(pThis), pSrc);
+}
+
+CSC_STATUS CSCMETHOD CSC_DynamicArrayAppendMove(_Inout_ CSC_DynamicArray* CONST pThis, _Inout_ CSC_DynamicArray* CONST pSrc)
+{
+	CSC_STATUS status;
+	CSC_SIZE_T elementCount;
+
+	if (CSC_DynamicArrayIsModifiable(pThis) != CSC_STATUS_SUCCESS || pThis == pSrc || !CSC_DynamicArrayIsCompatible(pThis, pSrc))
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	CSC_DynamicArrayMakeContiguous(pSrc);
+	elementCount = pSrc->elementCount;
+
+	if (!elementCount)
+	{
+		return CSC_STATUS_SUCCESS;
+	}
+
+	if (elementCount > CSC_DynamicArrayCalculateMaxElements(pThis->elementSize) - pThis->elementCount)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	// The elements are moved, hence the buffer of the source must not be shared with other arrays.
+	status = CSC_DynamicArrayGrow(pThis, pThis->elementCount + elementCount);
+
+	if (status == CSC_STATUS_SUCCESS)
+	{
+		status = CSC_DynamicArrayMakeUnique(pSrc);
+	}
+
+	if (status != CSC_STATUS_SUCCESS)
+	{
+		return status;
+	}
+
+	CSC_DynamicArrayRelocateElements(pThis, CSC_DynamicArrayGetElement(pThis, pThis->elementCount), CSC_DynamicArrayGetBuffer(pSrc), elementCount);
+	pThis->elementCount += elementCount;
+	CSC_DynamicArrayAdvanceEpoch(pThis);
+
+	pSrc->elementCount = (CSC_SIZE_T)0;
+	CSC_DynamicArrayRelease(pSrc);
+	CSC_DynamicArrayAdvanceEpoch(pSrc);
+
+	return CSC_STATUS_SUCCESS;
+}
+
+CSC_STATUS CSCMETHOD CSC_DynamicArrayRemoveElement(_Inout_ CSC_DynamicArray* CONST pThis, _In_ CONST CSC_SIZE_T removeIndex)
+{
+	if (CSC_DynamicArrayIsModifiable(pThis) != CSC_STATUS_SUCCESS)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	return CSC_DynamicArrayRemoveElements(pThis, removeIndex, (CSC_SIZE_T)1, (CSC_BOOLEAN)TRUE, (CSC_BOOLEAN)FALSE);
+}
+
+CSC_STATUS CSCMETHOD CSC_DynamicArrayLazyRemoveElement(_Inout_ CSC_DynamicArray* CONST pThis, _In_ CONST CSC_SIZE_T removeIndex)
+{
+	if (CSC_DynamicArrayIsModifiable(pThis) != CSC_STATUS_SUCCESS)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	return CSC_DynamicArrayRemoveElements(pThis, removeIndex, (CSC_SIZE_T)1, (CSC_BOOLEAN)TRUE, (CSC_BOOLEAN)TRUE);
+}
+
+CSC_STATUS CSCMETHOD CSC_DynamicArrayRemoveRange(_Inout_ CSC_DynamicArray* CONST pThis, _In_ CONST CSC_SIZE_T removeIndex, _In_ CONST CSC_SIZE_T numOfElements)
+{
+	if (CSC_DynamicArrayIsModifiable(pThis) != CSC_STATUS_SUCCESS)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	return CSC_DynamicArrayRemoveElements(pThis, removeIndex, numOfElements, (CSC_BOOLEAN)TRUE, (CSC_BOOLEAN)FALSE);
+}
+
+CSC_STATUS CSCMETHOD CSC_DynamicArrayLazyRemoveRange(_Inout_ CSC_DynamicArray* CONST pThis, _In_ CONST CSC_SIZE_T removeIndex, _In_ CONST CSC_SIZE_T numOfElements)
+{
+	if (CSC_DynamicArrayIsModifiable(pThis) != CSC_STATUS_SUCCESS)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	return CSC_DynamicArrayRemoveElements(pThis, removeIndex, numOfElements, (CSC_BOOLEAN)TRUE, (CSC_BOOLEAN)TRUE);
+}
+
+CSC_STATUS CSCMETHOD CSC_DynamicArrayRemoveIf(_Inout_ CSC_DynamicArray* CONST pThis, _In_ CONST CSC_P_DYNAMIC_ARRAY_PREDICATE pPredicate, _In_opt_ CONST CSC_PVOID pContext)
+{
+	CSC_SIZE_T readIndex;
+	CSC_SIZE_T writeIndex;
+	CSC_SIZE_T runIndex;
+	CSC_SIZE_T firstRemovedIndex;
+	CSC_STATUS status;
+
+	if (CSC_DynamicArrayIsModifiable(pThis) != CSC_STATUS_SUCCESS || !pPredicate)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	CSC_DynamicArrayMakeContiguous(pThis);
+
+	status = CSC_DynamicArrayMakeUnique(pThis);
+
+	if (status != CSC_STATUS_SUCCESS)
+	{
+		return status;
+	}
+
+	writeIndex = (CSC_SIZE_T)0;
+
+	while (writeIndex < pThis->elementCount && !pPredicate(CSC_DynamicArrayGetElement(pThis, writeIndex), pContext))
+	{
+		++writeIndex;
+	}
+
+	if (writeIndex == pThis->elementCount)
+	{
+		return CSC_STATUS_SUCCESS;
+	}
+
+	// Every iteration removes the selected element at the read index and moves the run of remaining elements behind it as a whole.
+	firstRemovedIndex = writeIndex;
+	readIndex = writeIndex;
+	runIndex = writeIndex;
+
+	while (readIndex < pThis->elementCount)
+	{
+		CSC_DynamicArrayDestroyElements(pThis, readIndex, (CSC_SIZE_T)1);
+		runIndex = readIndex++;
+
+		while (readIndex < pThis->elementCount && !pPredicate(CSC_DynamicArrayGetElement(pThis, readIndex), pContext))
+		{
+			++readIndex;
+		}
+
+		if (readIndex - runIndex > (CSC_SIZE_T)1)
+		{
+			CSC_DynamicArrayRelocateElements(pThis, CSC_DynamicArrayGetElement(pThis, writeIndex), CSC_DynamicArrayGetElement(pThis, runIndex + (CSC_SIZE_T)1), readIndex - runIndex - (CSC_SIZE_T)1);
+			writeIndex += readIndex - runIndex - (CSC_SIZE_T)1;
+		}
+	}
+
+	CSC_DynamicArrayFinishCompaction(pThis, writeIndex, firstRemovedIndex, runIndex);
+
+	return CSC_STATUS_SUCCESS;
+}
+
+CSC_STATUS CSCMETHOD CSC_DynamicArrayRemoveIndices(_Inout_ CSC_DynamicArray* CONST pThis, _In_ CONST CSC_SIZE_T* CONST pSortedIndices, _In_ CONST CSC_SIZE_T numOfIndices)
+{
+	CSC_SIZE_T iterator;
+	CSC_SIZE_T writeIndex;
+	CSC_SIZE_T runEnd;
+	CSC_STATUS status;
+
+	if (CSC_DynamicArrayIsModifiable(pThis) != CSC_STATUS_SUCCESS || (!pSortedIndices && numOfIndices))
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	if (!numOfIndices)
+	{
+		return CSC_STATUS_SUCCESS;
+	}
+
+	CSC_DynamicArrayMakeContiguous(pThis);
+
+	// The indices are validated up front, hence the array is either compacted completely or not at all.
+	for (iterator = (CSC_SIZE_T)0; iterator < numOfIndices; ++iterator)
+	{
+		if (pSortedIndices[iterator] >= pThis->elementCount || (iterator && pSortedIndices[iterator] <= pSortedIndices[iterator - (CSC_SIZE_T)1]))
+		{
+			return CSC_STATUS_INVALID_PARAMETER;
+		}
+	}
+
+	status = CSC_DynamicArrayMakeUnique(pThis);
+
+	if (status != CSC_STATUS_SUCCESS)
+	{
+		return status;
+	}
+
+	writeIndex = pSortedIndices[0];
+
+	for (iterator = (CSC_SIZE_T)0; iterator < numOfIndices; ++iterator)
+	{
+		CSC_DynamicArrayDestroyElements(pThis, pSortedIndices[iterator], (CSC_SIZE_T)1);
+		runEnd = (iterator + (CSC_SIZE_T)1 < numOfIndices) ? pSortedIndices[iterator + (CSC_SIZE_T)1] : pThis->elementCount;
+
+		if (runEnd - pSortedIndices[iterator] > (CSC_SIZE_T)1)
+		{
+			CSC_DynamicArrayRelocateElements(pThis, CSC_DynamicArrayGetElement(pThis, writeIndex), CSC_DynamicArrayGetElement(pThis, pSortedIndices[iterator] + (CSC_SIZE_T)1), runEnd - pSortedIndices[iterator] - (CSC_SIZE_T)1);
+			writeIndex += runEnd - pSortedIndices[iterator] - (CSC_SIZE_T)1;
+		}
+	}
+
+	CSC_DynamicArrayFinishCompaction(pThis, writeIndex, pSortedIndices[0], pSortedIndices[numOfIndices - (CSC_SIZE_T)1]);
+
+	return CSC_STATUS_SUCCESS;
+}
+
+CSC_STATUS CSCMETHOD CSC_DynamicArrayReverse(_Inout_ CSC_DynamicArray* CONST pThis)
+{
+	CSC_STATUS status;
+
+	if (CSC_DynamicArrayIsModifiable(pThis) != CSC_STATUS_SUCCESS || !CSC_DynamicArrayIsRelocatable(pThis))
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	CSC_DynamicArrayMakeContiguous(pThis);
+
+	status = CSC_DynamicArrayMakeUnique(pThis);
+
+	if (status != CSC_STATUS_SUCCESS)
+	{
+		return status;
+	}
+
+	if (pThis->elementCount < (CSC_SIZE_T)2)
+	{
+		return CSC_STATUS_SUCCESS;
+	}
+
+	return CSC_MemoryUtilsReverseArray(CSC_DynamicArrayGetBuffer(pThis), pThis->elementSize, pThis->elementCount);
+}
+
+CSC_STATUS CSCMETHOD CSC_DynamicArraySort(_Inout_ CSC_DynamicArray* CONST pThis, _In_ CONST CSC_P_DYNAMIC_ARRAY_COMPARE pCompare, _In_opt_ CONST CSC_PVOID pContext)
+{
+	CSC_STATUS status = CSC_STATUS_MEMORY_NOT_ALLOCATED;
+
+	if (CSC_DynamicArrayIsModifiable(pThis) != CSC_STATUS_SUCCESS || !pCompare || !CSC_DynamicArrayIsRelocatable(pThis))
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	CSC_DynamicArrayMakeContiguous(pThis);
+
+	if (CSC_DynamicArrayMakeUnique(pThis) != CSC_STATUS_SUCCESS)
+	{
+		return CSC_STATUS_MEMORY_NOT_ALLOCATED;
+	}
+
+	if (pThis->elementSize >= CSC_SORT_UTILS_INDEX_SORT_MIN_ELEMENT_SIZE)
+	{
+		status = CSC_SortUtilsIndexSort(CSC_DynamicArrayGetBuffer(pThis), pThis->elementCount, pThis->elementSize, pCompare, pContext, pThis->pIAllocator);
+	}
+
+	// Without memory for the indices the elements are sorted in place.
+	if (status == CSC_STATUS_MEMORY_NOT_ALLOCATED)
+	{
+		status = CSC_SortUtilsIntroSort(CSC_DynamicArrayGetBuffer(pThis), pThis->elementCount, pThis->elementSize, pCompare, pContext);
+	}
+
+	if (status != CSC_STATUS_SUCCESS)
+	{
+		return status;
+	}
+
+	CSC_DynamicArrayNotifyReplacement(pThis);
+
+	return CSC_STATUS_SUCCESS;
+}
+
+CSC_STATUS CSCMETHOD CSC_DynamicArrayStableSort(_Inout_ CSC_DynamicArray* CONST pThis, _In_ CONST CSC_P_DYNAMIC_ARRAY_COMPARE pCompare, _In_opt_ CONST CSC_PVOID pContext, _In_ CONST CSC_SIZE_T numOfThreads)
+{
+	CSC_STATUS status;
+
+	if (CSC_DynamicArrayIsModifiable(pThis) != CSC_STATUS_SUCCESS || !pCompare || !CSC_DynamicArrayIsRelocatable(pThis))
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	CSC_DynamicArrayMakeContiguous(pThis);
+
+	status = CSC_DynamicArrayMakeUnique(pThis);
+
+	if (status != CSC_STATUS_SUCCESS)
+	{
+		return status;
+	}
+
+	status = CSC_SortUtilsMergeSort(CSC_DynamicArrayGetBuffer(pThis), pThis->elementCount, pThis->elementSize, pCompare, pContext, numOfThreads, pThis->pIAllocator);
+
+	if (status != CSC_STATUS_SUCCESS)
+	{
+		return status;
+	}
+
+	CSC_DynamicArrayNotifyReplacement(pThis);
+
+	return CSC_STATUS_SUCCESS;
+}
+
+CSC_STATUS CSCMETHOD CSC_DynamicArrayRadixSort(_Inout_ CSC_DynamicArray* CONST pThis, _In_ CONST CSC_P_DYNAMIC_ARRAY_GET_KEY pGetKey, _In_opt_ CONST CSC_PVOID pContext, _In_ CONST CSC_SIZE_T keySize)
+{
+	CSC_STATUS status;
+
+	if (CSC_DynamicArrayIsModifiable(pThis) != CSC_STATUS_SUCCESS || !pGetKey || !CSC_DynamicArrayIsRelocatable(pThis))
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	CSC_DynamicArrayMakeContiguous(pThis);
+
+	status = CSC_DynamicArrayMakeUnique(pThis);
+
+	if (status != CSC_STATUS_SUCCESS)
+	{
+		return status;
+	}
+
+	status = CSC_SortUtilsRadixSort(CSC_DynamicArrayGetBuffer(pThis), pThis->elementCount, pThis->elementSize, pGetKey, pContext, keySize, pThis->pIAllocator);
+
+	if (status != CSC_STATUS_SUCCESS)
+	{
+		return status;
+	}
+
+	CSC_DynamicArrayNotifyReplacement(pThis);
+
+	return CSC_STATUS_SUCCESS;
+}
+
+CSC_SIZE_T CSCMETHOD CSC_DynamicArrayLowerBound(_In_ CONST CSC_DynamicArray* CONST pThis, _In_ CONST CSC_PCVOID pValue, _In_ CONST CSC_P_DYNAMIC_ARRAY_COMPARE pCompare, _In_opt_ CONST CSC_PVOID pContext)
+{
+	if (CSC_DynamicArrayIsModifiable(pThis) != CSC_STATUS_SUCCESS || pThis->tombstoneCount)
+	{
+		return CSC_DYNAMIC_ARRAY_INVALID_INDEX;
+	}
+
+	return CSC_SearchUtilsLowerBound(CSC_DynamicArrayGetBuffer(pThis), pThis->elementCount, pThis->elementSize, pValue, pCompare, pContext);
+}
+
+CSC_SIZE_T CSCMETHOD CSC_DynamicArrayUpperBound(_In_ CONST CSC_DynamicArray* CONST pThis, _In_ CONST CSC_PCVOID pValue, _In_ CONST CSC_P_DYNAMIC_ARRAY_COMPARE pCompare, _In_opt_ CONST CSC_PVOID pContext)
+{
+	if (CSC_DynamicArrayIsModifiable(pThis) != CSC_STATUS_SUCCESS || pThis->tombstoneCount)
+	{
+		return CSC_DYNAMIC_ARRAY_INVALID_INDEX;
+	}
+
+	return CSC_SearchUtilsUpperBound(CSC_DynamicArrayGetBuffer(pThis), pThis->elementCount, pThis->elementSize, pValue, pCompare, pContext);
+}
+
+CSC_STATUS CSCMETHOD CSC_DynamicArrayEqualRange(_In_ CONST CSC_DynamicArray* CONST pThis, _In_ CONST CSC_PCVOID pValue, _In_ CONST CSC_P_DYNAMIC_ARRAY_COMPARE pCompare, _In_opt_ CONST CSC_PVOID pContext, _Out_ CSC_SIZE_T* CONST pFirstIndex, _Out_ CSC_SIZE_T* CONST pLastIndex)
+{
+	if (CSC_DynamicArrayIsModifiable(pThis) != CSC_STATUS_SUCCESS || pThis->tombstoneCount)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	return CSC_SearchUtilsEqualRange(CSC_DynamicArrayGetBuffer(pThis), pThis->elementCount, pThis->elementSize, pValue, pCompare, pContext, pFirstIndex, pLastIndex);
+}
+
+CSC_SIZE_T CSCMETHOD CSC_DynamicArrayBinarySearch(_In_ CONST CSC_DynamicArray* CONST pThis, _In_ CONST CSC_PCVOID pValue, _In_ CONST CSC_P_DYNAMIC_ARRAY_COMPARE pCompare, _In_opt_ CONST CSC_PVOID pContext)
+{
+	if (CSC_DynamicArrayIsModifiable(pThis) != CSC_STATUS_SUCCESS || pThis->tombstoneCount)
+	{
+		return CSC_DYNAMIC_ARRAY_INVALID_INDEX;
+	}
+
+	return CSC_SearchUtilsBinarySearch(CSC_DynamicArrayGetBuffer(pThis), pThis->elementCount, pThis->elementSize, pValue, pCompare, pContext);
+}
+
+CSC_SIZE_T CSCMETHOD CSC_DynamicArrayBranchlessLowerBound(_In_ CONST CSC_DynamicArray* CONST pThis, _In_ CONST CSC_PCVOID pValue, _In_ CONST CSC_P_DYNAMIC_ARRAY_COMPARE pCompare, _In_opt_ CONST CSC_PVOID pContext)
+{
+	if (CSC_DynamicArrayIsModifiable(pThis) != CSC_STATUS_SUCCESS || pThis->tombstoneCount)
+	{
+		return CSC_DYNAMIC_ARRAY_INVALID_INDEX;
+	}
+
+	return CSC_SearchUtilsBranchlessLowerBound(CSC_DynamicArrayGetBuffer(pThis), pThis->elementCount, pThis->elementSize, pValue, pCompare, pContext);
+}
+
+CSC_STATUS CSCMETHOD CSC_DynamicArrayBuildEytzinger(_Inout_ CSC_DynamicArray* CONST pThis)
+{
+	CSC_STATUS status;
+
+	if (CSC_DynamicArrayIsModifiable(pThis) != CSC_STATUS_SUCCESS || !CSC_DynamicArrayIsRelocatable(pThis))
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	CSC_DynamicArrayMakeContiguous(pThis);
+
+	status = CSC_DynamicArrayMakeUnique(pThis);
+
+	if (status != CSC_STATUS_SUCCESS)
+	{
+		return status;
+	}
+
+	status = CSC_SearchUtilsBuildEytzinger(CSC_DynamicArrayGetBuffer(pThis), pThis->elementCount, pThis->elementSize, pThis->pIAllocator);
+
+	if (status != CSC_STATUS_SUCCESS)
+	{
+		return status;
+	}
+
+	CSC_DynamicArrayNotifyReplacement(pThis);
+
+	return CSC_STATUS_SUCCESS;
+}
+
+CSC_SIZE_T CSCMETHOD CSC_DynamicArrayEytzingerLowerBound(_In_ CONST CSC_DynamicArray* CONST pThis, _In_ CONST CSC_PCVOID pValue, _In_ CONST CSC_P_DYNAMIC_ARRAY_COMPARE pCompare, _In_opt_ CONST CSC_PVOID pContext)
+{
+	if (CSC_DynamicArrayIsModifiable(pThis) != CSC_STATUS_SUCCESS || pThis->tombstoneCount)
+	{
+		return CSC_DYNAMIC_ARRAY_INVALID_INDEX;
+	}
+
+	return CSC_SearchUtilsEytzingerLowerBound(CSC_DynamicArrayGetBuffer(pThis), pThis->elementCount, pThis->elementSize, pValue, pCompare, pContext);
+}
+
+CSC_STATUS CSCMETHOD CSC_DynamicArrayParallelForEach(_Inout_ CSC_DynamicArray* CONST pThis, _In_ CONST CSC_P_DYNAMIC_ARRAY_FOR_EACH pForEach, _In_opt_ CONST CSC_PVOID pContext, _In_ CONST CSC_SIZE_T numOfThreads, _In_ CONST CSC_SIZE_T grainSize)
+{
+	CSC_STATUS status;
+
+	if (CSC_DynamicArrayIsModifiable(pThis) != CSC_STATUS_SUCCESS)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	CSC_DynamicArrayMakeContiguous(pThis);
+
+	status = CSC_DynamicArrayMakeUnique(pThis);
+
+	if (status != CSC_STATUS_SUCCESS)
+	{
+		return status;
+	}
+
+	return CSC_ParallelUtilsForEach(CSC_DynamicArrayGetBuffer(pThis), pThis->elementCount, pThis->elementSize, pForEach, pContext, numOfThreads, grainSize);
+}
+
+CSC_STATUS CSCMETHOD CSC_DynamicArrayParallelTransform(_In_ CONST CSC_DynamicArray* CONST pThis, _Inout_ CSC_DynamicArray* CONST pDst, _In_ CONST CSC_P_DYNAMIC_ARRAY_TRANSFORM pTransform, _In_opt_ CONST CSC_PVOID pContext, _In_ CONST CSC_SIZE_T numOfThreads, _In_ CONST CSC_SIZE_T grainSize)
+{
+	CSC_PVOID pDstElements;
+	CSC_STATUS status;
+
+	if (CSC_DynamicArrayIsModifiable(pThis) != CSC_STATUS_SUCCESS || CSC_DynamicArrayIsModifiable(pDst) != CSC_STATUS_SUCCESS || pThis == pDst || pThis->tombstoneCount || pDst->pNestedContainerVTable || !pTransform || !numOfThreads)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	status = CSC_DynamicArrayClear(pDst);
+
+	if (status != CSC_STATUS_SUCCESS || !pThis->elementCount)
+	{
+		return status;
+	}
+
+	// The transformed elements are written into uninitialized slots, which only become part of the destination array once all of them are written.
+	pDstElements = CSC_DynamicArrayExtendUninitialized(pDst, pThis->elementCount);
+
+	if (!pDstElements)
+	{
+		return CSC_STATUS_MEMORY_NOT_ALLOCATED;
+	}
+
+	status = CSC_ParallelUtilsTransform(pDstElements, pDst->elementSize, CSC_DynamicArrayGetBuffer(pThis), pThis->elementSize, pThis->elementCount, pTransform, pContext, numOfThreads, grainSize);
+
+	if (status != CSC_STATUS_SUCCESS)
+	{
+		CSC_DynamicArrayCommitEmplace(pDst, (CSC_SIZE_T)0);
+		return status;
+	}
+
+	return CSC_DynamicArrayCommitEmplace(pDst, pThis->elementCount);
+}
+
+CSC_STATUS CSCMETHOD CSC_DynamicArrayParallelReduce(_In_ CONST CSC_DynamicArray* CONST pThis, _In_ CONST CSC_P_DYNAMIC_ARRAY_COMBINE pAccumulate, _In_opt_ CONST CSC_P_DYNAMIC_ARRAY_COMBINE pCombine, _In_opt_ CONST CSC_PVOID pContext, _Inout_ CONST CSC_PVOID pResult, _In_ CONST CSC_SIZE_T resultSize, _In_ CONST CSC_SIZE_T numOfThreads, _In_ CONST CSC_SIZE_T grainSize)
+{
+	if (CSC_DynamicArrayIsModifiable(pThis) != CSC_STATUS_SUCCESS || pThis->tombstoneCount)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	return CSC_ParallelUtilsReduce(CSC_DynamicArrayGetBuffer(pThis), pThis->elementCount, pThis->elementSize, pAccumulate, pCombine, pContext, pResult, resultSize, numOfThreads, grainSize, pThis->pIAllocator);
+}
+
+CSC_PVOID CSCMETHOD CSC_DynamicArrayFront(_In_ CONST CSC_DynamicArray* CONST pThis)
+{
+	return CSC_DynamicArrayAccessElement(pThis, (CSC_SIZE_T)0);
+}
+
+CSC_PVOID CSCMETHOD CSC_DynamicArrayBack(_In_ CONST CSC_DynamicArray* CONST pThis)
+{
+	if (CSC_DynamicArrayIsModifiable(pThis) != CSC_STATUS_SUCCESS || !pThis->elementCount)
+	{
+		return NULL;
+	}
+
+	return CSC_DynamicArrayAccessElement(pThis, CSC_DynamicArrayGetElementCount(pThis) - (CSC_SIZE_T)1);
+}
+
+CSC_PVOID CSCMETHOD CSC_DynamicArrayData(_In_ CONST CSC_DynamicArray* CONST pThis)
+{
+	if (CSC_DynamicArrayIsModifiable(pThis) != CSC_STATUS_SUCCESS || pThis->tombstoneCount)
+	{
+		return NULL;
+	}
+
+	// The buffer may be written through the returned pointer, hence a shared buffer is copied first.
+	if (CSC_DynamicArrayMakeUnique((CSC_DynamicArray*)pThis) != CSC_STATUS_SUCCESS)
+	{
+		return NULL;
+	}
+
+	return CSC_DynamicArrayGetBuffer(pThis);
+}
+
+CSC_STATUS CSCMETHOD CSC_DynamicArrayIsEmpty(_In_ CONST CSC_DynamicArray* CONST pThis)
+{
+	if (CSC_DynamicArrayIsValid(pThis) != CSC_STATUS_SUCCESS)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	return (pThis->elementCount) ? CSC_STATUS_GENERAL_FAILURE : CSC_STATUS_SUCCESS;
+}
+
+CSC_STATUS CSCMETHOD CSC_DynamicArrayIsValid(_In_ CONST CSC_DynamicArray* CONST pThis)
+{
+	if (!pThis || pThis->baseInterface.pIBaseInterfaceVirtualTable != &g_DynamicArrayBaseInterfaceVTable || pThis->iterableInterface.pIIterableVirtualTable != &g_DynamicArrayIterableVTable)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	if (pThis->containerInterface.pIContainerVirtualTable != ((pThis->inlineCapacity) ? &g_DynamicArrayInlineContainerVTable : &g_DynamicArrayContainerVTable) || (pThis->inlineCapacity && (pThis->inlineCapacity != CSC_DYNAMIC_ARRAY_INLINE_SIZE || pThis->isCopyOnWrite)))
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	if (pThis->isFileBacked && (pThis->inlineCapacity || pThis->isCopyOnWrite || pThis->pNestedContainerVTable || !pThis->pData || pThis->isDeferredCompaction))
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	if (!pThis->pIAllocator || !pThis->elementSize || pThis->elementCount > pThis->reservedSpace || pThis->emplaceCount > pThis->reservedSpace - pThis->elementCount || (!pThis->pData && pThis->reservedSpace != CSC_DynamicArrayGetInlineCapacity(pThis)))
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	if (pThis->tombstoneCount > pThis->elementCount || (pThis->tombstoneCount && !pThis->pTombstones))
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	return CSC_STATUS_SUCCESS;
+}
+
+CSC_SIZE_T CSCMETHOD CSC_DynamicArrayGetSize(_In_ CONST CSC_DynamicArray* CONST pThis)
+{
+	if (CSC_DynamicArrayIsValid(pThis) != CSC_STATUS_SUCCESS)
+	{
+		return CSC_CONTAINER_INVALID_LENGTH;
+	}
+
+	return CSC_DynamicArrayGetElementCount(pThis);
+}
+
+CSC_SIZE_T CSCMETHOD CSC_DynamicArrayGetCapacity(_In_ CONST CSC_DynamicArray* CONST pThis)
+{
+	if (CSC_DynamicArrayIsValid(pThis) != CSC_STATUS_SUCCESS)
+	{
+		return CSC_CONTAINER_INVALID_LENGTH;
+	}
+
+	return pThis->reservedSpace;
+}
+
+CSC_SIZE_T CSCMETHOD CSC_DynamicArrayGetMaxElements(_In_ CONST CSC_DynamicArray* CONST pThis)
+{
+	if (CSC_DynamicArrayIsValid(pThis) != CSC_STATUS_SUCCESS)
+	{
+		return CSC_CONTAINER_INVALID_LENGTH;
+	}
+
+	return CSC_DynamicArrayCalculateMaxElements(pThis->elementSize);
+}
+
+CSC_SIZE_T CSCMETHOD CSC_DynamicArrayGetElementSize(_In_ CONST CSC_DynamicArray* CONST pThis)
+{
+	if (CSC_DynamicArrayIsValid(pThis) != CSC_STATUS_SUCCESS)
+	{
+		return (CSC_SIZE_T)0;
+	}
+
+	return pThis->elementSize;
+}
+
+CSC_SIZE_T CSCMETHOD CSC_DynamicArrayGetTombstoneCount(_In_ CONST CSC_DynamicArray* CONST pThis)
+{
+	if (CSC_DynamicArrayIsValid(pThis) != CSC_STATUS_SUCCESS)
+	{
+		return CSC_CONTAINER_INVALID_LENGTH;
+	}
+
+	return pThis->tombstoneCount;
+}
+
+EDynamicArrayGrowthPolicy CSCMETHOD CSC_DynamicArrayGetGrowthPolicy(_In_ CONST CSC_DynamicArray* CONST pThis)
+{
+	if (CSC_DynamicArrayIsValid(pThis) != CSC_STATUS_SUCCESS)
+	{
+		return csc_dagp_Factor2;
+	}
+
+	return pThis->growthPolicy;
+}
+
+CSC_IBaseInterface* CSCMETHOD CSC_DynamicArrayGetIBaseInterface(_In_ CONST CSC_DynamicArray* CONST pThis)
+{
+	if (CSC_DynamicArrayIsValid(pThis) != CSC_STATUS_SUCCESS)
+	{
+		return NULL;
+	}
+
+	return (CSC_IBaseInterface*)&pThis->baseInterface;
+}
+
+CSC_IContainer* CSCMETHOD CSC_DynamicArrayGetIContainer(_In_ CONST CSC_DynamicArray* CONST pThis)
+{
+	if (CSC_DynamicArrayIsValid(pThis) != CSC_STATUS_SUCCESS)
+	{
+		return NULL;
+	}
+
+	return (CSC_IContainer*)&pThis->containerInterface;
+}
+
+CSC_IIterable* CSCMETHOD CSC_DynamicArrayGetIIterable(_In_ CONST CSC_DynamicArray* CONST pThis)
+{
+	if (CSC_DynamicArrayIsValid(pThis) != CSC_STATUS_SUCCESS)
+	{
+		return NULL;
+	}
+
+	return (CSC_IIterable*)&pThis->iterableInterface;
+}
+
+CSC_IAllocator* CSCMETHOD CSC_DynamicArrayGetIAllocator(_In_ CONST CSC_DynamicArray* CONST pThis)
+{
+	if (CSC_DynamicArrayIsValid(pThis) != CSC_STATUS_SUCCESS)
+	{
+		return NULL;
+	}
+
+	return pThis->pIAllocator;
+}
+
+CSC_IContainerVirtualTable* CSCMETHOD CSC_DynamicArrayGetNestedContainerVTable(_In_ CONST CSC_DynamicArray* CONST pThis)
+{
+	if (CSC_DynamicArrayIsValid(pThis) != CSC_STATUS_SUCCESS)
+	{
+		return NULL;
+	}
+
+	return pThis->pNestedContainerVTable;
+}
\ No newline at end of file
@@ -1,6 +1,17 @@
 #ifndef CSC_DYNAMIC_ARRAY
 #define CSC_DYNAMIC_ARRAY
 
+/*
+Description:
+The DynamicArray is a container that stores it's elements in contiguous memory, which is requested from the allocator supplied on initialization.
+Elements are either plain data of an arbitrary size or containers themselves, in which case the virtual table of the nested container type must be supplied on initialization.
+Nested containers are initialized in place, hence they must place their IContainer interface directly behind their IBaseInterface like all containers of the library do.
+Element containers that declare themselves trivially relocatable in their virtual table are relocated bytewise, other ones are moved one by one through their move method, which requires the move method and the allocator getter.
+Arrays of such element containers remove their elements right away instead of deferring the compaction, swap them through a temporary container and can't be reversed, sorted or rearranged into the Eytzinger layout.
+When the array runs out of space, the capacity grows geometrically according to the growth policy of the array, which makes appending an element an amortized O(1) operation.
+The regular removal functions release unused memory right away, while the lazy removal functions keep it to avoid reallocations.
+*/
+
 #include "../../Configuration/Configuration.h"
 #include "../../Interfaces/IBaseInterface.h"
 #include "../../Interfaces/IAllocator.h"
@@ -8,30 +19,128 @@
 #include "../../Interfaces/IIterator.h"
 #include "../../Interfaces/IIterable.h"
 
+// Definition of the smallest capacity that is allocated when the array grows.
+#define CSC_DYNAMIC_ARRAY_MIN_CAPACITY (CSC_SIZE_T)4
+// Definition of the page size that the allocation size is rounded up to by the page rounded growth policy.
+#define CSC_DYNAMIC_ARRAY_PAGE_SIZE (CSC_SIZE_T)0x1000
+// Definition of the fraction of the capacity below which lazy removals shrink the array.
+#define CSC_DYNAMIC_ARRAY_LAZY_SHRINK_DIVISOR (CSC_SIZE_T)4
+// Definition of the size of the inline storage of arrays initialized through CSC_DynamicArrayInitializeInline, must be a multiple of sizeof(CSC_SIZE_T).
+#define CSC_DYNAMIC_ARRAY_INLINE_SIZE (CSC_SIZE_T)0x40
+// Definition of the size of the header in front of the buffers of copy-on-write arrays, which holds the reference count of the buffer.
+#define CSC_DYNAMIC_ARRAY_SHARED_HEADER_SIZE (sizeof(CSC_SIZE_T) * (CSC_SIZE_T)2)
+// Definition of the size of the header at the beginning of the files of file-backed arrays, the elements follow the header.
+#define CSC_DYNAMIC_ARRAY_FILE_HEADER_SIZE (CSC_SIZE_T)0x40
+// Definition of the signature at the beginning of the files of file-backed arrays.
+#define CSC_DYNAMIC_ARRAY_FILE_SIGNATURE (CSC_QWORD)0x3130594152524143
+// Definition of the flag in the serialization record that marks arrays whose elements are containers themselves.
+#define CSC_DYNAMIC_ARRAY_SERIALIZATION_FLAG_NESTED (CSC_QWORD)0x1
+// Definition of the amount of slots that a word of the bitmap of removed slots covers.
+#define CSC_DYNAMIC_ARRAY_TOMBSTONE_BITS (sizeof(CSC_SIZE_T) * (CSC_SIZE_T)8)
+// Definition of the fraction of removed slots at which arrays in deferred compaction mode are compacted.
+#define CSC_DYNAMIC_ARRAY_COMPACTION_DIVISOR (CSC_SIZE_T)2
+// Definition of the amount of buffers of nested arrays that are allocated or freed through a single batch call to the allocator.
+#define CSC_DYNAMIC_ARRAY_BATCH_SIZE (CSC_SIZE_T)0x20
+// Definition of the index that the search functions return if the parameters are invalid or the value isn't found.
+#define CSC_DYNAMIC_ARRAY_INVALID_INDEX (CSC_SIZE_T)-1
+
+// Type definition of the predicate that selects the elements that are removed by CSC_DynamicArrayRemoveIf, which returns TRUE for elements that should be removed.
+typedef CSC_BOOLEAN(CSCMETHOD* CSC_P_DYNAMIC_ARRAY_PREDICATE)(_In_ CONST CSC_PCVOID pElement, _In_opt_ CONST CSC_PVOID pContext);
+// Type definitions of the callbacks of the sort, search and parallel functions, which match the callbacks of the SortUtils and the ParallelUtils that the array passes them on to.
+typedef CSC_INT(CSCMETHOD* CSC_P_DYNAMIC_ARRAY_COMPARE)(_In_ CONST CSC_PCVOID pFirst, _In_ CONST CSC_PCVOID pSecond, _In_opt_ CONST CSC_PVOID pContext);
+typedef CSC_QWORD(CSCMETHOD* CSC_P_DYNAMIC_ARRAY_GET_KEY)(_In_ CONST CSC_PCVOID pElement, _In_opt_ CONST CSC_PVOID pContext);
+typedef void(CSCMETHOD* CSC_P_DYNAMIC_ARRAY_FOR_EACH)(_Inout_ CONST CSC_PVOID pElement, _In_opt_ CONST CSC_PVOID pContext);
+typedef void(CSCMETHOD* CSC_P_DYNAMIC_ARRAY_TRANSFORM)(_Out_ CONST CSC_PVOID pDst, _In_ CONST CSC_PCVOID pSrc, _In_opt_ CONST CSC_PVOID pContext);
+typedef void(CSCMETHOD* CSC_P_DYNAMIC_ARRAY_COMBINE)(_Inout_ CONST CSC_PVOID pAccumulator, _In_ CONST CSC_PCVOID pValue, _In_opt_ CONST CSC_PVOID pContext);
+
+// Definition of the growth policies of the array, which determine the new capacity once the array is full.
+// The page rounded policy doubles the capacity and rounds allocations larger than a page up to a multiple of CSC_DYNAMIC_ARRAY_PAGE_SIZE, which suits page granular allocators.
+typedef enum _EDynamicArrayGrowthPolicy
+{
+	csc_dagp_Factor2 = 0,
+	csc_dagp_Factor1_5,
+	csc_dagp_PageRounded
+} EDynamicArrayGrowthPolicy;
+
 typedef struct _CSC_DynamicArray
 {
 	CSC_IBaseInterface baseInterface;
 	CSC_IContainer containerInterface;
 	CSC_IIterable iterableInterface;
 	CSC_IAllocator* pIAllocator;
-	CSC_IIterator* pIIterator;
+	CSC_IIterator* pFirstIterator;
+	CSC_SIZE_T epoch;
 	CSC_IContainerVirtualTable* pNestedContainerVTable;
 	CSC_PVOID pData;
 	CSC_SIZE_T elementSize;
 	CSC_SIZE_T elementCount;
 	CSC_SIZE_T reservedSpace;
+	EDynamicArrayGrowthPolicy growthPolicy;
+	CSC_SIZE_T inlineCapacity;
+	CSC_SIZE_T emplaceIndex;
+	CSC_SIZE_T emplaceCount;
+	CSC_BOOLEAN isCopyOnWrite;
+	CSC_BOOLEAN isFileBacked;
+	CSC_INT fileDescriptor;
+	CSC_SIZE_T* pTombstones;
+	CSC_SIZE_T tombstoneWords;
+	CSC_SIZE_T tombstoneCount;
+	CSC_BOOLEAN isDeferredCompaction;
 } CSC_DynamicArray;
 
 CSC_STATUS CSCMETHOD CSC_DynamicArrayInitialize(_Out_ CSC_DynamicArray* CONST pThis, _In_ CONST CSC_SIZE_T elementSize, _In_ CONST CSC_IAllocator* CONST pIAllocator, _In_ CONST CSC_IContainerVirtualTable* CONST pNestedContainerVTable);
+// Initializes an array that uses the CSC_DYNAMIC_ARRAY_INLINE_SIZE bytes that directly follow the object as initial storage, which must be provided by an enclosing object like CSC_SmallDynamicArray.
+// Returns CSC_STATUS_SUCCESS on success, otherwise an error code is returned.
+CSC_STATUS CSCMETHOD CSC_DynamicArrayInitializeInline(_Out_ CSC_DynamicArray* CONST pThis, _In_ CONST CSC_SIZE_T elementSize, _In_ CONST CSC_IAllocator* CONST pIAllocator, _In_ CONST CSC_IContainerVirtualTable* CONST pNestedContainerVTable);
 CSC_STATUS CSCMETHOD CSC_DynamicArrayInitializeWithSize(_Out_ CSC_DynamicArray* CONST pThis, _In_ CONST CSC_SIZE_T elementSize, _In_ CONST CSC_SIZE_T numOfElements, _In_opt_ CONST CSC_PCVOID pDefaultValue, _In_ CONST CSC_IAllocator* CONST pIAllocator, _In_ CONST CSC_IContainerVirtualTable* CONST pNestedContainerVTable);
 CSC_STATUS CSCMETHOD CSC_DynamicArrayInitializeWithValue(_Out_ CSC_DynamicArray* CONST pThis, _In_ CONST CSC_SIZE_T elementSize, _In_ CONST CSC_SIZE_T numOfElements, _In_ CONST CSC_PCVOID pValue, _In_ CONST CSC_IAllocator* CONST pIAllocator, _In_ CONST CSC_IContainerVirtualTable* CONST pNestedContainerVTable);
 CSC_STATUS CSCMETHOD CSC_DynamicArrayInitializeWithCopy(_Out_ CSC_DynamicArray* CONST pThis, _In_ CONST CSC_DynamicArray* CONST pSrc);
 CSC_STATUS CSCMETHOD CSC_DynamicArrayInitializeWithArray(_Out_ CSC_DynamicArray* CONST pThis, _In_ CONST CSC_PCVOID pFirst, _In_ CONST CSC_SIZE_T numOfElements, _In_ CONST CSC_SIZE_T elementSize, _In_ CONST CSC_IAllocator* CONST pIAllocator, _In_ CONST CSC_IContainerVirtualTable* CONST pNestedContainerVTable);
+#ifdef CSC_CONFIG_LINUX_NATIVE
+// Initializes an array of plain data that is backed by the file, which is created if it doesn't exist, an existing file must have been created for the same element size.
+// The buffer is a shared mapping of the file behind a header holding the element size, the element count and the capacity, hence opening the array neither reads nor copies the elements.
+// The array grows by extending the file and remapping it, the element count in the header is updated by CSC_DynamicArrayFlush and when the array is destroyed, which keeps the file.
+// The allocator is only used for temporary memory, for example by the sort functions.
+// Returns CSC_STATUS_SUCCESS on success, otherwise an error code is returned.
+CSC_STATUS CSCMETHOD CSC_DynamicArrayInitializeFromFile(_Out_ CSC_DynamicArray* CONST pThis, _In_ CONST CSC_CHAR* CONST pFileName, _In_ CONST CSC_SIZE_T elementSize, _In_ CONST CSC_IAllocator* CONST pIAllocator);
+// Writes the element count to the header of a file-backed array and waits until the mapping has been written back to the file.
+// Returns CSC_STATUS_SUCCESS on success, otherwise an error code is returned.
+CSC_STATUS CSCMETHOD CSC_DynamicArrayFlush(_Inout_ CSC_DynamicArray* CONST pThis);
+#endif
+// Initializes the array from the reader, the nested virtual table is required if the array was serialized with element containers and ignored otherwise.
+// The exact capacity is reserved once and plain data is read directly into the buffer, nested containers receive the same virtual table, hence the nesting below the array must be homogeneous.
+// Returns CSC_STATUS_SUCCESS on success, otherwise an error code is returned.
+CSC_STATUS CSCMETHOD CSC_DynamicArrayDeserialize(_Out_ CSC_DynamicArray* CONST pThis, _Inout_ CSC_SerializationReader* CONST pReader, _In_ CONST CSC_IAllocator* CONST pIAllocator, _In_opt_ CONST CSC_IContainerVirtualTable* CONST pNestedContainerVTable);
+CSC_STATUS CSCMETHOD CSC_DynamicArrayDeserializeInline(_Out_ CSC_DynamicArray* CONST pThis, _Inout_ CSC_SerializationReader* CONST pReader, _In_ CONST CSC_IAllocator* CONST pIAllocator, _In_opt_ CONST CSC_IContainerVirtualTable* CONST pNestedContainerVTable);
+// Queues the array for writing as a record holding the element size and count, followed by the elements.
+// Plain data is referenced in blocks of at most CSC_SERIALIZATION_UTILS_MAX_BLOCK_SIZE bytes and must not be modified until the writer has been flushed, nested containers serialize themselves.
+// Returns CSC_STATUS_SUCCESS on success, otherwise an error code is returned.
+CSC_STATUS CSCMETHOD CSC_DynamicArraySerialize(_In_ CONST CSC_DynamicArray* CONST pThis, _Inout_ CSC_SerializationWriter* CONST pWriter);
 
 CSC_STATUS CSCMETHOD CSC_DynamicArrayResize(_Inout_ CSC_DynamicArray* CONST pThis, _In_ CONST CSC_SIZE_T numOfElements, _In_opt_ CONST CSC_PCVOID pDefaultValue);
 CSC_STATUS CSCMETHOD CSC_DynamicArrayLazyResize(_Inout_ CSC_DynamicArray* CONST pThis, _In_ CONST CSC_SIZE_T numOfElements, _In_opt_ CONST CSC_PCVOID pDefaultValue);
+// Reserves space for at least the given amount of elements, slack that the allocator adds by rounding up the request is used as additional capacity.
+// Returns CSC_STATUS_SUCCESS on success, otherwise an error code is returned.
 CSC_STATUS CSCMETHOD CSC_DynamicArrayReserve(_Inout_ CSC_DynamicArray* CONST pThis, _In_ CONST CSC_SIZE_T numOfElements);
 CSC_STATUS CSCMETHOD CSC_DynamicArrayShrinkToFit(_Inout_ CSC_DynamicArray* CONST pThis);
+// Enables or disables the copy-on-write mode, which is inherited by copies of the array and not supported for arrays with inline storage.
+// Arrays in copy-on-write mode share their buffer with their copies through an atomic reference count, the buffer is only copied once one of them is modified or a writable element is retrieved.
+// Returns CSC_STATUS_SUCCESS on success, otherwise an error code is returned.
+CSC_STATUS CSCMETHOD CSC_DynamicArraySetCopyOnWrite(_Inout_ CSC_DynamicArray* CONST pThis, _In_ CONST CSC_BOOLEAN isCopyOnWrite);
+// Sets the policy that determines the new capacity when the array grows, the default policy is csc_dagp_Factor2.
+// Returns CSC_STATUS_SUCCESS on success, otherwise an error code is returned.
+CSC_STATUS CSCMETHOD CSC_DynamicArraySetGrowthPolicy(_Inout_ CSC_DynamicArray* CONST pThis, _In_ CONST EDynamicArrayGrowthPolicy growthPolicy);
+// Enables or disables the deferred compaction mode, which is inherited by copies of the array and not supported for file-backed arrays, disabling it compacts the array and releases the bitmap.
+// Removals only mark the slot of the element in a bitmap, indices keep referring to the remaining elements, which are moved together once 1/CSC_DYNAMIC_ARRAY_COMPACTION_DIVISOR of the slots are removed.
+// The slot of an index is located in logarithmic time through a Fenwick tree over the counts of removed slots per word of the bitmap, which doubles the size of the bitmap.
+// Modifying operations that require contiguous elements, like insertions in front of the last element and sorting, compact the array first, copies, serialization and insertions of the array into another one skip the removed slots.
+// The search functions, CSC_DynamicArrayData and the parallel functions that receive the array as constant fail while slots are removed until the array is compacted through CSC_DynamicArrayCompact.
+// Arrays of element containers that aren't trivially relocatable keep the mode, but remove their elements right away.
+// Returns CSC_STATUS_SUCCESS on success, otherwise an error code is returned.
+CSC_STATUS CSCMETHOD CSC_DynamicArraySetDeferredCompaction(_Inout_ CSC_DynamicArray* CONST pThis, _In_ CONST CSC_BOOLEAN isDeferredCompaction);
+// Moves the remaining elements of an array in deferred compaction mode in front of the removed slots and releases unused memory.
+// Returns CSC_STATUS_SUCCESS on success, otherwise an error code is returned.
+CSC_STATUS CSCMETHOD CSC_DynamicArrayCompact(_Inout_ CSC_DynamicArray* CONST pThis);
 
 CSC_STATUS CSCMETHOD CSC_DynamicArrayDestroy(_Inout_ CSC_DynamicArray* CONST pThis);
 CSC_STATUS CSCMETHOD CSC_DynamicArrayErase(_Inout_ CSC_DynamicArray* CONST pThis);
@@ -39,12 +148,34 @@ CSC_STATUS CSCMETHOD CSC_DynamicArrayClear(_Inout_ CSC_DynamicArray* CONST pThis
 CSC_STATUS CSCMETHOD CSC_DynamicArrayZeroMemory(_Out_ CSC_DynamicArray* CONST pThis);
 
 CSC_STATUS CSCMETHOD CSC_DynamicArrayPushValue(_Inout_ CSC_DynamicArray* CONST pThis, _In_opt_ CONST CSC_PCVOID pValue);
+// Reserves an uninitialized slot behind the last element and returns a pointer to it, which the caller writes the element to.
+// Nested containers must be initialized in place by the caller, operations that modify the array or copy it's elements fail with CSC_STATUS_INVALID_PARAMETER until the slot is committed through CSC_DynamicArrayCommitEmplace.
+// The elements behind the slot are already moved, hence element accesses, searches and the iteration through the IIterable interface fail as well until then.
+// Destroying or erasing the array cancels the emplacement.
+// Returns a null pointer if the slot couldn't be reserved or another emplacement is pending.
+CSC_PVOID CSCMETHOD CSC_DynamicArrayEmplaceBack(_Inout_ CSC_DynamicArray* CONST pThis);
+// Moves the elements starting at the given index back by one and returns a pointer to the uninitialized slot in front of them, the same rules as for CSC_DynamicArrayEmplaceBack apply.
+// Returns a null pointer if the slot couldn't be reserved or another emplacement is pending.
+CSC_PVOID CSCMETHOD CSC_DynamicArrayEmplaceAt(_Inout_ CSC_DynamicArray* CONST pThis, _In_ CONST CSC_SIZE_T insertIndex);
+// Reserves the given amount of uninitialized slots behind the last element and returns a pointer to the first one, which allows bulk producers to write directly into the array.
+// Returns a null pointer if the slots couldn't be reserved or another emplacement is pending.
+CSC_PVOID CSCMETHOD CSC_DynamicArrayExtendUninitialized(_Inout_ CSC_DynamicArray* CONST pThis, _In_ CONST CSC_SIZE_T numOfElements);
+// Adds the first numOfElements slots of the pending emplacement to the array and advances the epoch, the remaining slots are released.
+// Committing 0 elements cancels the emplacement.
+// Returns CSC_STATUS_SUCCESS on success, otherwise an error code is returned.
+CSC_STATUS CSCMETHOD CSC_DynamicArrayCommitEmplace(_Inout_ CSC_DynamicArray* CONST pThis, _In_ CONST CSC_SIZE_T numOfElements);
 CSC_STATUS CSCMETHOD CSC_DynamicArrayPopValue(_Inout_ CSC_DynamicArray* CONST pThis, _When_(return == STATUS_SUCCESS, _Out_opt_) CONST CSC_PVOID pValue);
 CSC_STATUS CSCMETHOD CSC_DynamicArrayLazyPopValue(_Inout_ CSC_DynamicArray* CONST pThis, _When_(return == STATUS_SUCCESS, _Out_opt_) CONST CSC_PVOID pValue);
 CSC_STATUS CSCMETHOD CSC_DynamicArrayPopFront(_Inout_ CSC_DynamicArray* CONST pThis, _When_(return == STATUS_SUCCESS, _Out_opt_) CONST CSC_PVOID pValue);
 CSC_STATUS CSCMETHOD CSC_DynamicArrayLazyPopFront(_Inout_ CSC_DynamicArray* CONST pThis, _When_(return == STATUS_SUCCESS, _Out_opt_) CONST CSC_PVOID pValue);
 
+// Retrieves a writable element, a buffer that is shared with copies of the array is copied first, NULL is returned if that fails.
 CSC_PVOID CSCMETHOD CSC_DynamicArrayAccessElement(_In_ CONST CSC_DynamicArray* CONST pThis, _In_ CONST CSC_SIZE_T index);
+// Retrieves an element for reading, which never copies a shared buffer.
+CSC_PCVOID CSCMETHOD CSC_DynamicArrayReadElement(_In_ CONST CSC_DynamicArray* CONST pThis, _In_ CONST CSC_SIZE_T index);
+// Retrieves the longest run of contiguous elements that begins at the given index for reading and stores it's length, like CSC_DynamicArrayReadElement it never copies a shared buffer.
+// Without removed slots the run extends to the last element, otherwise it ends at the next removed slot, NULL is returned and the length is set to 0 if the index is out of bounds.
+CSC_PCVOID CSCMETHOD CSC_DynamicArrayGetContiguousChunk(_In_ CONST CSC_DynamicArray* CONST pThis, _In_ CONST CSC_SIZE_T startIndex, _Out_ CSC_SIZE_T* CONST pNumOfElements);
 
 CSC_STATUS CSCMETHOD CSC_DynamicArrayAssign(_Inout_ CSC_DynamicArray* CONST pThis, _In_ CONST CSC_SIZE_T numOfElements, _In_ CONST CSC_PCVOID pValue);
 CSC_STATUS CSCMETHOD CSC_DynamicArrayAssignBlock(_Inout_ CSC_DynamicArray* CONST pThis, _In_ CONST CSC_SIZE_T firstIndex, _In_ CONST CSC_SIZE_T numOfElements, _In_ CONST CSC_PCVOID pValue);
@@ -55,6 +186,8 @@ CSC_STATUS CSCMETHOD CSC_DynamicArrayMove(_Inout_ CSC_DynamicArray* CONST pThis,
 CSC_STATUS CSCMETHOD CSC_DynamicArrayCopyArray(_Inout_ CSC_DynamicArray* CONST pThis, _In_ CONST CSC_PCVOID pFirst, _In_ CONST CSC_SIZE_T numOfElements, _In_ CONST CSC_SIZE_T elementSize);
 
 CSC_STATUS CSCMETHOD CSC_DynamicArrayInsertElement(_Inout_ CSC_DynamicArray* CONST pThis, _In_ CONST CSC_SIZE_T insertIndex, _In_opt_ CONST CSC_PCVOID pValue);
+// Inserts copies of the elements, the range may be taken from the array itself, in which case it's elements are counted by their index and may span removed slots.
+// Returns CSC_STATUS_SUCCESS on success, otherwise an error code is returned.
 CSC_STATUS CSCMETHOD CSC_DynamicArrayInsertRange(_Inout_ CSC_DynamicArray* CONST pThis, _In_ CONST CSC_SIZE_T insertIndex, _In_opt_ CONST CSC_PCVOID pFirst, _In_ CONST CSC_SIZE_T numOfElements);
 CSC_STATUS CSCMETHOD CSC_DynamicArrayInsertArray(_Inout_ CSC_DynamicArray* CONST pThis, _In_ CONST CSC_SIZE_T insertIndex, _In_ CONST CSC_DynamicArray* CONST pSrc);
 CSC_STATUS CSCMETHOD CSC_DynamicArrayAppendCopy(_Inout_ CSC_DynamicArray* CONST pThis, _In_ CONST CSC_DynamicArray* CONST pSrc);
@@ -64,8 +197,51 @@ CSC_STATUS CSCMETHOD CSC_DynamicArrayRemoveElement(_Inout_ CSC_DynamicArray* CON
 CSC_STATUS CSCMETHOD CSC_DynamicArrayLazyRemoveElement(_Inout_ CSC_DynamicArray* CONST pThis, _In_ CONST CSC_SIZE_T removeIndex);
 CSC_STATUS CSCMETHOD CSC_DynamicArrayRemoveRange(_Inout_ CSC_DynamicArray* CONST pThis, _In_ CONST CSC_SIZE_T removeIndex, _In_ CONST CSC_SIZE_T numOfElements);
 CSC_STATUS CSCMETHOD CSC_DynamicArrayLazyRemoveRange(_Inout_ CSC_DynamicArray* CONST pThis, _In_ CONST CSC_SIZE_T removeIndex, _In_ CONST CSC_SIZE_T numOfElements);
+// Removes all elements the predicate selects in a single pass that keeps the order of the remaining elements, which are moved in blocks.
+// The epoch is advanced once if the removed elements were adjacent, otherwise the iteration of the registered iterators is invalidated.
+// Returns CSC_STATUS_SUCCESS on success, otherwise an error code is returned.
+CSC_STATUS CSCMETHOD CSC_DynamicArrayRemoveIf(_Inout_ CSC_DynamicArray* CONST pThis, _In_ CONST CSC_P_DYNAMIC_ARRAY_PREDICATE pPredicate, _In_opt_ CONST CSC_PVOID pContext);
+// Removes the elements at the given indices like CSC_DynamicArrayRemoveIf, the indices must be in strictly ascending order.
+// Returns CSC_STATUS_SUCCESS on success, otherwise an error code is returned.
+CSC_STATUS CSCMETHOD CSC_DynamicArrayRemoveIndices(_Inout_ CSC_DynamicArray* CONST pThis, _In_ CONST CSC_SIZE_T* CONST pSortedIndices, _In_ CONST CSC_SIZE_T numOfIndices);
 
 CSC_STATUS CSCMETHOD CSC_DynamicArrayReverse(_Inout_ CSC_DynamicArray* CONST pThis);
+// Sorts the elements through an introsort, elements of at least CSC_SORT_UTILS_INDEX_SORT_MIN_ELEMENT_SIZE bytes are sorted through an index sort, which moves every element only once.
+// The sort is not stable, sorting invalidates the iteration of the registered iterators.
+// Returns CSC_STATUS_SUCCESS on success, otherwise an error code is returned.
+CSC_STATUS CSCMETHOD CSC_DynamicArraySort(_Inout_ CSC_DynamicArray* CONST pThis, _In_ CONST CSC_P_DYNAMIC_ARRAY_COMPARE pCompare, _In_opt_ CONST CSC_PVOID pContext);
+// Sorts the elements through a stable merge sort, large arrays are sorted by up to numOfThreads threads if the configuration supports it.
+// Returns CSC_STATUS_SUCCESS on success, otherwise an error code is returned.
+CSC_STATUS CSCMETHOD CSC_DynamicArrayStableSort(_Inout_ CSC_DynamicArray* CONST pThis, _In_ CONST CSC_P_DYNAMIC_ARRAY_COMPARE pCompare, _In_opt_ CONST CSC_PVOID pContext, _In_ CONST CSC_SIZE_T numOfThreads);
+// Sorts the elements through a stable radix sort over the lowest keySize bytes of the keys that the key function returns.
+// Returns CSC_STATUS_SUCCESS on success, otherwise an error code is returned.
+CSC_STATUS CSCMETHOD CSC_DynamicArrayRadixSort(_Inout_ CSC_DynamicArray* CONST pThis, _In_ CONST CSC_P_DYNAMIC_ARRAY_GET_KEY pGetKey, _In_opt_ CONST CSC_PVOID pContext, _In_ CONST CSC_SIZE_T keySize);
+
+// The search functions expect the elements to be sorted in ascending order of the comparison function, which is invoked with an element as first and the value as second argument.
+// The bounds are returned as indices, CSC_DYNAMIC_ARRAY_INVALID_INDEX is returned if the parameters are invalid or the binary search doesn't find the value.
+CSC_SIZE_T CSCMETHOD CSC_DynamicArrayLowerBound(_In_ CONST CSC_DynamicArray* CONST pThis, _In_ CONST CSC_PCVOID pValue, _In_ CONST CSC_P_DYNAMIC_ARRAY_COMPARE pCompare, _In_opt_ CONST CSC_PVOID pContext);
+CSC_SIZE_T CSCMETHOD CSC_DynamicArrayUpperBound(_In_ CONST CSC_DynamicArray* CONST pThis, _In_ CONST CSC_PCVOID pValue, _In_ CONST CSC_P_DYNAMIC_ARRAY_COMPARE pCompare, _In_opt_ CONST CSC_PVOID pContext);
+CSC_STATUS CSCMETHOD CSC_DynamicArrayEqualRange(_In_ CONST CSC_DynamicArray* CONST pThis, _In_ CONST CSC_PCVOID pValue, _In_ CONST CSC_P_DYNAMIC_ARRAY_COMPARE pCompare, _In_opt_ CONST CSC_PVOID pContext, _Out_ CSC_SIZE_T* CONST pFirstIndex, _Out_ CSC_SIZE_T* CONST pLastIndex);
+CSC_SIZE_T CSCMETHOD CSC_DynamicArrayBinarySearch(_In_ CONST CSC_DynamicArray* CONST pThis, _In_ CONST CSC_PCVOID pValue, _In_ CONST CSC_P_DYNAMIC_ARRAY_COMPARE pCompare, _In_opt_ CONST CSC_PVOID pContext);
+CSC_SIZE_T CSCMETHOD CSC_DynamicArrayBranchlessLowerBound(_In_ CONST CSC_DynamicArray* CONST pThis, _In_ CONST CSC_PCVOID pValue, _In_ CONST CSC_P_DYNAMIC_ARRAY_COMPARE pCompare, _In_opt_ CONST CSC_PVOID pContext);
+// Reorders the sorted elements into the Eytzinger layout, afterwards the array can only be searched through CSC_DynamicArrayEytzingerLowerBound until it is sorted again.
+// Returns CSC_STATUS_SUCCESS on success, otherwise an error code is returned.
+CSC_STATUS CSCMETHOD CSC_DynamicArrayBuildEytzinger(_Inout_ CSC_DynamicArray* CONST pThis);
+// Retrieves the index of the first element that is not ordered before the value within an array in Eytzinger layout, which is the size of the array if there is none.
+// Returns CSC_DYNAMIC_ARRAY_INVALID_INDEX if the parameters are invalid.
+CSC_SIZE_T CSCMETHOD CSC_DynamicArrayEytzingerLowerBound(_In_ CONST CSC_DynamicArray* CONST pThis, _In_ CONST CSC_PCVOID pValue, _In_ CONST CSC_P_DYNAMIC_ARRAY_COMPARE pCompare, _In_opt_ CONST CSC_PVOID pContext);
+
+// The parallel functions split the elements into chunks of at least grainSize elements that are processed by up to numOfThreads threads, the callbacks must be thread safe.
+// Arrays of less than CSC_PARALLEL_UTILS_SERIAL_CUTOFF elements are processed on the calling thread, a grain size of 0 selects CSC_PARALLEL_UTILS_DEFAULT_GRAIN_SIZE.
+// Applies the function to every element, the elements may be modified but the array itself must not be.
+// Returns CSC_STATUS_SUCCESS on success, otherwise an error code is returned.
+CSC_STATUS CSCMETHOD CSC_DynamicArrayParallelForEach(_Inout_ CSC_DynamicArray* CONST pThis, _In_ CONST CSC_P_DYNAMIC_ARRAY_FOR_EACH pForEach, _In_opt_ CONST CSC_PVOID pContext, _In_ CONST CSC_SIZE_T numOfThreads, _In_ CONST CSC_SIZE_T grainSize);
+// Replaces the elements of the destination array with the transformed elements of the array, the destination array must hold plain data and is resized to the size of the array.
+// Returns CSC_STATUS_SUCCESS on success, otherwise an error code is returned.
+CSC_STATUS CSCMETHOD CSC_DynamicArrayParallelTransform(_In_ CONST CSC_DynamicArray* CONST pThis, _Inout_ CSC_DynamicArray* CONST pDst, _In_ CONST CSC_P_DYNAMIC_ARRAY_TRANSFORM pTransform, _In_opt_ CONST CSC_PVOID pContext, _In_ CONST CSC_SIZE_T numOfThreads, _In_ CONST CSC_SIZE_T grainSize);
+// Reduces the elements into the result through an associative combiner like CSC_ParallelUtilsReduce, the result must hold the identity of the combiner on input.
+// Returns CSC_STATUS_SUCCESS on success, otherwise an error code is returned.
+CSC_STATUS CSCMETHOD CSC_DynamicArrayParallelReduce(_In_ CONST CSC_DynamicArray* CONST pThis, _In_ CONST CSC_P_DYNAMIC_ARRAY_COMBINE pAccumulate, _In_opt_ CONST CSC_P_DYNAMIC_ARRAY_COMBINE pCombine, _In_opt_ CONST CSC_PVOID pContext, _Inout_ CONST CSC_PVOID pResult, _In_ CONST CSC_SIZE_T resultSize, _In_ CONST CSC_SIZE_T numOfThreads, _In_ CONST CSC_SIZE_T grainSize);
 
 CSC_PVOID CSCMETHOD CSC_DynamicArrayFront(_In_ CONST CSC_DynamicArray* CONST pThis);
 CSC_PVOID CSCMETHOD CSC_DynamicArrayBack(_In_ CONST CSC_DynamicArray* CONST pThis);
@@ -78,8 +254,14 @@ CSC_SIZE_T CSCMETHOD CSC_DynamicArrayGetSize(_In_ CONST CSC_DynamicArray* CONST
 CSC_SIZE_T CSCMETHOD CSC_DynamicArrayGetCapacity(_In_ CONST CSC_DynamicArray* CONST pThis);
 CSC_SIZE_T CSCMETHOD CSC_DynamicArrayGetMaxElements(_In_ CONST CSC_DynamicArray* CONST pThis);
 CSC_SIZE_T CSCMETHOD CSC_DynamicArrayGetElementSize(_In_ CONST CSC_DynamicArray* CONST pThis);
+// Retrieves the amount of removed slots that haven't been compacted yet.
+CSC_SIZE_T CSCMETHOD CSC_DynamicArrayGetTombstoneCount(_In_ CONST CSC_DynamicArray* CONST pThis);
+EDynamicArrayGrowthPolicy CSCMETHOD CSC_DynamicArrayGetGrowthPolicy(_In_ CONST CSC_DynamicArray* CONST pThis);
 CSC_IBaseInterface* CSCMETHOD CSC_DynamicArrayGetIBaseInterface(_In_ CONST CSC_DynamicArray* CONST pThis);
+// The virtual table of the IContainer interface of any initialized array can be passed as nested virtual table of arrays of DynamicArrays.
 CSC_IContainer* CSCMETHOD CSC_DynamicArrayGetIContainer(_In_ CONST CSC_DynamicArray* CONST pThis);
+// Any number of iterators can be registered through the IIterable interface, insertions, removals and reallocations only advance the epoch, replacing the elements as a whole invalidates the iteration.
+// The iteration reads a shared buffer of an array in copy-on-write mode without copying it, elements that are written have to be retrieved through CSC_DynamicArrayAccessElement.
 CSC_IIterable* CSCMETHOD CSC_DynamicArrayGetIIterable(_In_ CONST CSC_DynamicArray* CONST pThis);
 CSC_IAllocator* CSCMETHOD CSC_DynamicArrayGetIAllocator(_In_ CONST CSC_DynamicArray* CONST pThis);
 CSC_IContainerVirtualTable* CSCMETHOD CSC_DynamicArrayGetNestedContainerVTable(_In_ CONST CSC_DynamicArray* CONST pThis);
@@ -0,0 +1,953 @@
+#include "JaggedArray.h"
+#include "../../Utils/MemoryUtils.h"
+
+static CSC_PCVOID CSCMETHOD CSC_JaggedArrayGetInterface(_In_ CONST CSC_IBaseInterface* CONST pThis, _In_ CONST EBaseInterfaceType interfaceType);
+
+static CSC_STATUS CSCMETHOD CSC_JaggedArrayIContainerInitialize(_Out_ CSC_IContainer* CONST pThis, _In_ CONST CSC_SIZE_T elementSize, _In_ CSC_IAllocator* CONST pIAllocator);
+static CSC_STATUS CSCMETHOD CSC_JaggedArrayIContainerErase(_Inout_ CSC_IContainer* CONST pThis);
+static CSC_STATUS CSCMETHOD CSC_JaggedArrayIContainerDestroy(_Inout_ CSC_IContainer* CONST pThis);
+static CSC_STATUS CSCMETHOD CSC_JaggedArrayIContainerCopy(_Inout_ CSC_IContainer* CONST pThis, _In_ CONST CSC_IContainer* CONST pOther);
+static CSC_STATUS CSCMETHOD CSC_JaggedArrayIContainerMove(_Inout_ CSC_IContainer* CONST pThis, _Inout_ CSC_IContainer* CONST pOther);
+static CSC_STATUS CSCMETHOD CSC_JaggedArrayIContainerSwapValues(_Inout_ CSC_IContainer* CONST pThis, _In_ CONST CSC_SIZE_T firstIndex, _In_ CONST CSC_SIZE_T secondIndex);
+static CSC_PVOID CSCMETHOD CSC_JaggedArrayIContainerAccessElement(_In_ CONST CSC_IContainer* CONST pThis, _In_ CONST CSC_SIZE_T index);
+static CSC_STATUS CSCMETHOD CSC_JaggedArrayIContainerIsValid(_In_ CONST CSC_IContainer* CONST pThis);
+static CSC_STATUS CSCMETHOD CSC_JaggedArrayIContainerIsEmpty(_In_ CONST CSC_IContainer* CONST pThis);
+static CSC_STATUS CSCMETHOD CSC_JaggedArrayIContainerIsElementContainer(_In_ CONST CSC_IContainer* CONST pThis);
+static CSC_SIZE_T CSCMETHOD CSC_JaggedArrayIContainerGetSize(_In_ CONST CSC_IContainer* CONST pThis);
+static CSC_SIZE_T CSCMETHOD CSC_JaggedArrayIContainerGetElementSize(_In_ CONST CSC_IContainer* CONST pThis);
+static CSC_SIZE_T CSCMETHOD CSC_JaggedArrayIContainerGetMaxElements(_In_ CONST CSC_IContainer* CONST pThis);
+static CSC_IAllocator* CSCMETHOD CSC_JaggedArrayIContainerGetIAllocator(_In_ CONST CSC_IContainer* CONST pThis);
+static CSC_IContainerVirtualTable* CSCMETHOD CSC_JaggedArrayIContainerGetNestedContainerVTable(_In_ CONST CSC_IContainer* CONST pThis);
+static CSC_STATUS CSCMETHOD CSC_JaggedArrayIContainerSerialize(_In_ CONST CSC_IContainer* CONST pThis, _Inout_ CSC_SerializationWriter* CONST pWriter);
+static CSC_STATUS CSCMETHOD CSC_JaggedArrayIContainerDeserialize(_Out_ CSC_IContainer* CONST pThis, _Inout_ CSC_SerializationReader* CONST pReader, _In_ CSC_IAllocator* CONST pIAllocator, _In_opt_ CSC_IContainerVirtualTable* CONST pNestedContainerVTable);
+
+static CSC_IBaseInterfaceVirtualTable g_JaggedArrayBaseInterfaceVTable =
+{
+	CSC_JaggedArrayGetInterface
+};
+
+// Insertions and removals of elements through the interface are not supported, as they would change the rows.
+static CSC_IContainerVirtualTable g_JaggedArrayContainerVTable =
+{
+	CSC_JaggedArrayIContainerInitialize,
+	CSC_JaggedArrayIContainerErase,
+	CSC_JaggedArrayIContainerDestroy,
+	CSC_JaggedArrayIContainerCopy,
+	CSC_JaggedArrayIContainerMove,
+	NULL,
+	NULL,
+	CSC_JaggedArrayIContainerSwapValues,
+	CSC_JaggedArrayIContainerAccessElement,
+	CSC_JaggedArrayIContainerIsValid,
+	CSC_JaggedArrayIContainerIsEmpty,
+	CSC_JaggedArrayIContainerIsElementContainer,
+	CSC_JaggedArrayIContainerGetSize,
+	CSC_JaggedArrayIContainerGetElementSize,
+	CSC_JaggedArrayIContainerGetMaxElements,
+	CSC_JaggedArrayIContainerGetIAllocator,
+	CSC_JaggedArrayIContainerGetNestedContainerVTable,
+	CSC_JaggedArrayIContainerSerialize,
+	CSC_JaggedArrayIContainerDeserialize,
+	(CSC_BOOLEAN)TRUE
+};
+
+
+static CSC_SIZE_T CSCMETHOD CSC_JaggedArrayGetRowEnd(_In_ CONST CSC_JaggedArray* CONST pThis, _In_ CONST CSC_SIZE_T rowIndex)
+{
+	return *(CONST CSC_SIZE_T*)CSC_DynamicArrayReadElement(&pThis->rowEnds, rowIndex);
+}
+
+// Rows begin at the end of the previous row, the first row begins at the first element.
+static CSC_SIZE_T CSCMETHOD CSC_JaggedArrayGetRowBegin(_In_ CONST CSC_JaggedArray* CONST pThis, _In_ CONST CSC_SIZE_T rowIndex)
+{
+	return (rowIndex) ? CSC_JaggedArrayGetRowEnd(pThis, rowIndex - (CSC_SIZE_T)1) : (CSC_SIZE_T)0;
+}
+
+// Checks that the row offsets ascend and that the last row ends at the last element, which is required for streams that haven't been written by the container itself.
+static CSC_BOOLEAN CSCMETHOD CSC_JaggedArrayAreRowsConsistent(_In_ CONST CSC_JaggedArray* CONST pThis)
+{
+	CONST CSC_SIZE_T rowCount = CSC_DynamicArrayGetSize(&pThis->rowEnds);
+	CSC_SIZE_T rowEnd = (CSC_SIZE_T)0;
+	CSC_SIZE_T iterator;
+
+	for (iterator = (CSC_SIZE_T)0; iterator < rowCount; ++iterator)
+	{
+		if (CSC_JaggedArrayGetRowEnd(pThis, iterator) < rowEnd)
+		{
+			return (CSC_BOOLEAN)FALSE;
+		}
+
+		rowEnd = CSC_JaggedArrayGetRowEnd(pThis, iterator);
+	}
+
+	return (rowEnd == CSC_DynamicArrayGetSize(&pThis->elements)) ? (CSC_BOOLEAN)TRUE : (CSC_BOOLEAN)FALSE;
+}
+
+static void CSCMETHOD CSC_JaggedArraySetInterfaces(_Inout_ CSC_JaggedArray* CONST pThis, _In_ CONST CSC_IAllocator* CONST pIAllocator)
+{
+	pThis->baseInterface.pIBaseInterfaceVirtualTable = &g_JaggedArrayBaseInterfaceVTable;
+	pThis->containerInterface.pIContainerVirtualTable = &g_JaggedArrayContainerVTable;
+	pThis->pIAllocator = (CSC_IAllocator*)pIAllocator;
+}
+
+
+static CSC_PCVOID CSCMETHOD CSC_JaggedArrayGetInterface(_In_ CONST CSC_IBaseInterface* CONST pThis, _In_ CONST EBaseInterfaceType interfaceType)
+{
+	CONST CSC_JaggedArray* CONST pArray = (CONST CSC_JaggedArray* CONST)pThis;
+
+	if (!pThis)
+	{
+		return NULL;
+	}
+
+	switch (interfaceType)
+	{
+	case csc_bit_IContainer:
+
+		return (CSC_PCVOID)&pArray->containerInterface;
+
+	default:
+
+		return NULL;
+	}
+}
+
+static CSC_STATUS CSCMETHOD CSC_JaggedArrayIContainerInitialize(_Out_ CSC_IContainer* CONST pThis, _In_ CONST CSC_SIZE_T elementSize, _In_ CSC_IAllocator* CONST pIAllocator)
+{
+	if (!pThis)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	return CSC_JaggedArrayInitialize(CSC_CONTAINING_RECORD(pThis, CSC_JaggedArray, containerInterface), elementSize, pIAllocator);
+}
+
+static CSC_STATUS CSCMETHOD CSC_JaggedArrayIContainerErase(_Inout_ CSC_IContainer* CONST pThis)
+{
+	if (!pThis)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	return CSC_JaggedArrayErase(CSC_CONTAINING_RECORD(pThis, CSC_JaggedArray, containerInterface));
+}
+
+static CSC_STATUS CSCMETHOD CSC_JaggedArrayIContainerDestroy(_Inout_ CSC_IContainer* CONST pThis)
+{
+	if (!pThis)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	return CSC_JaggedArrayDestroy(CSC_CONTAINING_RECORD(pThis, CSC_JaggedArray, containerInterface));
+}
+
+static CSC_STATUS CSCMETHOD CSC_JaggedArrayIContainerCopy(_Inout_ CSC_IContainer* CONST pThis, _In_ CONST CSC_IContainer* CONST pOther)
+{
+	if (!pThis || !pOther || pOther->pIContainerVirtualTable != &g_JaggedArrayContainerVTable)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	return CSC_JaggedArrayCopy(CSC_CONTAINING_RECORD(pThis, CSC_JaggedArray, containerInterface), CSC_CONTAINING_RECORD(pOther, CONST CSC_JaggedArray, containerInterface));
+}
+
+static CSC_STATUS CSCMETHOD CSC_JaggedArrayIContainerMove(_Inout_ CSC_IContainer* CONST pThis, _Inout_ CSC_IContainer* CONST pOther)
+{
+	if (!pThis || !pOther || pOther->pIContainerVirtualTable != &g_JaggedArrayContainerVTable)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	return CSC_JaggedArrayMove(CSC_CONTAINING_RECORD(pThis, CSC_JaggedArray, containerInterface), CSC_CONTAINING_RECORD(pOther, CSC_JaggedArray, containerInterface));
+}
+
+static CSC_STATUS CSCMETHOD CSC_JaggedArrayIContainerSwapValues(_Inout_ CSC_IContainer* CONST pThis, _In_ CONST CSC_SIZE_T firstIndex, _In_ CONST CSC_SIZE_T secondIndex)
+{
+	CSC_JaggedArray* pArray;
+
+	if (!pThis)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	pArray = CSC_CONTAINING_RECORD(pThis, CSC_JaggedArray, containerInterface);
+
+	if (CSC_JaggedArrayIsValid(pArray) != CSC_STATUS_SUCCESS)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	return CSC_IContainerSwapValues(CSC_DynamicArrayGetIContainer(&pArray->elements), firstIndex, secondIndex);
+}
+
+static CSC_PVOID CSCMETHOD CSC_JaggedArrayIContainerAccessElement(_In_ CONST CSC_IContainer* CONST pThis, _In_ CONST CSC_SIZE_T index)
+{
+	CONST CSC_JaggedArray* pArray;
+
+	if (!pThis)
+	{
+		return NULL;
+	}
+
+	pArray = CSC_CONTAINING_RECORD(pThis, CONST CSC_JaggedArray, containerInterface);
+
+	if (CSC_JaggedArrayIsValid(pArray) != CSC_STATUS_SUCCESS)
+	{
+		return NULL;
+	}
+
+	return CSC_DynamicArrayAccessElement(&pArray->elements, index);
+}
+
+static CSC_STATUS CSCMETHOD CSC_JaggedArrayIContainerIsValid(_In_ CONST CSC_IContainer* CONST pThis)
+{
+	if (!pThis)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	return CSC_JaggedArrayIsValid(CSC_CONTAINING_RECORD(pThis, CONST CSC_JaggedArray, containerInterface));
+}
+
+static CSC_STATUS CSCMETHOD CSC_JaggedArrayIContainerIsEmpty(_In_ CONST CSC_IContainer* CONST pThis)
+{
+	if (!pThis)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	return CSC_JaggedArrayIsEmpty(CSC_CONTAINING_RECORD(pThis, CONST CSC_JaggedArray, containerInterface));
+}
+
+static CSC_STATUS CSCMETHOD CSC_JaggedArrayIContainerIsElementContainer(_In_ CONST CSC_IContainer* CONST pThis)
+{
+	if (!pThis || CSC_JaggedArrayIsValid(CSC_CONTAINING_RECORD(pThis, CONST CSC_JaggedArray, containerInterface)) != CSC_STATUS_SUCCESS)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	return CSC_STATUS_GENERAL_FAILURE;
+}
+
+static CSC_SIZE_T CSCMETHOD CSC_JaggedArrayIContainerGetSize(_In_ CONST CSC_IContainer* CONST pThis)
+{
+	if (!pThis)
+	{
+		return CSC_CONTAINER_INVALID_LENGTH;
+	}
+
+	return CSC_JaggedArrayGetSize(CSC_CONTAINING_RECORD(pThis, CONST CSC_JaggedArray, containerInterface));
+}
+
+static CSC_SIZE_T CSCMETHOD CSC_JaggedArrayIContainerGetElementSize(_In_ CONST CSC_IContainer* CONST pThis)
+{
+	if (!pThis)
+	{
+		return (CSC_SIZE_T)0;
+	}
+
+	return CSC_JaggedArrayGetElementSize(CSC_CONTAINING_RECORD(pThis, CONST CSC_JaggedArray, containerInterface));
+}
+
+static CSC_SIZE_T CSCMETHOD CSC_JaggedArrayIContainerGetMaxElements(_In_ CONST CSC_IContainer* CONST pThis)
+{
+	if (!pThis)
+	{
+		return CSC_CONTAINER_INVALID_LENGTH;
+	}
+
+	return CSC_JaggedArrayGetMaxElements(CSC_CONTAINING_RECORD(pThis, CONST CSC_JaggedArray, containerInterface));
+}
+
+static CSC_IAllocator* CSCMETHOD CSC_JaggedArrayIContainerGetIAllocator(_In_ CONST CSC_IContainer* CONST pThis)
+{
+	if (!pThis)
+	{
+		return NULL;
+	}
+
+	return CSC_JaggedArrayGetIAllocator(CSC_CONTAINING_RECORD(pThis, CONST CSC_JaggedArray, containerInterface));
+}
+
+static CSC_IContainerVirtualTable* CSCMETHOD CSC_JaggedArrayIContainerGetNestedContainerVTable(_In_ CONST CSC_IContainer* CONST pThis)
+{
+	(void)pThis;
+
+	return NULL;
+}
+
+static CSC_STATUS CSCMETHOD CSC_JaggedArrayIContainerSerialize(_In_ CONST CSC_IContainer* CONST pThis, _Inout_ CSC_SerializationWriter* CONST pWriter)
+{
+	if (!pThis)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	return CSC_JaggedArraySerialize(CSC_CONTAINING_RECORD(pThis, CONST CSC_JaggedArray, containerInterface), pWriter);
+}
+
+static CSC_STATUS CSCMETHOD CSC_JaggedArrayIContainerDeserialize(_Out_ CSC_IContainer* CONST pThis, _Inout_ CSC_SerializationReader* CONST pReader, _In_ CSC_IAllocator* CONST pIAllocator, _In_opt_ CSC_IContainerVirtualTable* CONST pNestedContainerVTable)
+{
+	// The rows only hold plain data, the virtual table a DynamicArray of JaggedArrays passes to its elements is ignored.
+	(void)pNestedContainerVTable;
+
+	if (!pThis)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	return CSC_JaggedArrayDeserialize(CSC_CONTAINING_RECORD(pThis, CSC_JaggedArray, containerInterface), pReader, pIAllocator);
+}
+
+
+CSC_STATUS CSCMETHOD CSC_JaggedArrayInitialize(_Out_ CSC_JaggedArray* CONST pThis, _In_ CONST CSC_SIZE_T elementSize, _In_ CONST CSC_IAllocator* CONST pIAllocator)
+{
+	CSC_STATUS status;
+
+	if (!pThis)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	status = CSC_DynamicArrayInitialize(&pThis->elements, elementSize, pIAllocator, NULL);
+
+	if (status != CSC_STATUS_SUCCESS)
+	{
+		return status;
+	}
+
+	status = CSC_DynamicArrayInitialize(&pThis->rowEnds, sizeof(CSC_SIZE_T), pIAllocator, NULL);
+
+	if (status != CSC_STATUS_SUCCESS)
+	{
+		CSC_DynamicArrayDestroy(&pThis->elements);
+		return status;
+	}
+
+	CSC_JaggedArraySetInterfaces(pThis, pIAllocator);
+
+	return CSC_STATUS_SUCCESS;
+}
+
+CSC_STATUS CSCMETHOD CSC_JaggedArrayInitializeWithCopy(_Out_ CSC_JaggedArray* CONST pThis, _In_ CONST CSC_JaggedArray* CONST pSrc)
+{
+	CSC_STATUS status;
+
+	if (!pThis || pThis == pSrc || CSC_JaggedArrayIsValid(pSrc) != CSC_STATUS_SUCCESS)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	status = CSC_JaggedArrayInitialize(pThis, pSrc->elements.elementSize, pSrc->pIAllocator);
+
+	if (status != CSC_STATUS_SUCCESS)
+	{
+		return status;
+	}
+
+	status = CSC_JaggedArrayCopy(pThis, pSrc);
+
+	if (status != CSC_STATUS_SUCCESS)
+	{
+		CSC_JaggedArrayDestroy(pThis);
+	}
+
+	return status;
+}
+
+CSC_STATUS CSCMETHOD CSC_JaggedArrayDeserialize(_Out_ CSC_JaggedArray* CONST pThis, _Inout_ CSC_SerializationReader* CONST pReader, _In_ CONST CSC_IAllocator* CONST pIAllocator)
+{
+	CSC_STATUS status;
+
+	if (!pThis)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	status = CSC_DynamicArrayDeserialize(&pThis->elements, pReader, pIAllocator, NULL);
+
+	if (status != CSC_STATUS_SUCCESS)
+	{
+		return status;
+	}
+
+	status = CSC_DynamicArrayDeserialize(&pThis->rowEnds, pReader, pIAllocator, NULL);
+
+	if (status != CSC_STATUS_SUCCESS)
+	{
+		CSC_DynamicArrayDestroy(&pThis->elements);
+		return status;
+	}
+
+	CSC_JaggedArraySetInterfaces(pThis, pIAllocator);
+
+	if (pThis->elements.pNestedContainerVTable || pThis->rowEnds.elementSize != sizeof(CSC_SIZE_T) || pThis->rowEnds.pNestedContainerVTable || !CSC_JaggedArrayAreRowsConsistent(pThis))
+	{
+		CSC_DynamicArrayDestroy(&pThis->elements);
+		CSC_DynamicArrayDestroy(&pThis->rowEnds);
+		CSC_JaggedArrayZeroMemory(pThis);
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	return CSC_STATUS_SUCCESS;
+}
+
+CSC_STATUS CSCMETHOD CSC_JaggedArraySerialize(_In_ CONST CSC_JaggedArray* CONST pThis, _Inout_ CSC_SerializationWriter* CONST pWriter)
+{
+	CSC_STATUS status;
+
+	if (CSC_JaggedArrayIsValid(pThis) != CSC_STATUS_SUCCESS)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	status = CSC_DynamicArraySerialize(&pThis->elements, pWriter);
+
+	if (status != CSC_STATUS_SUCCESS)
+	{
+		return status;
+	}
+
+	return CSC_DynamicArraySerialize(&pThis->rowEnds, pWriter);
+}
+
+CSC_STATUS CSCMETHOD CSC_JaggedArrayReserve(_Inout_ CSC_JaggedArray* CONST pThis, _In_ CONST CSC_SIZE_T numOfRows, _In_ CONST CSC_SIZE_T numOfElements)
+{
+	CSC_STATUS status;
+
+	if (CSC_JaggedArrayIsValid(pThis) != CSC_STATUS_SUCCESS)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	status = CSC_DynamicArrayReserve(&pThis->rowEnds, numOfRows);
+
+	if (status != CSC_STATUS_SUCCESS)
+	{
+		return status;
+	}
+
+	return CSC_DynamicArrayReserve(&pThis->elements, numOfElements);
+}
+
+CSC_STATUS CSCMETHOD CSC_JaggedArrayShrinkToFit(_Inout_ CSC_JaggedArray* CONST pThis)
+{
+	CSC_STATUS status;
+
+	if (CSC_JaggedArrayIsValid(pThis) != CSC_STATUS_SUCCESS)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	status = CSC_DynamicArrayShrinkToFit(&pThis->rowEnds);
+
+	if (status != CSC_STATUS_SUCCESS)
+	{
+		return status;
+	}
+
+	return CSC_DynamicArrayShrinkToFit(&pThis->elements);
+}
+
+CSC_STATUS CSCMETHOD CSC_JaggedArrayDestroy(_Inout_ CSC_JaggedArray* CONST pThis)
+{
+	if (CSC_JaggedArrayIsValid(pThis) != CSC_STATUS_SUCCESS)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	CSC_DynamicArrayDestroy(&pThis->elements);
+	CSC_DynamicArrayDestroy(&pThis->rowEnds);
+
+	return CSC_JaggedArrayZeroMemory(pThis);
+}
+
+CSC_STATUS CSCMETHOD CSC_JaggedArrayErase(_Inout_ CSC_JaggedArray* CONST pThis)
+{
+	if (CSC_JaggedArrayIsValid(pThis) != CSC_STATUS_SUCCESS)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	CSC_DynamicArrayErase(&pThis->elements);
+
+	return CSC_DynamicArrayErase(&pThis->rowEnds);
+}
+
+CSC_STATUS CSCMETHOD CSC_JaggedArrayClear(_Inout_ CSC_JaggedArray* CONST pThis)
+{
+	if (CSC_JaggedArrayIsValid(pThis) != CSC_STATUS_SUCCESS)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	CSC_DynamicArrayClear(&pThis->elements);
+
+	return CSC_DynamicArrayClear(&pThis->rowEnds);
+}
+
+CSC_STATUS CSCMETHOD CSC_JaggedArrayZeroMemory(_Out_ CSC_JaggedArray* CONST pThis)
+{
+	if (!pThis)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	return CSC_MemoryUtilsSetZeroMemory(pThis, sizeof(*pThis));
+}
+
+CSC_STATUS CSCMETHOD CSC_JaggedArrayAppendRow(_Inout_ CSC_JaggedArray* CONST pThis, _In_opt_ CONST CSC_PCVOID pFirst, _In_ CONST CSC_SIZE_T numOfElements)
+{
+	CSC_STATUS status;
+	CSC_SIZE_T rowBegin;
+	CSC_SIZE_T rowEnd;
+
+	if (CSC_JaggedArrayIsValid(pThis) != CSC_STATUS_SUCCESS || (!pFirst && numOfElements))
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	rowBegin = CSC_DynamicArrayGetSize(&pThis->elements);
+
+	if (numOfElements > CSC_DynamicArrayGetMaxElements(&pThis->elements) - rowBegin)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	// The offset is appended first, hence a failing insertion of the elements only has to pop it without reallocating.
+	rowEnd = rowBegin + numOfElements;
+	status = CSC_DynamicArrayPushValue(&pThis->rowEnds, &rowEnd);
+
+	if (status != CSC_STATUS_SUCCESS || !numOfElements)
+	{
+		return status;
+	}
+
+	status = CSC_DynamicArrayInsertRange(&pThis->elements, rowBegin, pFirst, numOfElements);
+
+	if (status != CSC_STATUS_SUCCESS)
+	{
+		CSC_DynamicArrayLazyPopValue(&pThis->rowEnds, NULL);
+	}
+
+	return status;
+}
+
+CSC_STATUS CSCMETHOD CSC_JaggedArrayExtendLastRow(_Inout_ CSC_JaggedArray* CONST pThis, _In_ CONST CSC_PCVOID pFirst, _In_ CONST CSC_SIZE_T numOfElements)
+{
+	CSC_STATUS status;
+	CSC_SIZE_T* pRowEnd;
+
+	if (CSC_JaggedArrayIsValid(pThis) != CSC_STATUS_SUCCESS || !pFirst || !numOfElements)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	pRowEnd = (CSC_SIZE_T*)CSC_DynamicArrayBack(&pThis->rowEnds);
+
+	if (!pRowEnd)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	status = CSC_DynamicArrayInsertRange(&pThis->elements, *pRowEnd, pFirst, numOfElements);
+
+	if (status != CSC_STATUS_SUCCESS)
+	{
+		return status;
+	}
+
+	*pRowEnd += numOfElements;
+
+	return CSC_STATUS_SUCCESS;
+}
+
+CSC_STATUS CSCMETHOD CSC_JaggedArrayPopRow(_Inout_ CSC_JaggedArray* CONST pThis)
+{
+	CSC_STATUS status;
+	CSC_SIZE_T rowCount;
+	CSC_SIZE_T rowBegin;
+	CSC_SIZE_T rowEnd;
+
+	if (CSC_JaggedArrayIsValid(pThis) != CSC_STATUS_SUCCESS)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	rowCount = CSC_DynamicArrayGetSize(&pThis->rowEnds);
+
+	if (!rowCount)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	rowBegin = CSC_JaggedArrayGetRowBegin(pThis, rowCount - (CSC_SIZE_T)1);
+	rowEnd = CSC_JaggedArrayGetRowEnd(pThis, rowCount - (CSC_SIZE_T)1);
+
+	if (rowEnd > rowBegin)
+	{
+		status = CSC_DynamicArrayRemoveRange(&pThis->elements, rowBegin, rowEnd - rowBegin);
+
+		if (status != CSC_STATUS_SUCCESS)
+		{
+			return status;
+		}
+	}
+
+	return CSC_DynamicArrayPopValue(&pThis->rowEnds, NULL);
+}
+
+CSC_STATUS CSCMETHOD CSC_JaggedArrayGetRow(_In_ CONST CSC_JaggedArray* CONST pThis, _In_ CONST CSC_SIZE_T rowIndex, _Out_ CSC_JaggedArrayRow* CONST pRow)
+{
+	CSC_SIZE_T rowBegin;
+
+	if (CSC_JaggedArrayIsValid(pThis) != CSC_STATUS_SUCCESS || !pRow || rowIndex >= CSC_DynamicArrayGetSize(&pThis->rowEnds))
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	rowBegin = CSC_JaggedArrayGetRowBegin(pThis, rowIndex);
+	pRow->numOfElements = CSC_JaggedArrayGetRowEnd(pThis, rowIndex) - rowBegin;
+	pRow->pFirst = (pRow->numOfElements) ? CSC_DynamicArrayAccessElement(&pThis->elements, rowBegin) : NULL;
+
+	return (!pRow->numOfElements || pRow->pFirst) ? CSC_STATUS_SUCCESS : CSC_STATUS_MEMORY_NOT_ALLOCATED;
+}
+
+CSC_PVOID CSCMETHOD CSC_JaggedArrayAccessElement(_In_ CONST CSC_JaggedArray* CONST pThis, _In_ CONST CSC_SIZE_T rowIndex, _In_ CONST CSC_SIZE_T columnIndex)
+{
+	CSC_SIZE_T rowBegin;
+
+	if (CSC_JaggedArrayIsValid(pThis) != CSC_STATUS_SUCCESS || rowIndex >= CSC_DynamicArrayGetSize(&pThis->rowEnds))
+	{
+		return NULL;
+	}
+
+	rowBegin = CSC_JaggedArrayGetRowBegin(pThis, rowIndex);
+
+	if (columnIndex >= CSC_JaggedArrayGetRowEnd(pThis, rowIndex) - rowBegin)
+	{
+		return NULL;
+	}
+
+	return CSC_DynamicArrayAccessElement(&pThis->elements, rowBegin + columnIndex);
+}
+
+CSC_STATUS CSCMETHOD CSC_JaggedArrayCopy(_Inout_ CSC_JaggedArray* CONST pThis, _In_ CONST CSC_JaggedArray* CONST pSrc)
+{
+	CSC_STATUS status;
+
+	if (CSC_JaggedArrayIsValid(pThis) != CSC_STATUS_SUCCESS || CSC_JaggedArrayIsValid(pSrc) != CSC_STATUS_SUCCESS)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	if (pThis == pSrc)
+	{
+		return CSC_STATUS_SUCCESS;
+	}
+
+	status = CSC_DynamicArrayCopy(&pThis->elements, &pSrc->elements);
+
+	// The rows no longer match the elements if only the elements could be copied, hence the container is emptied.
+	if (status == CSC_STATUS_SUCCESS)
+	{
+		status = CSC_DynamicArrayCopy(&pThis->rowEnds, &pSrc->rowEnds);
+	}
+
+	if (status != CSC_STATUS_SUCCESS)
+	{
+		CSC_DynamicArrayClear(&pThis->elements);
+		CSC_DynamicArrayClear(&pThis->rowEnds);
+	}
+
+	return status;
+}
+
+CSC_STATUS CSCMETHOD CSC_JaggedArrayMove(_Inout_ CSC_JaggedArray* CONST pThis, _Inout_ CSC_JaggedArray* CONST pSrc)
+{
+	CSC_STATUS status;
+
+	if (CSC_JaggedArrayIsValid(pThis) != CSC_STATUS_SUCCESS || CSC_JaggedArrayIsValid(pSrc) != CSC_STATUS_SUCCESS)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	if (pThis == pSrc)
+	{
+		return CSC_STATUS_SUCCESS;
+	}
+
+	status = CSC_DynamicArrayMove(&pThis->elements, &pSrc->elements);
+
+	if (status == CSC_STATUS_SUCCESS)
+	{
+		status = CSC_DynamicArrayMove(&pThis->rowEnds, &pSrc->rowEnds);
+	}
+
+	if (status != CSC_STATUS_SUCCESS)
+	{
+		CSC_DynamicArrayClear(&pThis->elements);
+		CSC_DynamicArrayClear(&pThis->rowEnds);
+	}
+
+	return status;
+}
+
+CSC_STATUS CSCMETHOD CSC_JaggedArrayAssignNestedArray(_Inout_ CSC_JaggedArray* CONST pThis, _In_ CONST CSC_DynamicArray* CONST pSrc)
+{
+	CSC_STATUS status;
+	CSC_DynamicArray elements;
+	CSC_DynamicArray rowEnds;
+	CONST CSC_DynamicArray* pRow;
+	CSC_SIZE_T rowCount;
+	CSC_SIZE_T rowEnd = (CSC_SIZE_T)0;
+	CSC_SIZE_T iterator;
+
+	if (CSC_JaggedArrayIsValid(pThis) != CSC_STATUS_SUCCESS || CSC_DynamicArrayIsValid(pSrc) != CSC_STATUS_SUCCESS || !pSrc->pNestedContainerVTable || pSrc->elementSize < sizeof(CSC_DynamicArray))
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	rowCount = CSC_DynamicArrayGetSize(pSrc);
+
+	// The rows are validated and counted up front, hence both arrays are allocated only once.
+	for (iterator = (CSC_SIZE_T)0; iterator < rowCount; ++iterator)
+	{
+		pRow = (CONST CSC_DynamicArray*)CSC_DynamicArrayReadElement(pSrc, iterator);
+
+		if (CSC_DynamicArrayIsValid(pRow) != CSC_STATUS_SUCCESS || pRow->elementSize != pThis->elements.elementSize || pRow->pNestedContainerVTable || CSC_DynamicArrayGetSize(pRow) > CSC_DynamicArrayGetMaxElements(&pThis->elements) - rowEnd)
+		{
+			return CSC_STATUS_INVALID_PARAMETER;
+		}
+
+		rowEnd += CSC_DynamicArrayGetSize(pRow);
+	}
+
+	status = CSC_DynamicArrayInitialize(&elements, pThis->elements.elementSize, pThis->pIAllocator, NULL);
+
+	if (status != CSC_STATUS_SUCCESS)
+	{
+		return status;
+	}
+
+	status = CSC_DynamicArrayInitialize(&rowEnds, sizeof(CSC_SIZE_T), pThis->pIAllocator, NULL);
+
+	if (status != CSC_STATUS_SUCCESS)
+	{
+		CSC_DynamicArrayDestroy(&elements);
+		return status;
+	}
+
+	status = CSC_DynamicArrayReserve(&elements, rowEnd);
+
+	if (status == CSC_STATUS_SUCCESS)
+	{
+		status = CSC_DynamicArrayReserve(&rowEnds, rowCount);
+	}
+
+	for (iterator = (CSC_SIZE_T)0; iterator < rowCount && status == CSC_STATUS_SUCCESS; ++iterator)
+	{
+		status = CSC_DynamicArrayAppendCopy(&elements, (CONST CSC_DynamicArray*)CSC_DynamicArrayReadElement(pSrc, iterator));
+		rowEnd = CSC_DynamicArrayGetSize(&elements);
+
+		if (status == CSC_STATUS_SUCCESS)
+		{
+			status = CSC_DynamicArrayPushValue(&rowEnds, &rowEnd);
+		}
+	}
+
+	// The new arrays use the same allocator, hence moving them takes over their buffers.
+	if (status == CSC_STATUS_SUCCESS)
+	{
+		status = CSC_DynamicArrayMove(&pThis->elements, &elements);
+	}
+
+	if (status == CSC_STATUS_SUCCESS)
+	{
+		status = CSC_DynamicArrayMove(&pThis->rowEnds, &rowEnds);
+	}
+
+	CSC_DynamicArrayDestroy(&elements);
+	CSC_DynamicArrayDestroy(&rowEnds);
+
+	return status;
+}
+
+CSC_STATUS CSCMETHOD CSC_JaggedArrayToNestedArray(_In_ CONST CSC_JaggedArray* CONST pThis, _Inout_ CSC_DynamicArray* CONST pDst)
+{
+	CSC_STATUS status;
+	CSC_JaggedArrayRow row;
+	CSC_IContainer* pContainer;
+	CSC_PVOID pElement;
+	CSC_SIZE_T rowCount;
+	CSC_SIZE_T iterator;
+
+	if (CSC_JaggedArrayIsValid(pThis) != CSC_STATUS_SUCCESS || CSC_DynamicArrayIsValid(pDst) != CSC_STATUS_SUCCESS || !pDst->pNestedContainerVTable)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	rowCount = CSC_DynamicArrayGetSize(&pThis->rowEnds);
+
+	if (rowCount > CSC_DynamicArrayGetMaxElements(pDst) - CSC_DynamicArrayGetSize(pDst))
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	status = CSC_DynamicArrayReserve(pDst, CSC_DynamicArrayGetSize(pDst) + rowCount);
+
+	if (status != CSC_STATUS_SUCCESS)
+	{
+		return status;
+	}
+
+	// The element containers are constructed in place, nested containers place their IContainer interface directly behind their IBaseInterface.
+	for (iterator = (CSC_SIZE_T)0; iterator < rowCount; ++iterator)
+	{
+		CSC_JaggedArrayGetRow(pThis, iterator, &row);
+		pElement = CSC_DynamicArrayEmplaceBack(pDst);
+
+		if (!pElement)
+		{
+			return CSC_STATUS_MEMORY_NOT_ALLOCATED;
+		}
+
+		pContainer = (CSC_IContainer*)((CSC_BYTE*)pElement + sizeof(CSC_IBaseInterface));
+		status = pDst->pNestedContainerVTable->pInitialize(pContainer, pThis->elements.elementSize, pDst->pIAllocator);
+
+		if (status == CSC_STATUS_SUCCESS && row.numOfElements)
+		{
+			status = CSC_IContainerInsertRange(pContainer, (CSC_SIZE_T)0, row.numOfElements, row.pFirst);
+
+			if (status != CSC_STATUS_SUCCESS)
+			{
+				pDst->pNestedContainerVTable->pDestroy(pContainer);
+			}
+		}
+
+		if (status != CSC_STATUS_SUCCESS)
+		{
+			CSC_DynamicArrayCommitEmplace(pDst, (CSC_SIZE_T)0);
+			return status;
+		}
+
+		CSC_DynamicArrayCommitEmplace(pDst, (CSC_SIZE_T)1);
+	}
+
+	return CSC_STATUS_SUCCESS;
+}
+
+CSC_STATUS CSCMETHOD CSC_JaggedArrayIsEmpty(_In_ CONST CSC_JaggedArray* CONST pThis)
+{
+	if (CSC_JaggedArrayIsValid(pThis) != CSC_STATUS_SUCCESS)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	return CSC_DynamicArrayIsEmpty(&pThis->rowEnds);
+}
+
+CSC_STATUS CSCMETHOD CSC_JaggedArrayIsValid(_In_ CONST CSC_JaggedArray* CONST pThis)
+{
+	CSC_SIZE_T rowCount;
+
+	if (!pThis || pThis->baseInterface.pIBaseInterfaceVirtualTable != &g_JaggedArrayBaseInterfaceVTable || pThis->containerInterface.pIContainerVirtualTable != &g_JaggedArrayContainerVTable || !pThis->pIAllocator)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	if (CSC_DynamicArrayIsValid(&pThis->elements) != CSC_STATUS_SUCCESS || CSC_DynamicArrayIsValid(&pThis->rowEnds) != CSC_STATUS_SUCCESS || pThis->elements.pNestedContainerVTable || pThis->rowEnds.elementSize != sizeof(CSC_SIZE_T) || pThis->rowEnds.pNestedContainerVTable)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	rowCount = CSC_DynamicArrayGetSize(&pThis->rowEnds);
+
+	if (((rowCount) ? CSC_JaggedArrayGetRowEnd(pThis, rowCount - (CSC_SIZE_T)1) : (CSC_SIZE_T)0) != CSC_DynamicArrayGetSize(&pThis->elements))
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	return CSC_STATUS_SUCCESS;
+}
+
+CSC_SIZE_T CSCMETHOD CSC_JaggedArrayGetRowCount(_In_ CONST CSC_JaggedArray* CONST pThis)
+{
+	if (CSC_JaggedArrayIsValid(pThis) != CSC_STATUS_SUCCESS)
+	{
+		return CSC_CONTAINER_INVALID_LENGTH;
+	}
+
+	return CSC_DynamicArrayGetSize(&pThis->rowEnds);
+}
+
+CSC_SIZE_T CSCMETHOD CSC_JaggedArrayGetRowSize(_In_ CONST CSC_JaggedArray* CONST pThis, _In_ CONST CSC_SIZE_T rowIndex)
+{
+	if (CSC_JaggedArrayIsValid(pThis) != CSC_STATUS_SUCCESS || rowIndex >= CSC_DynamicArrayGetSize(&pThis->rowEnds))
+	{
+		return CSC_CONTAINER_INVALID_LENGTH;
+	}
+
+	return CSC_JaggedArrayGetRowEnd(pThis, rowIndex) - CSC_JaggedArrayGetRowBegin(pThis, rowIndex);
+}
+
+CSC_SIZE_T CSCMETHOD CSC_JaggedArrayGetSize(_In_ CONST CSC_JaggedArray* CONST pThis)
+{
+	if (CSC_JaggedArrayIsValid(pThis) != CSC_STATUS_SUCCESS)
+	{
+		return CSC_CONTAINER_INVALID_LENGTH;
+	}
+
+	return CSC_DynamicArrayGetSize(&pThis->elements);
+}
+
+CSC_SIZE_T CSCMETHOD CSC_JaggedArrayGetMaxElements(_In_ CONST CSC_JaggedArray* CONST pThis)
+{
+	if (CSC_JaggedArrayIsValid(pThis) != CSC_STATUS_SUCCESS)
+	{
+		return CSC_CONTAINER_INVALID_LENGTH;
+	}
+
+	return CSC_DynamicArrayGetMaxElements(&pThis->elements);
+}
+
+CSC_SIZE_T CSCMETHOD CSC_JaggedArrayGetElementSize(_In_ CONST CSC_JaggedArray* CONST pThis)
+{
+	if (CSC_JaggedArrayIsValid(pThis) != CSC_STATUS_SUCCESS)
+	{
+		return (CSC_SIZE_T)0;
+	}
+
+	return pThis->elements.elementSize;
+}
+
+CSC_IBaseInterface* CSCMETHOD CSC_JaggedArrayGetIBaseInterface(_In_ CONST CSC_JaggedArray* CONST pThis)
+{
+	if (CSC_JaggedArrayIsValid(pThis) != CSC_STATUS_SUCCESS)
+	{
+		return NULL;
+	}
+
+	return (CSC_IBaseInterface*)&pThis->baseInterface;
+}
+
+CSC_IContainer* CSCMETHOD CSC_JaggedArrayGetIContainer(_In_ CONST CSC_JaggedArray* CONST pThis)
+{
+	if (CSC_JaggedArrayIsValid(pThis) != CSC_STATUS_SUCCESS)
+	{
+		return NULL;
+	}
+
+	return (CSC_IContainer*)&pThis->containerInterface;
+}
+
+CSC_IAllocator* CSCMETHOD CSC_JaggedArrayGetIAllocator(_In_ CONST CSC_JaggedArray* CONST pThis)
+{
+	if (CSC_JaggedArrayIsValid(pThis) != CSC_STATUS_SUCCESS)
+	{
+		return NULL;
+	}
+
+	return pThis->pIAllocator;
+}
\ No newline at end of file
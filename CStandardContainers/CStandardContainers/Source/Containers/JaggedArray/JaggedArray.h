@@ -0,0 +1,93 @@
+#ifndef CSC_JAGGED_ARRAY
+#define CSC_JAGGED_ARRAY
+
+/*
+Description:
+The JaggedArray stores rows of plain data elements whose lengths differ, like a DynamicArray of DynamicArrays, but keeps the elements of all rows in a single contiguous array.
+A second array holds the end offset of every row, the row begins at the end offset of the previous row, hence the whole container costs two allocations instead of one per row and accessing an element never follows a pointer to the row.
+Rows can only be appended to and popped from the end, a row is retrieved as a view holding a pointer to its first element and its length, which remains valid until the container is modified.
+Nested arrays are converted in bulk: CSC_JaggedArrayAssignNestedArray reserves both arrays once and copies the rows of a DynamicArray of DynamicArrays, CSC_JaggedArrayToNestedArray appends every row as an element container to a DynamicArray with nested containers.
+The IContainer interface exposes the elements of all rows as a flat sequence, which allows nesting the container and serializing it, the elements can be accessed and swapped through it but insertions and removals are not supported as they would change the rows.
+Only plain data is supported as element type, as the rows are copied bytewise.
+*/
+
+// Include the current configuration of the library containing various type definitions and other things.
+#include "../../Configuration/Configuration.h"
+#include "../../Interfaces/IBaseInterface.h"
+#include "../../Interfaces/IAllocator.h"
+#include "../../Interfaces/IContainer.h"
+// Include the DynamicArray as the elements and the end offsets of the rows are stored in DynamicArrays.
+#include "../DynamicArray/DynamicArray.h"
+
+// Definition of a view of a row, the elements are stored contiguously.
+typedef struct _CSC_JaggedArrayRow
+{
+	CSC_PVOID pFirst;
+	CSC_SIZE_T numOfElements;
+} CSC_JaggedArrayRow;
+
+typedef struct _CSC_JaggedArray
+{
+	CSC_IBaseInterface baseInterface;
+	CSC_IContainer containerInterface;
+	CSC_IAllocator* pIAllocator;
+	CSC_DynamicArray elements;
+	CSC_DynamicArray rowEnds;
+} CSC_JaggedArray;
+
+CSC_STATUS CSCMETHOD CSC_JaggedArrayInitialize(_Out_ CSC_JaggedArray* CONST pThis, _In_ CONST CSC_SIZE_T elementSize, _In_ CONST CSC_IAllocator* CONST pIAllocator);
+CSC_STATUS CSCMETHOD CSC_JaggedArrayInitializeWithCopy(_Out_ CSC_JaggedArray* CONST pThis, _In_ CONST CSC_JaggedArray* CONST pSrc);
+// Initializes the container from the reader, the elements and the row offsets are read like DynamicArrays.
+// Returns CSC_STATUS_SUCCESS on success, otherwise an error code is returned.
+CSC_STATUS CSCMETHOD CSC_JaggedArrayDeserialize(_Out_ CSC_JaggedArray* CONST pThis, _Inout_ CSC_SerializationReader* CONST pReader, _In_ CONST CSC_IAllocator* CONST pIAllocator);
+// Queues the container for writing, the buffers are referenced by the writer and must not be modified until the writer has been flushed.
+// Returns CSC_STATUS_SUCCESS on success, otherwise an error code is returned.
+CSC_STATUS CSCMETHOD CSC_JaggedArraySerialize(_In_ CONST CSC_JaggedArray* CONST pThis, _Inout_ CSC_SerializationWriter* CONST pWriter);
+
+// Reserves space for the given total amount of rows and elements, which avoids reallocations while the rows are appended.
+// Returns CSC_STATUS_SUCCESS on success, otherwise an error code is returned.
+CSC_STATUS CSCMETHOD CSC_JaggedArrayReserve(_Inout_ CSC_JaggedArray* CONST pThis, _In_ CONST CSC_SIZE_T numOfRows, _In_ CONST CSC_SIZE_T numOfElements);
+CSC_STATUS CSCMETHOD CSC_JaggedArrayShrinkToFit(_Inout_ CSC_JaggedArray* CONST pThis);
+
+CSC_STATUS CSCMETHOD CSC_JaggedArrayDestroy(_Inout_ CSC_JaggedArray* CONST pThis);
+CSC_STATUS CSCMETHOD CSC_JaggedArrayErase(_Inout_ CSC_JaggedArray* CONST pThis);
+CSC_STATUS CSCMETHOD CSC_JaggedArrayClear(_Inout_ CSC_JaggedArray* CONST pThis);
+CSC_STATUS CSCMETHOD CSC_JaggedArrayZeroMemory(_Out_ CSC_JaggedArray* CONST pThis);
+
+// Appends a row holding a copy of the given elements, a row without elements may pass a null pointer.
+// Returns CSC_STATUS_SUCCESS on success, otherwise an error code is returned.
+CSC_STATUS CSCMETHOD CSC_JaggedArrayAppendRow(_Inout_ CSC_JaggedArray* CONST pThis, _In_opt_ CONST CSC_PCVOID pFirst, _In_ CONST CSC_SIZE_T numOfElements);
+// Appends the elements to the last row, which allows building a row incrementally.
+// Returns CSC_STATUS_SUCCESS on success, otherwise an error code is returned.
+CSC_STATUS CSCMETHOD CSC_JaggedArrayExtendLastRow(_Inout_ CSC_JaggedArray* CONST pThis, _In_ CONST CSC_PCVOID pFirst, _In_ CONST CSC_SIZE_T numOfElements);
+CSC_STATUS CSCMETHOD CSC_JaggedArrayPopRow(_Inout_ CSC_JaggedArray* CONST pThis);
+
+// Retrieves a view of the row, the pointer of a row without elements is a null pointer.
+// Returns CSC_STATUS_SUCCESS on success, otherwise an error code is returned.
+CSC_STATUS CSCMETHOD CSC_JaggedArrayGetRow(_In_ CONST CSC_JaggedArray* CONST pThis, _In_ CONST CSC_SIZE_T rowIndex, _Out_ CSC_JaggedArrayRow* CONST pRow);
+CSC_PVOID CSCMETHOD CSC_JaggedArrayAccessElement(_In_ CONST CSC_JaggedArray* CONST pThis, _In_ CONST CSC_SIZE_T rowIndex, _In_ CONST CSC_SIZE_T columnIndex);
+
+CSC_STATUS CSCMETHOD CSC_JaggedArrayCopy(_Inout_ CSC_JaggedArray* CONST pThis, _In_ CONST CSC_JaggedArray* CONST pSrc);
+CSC_STATUS CSCMETHOD CSC_JaggedArrayMove(_Inout_ CSC_JaggedArray* CONST pThis, _Inout_ CSC_JaggedArray* CONST pSrc);
+// Replaces the rows with copies of the element arrays of a DynamicArray whose elements are DynamicArrays or SmallDynamicArrays of plain data with the element size of the container.
+// Both arrays are reserved once before the rows are copied, the container remains unchanged if an error occurs.
+// Returns CSC_STATUS_SUCCESS on success, otherwise an error code is returned.
+CSC_STATUS CSCMETHOD CSC_JaggedArrayAssignNestedArray(_Inout_ CSC_JaggedArray* CONST pThis, _In_ CONST CSC_DynamicArray* CONST pSrc);
+// Appends every row to a DynamicArray with nested containers, the element containers are initialized through the nested virtual table and filled through their IContainer interface.
+// Returns CSC_STATUS_SUCCESS on success, otherwise an error code is returned.
+CSC_STATUS CSCMETHOD CSC_JaggedArrayToNestedArray(_In_ CONST CSC_JaggedArray* CONST pThis, _Inout_ CSC_DynamicArray* CONST pDst);
+
+CSC_STATUS CSCMETHOD CSC_JaggedArrayIsEmpty(_In_ CONST CSC_JaggedArray* CONST pThis);
+CSC_STATUS CSCMETHOD CSC_JaggedArrayIsValid(_In_ CONST CSC_JaggedArray* CONST pThis);
+
+CSC_SIZE_T CSCMETHOD CSC_JaggedArrayGetRowCount(_In_ CONST CSC_JaggedArray* CONST pThis);
+CSC_SIZE_T CSCMETHOD CSC_JaggedArrayGetRowSize(_In_ CONST CSC_JaggedArray* CONST pThis, _In_ CONST CSC_SIZE_T rowIndex);
+// Retrieves the total amount of elements of all rows.
+CSC_SIZE_T CSCMETHOD CSC_JaggedArrayGetSize(_In_ CONST CSC_JaggedArray* CONST pThis);
+CSC_SIZE_T CSCMETHOD CSC_JaggedArrayGetMaxElements(_In_ CONST CSC_JaggedArray* CONST pThis);
+CSC_SIZE_T CSCMETHOD CSC_JaggedArrayGetElementSize(_In_ CONST CSC_JaggedArray* CONST pThis);
+CSC_IBaseInterface* CSCMETHOD CSC_JaggedArrayGetIBaseInterface(_In_ CONST CSC_JaggedArray* CONST pThis);
+CSC_IContainer* CSCMETHOD CSC_JaggedArrayGetIContainer(_In_ CONST CSC_JaggedArray* CONST pThis);
+CSC_IAllocator* CSCMETHOD CSC_JaggedArrayGetIAllocator(_In_ CONST CSC_JaggedArray* CONST pThis);
+
+#endif
\ No newline at end of file
@@ -0,0 +1,487 @@
+#include "SmallDynamicArray.h"
+#include "../../Utils/MemoryUtils.h"
+
+// The small array begins with it's DynamicArray, hence the functions of the DynamicArray operate on it directly.
+
+CSC_STATUS CSCMETHOD CSC_SmallDynamicArrayInitialize(_Out_ CSC_SmallDynamicArray* CONST pThis, _In_ CONST CSC_SIZE_T elementSize, _In_ CONST CSC_IAllocator* CONST pIAllocator, _In_ CONST CSC_IContainerVirtualTable* CONST pNestedContainerVTable)
+{
+	return CSC_DynamicArrayInitializeInline((CSC_DynamicArray*)pThis, elementSize, pIAllocator, pNestedContainerVTable);
+}
+
+CSC_STATUS CSCMETHOD CSC_SmallDynamicArrayInitializeWithSize(_Out_ CSC_SmallDynamicArray* CONST pThis, _In_ CONST CSC_SIZE_T elementSize, _In_ CONST CSC_SIZE_T numOfElements, _In_opt_ CONST CSC_PCVOID pDefaultValue, _In_ CONST CSC_IAllocator* CONST pIAllocator, _In_ CONST CSC_IContainerVirtualTable* CONST pNestedContainerVTable)
+{
+	CSC_STATUS status = CSC_SmallDynamicArrayInitialize(pThis, elementSize, pIAllocator, pNestedContainerVTable);
+
+	if (status != CSC_STATUS_SUCCESS)
+	{
+		return status;
+	}
+
+	status = CSC_DynamicArrayResize((CSC_DynamicArray*)pThis, numOfElements, pDefaultValue);
+
+	if (status != CSC_STATUS_SUCCESS)
+	{
+		CSC_SmallDynamicArrayDestroy(pThis);
+	}
+
+	return status;
+}
+
+CSC_STATUS CSCMETHOD CSC_SmallDynamicArrayInitializeWithValue(_Out_ CSC_SmallDynamicArray* CONST pThis, _In_ CONST CSC_SIZE_T elementSize, _In_ CONST CSC_SIZE_T numOfElements, _In_ CONST CSC_PCVOID pValue, _In_ CONST CSC_IAllocator* CONST pIAllocator, _In_ CONST CSC_IContainerVirtualTable* CONST pNestedContainerVTable)
+{
+	if (!pValue)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	return CSC_SmallDynamicArrayInitializeWithSize(pThis, elementSize, numOfElements, pValue, pIAllocator, pNestedContainerVTable);
+}
+
+CSC_STATUS CSCMETHOD CSC_SmallDynamicArrayInitializeWithCopy(_Out_ CSC_SmallDynamicArray* CONST pThis, _In_ CONST CSC_SmallDynamicArray* CONST pSrc)
+{
+	CSC_STATUS status;
+
+	if (!pThis || pThis == pSrc || CSC_SmallDynamicArrayIsValid(pSrc) != CSC_STATUS_SUCCESS)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	status = CSC_SmallDynamicArrayInitialize(pThis, pSrc->array.elementSize, pSrc->array.pIAllocator, pSrc->array.pNestedContainerVTable);
+
+	if (status != CSC_STATUS_SUCCESS)
+	{
+		return status;
+	}
+
+	pThis->array.growthPolicy = pSrc->array.growthPolicy;
+	pThis->array.isDeferredCompaction = pSrc->array.isDeferredCompaction;
+	status = CSC_DynamicArrayCopy((CSC_DynamicArray*)pThis, (CONST CSC_DynamicArray*)pSrc);
+
+	if (status != CSC_STATUS_SUCCESS)
+	{
+		CSC_SmallDynamicArrayDestroy(pThis);
+	}
+
+	return status;
+}
+
+CSC_STATUS CSCMETHOD CSC_SmallDynamicArrayInitializeWithArray(_Out_ CSC_SmallDynamicArray* CONST pThis, _In_ CONST CSC_PCVOID pFirst, _In_ CONST CSC_SIZE_T numOfElements, _In_ CONST CSC_SIZE_T elementSize, _In_ CONST CSC_IAllocator* CONST pIAllocator, _In_ CONST CSC_IContainerVirtualTable* CONST pNestedContainerVTable)
+{
+	CSC_STATUS status;
+
+	if (!pFirst && numOfElements)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	status = CSC_SmallDynamicArrayInitialize(pThis, elementSize, pIAllocator, pNestedContainerVTable);
+
+	if (status != CSC_STATUS_SUCCESS)
+	{
+		return status;
+	}
+
+	status = CSC_DynamicArrayCopyArray((CSC_DynamicArray*)pThis, pFirst, numOfElements, elementSize);
+
+	if (status != CSC_STATUS_SUCCESS)
+	{
+		CSC_SmallDynamicArrayDestroy(pThis);
+	}
+
+	return status;
+}
+
+CSC_STATUS CSCMETHOD CSC_SmallDynamicArrayDeserialize(_Out_ CSC_SmallDynamicArray* CONST pThis, _Inout_ CSC_SerializationReader* CONST pReader, _In_ CONST CSC_IAllocator* CONST pIAllocator, _In_opt_ CONST CSC_IContainerVirtualTable* CONST pNestedContainerVTable)
+{
+	return CSC_DynamicArrayDeserializeInline((CSC_DynamicArray*)pThis, pReader, pIAllocator, pNestedContainerVTable);
+}
+
+CSC_STATUS CSCMETHOD CSC_SmallDynamicArraySerialize(_In_ CONST CSC_SmallDynamicArray* CONST pThis, _Inout_ CSC_SerializationWriter* CONST pWriter)
+{
+	return CSC_DynamicArraySerialize((CONST CSC_DynamicArray*)pThis, pWriter);
+}
+
+CSC_STATUS CSCMETHOD CSC_SmallDynamicArrayResize(_Inout_ CSC_SmallDynamicArray* CONST pThis, _In_ CONST CSC_SIZE_T numOfElements, _In_opt_ CONST CSC_PCVOID pDefaultValue)
+{
+	return CSC_DynamicArrayResize((CSC_DynamicArray*)pThis, numOfElements, pDefaultValue);
+}
+
+CSC_STATUS CSCMETHOD CSC_SmallDynamicArrayLazyResize(_Inout_ CSC_SmallDynamicArray* CONST pThis, _In_ CONST CSC_SIZE_T numOfElements, _In_opt_ CONST CSC_PCVOID pDefaultValue)
+{
+	return CSC_DynamicArrayLazyResize((CSC_DynamicArray*)pThis, numOfElements, pDefaultValue);
+}
+
+CSC_STATUS CSCMETHOD CSC_SmallDynamicArrayReserve(_Inout_ CSC_SmallDynamicArray* CONST pThis, _In_ CONST CSC_SIZE_T numOfElements)
+{
+	return CSC_DynamicArrayReserve((CSC_DynamicArray*)pThis, numOfElements);
+}
+
+CSC_STATUS CSCMETHOD CSC_SmallDynamicArrayShrinkToFit(_Inout_ CSC_SmallDynamicArray* CONST pThis)
+{
+	return CSC_DynamicArrayShrinkToFit((CSC_DynamicArray*)pThis);
+}
+
+CSC_STATUS CSCMETHOD CSC_SmallDynamicArraySetGrowthPolicy(_Inout_ CSC_SmallDynamicArray* CONST pThis, _In_ CONST EDynamicArrayGrowthPolicy growthPolicy)
+{
+	return CSC_DynamicArraySetGrowthPolicy((CSC_DynamicArray*)pThis, growthPolicy);
+}
+
+CSC_STATUS CSCMETHOD CSC_SmallDynamicArraySetDeferredCompaction(_Inout_ CSC_SmallDynamicArray* CONST pThis, _In_ CONST CSC_BOOLEAN isDeferredCompaction)
+{
+	return CSC_DynamicArraySetDeferredCompaction((CSC_DynamicArray*)pThis, isDeferredCompaction);
+}
+
+CSC_STATUS CSCMETHOD CSC_SmallDynamicArrayCompact(_Inout_ CSC_SmallDynamicArray* CONST pThis)
+{
+	return CSC_DynamicArrayCompact((CSC_DynamicArray*)pThis);
+}
+
+CSC_STATUS CSCMETHOD CSC_SmallDynamicArrayDestroy(_Inout_ CSC_SmallDynamicArray* CONST pThis)
+{
+	return CSC_DynamicArrayDestroy((CSC_DynamicArray*)pThis);
+}
+
+CSC_STATUS CSCMETHOD CSC_SmallDynamicArrayErase(_Inout_ CSC_SmallDynamicArray* CONST pThis)
+{
+	return CSC_DynamicArrayErase((CSC_DynamicArray*)pThis);
+}
+
+CSC_STATUS CSCMETHOD CSC_SmallDynamicArrayClear(_Inout_ CSC_SmallDynamicArray* CONST pThis)
+{
+	return CSC_DynamicArrayClear((CSC_DynamicArray*)pThis);
+}
+
+CSC_STATUS CSCMETHOD CSC_SmallDynamicArrayZeroMemory(_Out_ CSC_SmallDynamicArray* CONST pThis)
+{
+	if (!pThis)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	return CSC_MemoryUtilsSetZeroMemory(pThis, sizeof(*pThis));
+}
+
+CSC_STATUS CSCMETHOD CSC_SmallDynamicArrayPushValue(_Inout_ CSC_SmallDynamicArray* CONST pThis, _In_opt_ CONST CSC_PCVOID pValue)
+{
+	return CSC_DynamicArrayPushValue((CSC_DynamicArray*)pThis, pValue);
+}
+
+CSC_PVOID CSCMETHOD CSC_SmallDynamicArrayEmplaceBack(_Inout_ CSC_SmallDynamicArray* CONST pThis)
+{
+	return CSC_DynamicArrayEmplaceBack((CSC_DynamicArray*)pThis);
+}
+
+CSC_PVOID CSCMETHOD CSC_SmallDynamicArrayEmplaceAt(_Inout_ CSC_SmallDynamicArray* CONST pThis, _In_ CONST CSC_SIZE_T insertIndex)
+{
+	return CSC_DynamicArrayEmplaceAt((CSC_DynamicArray*)pThis, insertIndex);
+}
+
+CSC_PVOID CSCMETHOD CSC_SmallDynamicArrayExtendUninitialized(_Inout_ CSC_SmallDynamicArray* CONST pThis, _In_ CONST CSC_SIZE_T numOfElements)
+{
+	return CSC_DynamicArrayExtendUninitialized((CSC_DynamicArray*)pThis, numOfElements);
+}
+
+CSC_STATUS CSCMETHOD CSC_SmallDynamicArrayCommitEmplace(_Inout_ CSC_SmallDynamicArray* CONST pThis, _In_ CONST CSC_SIZE_T numOfElements)
+{
+	return CSC_DynamicArrayCommitEmplace((CSC_DynamicArray*)pThis, numOfElements);
+}
+
+CSC_STATUS CSCMETHOD CSC_SmallDynamicArrayPopValue(_Inout_ CSC_SmallDynamicArray* CONST pThis, _When_(return == STATUS_SUCCESS, _Out_opt_) CONST CSC_PVOID pValue)
+{
+	return CSC_DynamicArrayPopValue((CSC_DynamicArray*)pThis, pValue);
+}
+
+CSC_STATUS CSCMETHOD CSC_SmallDynamicArrayLazyPopValue(_Inout_ CSC_SmallDynamicArray* CONST pThis, _When_(return == STATUS_SUCCESS, _Out_opt_) CONST CSC_PVOID pValue)
+{
+	return CSC_DynamicArrayLazyPopValue((CSC_DynamicArray*)pThis, pValue);
+}
+
+CSC_STATUS CSCMETHOD CSC_SmallDynamicArrayPopFront(_Inout_ CSC_SmallDynamicArray* CONST pThis, _When_(return == STATUS_SUCCESS, _Out_opt_) CONST CSC_PVOID pValue)
+{
+	return CSC_DynamicArrayPopFront((CSC_DynamicArray*)pThis, pValue);
+}
+
+CSC_STATUS CSCMETHOD CSC_SmallDynamicArrayLazyPopFront(_Inout_ CSC_SmallDynamicArray* CONST pThis, _When_(return == STATUS_SUCCESS, _Out_opt_) CONST CSC_PVOID pValue)
+{
+	return CSC_DynamicArrayLazyPopFront((CSC_DynamicArray*)pThis, pValue);
+}
+
+CSC_PVOID CSCMETHOD CSC_SmallDynamicArrayAccessElement(_In_ CONST CSC_SmallDynamicArray* CONST pThis, _In_ CONST CSC_SIZE_T index)
+{
+	return CSC_DynamicArrayAccessElement((CONST CSC_DynamicArray*)pThis, index);
+}
+
+CSC_PCVOID CSCMETHOD CSC_SmallDynamicArrayReadElement(_In_ CONST CSC_SmallDynamicArray* CONST pThis, _In_ CONST CSC_SIZE_T index)
+{
+	return CSC_DynamicArrayReadElement((CONST CSC_DynamicArray*)pThis, index);
+}
+
+CSC_PCVOID CSCMETHOD CSC_SmallDynamicArrayGetContiguousChunk(_In_ CONST CSC_SmallDynamicArray* CONST pThis, _In_ CONST CSC_SIZE_T startIndex, _Out_ CSC_SIZE_T* CONST pNumOfElements)
+{
+	return CSC_DynamicArrayGetContiguousChunk((CONST CSC_DynamicArray*)pThis, startIndex, pNumOfElements);
+}
+
+CSC_STATUS CSCMETHOD CSC_SmallDynamicArrayAssign(_Inout_ CSC_SmallDynamicArray* CONST pThis, _In_ CONST CSC_SIZE_T numOfElements, _In_ CONST CSC_PCVOID pValue)
+{
+	return CSC_DynamicArrayAssign((CSC_DynamicArray*)pThis, numOfElements, pValue);
+}
+
+CSC_STATUS CSCMETHOD CSC_SmallDynamicArrayAssignBlock(_Inout_ CSC_SmallDynamicArray* CONST pThis, _In_ CONST CSC_SIZE_T firstIndex, _In_ CONST CSC_SIZE_T numOfElements, _In_ CONST CSC_PCVOID pValue)
+{
+	return CSC_DynamicArrayAssignBlock((CSC_DynamicArray*)pThis, firstIndex, numOfElements, pValue);
+}
+
+CSC_STATUS CSCMETHOD CSC_SmallDynamicArrayAssignRange(_Inout_ CSC_SmallDynamicArray* CONST pThis, _In_ CONST CSC_SIZE_T firstIndex, _In_ CONST CSC_SIZE_T lastIndex, _In_ CONST CSC_PCVOID pValue)
+{
+	return CSC_DynamicArrayAssignRange((CSC_DynamicArray*)pThis, firstIndex, lastIndex, pValue);
+}
+
+CSC_STATUS CSCMETHOD CSC_SmallDynamicArrayCopy(_Inout_ CSC_SmallDynamicArray* CONST pThis, _In_ CONST CSC_SmallDynamicArray* CONST pSrc)
+{
+	return CSC_DynamicArrayCopy((CSC_DynamicArray*)pThis, (CONST CSC_DynamicArray*)pSrc);
+}
+
+CSC_STATUS CSCMETHOD CSC_SmallDynamicArrayMove(_Inout_ CSC_SmallDynamicArray* CONST pThis, _Inout_ CSC_SmallDynamicArray* CONST pSrc)
+{
+	return CSC_DynamicArrayMove((CSC_DynamicArray*)pThis, (CSC_DynamicArray*)pSrc);
+}
+
+CSC_STATUS CSCMETHOD CSC_SmallDynamicArrayCopyArray(_Inout_ CSC_SmallDynamicArray* CONST pThis, _In_ CONST CSC_PCVOID pFirst, _In_ CONST CSC_SIZE_T numOfElements, _In_ CONST CSC_SIZE_T elementSize)
+{
+	return CSC_DynamicArrayCopyArray((CSC_DynamicArray*)pThis, pFirst, numOfElements, elementSize);
+}
+
+CSC_STATUS CSCMETHOD CSC_SmallDynamicArrayInsertElement(_Inout_ CSC_SmallDynamicArray* CONST pThis, _In_ CONST CSC_SIZE_T insertIndex, _In_opt_ CONST CSC_PCVOID pValue)
+{
+	return CSC_DynamicArrayInsertElement((CSC_DynamicArray*)pThis, insertIndex, pValue);
+}
+
+CSC_STATUS CSCMETHOD CSC_SmallDynamicArrayInsertRange(_Inout_ CSC_SmallDynamicArray* CONST pThis, _In_ CONST CSC_SIZE_T insertIndex, _In_opt_ CONST CSC_PCVOID pFirst, _In_ CONST CSC_SIZE_T numOfElements)
+{
+	return CSC_DynamicArrayInsertRange((CSC_DynamicArray*)pThis, insertIndex, pFirst, numOfElements);
+}
+
+CSC_STATUS CSCMETHOD CSC_SmallDynamicArrayInsertArray(_Inout_ CSC_SmallDynamicArray* CONST pThis, _In_ CONST CSC_SIZE_T insertIndex, _In_ CONST CSC_SmallDynamicArray* CONST pSrc)
+{
+	return CSC_DynamicArrayInsertArray((CSC_DynamicArray*)pThis, insertIndex, (CONST CSC_DynamicArray*)pSrc);
+}
+
+CSC_STATUS CSCMETHOD CSC_SmallDynamicArrayAppendCopy(_Inout_ CSC_SmallDynamicArray* CONST pThis, _In_ CONST CSC_SmallDynamicArray* CONST pSrc)
+{
+	return CSC_DynamicArrayAppendCopy((CSC_DynamicArray*)pThis, (CONST CSC_DynamicArray*)pSrc);
+}
+
+CSC_STATUS CSCMETHOD CSC_SmallDynamicArrayAppendMove(_Inout_ CSC_SmallDynamicArray* CONST pThis, _Inout_ CSC_SmallDynamicArray* CONST pSrc)
+{
+	return CSC_DynamicArrayAppendMove((CSC_DynamicArray*)pThis, (CSC_DynamicArray*)pSrc);
+}
+
+CSC_STATUS CSCMETHOD CSC_SmallDynamicArrayRemoveElement(_Inout_ CSC_SmallDynamicArray* CONST pThis, _In_ CONST CSC_SIZE_T removeIndex)
+{
+	return CSC_DynamicArrayRemoveElement((CSC_DynamicArray*)pThis, removeIndex);
+}
+
+CSC_STATUS CSCMETHOD CSC_SmallDynamicArrayLazyRemoveElement(_Inout_ CSC_SmallDynamicArray* CONST pThis, _In_ CONST CSC_SIZE_T removeIndex)
+{
+	return CSC_DynamicArrayLazyRemoveElement((CSC_DynamicArray*)pThis, removeIndex);
+}
+
+CSC_STATUS CSCMETHOD CSC_SmallDynamicArrayRemoveRange(_Inout_ CSC_SmallDynamicArray* CONST pThis, _In_ CONST CSC_SIZE_T removeIndex, _In_ CONST CSC_SIZE_T numOfElements)
+{
+	return CSC_DynamicArrayRemoveRange((CSC_DynamicArray*)pThis, removeIndex, numOfElements);
+}
+
+CSC_STATUS CSCMETHOD CSC_SmallDynamicArrayLazyRemoveRange(_Inout_ CSC_SmallDynamicArray* CONST pThis, _In_ CONST CSC_SIZE_T removeIndex, _In_ CONST CSC_SIZE_T numOfElements)
+{
+	return CSC_DynamicArrayLazyRemoveRange((CSC_DynamicArray*)pThis, removeIndex, numOfElements);
+}
+
+CSC_STATUS CSCMETHOD CSC_SmallDynamicArrayRemoveIf(_Inout_ CSC_SmallDynamicArray* CONST pThis, _In_ CONST CSC_P_DYNAMIC_ARRAY_PREDICATE pPredicate, _In_opt_ CONST CSC_PVOID pContext)
+{
+	return CSC_DynamicArrayRemoveIf((CSC_DynamicArray*)pThis, pPredicate, pContext);
+}
+
+CSC_STATUS CSCMETHOD CSC_SmallDynamicArrayRemoveIndices(_Inout_ CSC_SmallDynamicArray* CONST pThis, _In_ CONST CSC_SIZE_T* CONST pSortedIndices, _In_ CONST CSC_SIZE_T numOfIndices)
+{
+	return CSC_DynamicArrayRemoveIndices((CSC_DynamicArray*)pThis, pSortedIndices, numOfIndices);
+}
+
+CSC_STATUS CSCMETHOD CSC_SmallDynamicArrayReverse(_Inout_ CSC_SmallDynamicArray* CONST pThis)
+{
+	return CSC_DynamicArrayReverse((CSC_DynamicArray*)pThis);
+}
+
+CSC_STATUS CSCMETHOD CSC_SmallDynamicArraySort(_Inout_ CSC_SmallDynamicArray* CONST pThis, _In_ CONST CSC_P_DYNAMIC_ARRAY_COMPARE pCompare, _In_opt_ CONST CSC_PVOID pContext)
+{
+	return CSC_DynamicArraySort((CSC_DynamicArray*)pThis, pCompare, pContext);
+}
+
+CSC_STATUS CSCMETHOD CSC_SmallDynamicArrayStableSort(_Inout_ CSC_SmallDynamicArray* CONST pThis, _In_ CONST CSC_P_DYNAMIC_ARRAY_COMPARE pCompare, _In_opt_ CONST CSC_PVOID pContext, _In_ CONST CSC_SIZE_T numOfThreads)
+{
+	return CSC_DynamicArrayStableSort((CSC_DynamicArray*)pThis, pCompare, pContext, numOfThreads);
+}
+
+CSC_STATUS CSCMETHOD CSC_SmallDynamicArrayRadixSort(_Inout_ CSC_SmallDynamicArray* CONST pThis, _In_ CONST CSC_P_DYNAMIC_ARRAY_GET_KEY pGetKey, _In_opt_ CONST CSC_PVOID pContext, _In_ CONST CSC_SIZE_T keySize)
+{
+	return CSC_DynamicArrayRadixSort((CSC_DynamicArray*)pThis, pGetKey, pContext, keySize);
+}
+
+CSC_SIZE_T CSCMETHOD CSC_SmallDynamicArrayLowerBound(_In_ CONST CSC_SmallDynamicArray* CONST pThis, _In_ CONST CSC_PCVOID pValue, _In_ CONST CSC_P_DYNAMIC_ARRAY_COMPARE pCompare, _In_opt_ CONST CSC_PVOID pContext)
+{
+	return CSC_DynamicArrayLowerBound((CONST CSC_DynamicArray*)pThis, pValue, pCompare, pContext);
+}
+
+CSC_SIZE_T CSCMETHOD CSC_SmallDynamicArrayUpperBound(_In_ CONST CSC_SmallDynamicArray* CONST pThis, _In_ CONST CSC_PCVOID pValue, _In_ CONST CSC_P_DYNAMIC_ARRAY_COMPARE pCompare, _In_opt_ CONST CSC_PVOID pContext)
+{
+	return CSC_DynamicArrayUpperBound((CONST CSC_DynamicArray*)pThis, pValue, pCompare, pContext);
+}
+
+CSC_STATUS CSCMETHOD CSC_SmallDynamicArrayEqualRange(_In_ CONST CSC_SmallDynamicArray* CONST pThis, _In_ CONST CSC_PCVOID pValue, _In_ CONST CSC_P_DYNAMIC_ARRAY_COMPARE pCompare, _In_opt_ CONST CSC_PVOID pContext, _Out_ CSC_SIZE_T* CONST pFirstIndex, _Out_ CSC_SIZE_T* CONST pLastIndex)
+{
+	return CSC_DynamicArrayEqualRange((CONST CSC_DynamicArray*)pThis, pValue, pCompare, pContext, pFirstIndex, pLastIndex);
+}
+
+CSC_SIZE_T CSCMETHOD CSC_SmallDynamicArrayBinarySearch(_In_ CONST CSC_SmallDynamicArray* CONST pThis, _In_ CONST CSC_PCVOID pValue, _In_ CONST CSC_P_DYNAMIC_ARRAY_COMPARE pCompare, _In_opt_ CONST CSC_PVOID pContext)
+{
+	return CSC_DynamicArrayBinarySearch((CONST CSC_DynamicArray*)pThis, pValue, pCompare, pContext);
+}
+
+CSC_SIZE_T CSCMETHOD CSC_SmallDynamicArrayBranchlessLowerBound(_In_ CONST CSC_SmallDynamicArray* CONST pThis, _In_ CONST CSC_PCVOID pValue, _In_ CONST CSC_P_DYNAMIC_ARRAY_COMPARE pCompare, _In_opt_ CONST CSC_PVOID pContext)
+{
+	return CSC_DynamicArrayBranchlessLowerBound((CONST CSC_DynamicArray*)pThis, pValue, pCompare, pContext);
+}
+
+CSC_STATUS CSCMETHOD CSC_SmallDynamicArrayBuildEytzinger(_Inout_ CSC_SmallDynamicArray* CONST pThis)
+{
+	return CSC_DynamicArrayBuildEytzinger((CSC_DynamicArray*)pThis);
+}
+
+CSC_SIZE_T CSCMETHOD CSC_SmallDynamicArrayEytzingerLowerBound(_In_ CONST CSC_SmallDynamicArray* CONST pThis, _In_ CONST CSC_PCVOID pValue, _In_ CONST CSC_P_DYNAMIC_ARRAY_COMPARE pCompare, _In_opt_ CONST CSC_PVOID pContext)
+{
+	return CSC_DynamicArrayEytzingerLowerBound((CONST CSC_DynamicArray*)pThis, pValue, pCompare, pContext);
+}
+
+CSC_STATUS CSCMETHOD CSC_SmallDynamicArrayParallelForEach(_Inout_ CSC_SmallDynamicArray* CONST pThis, _In_ CONST CSC_P_DYNAMIC_ARRAY_FOR_EACH pForEach, _In_opt_ CONST CSC_PVOID pContext, _In_ CONST CSC_SIZE_T numOfThreads, _In_ CONST CSC_SIZE_T grainSize)
+{
+	return CSC_DynamicArrayParallelForEach((CSC_DynamicArray*)pThis, pForEach, pContext, numOfThreads, grainSize);
+}
+
+CSC_STATUS CSCMETHOD CSC_SmallDynamicArrayParallelTransform(_In_ CONST CSC_SmallDynamicArray* CONST pThis, _Inout_ CSC_SmallDynamicArray* CONST pDst, _In_ CONST CSC_P_DYNAMIC_ARRAY_TRANSFORM pTransform, _In_opt_ CONST CSC_PVOID pContext, _In_ CONST CSC_SIZE_T numOfThreads, _In_ CONST CSC_SIZE_T grainSize)
+{
+	return CSC_DynamicArrayParallelTransform((CONST CSC_DynamicArray*)pThis, (CSC_DynamicArray*)pDst, pTransform, pContext, numOfThreads, grainSize);
+}
+
+CSC_STATUS CSCMETHOD CSC_SmallDynamicArrayParallelReduce(_In_ CONST CSC_SmallDynamicArray* CONST pThis, _In_ CONST CSC_P_DYNAMIC_ARRAY_COMBINE pAccumulate, _In_opt_ CONST CSC_P_DYNAMIC_ARRAY_COMBINE pCombine, _In_opt_ CONST CSC_PVOID pContext, _Inout_ CONST CSC_PVOID pResult, _In_ CONST CSC_SIZE_T resultSize, _In_ CONST CSC_SIZE_T numOfThreads, _In_ CONST CSC_SIZE_T grainSize)
+{
+	return CSC_DynamicArrayParallelReduce((CONST CSC_DynamicArray*)pThis, pAccumulate, pCombine, pContext, pResult, resultSize, numOfThreads, grainSize);
+}
+
+CSC_PVOID CSCMETHOD CSC_SmallDynamicArrayFront(_In_ CONST CSC_SmallDynamicArray* CONST pThis)
+{
+	return CSC_DynamicArrayFront((CONST CSC_DynamicArray*)pThis);
+}
+
+CSC_PVOID CSCMETHOD CSC_SmallDynamicArrayBack(_In_ CONST CSC_SmallDynamicArray* CONST pThis)
+{
+	return CSC_DynamicArrayBack((CONST CSC_DynamicArray*)pThis);
+}
+
+CSC_PVOID CSCMETHOD CSC_SmallDynamicArrayData(_In_ CONST CSC_SmallDynamicArray* CONST pThis)
+{
+	return CSC_DynamicArrayData((CONST CSC_DynamicArray*)pThis);
+}
+
+CSC_STATUS CSCMETHOD CSC_SmallDynamicArrayIsEmpty(_In_ CONST CSC_SmallDynamicArray* CONST pThis)
+{
+	return CSC_DynamicArrayIsEmpty((CONST CSC_DynamicArray*)pThis);
+}
+
+CSC_STATUS CSCMETHOD CSC_SmallDynamicArrayIsValid(_In_ CONST CSC_SmallDynamicArray* CONST pThis)
+{
+	if (CSC_DynamicArrayIsValid((CONST CSC_DynamicArray*)pThis) != CSC_STATUS_SUCCESS || pThis->array.inlineCapacity != CSC_DYNAMIC_ARRAY_INLINE_SIZE)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	return CSC_STATUS_SUCCESS;
+}
+
+CSC_STATUS CSCMETHOD CSC_SmallDynamicArrayIsInline(_In_ CONST CSC_SmallDynamicArray* CONST pThis)
+{
+	if (CSC_SmallDynamicArrayIsValid(pThis) != CSC_STATUS_SUCCESS)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	return (pThis->array.pData) ? CSC_STATUS_GENERAL_FAILURE : CSC_STATUS_SUCCESS;
+}
+
+CSC_SIZE_T CSCMETHOD CSC_SmallDynamicArrayGetSize(_In_ CONST CSC_SmallDynamicArray* CONST pThis)
+{
+	return CSC_DynamicArrayGetSize((CONST CSC_DynamicArray*)pThis);
+}
+
+CSC_SIZE_T CSCMETHOD CSC_SmallDynamicArrayGetCapacity(_In_ CONST CSC_SmallDynamicArray* CONST pThis)
+{
+	return CSC_DynamicArrayGetCapacity((CONST CSC_DynamicArray*)pThis);
+}
+
+CSC_SIZE_T CSCMETHOD CSC_SmallDynamicArrayGetInlineCapacity(_In_ CONST CSC_SmallDynamicArray* CONST pThis)
+{
+	if (CSC_SmallDynamicArrayIsValid(pThis) != CSC_STATUS_SUCCESS)
+	{
+		return CSC_CONTAINER_INVALID_LENGTH;
+	}
+
+	return pThis->array.inlineCapacity / pThis->array.elementSize;
+}
+
+CSC_SIZE_T CSCMETHOD CSC_SmallDynamicArrayGetMaxElements(_In_ CONST CSC_SmallDynamicArray* CONST pThis)
+{
+	return CSC_DynamicArrayGetMaxElements((CONST CSC_DynamicArray*)pThis);
+}
+
+CSC_SIZE_T CSCMETHOD CSC_SmallDynamicArrayGetElementSize(_In_ CONST CSC_SmallDynamicArray* CONST pThis)
+{
+	return CSC_DynamicArrayGetElementSize((CONST CSC_DynamicArray*)pThis);
+}
+
+EDynamicArrayGrowthPolicy CSCMETHOD CSC_SmallDynamicArrayGetGrowthPolicy(_In_ CONST CSC_SmallDynamicArray* CONST pThis)
+{
+	return CSC_DynamicArrayGetGrowthPolicy((CONST CSC_DynamicArray*)pThis);
+}
+
+CSC_DynamicArray* CSCMETHOD CSC_SmallDynamicArrayGetDynamicArray(_In_ CONST CSC_SmallDynamicArray* CONST pThis)
+{
+	if (CSC_SmallDynamicArrayIsValid(pThis) != CSC_STATUS_SUCCESS)
+	{
+		return NULL;
+	}
+
+	return (CSC_DynamicArray*)&pThis->array;
+}
+
+CSC_IBaseInterface* CSCMETHOD CSC_SmallDynamicArrayGetIBaseInterface(_In_ CONST CSC_SmallDynamicArray* CONST pThis)
+{
+	return CSC_DynamicArrayGetIBaseInterface((CONST CSC_DynamicArray*)pThis);
+}
+
+CSC_IContainer* CSCMETHOD CSC_SmallDynamicArrayGetIContainer(_In_ CONST CSC_SmallDynamicArray* CONST pThis)
+{
+	return CSC_DynamicArrayGetIContainer((CONST CSC_DynamicArray*)pThis);
+}
+
+CSC_IIterable* CSCMETHOD CSC_SmallDynamicArrayGetIIterable(_In_ CONST CSC_SmallDynamicArray* CONST pThis)
+{
+	return CSC_DynamicArrayGetIIterable((CONST CSC_DynamicArray*)pThis);
+}
+
+CSC_IAllocator* CSCMETHOD CSC_SmallDynamicArrayGetIAllocator(_In_ CONST CSC_SmallDynamicArray* CONST pThis)
+{
+	return CSC_DynamicArrayGetIAllocator((CONST CSC_DynamicArray*)pThis);
+}
+
+CSC_IContainerVirtualTable* CSCMETHOD CSC_SmallDynamicArrayGetNestedContainerVTable(_In_ CONST CSC_SmallDynamicArray* CONST pThis)
+{
+	return CSC_DynamicArrayGetNestedContainerVTable((CONST CSC_DynamicArray*)pThis);
+}
\ No newline at end of file
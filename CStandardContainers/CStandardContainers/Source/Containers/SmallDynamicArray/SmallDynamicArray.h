@@ -0,0 +1,128 @@
+#ifndef CSC_SMALL_DYNAMIC_ARRAY
+#define CSC_SMALL_DYNAMIC_ARRAY
+
+/*
+Description:
+The SmallDynamicArray is a DynamicArray that stores up to CSC_DYNAMIC_ARRAY_INLINE_SIZE bytes of elements within the object itself, which saves the allocation and the indirection for arrays that usually hold few elements.
+Once the elements outgrow the inline storage they are moved to memory requested from the allocator, they return to the inline storage as soon as the array shrinks to fit into it again.
+The inline storage is aligned to sizeof(CSC_SIZE_T), element types with stricter alignment requirements must use a regular DynamicArray.
+The object begins with a CSC_DynamicArray and implements the same IContainer and IIterable interfaces, hence it can be nested and iterated like a DynamicArray.
+The functions of the DynamicArray can be used on the array returned by CSC_SmallDynamicArrayGetDynamicArray, the functions below are provided for convenience and type safety.
+*/
+
+// Include the current configuration of the library containing various type definitions and other things.
+#include "../../Configuration/Configuration.h"
+// Include the DynamicArray as the small array is a DynamicArray with inline storage.
+#include "../DynamicArray/DynamicArray.h"
+
+// Definition of the small array, the inline storage directly follows the array since the size of the array is a multiple of the alignment of CSC_SIZE_T.
+typedef struct _CSC_SmallDynamicArray
+{
+	CSC_DynamicArray array;
+	CSC_SIZE_T inlineStorage[CSC_DYNAMIC_ARRAY_INLINE_SIZE / sizeof(CSC_SIZE_T)];
+} CSC_SmallDynamicArray;
+
+CSC_STATUS CSCMETHOD CSC_SmallDynamicArrayInitialize(_Out_ CSC_SmallDynamicArray* CONST pThis, _In_ CONST CSC_SIZE_T elementSize, _In_ CONST CSC_IAllocator* CONST pIAllocator, _In_ CONST CSC_IContainerVirtualTable* CONST pNestedContainerVTable);
+CSC_STATUS CSCMETHOD CSC_SmallDynamicArrayInitializeWithSize(_Out_ CSC_SmallDynamicArray* CONST pThis, _In_ CONST CSC_SIZE_T elementSize, _In_ CONST CSC_SIZE_T numOfElements, _In_opt_ CONST CSC_PCVOID pDefaultValue, _In_ CONST CSC_IAllocator* CONST pIAllocator, _In_ CONST CSC_IContainerVirtualTable* CONST pNestedContainerVTable);
+CSC_STATUS CSCMETHOD CSC_SmallDynamicArrayInitializeWithValue(_Out_ CSC_SmallDynamicArray* CONST pThis, _In_ CONST CSC_SIZE_T elementSize, _In_ CONST CSC_SIZE_T numOfElements, _In_ CONST CSC_PCVOID pValue, _In_ CONST CSC_IAllocator* CONST pIAllocator, _In_ CONST CSC_IContainerVirtualTable* CONST pNestedContainerVTable);
+CSC_STATUS CSCMETHOD CSC_SmallDynamicArrayInitializeWithCopy(_Out_ CSC_SmallDynamicArray* CONST pThis, _In_ CONST CSC_SmallDynamicArray* CONST pSrc);
+CSC_STATUS CSCMETHOD CSC_SmallDynamicArrayInitializeWithArray(_Out_ CSC_SmallDynamicArray* CONST pThis, _In_ CONST CSC_PCVOID pFirst, _In_ CONST CSC_SIZE_T numOfElements, _In_ CONST CSC_SIZE_T elementSize, _In_ CONST CSC_IAllocator* CONST pIAllocator, _In_ CONST CSC_IContainerVirtualTable* CONST pNestedContainerVTable);
+CSC_STATUS CSCMETHOD CSC_SmallDynamicArrayDeserialize(_Out_ CSC_SmallDynamicArray* CONST pThis, _Inout_ CSC_SerializationReader* CONST pReader, _In_ CONST CSC_IAllocator* CONST pIAllocator, _In_opt_ CONST CSC_IContainerVirtualTable* CONST pNestedContainerVTable);
+CSC_STATUS CSCMETHOD CSC_SmallDynamicArraySerialize(_In_ CONST CSC_SmallDynamicArray* CONST pThis, _Inout_ CSC_SerializationWriter* CONST pWriter);
+
+CSC_STATUS CSCMETHOD CSC_SmallDynamicArrayResize(_Inout_ CSC_SmallDynamicArray* CONST pThis, _In_ CONST CSC_SIZE_T numOfElements, _In_opt_ CONST CSC_PCVOID pDefaultValue);
+CSC_STATUS CSCMETHOD CSC_SmallDynamicArrayLazyResize(_Inout_ CSC_SmallDynamicArray* CONST pThis, _In_ CONST CSC_SIZE_T numOfElements, _In_opt_ CONST CSC_PCVOID pDefaultValue);
+CSC_STATUS CSCMETHOD CSC_SmallDynamicArrayReserve(_Inout_ CSC_SmallDynamicArray* CONST pThis, _In_ CONST CSC_SIZE_T numOfElements);
+CSC_STATUS CSCMETHOD CSC_SmallDynamicArrayShrinkToFit(_Inout_ CSC_SmallDynamicArray* CONST pThis);
+// Sets the policy that determines the new capacity when the array grows, the default policy is csc_dagp_Factor2.
+// Returns CSC_STATUS_SUCCESS on success, otherwise an error code is returned.
+CSC_STATUS CSCMETHOD CSC_SmallDynamicArraySetGrowthPolicy(_Inout_ CSC_SmallDynamicArray* CONST pThis, _In_ CONST EDynamicArrayGrowthPolicy growthPolicy);
+// Enables or disables deferred compaction of removed elements, disabling it compacts the array.
+// Returns CSC_STATUS_SUCCESS on success, otherwise an error code is returned.
+CSC_STATUS CSCMETHOD CSC_SmallDynamicArraySetDeferredCompaction(_Inout_ CSC_SmallDynamicArray* CONST pThis, _In_ CONST CSC_BOOLEAN isDeferredCompaction);
+CSC_STATUS CSCMETHOD CSC_SmallDynamicArrayCompact(_Inout_ CSC_SmallDynamicArray* CONST pThis);
+
+CSC_STATUS CSCMETHOD CSC_SmallDynamicArrayDestroy(_Inout_ CSC_SmallDynamicArray* CONST pThis);
+CSC_STATUS CSCMETHOD CSC_SmallDynamicArrayErase(_Inout_ CSC_SmallDynamicArray* CONST pThis);
+CSC_STATUS CSCMETHOD CSC_SmallDynamicArrayClear(_Inout_ CSC_SmallDynamicArray* CONST pThis);
+CSC_STATUS CSCMETHOD CSC_SmallDynamicArrayZeroMemory(_Out_ CSC_SmallDynamicArray* CONST pThis);
+
+CSC_STATUS CSCMETHOD CSC_SmallDynamicArrayPushValue(_Inout_ CSC_SmallDynamicArray* CONST pThis, _In_opt_ CONST CSC_PCVOID pValue);
+// Reserves uninitialized slots like the emplace functions of the DynamicArray, the slots must be committed through CSC_SmallDynamicArrayCommitEmplace.
+// Returns a null pointer if the slots couldn't be reserved or another emplacement is pending.
+CSC_PVOID CSCMETHOD CSC_SmallDynamicArrayEmplaceBack(_Inout_ CSC_SmallDynamicArray* CONST pThis);
+CSC_PVOID CSCMETHOD CSC_SmallDynamicArrayEmplaceAt(_Inout_ CSC_SmallDynamicArray* CONST pThis, _In_ CONST CSC_SIZE_T insertIndex);
+CSC_PVOID CSCMETHOD CSC_SmallDynamicArrayExtendUninitialized(_Inout_ CSC_SmallDynamicArray* CONST pThis, _In_ CONST CSC_SIZE_T numOfElements);
+// Adds the first numOfElements slots of the pending emplacement to the array, committing 0 elements cancels the emplacement.
+// Returns CSC_STATUS_SUCCESS on success, otherwise an error code is returned.
+CSC_STATUS CSCMETHOD CSC_SmallDynamicArrayCommitEmplace(_Inout_ CSC_SmallDynamicArray* CONST pThis, _In_ CONST CSC_SIZE_T numOfElements);
+CSC_STATUS CSCMETHOD CSC_SmallDynamicArrayPopValue(_Inout_ CSC_SmallDynamicArray* CONST pThis, _When_(return == STATUS_SUCCESS, _Out_opt_) CONST CSC_PVOID pValue);
+CSC_STATUS CSCMETHOD CSC_SmallDynamicArrayLazyPopValue(_Inout_ CSC_SmallDynamicArray* CONST pThis, _When_(return == STATUS_SUCCESS, _Out_opt_) CONST CSC_PVOID pValue);
+CSC_STATUS CSCMETHOD CSC_SmallDynamicArrayPopFront(_Inout_ CSC_SmallDynamicArray* CONST pThis, _When_(return == STATUS_SUCCESS, _Out_opt_) CONST CSC_PVOID pValue);
+CSC_STATUS CSCMETHOD CSC_SmallDynamicArrayLazyPopFront(_Inout_ CSC_SmallDynamicArray* CONST pThis, _When_(return == STATUS_SUCCESS, _Out_opt_) CONST CSC_PVOID pValue);
+
+CSC_PVOID CSCMETHOD CSC_SmallDynamicArrayAccessElement(_In_ CONST CSC_SmallDynamicArray* CONST pThis, _In_ CONST CSC_SIZE_T index);
+CSC_PCVOID CSCMETHOD CSC_SmallDynamicArrayReadElement(_In_ CONST CSC_SmallDynamicArray* CONST pThis, _In_ CONST CSC_SIZE_T index);
+CSC_PCVOID CSCMETHOD CSC_SmallDynamicArrayGetContiguousChunk(_In_ CONST CSC_SmallDynamicArray* CONST pThis, _In_ CONST CSC_SIZE_T startIndex, _Out_ CSC_SIZE_T* CONST pNumOfElements);
+
+CSC_STATUS CSCMETHOD CSC_SmallDynamicArrayAssign(_Inout_ CSC_SmallDynamicArray* CONST pThis, _In_ CONST CSC_SIZE_T numOfElements, _In_ CONST CSC_PCVOID pValue);
+CSC_STATUS CSCMETHOD CSC_SmallDynamicArrayAssignBlock(_Inout_ CSC_SmallDynamicArray* CONST pThis, _In_ CONST CSC_SIZE_T firstIndex, _In_ CONST CSC_SIZE_T numOfElements, _In_ CONST CSC_PCVOID pValue);
+CSC_STATUS CSCMETHOD CSC_SmallDynamicArrayAssignRange(_Inout_ CSC_SmallDynamicArray* CONST pThis, _In_ CONST CSC_SIZE_T firstIndex, _In_ CONST CSC_SIZE_T lastIndex, _In_ CONST CSC_PCVOID pValue);
+
+CSC_STATUS CSCMETHOD CSC_SmallDynamicArrayCopy(_Inout_ CSC_SmallDynamicArray* CONST pThis, _In_ CONST CSC_SmallDynamicArray* CONST pSrc);
+CSC_STATUS CSCMETHOD CSC_SmallDynamicArrayMove(_Inout_ CSC_SmallDynamicArray* CONST pThis, _Inout_ CSC_SmallDynamicArray* CONST pSrc);
+CSC_STATUS CSCMETHOD CSC_SmallDynamicArrayCopyArray(_Inout_ CSC_SmallDynamicArray* CONST pThis, _In_ CONST CSC_PCVOID pFirst, _In_ CONST CSC_SIZE_T numOfElements, _In_ CONST CSC_SIZE_T elementSize);
+
+CSC_STATUS CSCMETHOD CSC_SmallDynamicArrayInsertElement(_Inout_ CSC_SmallDynamicArray* CONST pThis, _In_ CONST CSC_SIZE_T insertIndex, _In_opt_ CONST CSC_PCVOID pValue);
+CSC_STATUS CSCMETHOD CSC_SmallDynamicArrayInsertRange(_Inout_ CSC_SmallDynamicArray* CONST pThis, _In_ CONST CSC_SIZE_T insertIndex, _In_opt_ CONST CSC_PCVOID pFirst, _In_ CONST CSC_SIZE_T numOfElements);
+CSC_STATUS CSCMETHOD CSC_SmallDynamicArrayInsertArray(_Inout_ CSC_SmallDynamicArray* CONST pThis, _In_ CONST CSC_SIZE_T insertIndex, _In_ CONST CSC_SmallDynamicArray* CONST pSrc);
+CSC_STATUS CSCMETHOD CSC_SmallDynamicArrayAppendCopy(_Inout_ CSC_SmallDynamicArray* CONST pThis, _In_ CONST CSC_SmallDynamicArray* CONST pSrc);
+CSC_STATUS CSCMETHOD CSC_SmallDynamicArrayAppendMove(_Inout_ CSC_SmallDynamicArray* CONST pThis, _Inout_ CSC_SmallDynamicArray* CONST pSrc);
+
+CSC_STATUS CSCMETHOD CSC_SmallDynamicArrayRemoveElement(_Inout_ CSC_SmallDynamicArray* CONST pThis, _In_ CONST CSC_SIZE_T removeIndex);
+CSC_STATUS CSCMETHOD CSC_SmallDynamicArrayLazyRemoveElement(_Inout_ CSC_SmallDynamicArray* CONST pThis, _In_ CONST CSC_SIZE_T removeIndex);
+CSC_STATUS CSCMETHOD CSC_SmallDynamicArrayRemoveRange(_Inout_ CSC_SmallDynamicArray* CONST pThis, _In_ CONST CSC_SIZE_T removeIndex, _In_ CONST CSC_SIZE_T numOfElements);
+CSC_STATUS CSCMETHOD CSC_SmallDynamicArrayLazyRemoveRange(_Inout_ CSC_SmallDynamicArray* CONST pThis, _In_ CONST CSC_SIZE_T removeIndex, _In_ CONST CSC_SIZE_T numOfElements);
+CSC_STATUS CSCMETHOD CSC_SmallDynamicArrayRemoveIf(_Inout_ CSC_SmallDynamicArray* CONST pThis, _In_ CONST CSC_P_DYNAMIC_ARRAY_PREDICATE pPredicate, _In_opt_ CONST CSC_PVOID pContext);
+CSC_STATUS CSCMETHOD CSC_SmallDynamicArrayRemoveIndices(_Inout_ CSC_SmallDynamicArray* CONST pThis, _In_ CONST CSC_SIZE_T* CONST pSortedIndices, _In_ CONST CSC_SIZE_T numOfIndices);
+
+CSC_STATUS CSCMETHOD CSC_SmallDynamicArrayReverse(_Inout_ CSC_SmallDynamicArray* CONST pThis);
+CSC_STATUS CSCMETHOD CSC_SmallDynamicArraySort(_Inout_ CSC_SmallDynamicArray* CONST pThis, _In_ CONST CSC_P_DYNAMIC_ARRAY_COMPARE pCompare, _In_opt_ CONST CSC_PVOID pContext);
+CSC_STATUS CSCMETHOD CSC_SmallDynamicArrayStableSort(_Inout_ CSC_SmallDynamicArray* CONST pThis, _In_ CONST CSC_P_DYNAMIC_ARRAY_COMPARE pCompare, _In_opt_ CONST CSC_PVOID pContext, _In_ CONST CSC_SIZE_T numOfThreads);
+CSC_STATUS CSCMETHOD CSC_SmallDynamicArrayRadixSort(_Inout_ CSC_SmallDynamicArray* CONST pThis, _In_ CONST CSC_P_DYNAMIC_ARRAY_GET_KEY pGetKey, _In_opt_ CONST CSC_PVOID pContext, _In_ CONST CSC_SIZE_T keySize);
+
+CSC_SIZE_T CSCMETHOD CSC_SmallDynamicArrayLowerBound(_In_ CONST CSC_SmallDynamicArray* CONST pThis, _In_ CONST CSC_PCVOID pValue, _In_ CONST CSC_P_DYNAMIC_ARRAY_COMPARE pCompare, _In_opt_ CONST CSC_PVOID pContext);
+CSC_SIZE_T CSCMETHOD CSC_SmallDynamicArrayUpperBound(_In_ CONST CSC_SmallDynamicArray* CONST pThis, _In_ CONST CSC_PCVOID pValue, _In_ CONST CSC_P_DYNAMIC_ARRAY_COMPARE pCompare, _In_opt_ CONST CSC_PVOID pContext);
+CSC_STATUS CSCMETHOD CSC_SmallDynamicArrayEqualRange(_In_ CONST CSC_SmallDynamicArray* CONST pThis, _In_ CONST CSC_PCVOID pValue, _In_ CONST CSC_P_DYNAMIC_ARRAY_COMPARE pCompare, _In_opt_ CONST CSC_PVOID pContext, _Out_ CSC_SIZE_T* CONST pFirstIndex, _Out_ CSC_SIZE_T* CONST pLastIndex);
+CSC_SIZE_T CSCMETHOD CSC_SmallDynamicArrayBinarySearch(_In_ CONST CSC_SmallDynamicArray* CONST pThis, _In_ CONST CSC_PCVOID pValue, _In_ CONST CSC_P_DYNAMIC_ARRAY_COMPARE pCompare, _In_opt_ CONST CSC_PVOID pContext);
+CSC_SIZE_T CSCMETHOD CSC_SmallDynamicArrayBranchlessLowerBound(_In_ CONST CSC_SmallDynamicArray* CONST pThis, _In_ CONST CSC_PCVOID pValue, _In_ CONST CSC_P_DYNAMIC_ARRAY_COMPARE pCompare, _In_opt_ CONST CSC_PVOID pContext);
+CSC_STATUS CSCMETHOD CSC_SmallDynamicArrayBuildEytzinger(_Inout_ CSC_SmallDynamicArray* CONST pThis);
+CSC_SIZE_T CSCMETHOD CSC_SmallDynamicArrayEytzingerLowerBound(_In_ CONST CSC_SmallDynamicArray* CONST pThis, _In_ CONST CSC_PCVOID pValue, _In_ CONST CSC_P_DYNAMIC_ARRAY_COMPARE pCompare, _In_opt_ CONST CSC_PVOID pContext);
+CSC_STATUS CSCMETHOD CSC_SmallDynamicArrayParallelForEach(_Inout_ CSC_SmallDynamicArray* CONST pThis, _In_ CONST CSC_P_DYNAMIC_ARRAY_FOR_EACH pForEach, _In_opt_ CONST CSC_PVOID pContext, _In_ CONST CSC_SIZE_T numOfThreads, _In_ CONST CSC_SIZE_T grainSize);
+CSC_STATUS CSCMETHOD CSC_SmallDynamicArrayParallelTransform(_In_ CONST CSC_SmallDynamicArray* CONST pThis, _Inout_ CSC_SmallDynamicArray* CONST pDst, _In_ CONST CSC_P_DYNAMIC_ARRAY_TRANSFORM pTransform, _In_opt_ CONST CSC_PVOID pContext, _In_ CONST CSC_SIZE_T numOfThreads, _In_ CONST CSC_SIZE_T grainSize);
+CSC_STATUS CSCMETHOD CSC_SmallDynamicArrayParallelReduce(_In_ CONST CSC_SmallDynamicArray* CONST pThis, _In_ CONST CSC_P_DYNAMIC_ARRAY_COMBINE pAccumulate, _In_opt_ CONST CSC_P_DYNAMIC_ARRAY_COMBINE pCombine, _In_opt_ CONST CSC_PVOID pContext, _Inout_ CONST CSC_PVOID pResult, _In_ CONST CSC_SIZE_T resultSize, _In_ CONST CSC_SIZE_T numOfThreads, _In_ CONST CSC_SIZE_T grainSize);
+
+CSC_PVOID CSCMETHOD CSC_SmallDynamicArrayFront(_In_ CONST CSC_SmallDynamicArray* CONST pThis);
+CSC_PVOID CSCMETHOD CSC_SmallDynamicArrayBack(_In_ CONST CSC_SmallDynamicArray* CONST pThis);
+CSC_PVOID CSCMETHOD CSC_SmallDynamicArrayData(_In_ CONST CSC_SmallDynamicArray* CONST pThis);
+
+CSC_STATUS CSCMETHOD CSC_SmallDynamicArrayIsEmpty(_In_ CONST CSC_SmallDynamicArray* CONST pThis);
+CSC_STATUS CSCMETHOD CSC_SmallDynamicArrayIsValid(_In_ CONST CSC_SmallDynamicArray* CONST pThis);
+// Checks whether the elements are currently stored inline.
+// Returns CSC_STATUS_SUCCESS if they are, CSC_STATUS_GENERAL_FAILURE if they are stored in allocated memory, otherwise an error code is returned.
+CSC_STATUS CSCMETHOD CSC_SmallDynamicArrayIsInline(_In_ CONST CSC_SmallDynamicArray* CONST pThis);
+
+CSC_SIZE_T CSCMETHOD CSC_SmallDynamicArrayGetSize(_In_ CONST CSC_SmallDynamicArray* CONST pThis);
+CSC_SIZE_T CSCMETHOD CSC_SmallDynamicArrayGetCapacity(_In_ CONST CSC_SmallDynamicArray* CONST pThis);
+CSC_SIZE_T CSCMETHOD CSC_SmallDynamicArrayGetInlineCapacity(_In_ CONST CSC_SmallDynamicArray* CONST pThis);
+CSC_SIZE_T CSCMETHOD CSC_SmallDynamicArrayGetMaxElements(_In_ CONST CSC_SmallDynamicArray* CONST pThis);
+CSC_SIZE_T CSCMETHOD CSC_SmallDynamicArrayGetElementSize(_In_ CONST CSC_SmallDynamicArray* CONST pThis);
+EDynamicArrayGrowthPolicy CSCMETHOD CSC_SmallDynamicArrayGetGrowthPolicy(_In_ CONST CSC_SmallDynamicArray* CONST pThis);
+CSC_DynamicArray* CSCMETHOD CSC_SmallDynamicArrayGetDynamicArray(_In_ CONST CSC_SmallDynamicArray* CONST pThis);
+CSC_IBaseInterface* CSCMETHOD CSC_SmallDynamicArrayGetIBaseInterface(_In_ CONST CSC_SmallDynamicArray* CONST pThis);
+CSC_IContainer* CSCMETHOD CSC_SmallDynamicArrayGetIContainer(_In_ CONST CSC_SmallDynamicArray* CONST pThis);
+CSC_IIterable* CSCMETHOD CSC_SmallDynamicArrayGetIIterable(_In_ CONST CSC_SmallDynamicArray* CONST pThis);
+CSC_IAllocator* CSCMETHOD CSC_SmallDynamicArrayGetIAllocator(_In_ CONST CSC_SmallDynamicArray* CONST pThis);
+CSC_IContainerVirtualTable* CSCMETHOD CSC_SmallDynamicArrayGetNestedContainerVTable(_In_ CONST CSC_SmallDynamicArray* CONST pThis);
+
+#endif
\ No newline at end of file
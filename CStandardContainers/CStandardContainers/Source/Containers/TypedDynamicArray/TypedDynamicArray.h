@@ -0,0 +1,193 @@
+#ifndef CSC_TYPED_DYNAMIC_ARRAY
+#define CSC_TYPED_DYNAMIC_ARRAY
+
+/*
+Description:
+The TypedDynamicArray macros generate a type safe DynamicArray for a fixed element type T, which can be any type that can be copied through plain assignment.
+CSC_DECLARE_TYPED_ARRAY(Name, T) declares the type Name together with functions prefixed by Name, for example CSC_DECLARE_TYPED_ARRAY(IntArray, int) declares IntArray and IntArrayPush.
+The functions are defined in the header, hence sizeof(T) is known at compile time and element accesses compile down to plain pointer arithmetic instead of a validated call and a multiplication with the runtime element size.
+Element access through Name##At, Name##Get and Name##Set is not checked, the caller has to make sure the index is in bounds, elements are copied through struct assignment instead of the MemoryUtils.
+The generated type only wraps a CSC_DynamicArray, hence it is binary compatible with it: Name##GetDynamicArray hands the array to all DynamicArray functions and Name##FromDynamicArray casts an array of matching element size back.
+Operations that may reallocate or invalidate registered iterators are forwarded to the DynamicArray functions, pushes into free capacity take the inline fast path, which only advances the epoch of the array.
+Writes through the pointers returned by the typed functions don't advance the epoch.
+Arrays in copy-on-write mode never take the fast path for pushes, Name##Data, Name##End, Name##At and Name##Set copy a shared buffer through CSC_DynamicArrayData while Name##Get reads it directly.
+Name##Data and Name##End return NULL while removed slots are pending compaction through CSC_DynamicArrayCompact, Name##At, Name##Set and Name##Get locate the slot of the element through CSC_DynamicArrayAccessElement and CSC_DynamicArrayReadElement instead.
+Nested containers are not supported as element type since they can't be copied through assignment, they still require a regular CSC_DynamicArray.
+The type and the functions can also be generated separately through CSC_DECLARE_TYPED_ARRAY_TYPE and CSC_DECLARE_TYPED_ARRAY_FUNCTIONS.
+*/
+
+// Include the current configuration of the library containing various type definitions and other things.
+#include "../../Configuration/Configuration.h"
+// Include the DynamicArray as the generated types wrap it and forward the operations that may reallocate to it.
+#include "../DynamicArray/DynamicArray.h"
+
+// Definition of the macro that retrieves the buffer of a DynamicArray, which is the storage that directly follows the object for arrays that store their elements inline.
+#define CSC_TYPED_ARRAY_BUFFER(pArray) ((pArray)->pData ? (CSC_BYTE*)(pArray)->pData : ((pArray)->reservedSpace ? (CSC_BYTE*)(pArray) + sizeof(CSC_DynamicArray) : (CSC_BYTE*)NULL))
+
+// Definition of the macro that declares the typed array type Name holding elements of type T.
+#define CSC_DECLARE_TYPED_ARRAY_TYPE(Name, T) \
+	typedef struct _##Name \
+	{ \
+		CSC_DynamicArray array; \
+	} Name;
+
+// Definition of the macro that defines the functions of the typed array type Name holding elements of type T, the type must have been declared before.
+#define CSC_DECLARE_TYPED_ARRAY_FUNCTIONS(Name, T) \
+	CSC_INLINE CSC_STATUS CSCMETHOD Name##Initialize(_Out_ Name* CONST pThis, _In_ CONST CSC_IAllocator* CONST pIAllocator) \
+	{ \
+		return CSC_DynamicArrayInitialize((CSC_DynamicArray*)pThis, sizeof(T), pIAllocator, NULL); \
+	} \
+	\
+	CSC_INLINE CSC_STATUS CSCMETHOD Name##InitializeWithArray(_Out_ Name* CONST pThis, _In_ CONST T* CONST pFirst, _In_ CONST CSC_SIZE_T numOfElements, _In_ CONST CSC_IAllocator* CONST pIAllocator) \
+	{ \
+		return CSC_DynamicArrayInitializeWithArray((CSC_DynamicArray*)pThis, pFirst, numOfElements, sizeof(T), pIAllocator, NULL); \
+	} \
+	\
+	CSC_INLINE CSC_STATUS CSCMETHOD Name##InitializeWithCopy(_Out_ Name* CONST pThis, _In_ CONST Name* CONST pSrc) \
+	{ \
+		return CSC_DynamicArrayInitializeWithCopy((CSC_DynamicArray*)pThis, (CONST CSC_DynamicArray*)pSrc); \
+	} \
+	\
+	CSC_INLINE CSC_STATUS CSCMETHOD Name##Destroy(_Inout_ Name* CONST pThis) \
+	{ \
+		return CSC_DynamicArrayDestroy((CSC_DynamicArray*)pThis); \
+	} \
+	\
+	CSC_INLINE CSC_STATUS CSCMETHOD Name##Clear(_Inout_ Name* CONST pThis) \
+	{ \
+		return CSC_DynamicArrayClear((CSC_DynamicArray*)pThis); \
+	} \
+	\
+	CSC_INLINE CSC_STATUS CSCMETHOD Name##Reserve(_Inout_ Name* CONST pThis, _In_ CONST CSC_SIZE_T numOfElements) \
+	{ \
+		return CSC_DynamicArrayReserve((CSC_DynamicArray*)pThis, numOfElements); \
+	} \
+	\
+	CSC_INLINE CSC_STATUS CSCMETHOD Name##Resize(_Inout_ Name* CONST pThis, _In_ CONST CSC_SIZE_T numOfElements, _In_opt_ CONST T* CONST pDefaultValue) \
+	{ \
+		return CSC_DynamicArrayResize((CSC_DynamicArray*)pThis, numOfElements, pDefaultValue); \
+	} \
+	\
+	CSC_INLINE CSC_STATUS CSCMETHOD Name##Copy(_Inout_ Name* CONST pThis, _In_ CONST Name* CONST pSrc) \
+	{ \
+		return CSC_DynamicArrayCopy((CSC_DynamicArray*)pThis, (CONST CSC_DynamicArray*)pSrc); \
+	} \
+	\
+	CSC_INLINE CSC_STATUS CSCMETHOD Name##Move(_Inout_ Name* CONST pThis, _Inout_ Name* CONST pSrc) \
+	{ \
+		return CSC_DynamicArrayMove((CSC_DynamicArray*)pThis, (CSC_DynamicArray*)pSrc); \
+	} \
+	\
+	CSC_INLINE CSC_STATUS CSCMETHOD Name##PushValue(_Inout_ Name* CONST pThis, _In_ CONST T* CONST pValue) \
+	{ \
+		CSC_DynamicArray* CONST pArray = (CSC_DynamicArray*)pThis; \
+		\
+		if (!pArray->emplaceCount && !pArray->isCopyOnWrite && pArray->elementCount < pArray->reservedSpace) \
+		{ \
+			((T*)CSC_TYPED_ARRAY_BUFFER(pArray))[pArray->elementCount] = *pValue; \
+			++pArray->elementCount; \
+			++pArray->epoch; \
+			return CSC_STATUS_SUCCESS; \
+		} \
+		\
+		return CSC_DynamicArrayPushValue(pArray, pValue); \
+	} \
+	\
+	CSC_INLINE CSC_STATUS CSCMETHOD Name##Push(_Inout_ Name* CONST pThis, _In_ CONST T value) \
+	{ \
+		return Name##PushValue(pThis, &value); \
+	} \
+	\
+	CSC_INLINE CSC_STATUS CSCMETHOD Name##PopValue(_Inout_ Name* CONST pThis, _Out_opt_ T* CONST pValue) \
+	{ \
+		return CSC_DynamicArrayPopValue((CSC_DynamicArray*)pThis, pValue); \
+	} \
+	\
+	CSC_INLINE CSC_STATUS CSCMETHOD Name##InsertElement(_Inout_ Name* CONST pThis, _In_ CONST CSC_SIZE_T insertIndex, _In_ CONST T* CONST pValue) \
+	{ \
+		return CSC_DynamicArrayInsertElement((CSC_DynamicArray*)pThis, insertIndex, pValue); \
+	} \
+	\
+	CSC_INLINE CSC_STATUS CSCMETHOD Name##RemoveElement(_Inout_ Name* CONST pThis, _In_ CONST CSC_SIZE_T removeIndex) \
+	{ \
+		return CSC_DynamicArrayRemoveElement((CSC_DynamicArray*)pThis, removeIndex); \
+	} \
+	\
+	CSC_INLINE T* CSCMETHOD Name##Data(_In_ CONST Name* CONST pThis) \
+	{ \
+		if (pThis->array.isCopyOnWrite || pThis->array.tombstoneCount) \
+		{ \
+			return (T*)CSC_DynamicArrayData(&pThis->array); \
+		} \
+		\
+		return (T*)CSC_TYPED_ARRAY_BUFFER(&pThis->array); \
+	} \
+	\
+	CSC_INLINE T* CSCMETHOD Name##End(_In_ CONST Name* CONST pThis) \
+	{ \
+		T* CONST pData = Name##Data(pThis); \
+		\
+		if (!pData) \
+		{ \
+			return NULL; \
+		} \
+		\
+		return pData + pThis->array.elementCount; \
+	} \
+	\
+	CSC_INLINE T* CSCMETHOD Name##At(_In_ CONST Name* CONST pThis, _In_ CONST CSC_SIZE_T index) \
+	{ \
+		if (pThis->array.tombstoneCount) \
+		{ \
+			return (T*)CSC_DynamicArrayAccessElement(&pThis->array, index); \
+		} \
+		\
+		return Name##Data(pThis) + index; \
+	} \
+	\
+	CSC_INLINE T CSCMETHOD Name##Get(_In_ CONST Name* CONST pThis, _In_ CONST CSC_SIZE_T index) \
+	{ \
+		if (pThis->array.tombstoneCount) \
+		{ \
+			return *(CONST T*)CSC_DynamicArrayReadElement(&pThis->array, index); \
+		} \
+		\
+		return ((CONST T*)CSC_TYPED_ARRAY_BUFFER(&pThis->array))[index]; \
+	} \
+	\
+	CSC_INLINE void CSCMETHOD Name##Set(_Inout_ Name* CONST pThis, _In_ CONST CSC_SIZE_T index, _In_ CONST T value) \
+	{ \
+		*Name##At(pThis, index) = value; \
+	} \
+	\
+	CSC_INLINE CSC_SIZE_T CSCMETHOD Name##GetSize(_In_ CONST Name* CONST pThis) \
+	{ \
+		return pThis->array.elementCount - pThis->array.tombstoneCount; \
+	} \
+	\
+	CSC_INLINE CSC_SIZE_T CSCMETHOD Name##GetCapacity(_In_ CONST Name* CONST pThis) \
+	{ \
+		return pThis->array.reservedSpace; \
+	} \
+	\
+	CSC_INLINE CSC_DynamicArray* CSCMETHOD Name##GetDynamicArray(_In_ CONST Name* CONST pThis) \
+	{ \
+		return (CSC_DynamicArray*)&pThis->array; \
+	} \
+	\
+	CSC_INLINE Name* CSCMETHOD Name##FromDynamicArray(_In_ CONST CSC_DynamicArray* CONST pArray) \
+	{ \
+		if (!pArray || pArray->elementSize != sizeof(T) || pArray->pNestedContainerVTable) \
+		{ \
+			return NULL; \
+		} \
+		\
+		return (Name*)pArray; \
+	}
+
+// Definition of the macro that declares the typed array type Name holding elements of type T together with it's functions.
+#define CSC_DECLARE_TYPED_ARRAY(Name, T) \
+	CSC_DECLARE_TYPED_ARRAY_TYPE(Name, T) \
+	CSC_DECLARE_TYPED_ARRAY_FUNCTIONS(Name, T)
+
+#endif
\ No newline at end of file
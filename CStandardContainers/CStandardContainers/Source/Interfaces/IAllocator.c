@@ -62,6 +62,150 @@ CSC_STATUS CSCMETHOD CSC_IAllocatorFree(_In_ CONST CSC_IAllocator* CONST pThis,
 	}
 }
 
+CSC_STATUS CSCMETHOD CSC_IAllocatorFreeSized(_In_ CONST CSC_IAllocator* CONST pThis, _In_ CONST CSC_PVOID pMemoryBlock, _In_ CONST CSC_SIZE_T size)
+{
+	if (!size || !pMemoryBlock || !pThis || !pThis->pIAllocatorVirtualTable)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+	else if (pThis->pIAllocatorVirtualTable->pFreeSized)
+	{
+		return pThis->pIAllocatorVirtualTable->pFreeSized(pThis, pMemoryBlock, size);
+	}
+	else if (pThis->pIAllocatorVirtualTable->pFree)
+	{
+		return pThis->pIAllocatorVirtualTable->pFree(pThis, pMemoryBlock);
+	}
+	else
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+}
+
+CSC_STATUS CSCMETHOD CSC_IAllocatorAllocBatch(_In_ CONST CSC_IAllocator* CONST pThis, _In_ CONST CSC_SIZE_T size, _In_ CONST CSC_SIZE_T count, _Out_ CSC_PVOID* CONST ppMemoryBlocks)
+{
+	CSC_SIZE_T iterator;
+
+	if (!size || !count || !ppMemoryBlocks || !pThis || !pThis->pIAllocatorVirtualTable)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+	else if (pThis->pIAllocatorVirtualTable->pAllocBatch)
+	{
+		return pThis->pIAllocatorVirtualTable->pAllocBatch(pThis, size, count, ppMemoryBlocks);
+	}
+	else if (!pThis->pIAllocatorVirtualTable->pAlloc || !pThis->pIAllocatorVirtualTable->pFree)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	for (iterator = (CSC_SIZE_T)0; iterator < count; ++iterator)
+	{
+		ppMemoryBlocks[iterator] = pThis->pIAllocatorVirtualTable->pAlloc(pThis, size);
+
+		if (!ppMemoryBlocks[iterator])
+		{
+			// Release the blocks that were allocated so far, so that the caller doesn't have to deal with partial batches.
+			while (iterator)
+			{
+				--iterator;
+				pThis->pIAllocatorVirtualTable->pFree(pThis, ppMemoryBlocks[iterator]);
+				ppMemoryBlocks[iterator] = NULL;
+			}
+
+			return CSC_STATUS_MEMORY_NOT_ALLOCATED;
+		}
+	}
+
+	return CSC_STATUS_SUCCESS;
+}
+
+CSC_STATUS CSCMETHOD CSC_IAllocatorFreeBatch(_In_ CONST CSC_IAllocator* CONST pThis, _In_ CSC_PVOID* CONST ppMemoryBlocks, _In_ CONST CSC_SIZE_T count)
+{
+	CSC_STATUS status, firstStatus = CSC_STATUS_SUCCESS;
+	CSC_SIZE_T iterator;
+
+	if (!count || !ppMemoryBlocks || !pThis || !pThis->pIAllocatorVirtualTable)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+	else if (pThis->pIAllocatorVirtualTable->pFreeBatch)
+	{
+		return pThis->pIAllocatorVirtualTable->pFreeBatch(pThis, ppMemoryBlocks, count);
+	}
+	else if (!pThis->pIAllocatorVirtualTable->pFree)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	for (iterator = (CSC_SIZE_T)0; iterator < count; ++iterator)
+	{
+		if (!ppMemoryBlocks[iterator])
+		{
+			continue;
+		}
+
+		status = pThis->pIAllocatorVirtualTable->pFree(pThis, ppMemoryBlocks[iterator]);
+
+		if (status != CSC_STATUS_SUCCESS && firstStatus == CSC_STATUS_SUCCESS)
+		{
+			firstStatus = status;
+		}
+	}
+
+	return firstStatus;
+}
+
+CSC_STATUS CSCMETHOD CSC_IAllocatorFreeBatchSized(_In_ CONST CSC_IAllocator* CONST pThis, _In_ CSC_PVOID* CONST ppMemoryBlocks, _In_ CONST CSC_SIZE_T* CONST pSizes, _In_ CONST CSC_SIZE_T count)
+{
+	CSC_STATUS status, firstStatus = CSC_STATUS_SUCCESS;
+	CSC_SIZE_T iterator;
+
+	if (!count || !ppMemoryBlocks || !pSizes || !pThis || !pThis->pIAllocatorVirtualTable)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+	else if (pThis->pIAllocatorVirtualTable->pFreeBatch)
+	{
+		return pThis->pIAllocatorVirtualTable->pFreeBatch(pThis, ppMemoryBlocks, count);
+	}
+
+	for (iterator = (CSC_SIZE_T)0; iterator < count; ++iterator)
+	{
+		if (!ppMemoryBlocks[iterator])
+		{
+			continue;
+		}
+
+		status = CSC_IAllocatorFreeSized(pThis, ppMemoryBlocks[iterator], pSizes[iterator]);
+
+		if (status != CSC_STATUS_SUCCESS && firstStatus == CSC_STATUS_SUCCESS)
+		{
+			firstStatus = status;
+		}
+	}
+
+	return firstStatus;
+}
+
+CSC_SIZE_T CSCMETHOD CSC_IAllocatorGetUsableSize(_In_ CONST CSC_IAllocator* CONST pThis, _In_ CONST CSC_PCVOID pMemoryBlock, _In_ CONST CSC_SIZE_T size)
+{
+	CSC_SIZE_T usableSize;
+
+	if (!size || !pMemoryBlock || !pThis || !pThis->pIAllocatorVirtualTable)
+	{
+		return (CSC_SIZE_T)0;
+	}
+	else if (!pThis->pIAllocatorVirtualTable->pGetUsableSize)
+	{
+		return size;
+	}
+
+	usableSize = pThis->pIAllocatorVirtualTable->pGetUsableSize(pThis, pMemoryBlock);
+
+	return (usableSize < size) ? size : usableSize;
+}
+
 
 CSC_BOOLEAN CSCMETHOD CSC_IAllocatorIsUsable(_In_ CONST CSC_IAllocator* CONST pThis)
 {
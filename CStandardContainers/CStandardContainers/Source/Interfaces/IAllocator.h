@@ -7,6 +7,12 @@ The IAllocator interface must be implemented by allocators that are supposed to
 Most objects in the CSC library require an allocator, which will call into the generic methods of the interface.
 Hence all of the methods must be implemented, especially the AllocZero method, which is almost exclusively used for internal allocations.
 If such a primitive does not exist for a given allocator, it can be easily implemented through combining a basic allocation primitive with the MemoryUtilsZeroMemory function.
+The only optional methods are FreeSized, AllocBatch, FreeBatch and GetUsableSize.
+FreeSized receives the size that was requested for the block in addition to the block itself.
+Allocators that organize their blocks in size classes can use it to free a block without storing or looking up it's size, callers that know the size of a block should prefer it.
+GetUsableSize reports how many bytes of a block can actually be used, which is larger than the requested size if the allocator rounds requests up, callers like growing containers can use the slack instead of wasting it.
+AllocBatch and FreeBatch allocate or free many blocks at once, which allows pool allocators to serve a whole batch with a single bookkeeping step.
+If an allocator does not implement one of these methods, the function pointer in the virtual table should be a null pointer and the interface falls back to the regular methods.
 Implemented allocators are expected to allocate memory on at least 16-Bit alignment. 
 */
 
@@ -24,8 +30,14 @@ typedef CSC_PVOID(CSCMETHOD* CSC_P_I_ALLOCATOR_ALLOC)(_In_ CONST struct _CSC_IAl
 typedef CSC_PVOID(CSCMETHOD* CSC_P_I_ALLOCATOR_ALLOC_ZERO)(_In_ CONST struct _CSC_IAllocator* CONST pThis, _In_ CONST CSC_SIZE_T size);
 
 typedef CSC_STATUS(CSCMETHOD* CSC_P_I_ALLOCATOR_FREE)(_In_ CONST struct _CSC_IAllocator* CONST pThis, _In_ CONST CSC_PVOID pMemoryBlock);
+typedef CSC_STATUS(CSCMETHOD* CSC_P_I_ALLOCATOR_FREE_SIZED)(_In_ CONST struct _CSC_IAllocator* CONST pThis, _In_ CONST CSC_PVOID pMemoryBlock, _In_ CONST CSC_SIZE_T size);
 
-typedef CSC_STATUS(CSCMETHOD* CSC_P_I_ALLOCATOR_IS_USABLE)(_In_ CONST struct _CSC_IAllocator* CONST pThis);
+typedef CSC_STATUS(CSCMETHOD* CSC_P_I_ALLOCATOR_ALLOC_BATCH)(_In_ CONST struct _CSC_IAllocator* CONST pThis, _In_ CONST CSC_SIZE_T size, _In_ CONST CSC_SIZE_T count, _Out_ CSC_PVOID* CONST ppMemoryBlocks);
+typedef CSC_STATUS(CSCMETHOD* CSC_P_I_ALLOCATOR_FREE_BATCH)(_In_ CONST struct _CSC_IAllocator* CONST pThis, _In_ CSC_PVOID* CONST ppMemoryBlocks, _In_ CONST CSC_SIZE_T count);
+
+typedef CSC_SIZE_T(CSCMETHOD* CSC_P_I_ALLOCATOR_GET_USABLE_SIZE)(_In_ CONST struct _CSC_IAllocator* CONST pThis, _In_ CONST CSC_PCVOID pMemoryBlock);
+
+typedef CSC_BOOLEAN(CSCMETHOD* CSC_P_I_ALLOCATOR_IS_USABLE)(_In_ CONST struct _CSC_IAllocator* CONST pThis);
 
 // Definition of the virtual table layout of the IAllocator type.
 typedef struct _CSC_IAllocatorVirtualTable
@@ -36,6 +48,10 @@ typedef struct _CSC_IAllocatorVirtualTable
 	CSC_P_I_ALLOCATOR_ALLOC_ZERO pAllocZero;
 	CSC_P_I_ALLOCATOR_FREE pFree;
 	CSC_P_I_ALLOCATOR_IS_USABLE pIsUsable;
+	CSC_P_I_ALLOCATOR_FREE_SIZED pFreeSized;
+	CSC_P_I_ALLOCATOR_ALLOC_BATCH pAllocBatch;
+	CSC_P_I_ALLOCATOR_FREE_BATCH pFreeBatch;
+	CSC_P_I_ALLOCATOR_GET_USABLE_SIZE pGetUsableSize;
 } CSC_IAllocatorVirtualTable;
 
 // Definition of the IAllocator type, contains a pointer to the virtual table of the object that implements the interfaces methods.
@@ -61,6 +77,28 @@ CSC_PVOID CSCMETHOD CSC_IAllocatorAllocZero(_In_ CONST CSC_IAllocator* CONST pTh
 // Calls the underlying free method implemented by the allocator object to free a priorly allocated memory block.
 // Should return CSC_STATUS_SUCCESS on success, otherwise an error code is returned.
 CSC_STATUS CSCMETHOD CSC_IAllocatorFree(_In_ CONST CSC_IAllocator* CONST pThis, _In_ CONST CSC_PVOID pMemoryBlock);
+// Calls the underlying sized free method implemented by the allocator object to free a priorly allocated memory block of the given size.
+// The size must be at least the size that was passed to the allocation method and at most the usable size of the block, if the allocator doesn't implement the method the regular free method is called.
+// Should return CSC_STATUS_SUCCESS on success, otherwise an error code is returned.
+CSC_STATUS CSCMETHOD CSC_IAllocatorFreeSized(_In_ CONST CSC_IAllocator* CONST pThis, _In_ CONST CSC_PVOID pMemoryBlock, _In_ CONST CSC_SIZE_T size);
+
+// Calls the underlying batch allocation method implemented by the allocator object to allocate count blocks of the same size.
+// The pointers are stored in the supplied array, either all blocks are allocated or none, if the allocator doesn't implement the method the regular allocation method is called for every block.
+// Should return CSC_STATUS_SUCCESS on success, otherwise an error code is returned.
+CSC_STATUS CSCMETHOD CSC_IAllocatorAllocBatch(_In_ CONST CSC_IAllocator* CONST pThis, _In_ CONST CSC_SIZE_T size, _In_ CONST CSC_SIZE_T count, _Out_ CSC_PVOID* CONST ppMemoryBlocks);
+// Calls the underlying batch free method implemented by the allocator object to free count priorly allocated blocks, null pointers in the array are skipped.
+// If the allocator doesn't implement the method the regular free method is called for every block.
+// Should return CSC_STATUS_SUCCESS on success, otherwise the first error code that occurred is returned.
+CSC_STATUS CSCMETHOD CSC_IAllocatorFreeBatch(_In_ CONST CSC_IAllocator* CONST pThis, _In_ CSC_PVOID* CONST ppMemoryBlocks, _In_ CONST CSC_SIZE_T count);
+// Frees count priorly allocated blocks like CSC_IAllocatorFreeBatch, the sizes array holds the size of every block like the size passed to CSC_IAllocatorFreeSized.
+// If the allocator doesn't implement the batch free method the sized free method is called for every block, hence the sizes aren't lost.
+// Should return CSC_STATUS_SUCCESS on success, otherwise the first error code that occurred is returned.
+CSC_STATUS CSCMETHOD CSC_IAllocatorFreeBatchSized(_In_ CONST CSC_IAllocator* CONST pThis, _In_ CSC_PVOID* CONST ppMemoryBlocks, _In_ CONST CSC_SIZE_T* CONST pSizes, _In_ CONST CSC_SIZE_T count);
+
+// Calls the underlying method implemented by the allocator object to retrieve the usable size of a block, the size must be the size that was passed to the allocation method.
+// The whole usable size of the block may be used by the caller, if the allocator doesn't implement the method or the result is invalid the supplied size is returned.
+// Returns 0 if the parameters are invalid.
+CSC_SIZE_T CSCMETHOD CSC_IAllocatorGetUsableSize(_In_ CONST CSC_IAllocator* CONST pThis, _In_ CONST CSC_PCVOID pMemoryBlock, _In_ CONST CSC_SIZE_T size);
 
 // Calls the underlying method implemented by the allocator object to check if the allocator is in a usable state.
 // Should return true or false depending on the situation.
@@ -148,6 +148,18 @@ CSC_STATUS CSCMETHOD CSC_IContainerIsElementContainer(_In_ CONST CSC_IContainer*
 	}
 }
 
+CSC_STATUS CSCMETHOD CSC_IContainerIsTriviallyRelocatable(_In_ CONST CSC_IContainer* CONST pThis)
+{
+	if (!pThis || !pThis->pIContainerVirtualTable)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+	else
+	{
+		return (pThis->pIContainerVirtualTable->isTriviallyRelocatable) ? CSC_STATUS_SUCCESS : CSC_STATUS_GENERAL_FAILURE;
+	}
+}
+
 
 CSC_SIZE_T CSCMETHOD CSC_IContainerGetSize(_In_ CONST CSC_IContainer* CONST pThis)
 {
@@ -208,3 +220,28 @@ CSC_IContainerVirtualTable* CSCMETHOD CSC_IContainerGetNestedContainerVTable(_In
 		return pThis->pIContainerVirtualTable->pGetNestedContainerVTable(pThis);
 	}
 }
+
+
+CSC_STATUS CSCMETHOD CSC_IContainerSerialize(_In_ CONST CSC_IContainer* CONST pThis, _Inout_ CSC_SerializationWriter* CONST pWriter)
+{
+	if (!pWriter || !pThis || !pThis->pIContainerVirtualTable || !pThis->pIContainerVirtualTable->pSerialize)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+	else
+	{
+		return pThis->pIContainerVirtualTable->pSerialize(pThis, pWriter);
+	}
+}
+
+CSC_STATUS CSCMETHOD CSC_IContainerDeserialize(_Out_ CSC_IContainer* CONST pThis, _Inout_ CSC_SerializationReader* CONST pReader, _In_ CSC_IAllocator* CONST pIAllocator, _In_opt_ CSC_IContainerVirtualTable* CONST pNestedContainerVTable)
+{
+	if (!pReader || !pIAllocator || !pThis || !pThis->pIContainerVirtualTable || !pThis->pIContainerVirtualTable->pDeserialize)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+	else
+	{
+		return pThis->pIContainerVirtualTable->pDeserialize(pThis, pReader, pIAllocator, pNestedContainerVTable);
+	}
+}
\ No newline at end of file
@@ -14,6 +14,10 @@ As the interface only requires the elements container type to match, making sure
 On the other hand, this opens the possibility for using varying types for the element types of the underlying containers.
 However, this practice is highly discouraged and should only be utilized by experienced users.
 The initialization method is called through the virtual table pointer, which is passed to the initializer of the container when container nesting is used.
+Serialization works the same way: a container writes it's own layout and invokes the serialization method of the nested virtual table for every element container, deserialization initializes the element containers through the nested virtual table.
+Containers that can't be serialized leave both serialization methods as null pointers.
+Besides the methods the virtual table declares whether the container type is trivially relocatable, which means a container remains valid after it's bytes have been copied to another address and the old bytes are discarded.
+Outer containers rely on this to move their element containers with a single copy of their buffer on growth, insertion, removal and moves instead of invoking methods for every element, element containers of other types are moved one by one through their move method.
 */
 
 // Include the current configuration of the library containing various type definitions and other things.
@@ -22,6 +26,8 @@ The initialization method is called through the virtual table pointer, which is
 #include "IAllocator.h"
 // Include the string utilities which define the invalid string length, which is used to define the invalid length and index of containers and their elements.
 #include "../Utils/StringUtils.h"
+// Include the serialization utilities which provide the writers and readers passed to the serialization methods.
+#include "../Utils/SerializationUtils.h"
 
 #define CSC_CONTAINER_INVALID_LENGTH CSC_STRING_INVALID_LENGTH
 #define CSC_CONTAINER_INVALID_INDEX CSC_CONTAINER_INVALID_LENGTH
@@ -54,6 +60,9 @@ typedef CSC_SIZE_T(CSCMETHOD* CSC_P_I_CONTAINER_GET_MAX_ELEMENTS)(_In_ CONST str
 typedef CSC_IAllocator*(CSCMETHOD* CSC_P_I_CONTAINER_GET_I_ALLCATOR)(_In_ CONST struct _CSC_IContainer* CONST pThis);
 typedef struct _CSC_IContainerVirtualTable* (CSCMETHOD* CSC_P_I_CONTAINER_GET_NESTED_CONTAINER_VIRTUAL_TABLE)(_In_ CONST struct _CSC_IContainer* CONST pThis);
 
+typedef CSC_STATUS(CSCMETHOD* CSC_P_I_CONTAINER_SERIALIZE)(_In_ CONST struct _CSC_IContainer* CONST pThis, _Inout_ CSC_SerializationWriter* CONST pWriter);
+typedef CSC_STATUS(CSCMETHOD* CSC_P_I_CONTAINER_DESERIALIZE)(_Out_ struct _CSC_IContainer* CONST pThis, _Inout_ CSC_SerializationReader* CONST pReader, _In_ CSC_IAllocator* CONST pIAllocator, _In_opt_ struct _CSC_IContainerVirtualTable* CONST pNestedContainerVTable);
+
 // Definition of the virtual table layout of the IContainer type.
 typedef struct _CSC_IContainerVirtualTable
 {
@@ -74,6 +83,10 @@ typedef struct _CSC_IContainerVirtualTable
 	CSC_P_I_CONTAINER_GET_MAX_ELEMENTS pGetMaxElements;
 	CSC_P_I_CONTAINER_GET_I_ALLCATOR pGetIAllocator;
 	CSC_P_I_CONTAINER_GET_NESTED_CONTAINER_VIRTUAL_TABLE pGetNestedContainerVTable;
+	CSC_P_I_CONTAINER_SERIALIZE pSerialize;
+	CSC_P_I_CONTAINER_DESERIALIZE pDeserialize;
+	// Set if containers of the type hold no pointers into themselves and aren't referenced by other objects, virtual tables that omit the member are treated as not relocatable.
+	CSC_BOOLEAN isTriviallyRelocatable;
 } CSC_IContainerVirtualTable;
 
 // Definition of the IContainer type, contains a pointer to the virtual table of the object that implements the interfaces methods.
@@ -120,6 +133,9 @@ CSC_STATUS CSCMETHOD CSC_IContainerIsEmpty(_In_ CONST CSC_IContainer* CONST pThi
 // Calls the underlying method to check whether the elements contained by the container are containers themselves.
 CSC_STATUS CSCMETHOD CSC_IContainerIsElementContainer(_In_ CONST CSC_IContainer* CONST pThis);
 
+// Checks whether the virtual table of the container declares the type as trivially relocatable, in which case the container can be moved bytewise.
+CSC_STATUS CSCMETHOD CSC_IContainerIsTriviallyRelocatable(_In_ CONST CSC_IContainer* CONST pThis);
+
 // Calls the underlying method to get the number of elements that the container currently stores.
 CSC_SIZE_T CSCMETHOD CSC_IContainerGetSize(_In_ CONST CSC_IContainer* CONST pThis);
 // Calls the underlying method to get the size in bytes that a container element consumes.
@@ -132,4 +148,11 @@ CSC_IAllocator* CSCMETHOD CSC_IContainerGetIAllocator(_In_ CONST CSC_IContainer*
 // Will return a nullptr if the virtual table does not exist or if an error occurred while calling the method.
 CSC_IContainerVirtualTable* CSCMETHOD CSC_IContainerGetNestedContainerVTable(_In_ CONST struct _CSC_IContainer* CONST pThis);
 
+// Calls the underlying method to write the container including all of it's elements to the writer.
+// The data of the container is referenced by the writer, hence the container must not be modified until the writer has been flushed.
+CSC_STATUS CSCMETHOD CSC_IContainerSerialize(_In_ CONST CSC_IContainer* CONST pThis, _Inout_ CSC_SerializationWriter* CONST pWriter);
+// Calls the underlying method to initialize the container from the reader, like the initialization method it requires the virtual table pointer to be set.
+// The nested virtual table is used to deserialize the element containers and must be supplied if the container was serialized with element containers.
+CSC_STATUS CSCMETHOD CSC_IContainerDeserialize(_Out_ CSC_IContainer* CONST pThis, _Inout_ CSC_SerializationReader* CONST pReader, _In_ CSC_IAllocator* CONST pIAllocator, _In_opt_ CSC_IContainerVirtualTable* CONST pNestedContainerVTable);
+
 #endif
\ No newline at end of file
@@ -12,15 +12,15 @@ CSC_STATUS CSCMETHOD CSC_IIterableRegisterIterator(_Inout_ CSC_IIterable* CONST
 	}
 }
 
-CSC_STATUS CSCMETHOD CSC_IIterableUnregisterIterator(_Inout_ CSC_IIterable* CONST pThis)
+CSC_STATUS CSCMETHOD CSC_IIterableUnregisterIterator(_Inout_ CSC_IIterable* CONST pThis, _In_ CONST CSC_IIterator* CONST pIIterator)
 {
-	if (!pThis || !pThis->pIIterableVirtualTable || !pThis->pIIterableVirtualTable->pUnregisterIterator)
+	if (!pIIterator || !pThis || !pThis->pIIterableVirtualTable || !pThis->pIIterableVirtualTable->pUnregisterIterator)
 	{
 		return CSC_STATUS_INVALID_PARAMETER;
 	}
 	else
 	{
-		return pThis->pIIterableVirtualTable->pUnregisterIterator(pThis);
+		return pThis->pIIterableVirtualTable->pUnregisterIterator(pThis, pIIterator);
 	}
 }
 
@@ -97,3 +97,68 @@ CSC_SIZE_T CSCMETHOD CSC_IIterableGetElementCount(_In_ CONST CSC_IIterable* CONS
 		return pThis->pIIterableVirtualTable->pLastElement(pThis);
 	}
 }
+
+
+CSC_SIZE_T CSCMETHOD CSC_IIterableGetEpoch(_In_ CONST CSC_IIterable* CONST pThis)
+{
+	if (!pThis || !pThis->pIIterableVirtualTable || !pThis->pIIterableVirtualTable->pGetEpoch)
+	{
+		return (CSC_SIZE_T)0;
+	}
+	else
+	{
+		return pThis->pIIterableVirtualTable->pGetEpoch(pThis);
+	}
+}
+
+CSC_STATUS CSCMETHOD CSC_IIterableValidateIterator(_In_ CONST CSC_IIterable* CONST pThis, _Inout_ CSC_IIterator* CONST pIIterator)
+{
+	CSC_SIZE_T epoch;
+
+	if (!pThis || !pIIterator)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	epoch = CSC_IIterableGetEpoch(pThis);
+
+	if (pIIterator->epoch == epoch)
+	{
+		return CSC_STATUS_SUCCESS;
+	}
+
+	pIIterator->epoch = epoch;
+
+	return CSC_STATUS_GENERAL_FAILURE;
+}
+
+CSC_PCVOID CSCMETHOD CSC_IIterableGetContiguousChunk(_In_ CONST CSC_IIterable* CONST pThis, _In_ CONST CSC_SIZE_T startIndex, _Out_ CSC_SIZE_T* CONST pNumOfElements)
+{
+	CSC_PCVOID pElement;
+
+	if (!pNumOfElements)
+	{
+		return NULL;
+	}
+
+	*pNumOfElements = (CSC_SIZE_T)0;
+
+	if (!pThis || !pThis->pIIterableVirtualTable)
+	{
+		return NULL;
+	}
+
+	if (pThis->pIIterableVirtualTable->pGetContiguousChunk)
+	{
+		return pThis->pIIterableVirtualTable->pGetContiguousChunk(pThis, startIndex, pNumOfElements);
+	}
+
+	pElement = CSC_IIterableGetElementAt(pThis, startIndex, CSC_ITERATOR_INVALID_INDEX, NULL);
+
+	if (pElement)
+	{
+		*pNumOfElements = (CSC_SIZE_T)1;
+	}
+
+	return pElement;
+}
\ No newline at end of file
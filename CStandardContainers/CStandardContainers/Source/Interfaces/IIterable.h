@@ -6,6 +6,9 @@ Description:
 The IIterable interface must be implemented by all iterable objects in the CSC library that wish to be iterable through the IIterable interface.
 The interface is usually invoked by an object that supports the IIterator interface, hence arbitrary invocations are discouraged.
 Instead the dedicated methods of the objects that implement the IIterator interface should be used to traverse the IIterable object.
+Iterables can be observed by multiple iterators at once, every modification of the iterable advances it's epoch, which allows iterators to detect modifications lazily instead of being notified on each of them.
+Iterables that notify their iterators on every modification don't need to implement the epoch, in that case the epoch is reported as 0 and iterators never have to look up their current element again.
+Generic algorithms can read an iterable in chunks of contiguous elements, which they can process in tight loops instead of invoking a method for every element, contiguous containers hand out all of their elements as a single chunk.
 */
 
 // Include the current configuration of the library containing various type definitions and other things.
@@ -18,7 +21,7 @@ struct _CSC_IIterable;
 
 // Type definitions of the function pointer types of the IIterable interfaces methods, which need to be implemented by types that utilize the interface.
 typedef CSC_STATUS(CSCMETHOD* CSC_P_I_ITERABLE_REGISTER_ITERATOR)(_Inout_ struct _CSC_IIterable* CONST pThis, _In_ CONST CSC_IIterator* CONST pIIterator);
-typedef CSC_STATUS(CSCMETHOD* CSC_P_I_ITERABLE_UNREGISTER_ITERATOR)(_Inout_ struct _CSC_IIterable* CONST pThis);
+typedef CSC_STATUS(CSCMETHOD* CSC_P_I_ITERABLE_UNREGISTER_ITERATOR)(_Inout_ struct _CSC_IIterable* CONST pThis, _In_ CONST CSC_IIterator* CONST pIIterator);
 
 typedef CSC_PVOID(CSCMETHOD* CSC_P_I_ITERABLE_FIRST_ELEMENT)(_In_ CONST struct _CSC_IIterable* CONST pThis);
 typedef CSC_PVOID(CSCMETHOD* CSC_P_I_ITERABLE_NEXT_ELEMENT)(_In_ CONST struct _CSC_IIterable* CONST pThis, _In_ CSC_SIZE_T currentIndex, _In_ CSC_PVOID pCurrentElement);
@@ -27,6 +30,8 @@ typedef CSC_PVOID(CSCMETHOD* CSC_P_I_ITERABLE_PREVIOUS_ELEMENT)(_In_ CONST struc
 
 typedef CSC_PVOID(CSCMETHOD* CSC_P_I_ITERABLE_GET_ELEMENT_AT)(_In_ CONST struct _CSC_IIterable* CONST pThis, _In_ CONST CSC_SIZE_T index, _In_opt_ CONST CSC_SIZE_T currentIndex, _In_opt_ CONST CSC_PVOID pCurrentElement);
 typedef CSC_SIZE_T(CSCMETHOD* CSC_P_I_ITERABLE_GET_ELEMENT_COUNT)(_In_ CONST struct _CSC_IIterable* CONST pThis);
+typedef CSC_SIZE_T(CSCMETHOD* CSC_P_I_ITERABLE_GET_EPOCH)(_In_ CONST struct _CSC_IIterable* CONST pThis);
+typedef CSC_PCVOID(CSCMETHOD* CSC_P_I_ITERABLE_GET_CONTIGUOUS_CHUNK)(_In_ CONST struct _CSC_IIterable* CONST pThis, _In_ CONST CSC_SIZE_T startIndex, _Out_ CSC_SIZE_T* CONST pNumOfElements);
 
 // Definition of the virtual table layout of the IIterable type.
 typedef struct _CSC_IIterableVirtualTable
@@ -39,6 +44,8 @@ typedef struct _CSC_IIterableVirtualTable
 	CSC_P_I_ITERABLE_PREVIOUS_ELEMENT pPreviousElement;
 	CSC_P_I_ITERABLE_GET_ELEMENT_AT pGetElementAt;
 	CSC_P_I_ITERABLE_GET_ELEMENT_COUNT pGetElementCount;
+	CSC_P_I_ITERABLE_GET_EPOCH pGetEpoch;
+	CSC_P_I_ITERABLE_GET_CONTIGUOUS_CHUNK pGetContiguousChunk;
 } CSC_IIterableVirtualTable;
 
 // Definition of the IIterable type, contains a pointer to the virtual table of the object that implements the interfaces methods.
@@ -48,11 +55,13 @@ typedef struct _CSC_IIterable
 } CSC_IIterable;
 
 // Calls the underlying method on the IIterable to register an observing IIterator object, which is typically the object that invokes the method.
+// The iterator is linked into the list of iterators of the iterable and validated at the current epoch, it's links must be null pointers unless it's already registered with the iterable.
 // Should return CSC_STATUS_SUCCESS on success, otherwise an error code is returned.
 CSC_STATUS CSCMETHOD CSC_IIterableRegisterIterator(_Inout_ CSC_IIterable* CONST pThis, _In_ CONST CSC_IIterator* CONST pIIterator);
 // Calls the underlying method on the IIterable to unregister an observing IIterator object, which is typically the object that invokes the method.
+// The iterator is unlinked from the list of iterators of the iterable, other registered iterators remain registered.
 // Should return CSC_STATUS_SUCCESS on success, otherwise an error code is returned.
-CSC_STATUS CSCMETHOD CSC_IIterableUnregisterIterator(_Inout_ CSC_IIterable* CONST pThis);
+CSC_STATUS CSCMETHOD CSC_IIterableUnregisterIterator(_Inout_ CSC_IIterable* CONST pThis, _In_ CONST CSC_IIterator* CONST pIIterator);
 
 // Calls the underlying method on the IIterable to retrieve the first element of the IIterable object, typically is invoked by an IIterator object.
 // Should return a pointer to the requested element on success, otherwise a null pointer is returned.
@@ -77,5 +86,17 @@ CSC_PVOID CSCMETHOD CSC_IIterableGetElementAt(_In_ CONST CSC_IIterable* CONST pT
 // Calls the underlying method on the IIterable to retrieve the element count of the IIterable object, typically is invoked by an IIterator object.
 // On success the element count of the IIterable is returned, otherwise CSC_ITERATOR_INVALID_LENGTH is returned.
 CSC_SIZE_T CSCMETHOD CSC_IIterableGetElementCount(_In_ CONST CSC_IIterable* CONST pThis);
+// Calls the underlying method on the IIterable to retrieve the epoch of the IIterable object, which is advanced on every modification of the IIterable.
+// Iterables that don't implement the method report an epoch of 0.
+CSC_SIZE_T CSCMETHOD CSC_IIterableGetEpoch(_In_ CONST CSC_IIterable* CONST pThis);
+// Compares the epoch the iterator was validated at with the current epoch of the IIterable, which is an O(1) operation that doesn't notify the iterator.
+// If the epochs differ the iterator is validated at the current epoch, afterwards the iterator has to look up it's current element again by it's index.
+// Returns CSC_STATUS_SUCCESS if the iterable hasn't been modified since the iterator was validated, otherwise CSC_STATUS_GENERAL_FAILURE or an error code is returned.
+CSC_STATUS CSCMETHOD CSC_IIterableValidateIterator(_In_ CONST CSC_IIterable* CONST pThis, _Inout_ CSC_IIterator* CONST pIIterator);
+// Calls the underlying method on the IIterable to retrieve the longest run of contiguous elements that begins at the given index, the amount of elements of the run is stored in pNumOfElements.
+// Iterables that don't implement the method hand out a single element per chunk through their CSC_IIterableGetElementAt method.
+// The elements of the run may only be read, retrieving a chunk never modifies the IIterable.
+// Should return a pointer to the first element of the run on success, otherwise a null pointer is returned and the amount of elements is set to 0.
+CSC_PCVOID CSCMETHOD CSC_IIterableGetContiguousChunk(_In_ CONST CSC_IIterable* CONST pThis, _In_ CONST CSC_SIZE_T startIndex, _Out_ CSC_SIZE_T* CONST pNumOfElements);
 
 #endif
\ No newline at end of file
@@ -7,6 +7,10 @@ The IIterator interface must be implemented by all iterator objects that wish to
 The iterable uses the IIterator interface as a observer pattern, to notify the subscribed iterator objects on any updates that occurr during changes in the iterable.
 While the IIterator interface methods could be directly called on the iterator by an arbitrary caller, this use is discouraged unless there is a justified need for it.
 Instead it is encouraged to invoke the methods of the object implementing the IIterator interface to make changes to the iterator.
+An iterable can be observed by any number of iterators, it keeps them in an intrusive list through the links of the IIterator interface, hence registering an iterator never allocates.
+The links belong to the iterable the iterator is registered with, they must be null pointers before the iterator is registered and must not be changed by the iterator.
+Iterables may report insertions, removals and reallocations only by advancing their epoch instead of invoking the notification methods, the epoch the iterator was validated at is stored in the interface as well.
+Such iterators check the epoch through CSC_IIterableValidateIterator before they access their current element and look the element up again by it's index if the iterable has been modified in the meantime.
 */
 
 // Include the current configuration of the library containing various type definitions and other things.
@@ -38,10 +42,13 @@ typedef struct _CSC_IIteratorVirtualTable
 	CSC_P_I_ITERATOR_ON_DESTRUCTION pOnDestruction;
 } CSC_IIteratorVirtualTable;
 
-// Definition of the IIterator type, contains a pointer to the virtual table of the object that implements the interfaces methods.
+// Definition of the IIterator type, contains a pointer to the virtual table of the object that implements the interfaces methods, the links of the list of iterators of the iterable and the epoch of the iterable the iteration was last validated at.
 typedef struct _CSC_IIterator
 {
 	CSC_IIteratorVirtualTable* pIIteratorVirtualTable;
+	struct _CSC_IIterator* pNextIterator;
+	struct _CSC_IIterator* pPreviousIterator;
+	CSC_SIZE_T epoch;
 } CSC_IIterator;
 
 // Calls the underlying method to invalidate the iteration, if it is currently valid.
@@ -1,5 +1,13 @@
 #include "MemoryUtils.h"
 
+#if CSC_VECTOR_SUPPORTED == TRUE
+// Definition of the byte indices that reverse the order of the elements of 1, 2, 4 and 8 bytes within a vector.
+#define CSC_MEMORY_UTILS_REVERSE_BYTES 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0
+#define CSC_MEMORY_UTILS_REVERSE_WORDS 14, 15, 12, 13, 10, 11, 8, 9, 6, 7, 4, 5, 2, 3, 0, 1
+#define CSC_MEMORY_UTILS_REVERSE_DWORDS 12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3
+#define CSC_MEMORY_UTILS_REVERSE_QWORDS 8, 9, 10, 11, 12, 13, 14, 15, 0, 1, 2, 3, 4, 5, 6, 7
+#endif
+
 static CSC_STATUS CSCAPI CSC_MemoryUtilsMemMoveBasic(_When_(return == CSC_STATUS_SUCCESS, _Out_) CONST CSC_PVOID pDst, _In_ CONST CSC_PCVOID pSrc, _In_ CONST CSC_SIZE_T size)
 {
 	CSC_SIZE_T iterator;
@@ -999,6 +1007,205 @@ static CSC_STATUS CSCAPI CSC_MemoryUtilsCompareMemoryNonRecursive(_In_ CONST CSC
 
 #endif
 
+// Reverses arrays whose elements are one or two words by exchanging them from both ends, every loop only moves words of a single type, which allows the compiler to turn it into byte shuffles of vector registers.
+// Returns FALSE if the element size doesn't match a word type or the array is misaligned for it, in which case the elements are swapped in blocks.
+static CSC_BOOLEAN CSCAPI CSC_MemoryUtilsReverseWords(_Inout_ CONST CSC_PVOID pFirst, _In_ CONST CSC_SIZE_T elementSize, _In_ CONST CSC_SIZE_T elementCount)
+{
+	CSC_SIZE_T iterator;
+	CONST CSC_SIZE_T lastIndex = elementCount - (CSC_SIZE_T)1;
+
+#if CSC_MEMORY_UTILS_USE_UNALIGNED_ACCESS == FALSE
+
+	// Elements of two words only require the alignment of a single word.
+	if ((CSC_DATA_POINTER_TYPE)pFirst % ((elementSize > sizeof(CSC_SIZE_T)) ? (elementSize >> 1) : elementSize))
+	{
+		return (CSC_BOOLEAN)FALSE;
+	}
+
+#endif
+
+	if (elementSize == sizeof(CSC_BYTE))
+	{
+		CSC_BYTE* CONST pElements = (CSC_BYTE* CONST)pFirst;
+		CSC_BYTE value;
+
+		for (iterator = (CSC_SIZE_T)0; iterator < (elementCount >> 1); ++iterator)
+		{
+			value = pElements[iterator];
+			pElements[iterator] = pElements[lastIndex - iterator];
+			pElements[lastIndex - iterator] = value;
+		}
+
+		return (CSC_BOOLEAN)TRUE;
+	}
+
+#if CSC_MEMORY_UTILS_USE_SIZE_BASED_OPTIMIZATION == TRUE && CSC_DATA_BUS_WIDTH > CSC_DATA_BUS_WIDTH_8BIT
+
+	if (elementSize == sizeof(CSC_WORD))
+	{
+		CSC_WORD* CONST pElements = (CSC_WORD* CONST)pFirst;
+		CSC_WORD value;
+
+		for (iterator = (CSC_SIZE_T)0; iterator < (elementCount >> 1); ++iterator)
+		{
+			value = pElements[iterator];
+			pElements[iterator] = pElements[lastIndex - iterator];
+			pElements[lastIndex - iterator] = value;
+		}
+
+		return (CSC_BOOLEAN)TRUE;
+	}
+
+#if CSC_DATA_BUS_WIDTH > CSC_DATA_BUS_WIDTH_16BIT
+
+	if (elementSize == sizeof(CSC_DWORD))
+	{
+		CSC_DWORD* CONST pElements = (CSC_DWORD* CONST)pFirst;
+		CSC_DWORD value;
+
+		for (iterator = (CSC_SIZE_T)0; iterator < (elementCount >> 1); ++iterator)
+		{
+			value = pElements[iterator];
+			pElements[iterator] = pElements[lastIndex - iterator];
+			pElements[lastIndex - iterator] = value;
+		}
+
+		return (CSC_BOOLEAN)TRUE;
+	}
+
+#if CSC_DATA_BUS_WIDTH > CSC_DATA_BUS_WIDTH_32BIT
+
+	if (elementSize == sizeof(CSC_QWORD))
+	{
+		CSC_QWORD* CONST pElements = (CSC_QWORD* CONST)pFirst;
+		CSC_QWORD value;
+
+		for (iterator = (CSC_SIZE_T)0; iterator < (elementCount >> 1); ++iterator)
+		{
+			value = pElements[iterator];
+			pElements[iterator] = pElements[lastIndex - iterator];
+			pElements[lastIndex - iterator] = value;
+		}
+
+		return (CSC_BOOLEAN)TRUE;
+	}
+
+	// Elements of two words are exchanged as pairs, which keeps the order of the words within an element.
+	if (elementSize == (sizeof(CSC_QWORD) << 1))
+	{
+		CSC_QWORD* CONST pElements = (CSC_QWORD* CONST)pFirst;
+		CSC_QWORD lowValue;
+		CSC_QWORD highValue;
+
+		for (iterator = (CSC_SIZE_T)0; iterator < (elementCount >> 1); ++iterator)
+		{
+			lowValue = pElements[iterator << 1];
+			highValue = pElements[(iterator << 1) + (CSC_SIZE_T)1];
+			pElements[iterator << 1] = pElements[(lastIndex - iterator) << 1];
+			pElements[(iterator << 1) + (CSC_SIZE_T)1] = pElements[((lastIndex - iterator) << 1) + (CSC_SIZE_T)1];
+			pElements[(lastIndex - iterator) << 1] = lowValue;
+			pElements[((lastIndex - iterator) << 1) + (CSC_SIZE_T)1] = highValue;
+		}
+
+		return (CSC_BOOLEAN)TRUE;
+	}
+
+#endif
+#endif
+#endif
+
+	return (CSC_BOOLEAN)FALSE;
+}
+
+#if CSC_VECTOR_SUPPORTED == TRUE
+
+// Reverses the outer parts of arrays whose elements evenly divide a vector by exchanging vectors from both ends, the order of the elements within each vector is reversed by a single shuffle.
+// Returns the number of elements that were exchanged at each end, the remaining elements in the middle don't fill two vectors, 0 is returned for other element sizes.
+static CSC_SIZE_T CSCAPI CSC_MemoryUtilsReverseVectors(_Inout_ CONST CSC_PVOID pFirst, _In_ CONST CSC_SIZE_T elementSize, _In_ CONST CSC_SIZE_T elementCount)
+{
+	CSC_BYTE* pFront = (CSC_BYTE*)pFirst;
+	CSC_BYTE* pBack = (CSC_BYTE*)pFirst + elementCount * elementSize - CSC_VECTOR_SIZE;
+	CSC_VECTOR frontVector;
+	CSC_VECTOR backVector;
+
+	if (elementCount * elementSize < (CSC_VECTOR_SIZE << 1))
+	{
+		return (CSC_SIZE_T)0;
+	}
+
+	switch (elementSize)
+	{
+	case (CSC_SIZE_T)1:
+
+		for (; pFront + CSC_VECTOR_SIZE <= pBack; pFront += CSC_VECTOR_SIZE, pBack -= CSC_VECTOR_SIZE)
+		{
+			frontVector = CSC_VECTOR_LOAD(pFront);
+			backVector = CSC_VECTOR_LOAD(pBack);
+			CSC_VECTOR_STORE(pFront, CSC_VECTOR_SHUFFLE(backVector, CSC_MEMORY_UTILS_REVERSE_BYTES));
+			CSC_VECTOR_STORE(pBack, CSC_VECTOR_SHUFFLE(frontVector, CSC_MEMORY_UTILS_REVERSE_BYTES));
+		}
+
+		break;
+
+	case (CSC_SIZE_T)2:
+
+		for (; pFront + CSC_VECTOR_SIZE <= pBack; pFront += CSC_VECTOR_SIZE, pBack -= CSC_VECTOR_SIZE)
+		{
+			frontVector = CSC_VECTOR_LOAD(pFront);
+			backVector = CSC_VECTOR_LOAD(pBack);
+			CSC_VECTOR_STORE(pFront, CSC_VECTOR_SHUFFLE(backVector, CSC_MEMORY_UTILS_REVERSE_WORDS));
+			CSC_VECTOR_STORE(pBack, CSC_VECTOR_SHUFFLE(frontVector, CSC_MEMORY_UTILS_REVERSE_WORDS));
+		}
+
+		break;
+
+	case (CSC_SIZE_T)4:
+
+		for (; pFront + CSC_VECTOR_SIZE <= pBack; pFront += CSC_VECTOR_SIZE, pBack -= CSC_VECTOR_SIZE)
+		{
+			frontVector = CSC_VECTOR_LOAD(pFront);
+			backVector = CSC_VECTOR_LOAD(pBack);
+			CSC_VECTOR_STORE(pFront, CSC_VECTOR_SHUFFLE(backVector, CSC_MEMORY_UTILS_REVERSE_DWORDS));
+			CSC_VECTOR_STORE(pBack, CSC_VECTOR_SHUFFLE(frontVector, CSC_MEMORY_UTILS_REVERSE_DWORDS));
+		}
+
+		break;
+
+	case (CSC_SIZE_T)8:
+
+		for (; pFront + CSC_VECTOR_SIZE <= pBack; pFront += CSC_VECTOR_SIZE, pBack -= CSC_VECTOR_SIZE)
+		{
+			frontVector = CSC_VECTOR_LOAD(pFront);
+			backVector = CSC_VECTOR_LOAD(pBack);
+			CSC_VECTOR_STORE(pFront, CSC_VECTOR_SHUFFLE(backVector, CSC_MEMORY_UTILS_REVERSE_QWORDS));
+			CSC_VECTOR_STORE(pBack, CSC_VECTOR_SHUFFLE(frontVector, CSC_MEMORY_UTILS_REVERSE_QWORDS));
+		}
+
+		break;
+
+	// Elements of a whole vector are exchanged as they are.
+	case (CSC_SIZE_T)16:
+
+		for (; pFront + CSC_VECTOR_SIZE <= pBack; pFront += CSC_VECTOR_SIZE, pBack -= CSC_VECTOR_SIZE)
+		{
+			frontVector = CSC_VECTOR_LOAD(pFront);
+			backVector = CSC_VECTOR_LOAD(pBack);
+			CSC_VECTOR_STORE(pFront, backVector);
+			CSC_VECTOR_STORE(pBack, frontVector);
+		}
+
+		break;
+
+	default:
+
+		return (CSC_SIZE_T)0;
+	}
+
+	return (CSC_SIZE_T)(pFront - (CSC_BYTE*)pFirst) / elementSize;
+}
+
+#endif
+
 
 CSC_STATUS CSCAPI CSC_MemoryUtilsCopyMemory(_Out_ CONST CSC_PVOID pDst, _In_ CONST CSC_PCVOID pSrc, _In_ CONST CSC_SIZE_T size)
 {
@@ -1224,7 +1431,7 @@ CSC_STATUS CSCAPI CSC_MemoryUtilsSwapValuesHeap(_Inout_ CONST CSC_PVOID pFirst,
 
 	if (status != CSC_STATUS_SUCCESS)
 	{
-		CSC_IAllocatorFree(pIAllocator, pBuffer);
+		CSC_IAllocatorFreeSized(pIAllocator, pBuffer, size);
 		return status;
 	}
 
@@ -1232,13 +1439,13 @@ CSC_STATUS CSCAPI CSC_MemoryUtilsSwapValuesHeap(_Inout_ CONST CSC_PVOID pFirst,
 
 	if (status != CSC_STATUS_SUCCESS)
 	{
-		CSC_IAllocatorFree(pIAllocator, pBuffer);
+		CSC_IAllocatorFreeSized(pIAllocator, pBuffer, size);
 		return status;
 	}
 
 	status = CSC_MemoryUtilsCopyMemory(pSecond, pBuffer, size);
 
-	CSC_IAllocatorFree(pIAllocator, pBuffer);
+	CSC_IAllocatorFreeSized(pIAllocator, pBuffer, size);
 	return status;
 }
 
@@ -1310,3 +1517,60 @@ CSC_STATUS CSCAPI CSC_MemoryUtilsMoveValue(_Out_ CONST CSC_PVOID pDst, _Inout_ C
 
 	return CSC_MemoryUtilsSetZeroMemory(pDeletionBase, deletionSize);
 }
+
+
+CSC_STATUS CSCAPI CSC_MemoryUtilsReverseArray(_Inout_ CONST CSC_PVOID pFirst, _In_ CONST CSC_SIZE_T elementSize, _In_ CONST CSC_SIZE_T elementCount)
+{
+	CSC_STATUS status;
+	CSC_SIZE_T front;
+	CSC_SIZE_T back;
+	CSC_SIZE_T offset;
+	CSC_SIZE_T blockSize;
+#if CSC_VECTOR_SUPPORTED == TRUE
+	CSC_SIZE_T exchangedCount;
+#endif
+
+	if (!pFirst || !elementSize || !elementCount)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+#if CSC_VECTOR_SUPPORTED == TRUE
+
+	// The vector kernel reverses the outer parts of the array, the elements in the middle are reversed by the word loops.
+	exchangedCount = CSC_MemoryUtilsReverseVectors(pFirst, elementSize, elementCount);
+
+	if (exchangedCount)
+	{
+		if (elementCount == exchangedCount << 1)
+		{
+			return CSC_STATUS_SUCCESS;
+		}
+
+		return CSC_MemoryUtilsReverseArray((CSC_PVOID)((CSC_BYTE* CONST)pFirst + exchangedCount * elementSize), elementSize, elementCount - (exchangedCount << 1));
+	}
+
+#endif
+
+	if (CSC_MemoryUtilsReverseWords(pFirst, elementSize, elementCount))
+	{
+		return CSC_STATUS_SUCCESS;
+	}
+
+	// Other elements are swapped in blocks of up to 256 bytes through a stack based buffer, hence large elements don't require an allocation.
+	for (front = (CSC_SIZE_T)0, back = elementCount - (CSC_SIZE_T)1; front < back; ++front, --back)
+	{
+		for (offset = (CSC_SIZE_T)0; offset < elementSize; offset += blockSize)
+		{
+			blockSize = (elementSize - offset > (CSC_SIZE_T)0x100) ? (CSC_SIZE_T)0x100 : elementSize - offset;
+			status = CSC_MemoryUtilsSwapValues256((CSC_PVOID)((CSC_BYTE* CONST)pFirst + front * elementSize + offset), (CSC_PVOID)((CSC_BYTE* CONST)pFirst + back * elementSize + offset), blockSize);
+
+			if (status != CSC_STATUS_SUCCESS)
+			{
+				return status;
+			}
+		}
+	}
+
+	return CSC_STATUS_SUCCESS;
+}
\ No newline at end of file
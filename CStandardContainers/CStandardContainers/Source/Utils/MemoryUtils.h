@@ -74,5 +74,10 @@ CSC_STATUS CSCAPI CSC_MemoryUtilsSwapValues256(_Inout_ CONST CSC_PVOID pFirst, _
 // Overlapping move operations are supported by the function.
 // Returns CSC_STATUS_SUCCESS on success, otherwise an error code is returned.
 CSC_STATUS CSCAPI CSC_MemoryUtilsMoveValue(_Out_ CONST CSC_PVOID pDst, _Inout_ CONST CSC_PVOID pSrc, _In_ CONST CSC_SIZE_T size);
+// Helper function for reversing the order of the elements of an array in place.
+// Elements of 1, 2, 4, 8 and 16 bytes are exchanged as words from both ends in loops the compiler can turn into byte shuffles, when allowed by the configuration and the alignment of the array.
+// Elements of other sizes are swapped in blocks of up to 256 bytes through a stack based buffer, hence the function never allocates memory.
+// Returns CSC_STATUS_SUCCESS on success, otherwise an error code is returned.
+CSC_STATUS CSCAPI CSC_MemoryUtilsReverseArray(_Inout_ CONST CSC_PVOID pFirst, _In_ CONST CSC_SIZE_T elementSize, _In_ CONST CSC_SIZE_T elementCount);
 
 #endif
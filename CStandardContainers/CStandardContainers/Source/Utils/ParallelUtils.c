@@ -0,0 +1,523 @@
+#include "ParallelUtils.h"
+#include "MemoryUtils.h"
+
+#ifdef CSC_CONFIG_LINUX_NATIVE
+#include <pthread.h>
+#endif
+
+// Definition of the amount of bits the first chunk index of a queue range is shifted by, the end of the range is stored in the lower half.
+#define CSC_PARALLEL_UTILS_RANGE_SHIFT (sizeof(CSC_SIZE_T) << 2)
+// Definition of the mask of the lower half of a queue range, which is also the maximum amount of chunks.
+#define CSC_PARALLEL_UTILS_RANGE_MASK (((CSC_SIZE_T)1 << CSC_PARALLEL_UTILS_RANGE_SHIFT) - (CSC_SIZE_T)1)
+
+struct _CSC_ParallelUtilsTask;
+
+// Type definition of the function that processes all elements of a single chunk.
+typedef void(CSCMETHOD* CSC_P_PARALLEL_UTILS_RUN_CHUNK)(_In_ CONST struct _CSC_ParallelUtilsTask* CONST pTask, _In_ CONST CSC_SIZE_T chunkIndex);
+
+// Definition of the work that is split into chunks, the destination is either the destination array of a transformation or the partial results of a reduction.
+typedef struct _CSC_ParallelUtilsTask
+{
+	CSC_BYTE* pFirst;
+	CSC_BYTE* pDst;
+	CSC_SIZE_T elementSize;
+	CSC_SIZE_T dstElementSize;
+	CSC_SIZE_T numOfElements;
+	CSC_SIZE_T chunkSize;
+	CSC_SIZE_T numOfThreads;
+	CSC_P_PARALLEL_UTILS_RUN_CHUNK pRunChunk;
+	CSC_P_PARALLEL_UTILS_FOR_EACH pForEach;
+	CSC_P_PARALLEL_UTILS_TRANSFORM pTransform;
+	CSC_P_PARALLEL_UTILS_COMBINE pAccumulate;
+	CSC_PVOID pContext;
+} CSC_ParallelUtilsTask;
+
+#ifdef CSC_CONFIG_LINUX_NATIVE
+
+// Definition of the queue of a worker, which holds the first and the end index of the chunks it still has to process.
+// Every queue occupies a cache line of it's own, hence workers don't contend on the queues of their neighbours.
+typedef struct _CSC_ParallelUtilsQueue
+{
+	CSC_ATOMIC CSC_SIZE_T range;
+	CSC_BYTE padding[CSC_PARALLEL_UTILS_CACHE_LINE_SIZE - sizeof(CSC_SIZE_T)];
+} CSC_ParallelUtilsQueue;
+
+// Definition of the thread pool of a single call.
+typedef struct _CSC_ParallelUtilsPool
+{
+	CSC_ParallelUtilsQueue queues[CSC_PARALLEL_UTILS_MAX_THREADS];
+	CONST CSC_ParallelUtilsTask* pTask;
+	CSC_SIZE_T numOfWorkers;
+} CSC_ParallelUtilsPool;
+
+// Definition of the argument of a worker thread.
+typedef struct _CSC_ParallelUtilsWorker
+{
+	CSC_ParallelUtilsPool* pPool;
+	CSC_SIZE_T workerIndex;
+} CSC_ParallelUtilsWorker;
+
+// Definition of the persistent helper threads, which are created on demand and run the workers that are assigned to them.
+// The helpers serve one call at a time, which holds the job lock for it's whole duration, helper n runs the worker with index n.
+typedef struct _CSC_ParallelUtilsHelpers
+{
+	pthread_mutex_t jobLock;
+	pthread_mutex_t lock;
+	pthread_cond_t assignedCondition;
+	pthread_cond_t finishedCondition;
+	CSC_ParallelUtilsWorker* pAssignedWorkers[CSC_PARALLEL_UTILS_MAX_THREADS];
+	CSC_SIZE_T numOfHelpers;
+	CSC_SIZE_T numOfBusyHelpers;
+} CSC_ParallelUtilsHelpers;
+
+static CSC_ParallelUtilsHelpers g_ParallelUtilsHelpers =
+{
+	PTHREAD_MUTEX_INITIALIZER,
+	PTHREAD_MUTEX_INITIALIZER,
+	PTHREAD_COND_INITIALIZER,
+	PTHREAD_COND_INITIALIZER,
+	{ NULL },
+	(CSC_SIZE_T)0,
+	(CSC_SIZE_T)0
+};
+
+#endif
+
+
+// Retrieves the first index and the amount of elements of a chunk.
+static CSC_SIZE_T CSCAPI CSC_ParallelUtilsGetChunkRange(_In_ CONST CSC_ParallelUtilsTask* CONST pTask, _In_ CONST CSC_SIZE_T chunkIndex, _Out_ CSC_SIZE_T* CONST pFirstIndex)
+{
+	CONST CSC_SIZE_T firstIndex = chunkIndex * pTask->chunkSize;
+
+	*pFirstIndex = firstIndex;
+
+	return (pTask->numOfElements - firstIndex < pTask->chunkSize) ? pTask->numOfElements - firstIndex : pTask->chunkSize;
+}
+
+static void CSCMETHOD CSC_ParallelUtilsForEachChunk(_In_ CONST CSC_ParallelUtilsTask* CONST pTask, _In_ CONST CSC_SIZE_T chunkIndex)
+{
+	CSC_SIZE_T firstIndex;
+	CONST CSC_SIZE_T numOfElements = CSC_ParallelUtilsGetChunkRange(pTask, chunkIndex, &firstIndex);
+	CSC_BYTE* pElement = pTask->pFirst + firstIndex * pTask->elementSize;
+	CSC_SIZE_T iterator;
+
+	for (iterator = (CSC_SIZE_T)0; iterator < numOfElements; ++iterator)
+	{
+		pTask->pForEach(pElement, pTask->pContext);
+		pElement += pTask->elementSize;
+	}
+}
+
+static void CSCMETHOD CSC_ParallelUtilsTransformChunk(_In_ CONST CSC_ParallelUtilsTask* CONST pTask, _In_ CONST CSC_SIZE_T chunkIndex)
+{
+	CSC_SIZE_T firstIndex;
+	CONST CSC_SIZE_T numOfElements = CSC_ParallelUtilsGetChunkRange(pTask, chunkIndex, &firstIndex);
+	CONST CSC_BYTE* pSrc = pTask->pFirst + firstIndex * pTask->elementSize;
+	CSC_BYTE* pDst = pTask->pDst + firstIndex * pTask->dstElementSize;
+	CSC_SIZE_T iterator;
+
+	for (iterator = (CSC_SIZE_T)0; iterator < numOfElements; ++iterator)
+	{
+		pTask->pTransform(pDst, pSrc, pTask->pContext);
+		pSrc += pTask->elementSize;
+		pDst += pTask->dstElementSize;
+	}
+}
+
+static void CSCMETHOD CSC_ParallelUtilsReduceChunk(_In_ CONST CSC_ParallelUtilsTask* CONST pTask, _In_ CONST CSC_SIZE_T chunkIndex)
+{
+	CSC_SIZE_T firstIndex;
+	CONST CSC_SIZE_T numOfElements = CSC_ParallelUtilsGetChunkRange(pTask, chunkIndex, &firstIndex);
+	CONST CSC_BYTE* pElement = pTask->pFirst + firstIndex * pTask->elementSize;
+	CSC_BYTE* CONST pPartial = pTask->pDst + chunkIndex * pTask->dstElementSize;
+	CSC_SIZE_T iterator;
+
+	for (iterator = (CSC_SIZE_T)0; iterator < numOfElements; ++iterator)
+	{
+		pTask->pAccumulate(pPartial, pElement, pTask->pContext);
+		pElement += pTask->elementSize;
+	}
+}
+
+// Retrieves the amount of chunks the elements are split into and stores their size in the task, all elements form a single chunk if they are processed serially.
+// The chunks are aligned to the size of the elements that are written by the threads.
+static CSC_SIZE_T CSCAPI CSC_ParallelUtilsSplitChunks(_Inout_ CSC_ParallelUtilsTask* CONST pTask, _In_ CONST CSC_SIZE_T writtenElementSize, _In_ CONST CSC_SIZE_T grainSize)
+{
+	CSC_SIZE_T alignment;
+	CSC_SIZE_T chunkSize;
+
+	pTask->chunkSize = pTask->numOfElements;
+
+#ifdef CSC_CONFIG_LINUX_NATIVE
+	if (pTask->numOfThreads < (CSC_SIZE_T)2 || pTask->numOfElements < CSC_PARALLEL_UTILS_SERIAL_CUTOFF)
+#endif
+	{
+		return (CSC_SIZE_T)1;
+	}
+
+	// The chunk size is rounded up to the smallest amount of elements that spans a whole number of cache lines, which is derived from the lowest set bit of the element size.
+	alignment = writtenElementSize & ((CSC_SIZE_T)0 - writtenElementSize);
+	alignment = (alignment < CSC_PARALLEL_UTILS_CACHE_LINE_SIZE) ? CSC_PARALLEL_UTILS_CACHE_LINE_SIZE / alignment : (CSC_SIZE_T)1;
+	chunkSize = grainSize ? grainSize : CSC_PARALLEL_UTILS_DEFAULT_GRAIN_SIZE;
+
+	if (chunkSize >= pTask->numOfElements)
+	{
+		return (CSC_SIZE_T)1;
+	}
+
+	chunkSize += (alignment - chunkSize % alignment) % alignment;
+
+	// Both indices of a range must fit into half of a CSC_SIZE_T, hence huge arrays get larger chunks.
+	while ((pTask->numOfElements - (CSC_SIZE_T)1) / chunkSize >= CSC_PARALLEL_UTILS_RANGE_MASK)
+	{
+		chunkSize <<= 1;
+	}
+
+	if (chunkSize >= pTask->numOfElements)
+	{
+		return (CSC_SIZE_T)1;
+	}
+
+	pTask->chunkSize = chunkSize;
+
+	return (pTask->numOfElements - (CSC_SIZE_T)1) / chunkSize + (CSC_SIZE_T)1;
+}
+
+#ifdef CSC_CONFIG_LINUX_NATIVE
+
+// Moves the back half of the remaining chunks of another worker into the empty queue of the worker.
+// Returns FALSE if the queues of all other workers are empty.
+static CSC_BOOLEAN CSCAPI CSC_ParallelUtilsSteal(_Inout_ CSC_ParallelUtilsPool* CONST pPool, _In_ CONST CSC_SIZE_T workerIndex)
+{
+	CSC_ParallelUtilsQueue* pVictim;
+	CSC_SIZE_T range;
+	CSC_SIZE_T stolenCount;
+	CSC_SIZE_T offset;
+
+	for (offset = (CSC_SIZE_T)1; offset < pPool->numOfWorkers; ++offset)
+	{
+		pVictim = &pPool->queues[(workerIndex + offset) % pPool->numOfWorkers];
+		range = CSC_ATOMIC_LOAD(&pVictim->range);
+
+		// Every chunk is only ever part of a single non empty range, hence a non empty range never reappears and the exchange is not subject to the ABA problem.
+		while ((range >> CSC_PARALLEL_UTILS_RANGE_SHIFT) < (range & CSC_PARALLEL_UTILS_RANGE_MASK))
+		{
+			stolenCount = ((range & CSC_PARALLEL_UTILS_RANGE_MASK) - (range >> CSC_PARALLEL_UTILS_RANGE_SHIFT) + (CSC_SIZE_T)1) >> 1;
+
+			if (CSC_ATOMIC_COMPARE_EXCHANGE(&pVictim->range, &range, range - stolenCount))
+			{
+				CSC_ATOMIC_STORE(&pPool->queues[workerIndex].range, (((range & CSC_PARALLEL_UTILS_RANGE_MASK) - stolenCount) << CSC_PARALLEL_UTILS_RANGE_SHIFT) | (range & CSC_PARALLEL_UTILS_RANGE_MASK));
+				return (CSC_BOOLEAN)TRUE;
+			}
+		}
+	}
+
+	return (CSC_BOOLEAN)FALSE;
+}
+
+// Processes the chunks of the queue of the worker from the front and steals chunks from other workers once it is empty.
+static void CSCAPI CSC_ParallelUtilsWork(_In_ CONST CSC_ParallelUtilsWorker* CONST pWorker)
+{
+	CSC_ParallelUtilsPool* CONST pPool = pWorker->pPool;
+	CSC_ParallelUtilsQueue* CONST pQueue = &pPool->queues[pWorker->workerIndex];
+	CSC_SIZE_T range;
+
+	do
+	{
+		range = CSC_ATOMIC_LOAD(&pQueue->range);
+
+		while ((range >> CSC_PARALLEL_UTILS_RANGE_SHIFT) < (range & CSC_PARALLEL_UTILS_RANGE_MASK))
+		{
+			if (CSC_ATOMIC_COMPARE_EXCHANGE(&pQueue->range, &range, range + ((CSC_SIZE_T)1 << CSC_PARALLEL_UTILS_RANGE_SHIFT)))
+			{
+				pPool->pTask->pRunChunk(pPool->pTask, range >> CSC_PARALLEL_UTILS_RANGE_SHIFT);
+				range = CSC_ATOMIC_LOAD(&pQueue->range);
+			}
+		}
+	} while (CSC_ParallelUtilsSteal(pPool, pWorker->workerIndex));
+}
+
+static void* CSC_ParallelUtilsWorkerThread(void* pWorker)
+{
+	CSC_ParallelUtilsWork((CONST CSC_ParallelUtilsWorker*)pWorker);
+	return NULL;
+}
+
+// Waits for workers that are assigned to the helper and runs them, helpers are never terminated.
+static void* CSC_ParallelUtilsHelperThread(void* pHelperIndex)
+{
+	CSC_ParallelUtilsHelpers* CONST pHelpers = &g_ParallelUtilsHelpers;
+	CONST CSC_SIZE_T helperIndex = (CSC_SIZE_T)(CSC_DATA_POINTER_TYPE)pHelperIndex;
+	CSC_ParallelUtilsWorker* pWorker;
+
+	pthread_mutex_lock(&pHelpers->lock);
+
+	for (;;)
+	{
+		while (!pHelpers->pAssignedWorkers[helperIndex])
+		{
+			pthread_cond_wait(&pHelpers->assignedCondition, &pHelpers->lock);
+		}
+
+		pWorker = pHelpers->pAssignedWorkers[helperIndex];
+		pthread_mutex_unlock(&pHelpers->lock);
+
+		CSC_ParallelUtilsWork(pWorker);
+
+		pthread_mutex_lock(&pHelpers->lock);
+		pHelpers->pAssignedWorkers[helperIndex] = NULL;
+
+		if (!--pHelpers->numOfBusyHelpers)
+		{
+			pthread_cond_signal(&pHelpers->finishedCondition);
+		}
+	}
+
+	return NULL;
+}
+
+// Runs the workers on threads that are created for this call only, which is used if the helpers are serving another call.
+static void CSCAPI CSC_ParallelUtilsRunThreads(_In_ CONST CSC_ParallelUtilsPool* CONST pPool, _In_ CSC_ParallelUtilsWorker* CONST pWorkers)
+{
+	pthread_t threads[CSC_PARALLEL_UTILS_MAX_THREADS];
+	CSC_BOOLEAN isStarted[CSC_PARALLEL_UTILS_MAX_THREADS];
+	CSC_SIZE_T iterator;
+
+	for (iterator = (CSC_SIZE_T)1; iterator < pPool->numOfWorkers; ++iterator)
+	{
+		isStarted[iterator] = (pthread_create(&threads[iterator], NULL, CSC_ParallelUtilsWorkerThread, &pWorkers[iterator]) == 0) ? (CSC_BOOLEAN)TRUE : (CSC_BOOLEAN)FALSE;
+	}
+
+	CSC_ParallelUtilsWork(&pWorkers[0]);
+
+	for (iterator = (CSC_SIZE_T)1; iterator < pPool->numOfWorkers; ++iterator)
+	{
+		if (isStarted[iterator])
+		{
+			pthread_join(threads[iterator], NULL);
+		}
+	}
+}
+
+// Runs the workers on the persistent helpers, which are created once they are needed for the first time, hence repeated calls only pay for waking them up.
+// Calls that find the helpers serving another call, like calls from within a callback or concurrent calls, create threads of their own.
+static void CSCAPI CSC_ParallelUtilsRunHelpers(_In_ CONST CSC_ParallelUtilsPool* CONST pPool, _In_ CSC_ParallelUtilsWorker* CONST pWorkers)
+{
+	CSC_ParallelUtilsHelpers* CONST pHelpers = &g_ParallelUtilsHelpers;
+	pthread_t thread;
+	CSC_SIZE_T iterator;
+
+	if (pthread_mutex_trylock(&pHelpers->jobLock))
+	{
+		CSC_ParallelUtilsRunThreads(pPool, pWorkers);
+		return;
+	}
+
+	pthread_mutex_lock(&pHelpers->lock);
+
+	while (pHelpers->numOfHelpers + (CSC_SIZE_T)1 < pPool->numOfWorkers && !pthread_create(&thread, NULL, CSC_ParallelUtilsHelperThread, (CSC_PVOID)(CSC_DATA_POINTER_TYPE)(pHelpers->numOfHelpers + (CSC_SIZE_T)1)))
+	{
+		pthread_detach(thread);
+		++pHelpers->numOfHelpers;
+	}
+
+	for (iterator = (CSC_SIZE_T)1; iterator < pPool->numOfWorkers && iterator <= pHelpers->numOfHelpers; ++iterator)
+	{
+		pHelpers->pAssignedWorkers[iterator] = &pWorkers[iterator];
+		++pHelpers->numOfBusyHelpers;
+	}
+
+	pthread_cond_broadcast(&pHelpers->assignedCondition);
+	pthread_mutex_unlock(&pHelpers->lock);
+
+	CSC_ParallelUtilsWork(&pWorkers[0]);
+
+	pthread_mutex_lock(&pHelpers->lock);
+
+	while (pHelpers->numOfBusyHelpers)
+	{
+		pthread_cond_wait(&pHelpers->finishedCondition, &pHelpers->lock);
+	}
+
+	pthread_mutex_unlock(&pHelpers->lock);
+	pthread_mutex_unlock(&pHelpers->jobLock);
+}
+
+// Distributes the chunks evenly across the queues of up to numOfThreads workers and runs the workers until all chunks are processed, the first worker runs on the calling thread.
+// Chunks of workers whose thread couldn't be created are stolen by the other workers.
+static void CSCAPI CSC_ParallelUtilsRunPool(_In_ CONST CSC_ParallelUtilsTask* CONST pTask, _In_ CONST CSC_SIZE_T numOfChunks)
+{
+	CSC_ParallelUtilsPool pool;
+	CSC_ParallelUtilsWorker workers[CSC_PARALLEL_UTILS_MAX_THREADS];
+	CSC_SIZE_T firstChunk;
+	CSC_SIZE_T lastChunk;
+	CSC_SIZE_T iterator;
+
+	pool.pTask = pTask;
+	pool.numOfWorkers = (pTask->numOfThreads < numOfChunks) ? pTask->numOfThreads : numOfChunks;
+
+	if (pool.numOfWorkers > CSC_PARALLEL_UTILS_MAX_THREADS)
+	{
+		pool.numOfWorkers = CSC_PARALLEL_UTILS_MAX_THREADS;
+	}
+
+	for (iterator = (CSC_SIZE_T)0; iterator < pool.numOfWorkers; ++iterator)
+	{
+		firstChunk = numOfChunks / pool.numOfWorkers * iterator + ((numOfChunks % pool.numOfWorkers) * iterator) / pool.numOfWorkers;
+		lastChunk = numOfChunks / pool.numOfWorkers * (iterator + (CSC_SIZE_T)1) + ((numOfChunks % pool.numOfWorkers) * (iterator + (CSC_SIZE_T)1)) / pool.numOfWorkers;
+		pool.queues[iterator].range = (firstChunk << CSC_PARALLEL_UTILS_RANGE_SHIFT) | lastChunk;
+		workers[iterator].pPool = &pool;
+		workers[iterator].workerIndex = iterator;
+	}
+
+	CSC_ParallelUtilsRunHelpers(&pool, workers);
+}
+
+#endif
+
+// Processes all chunks of the task, on the thread pool if there is more than one chunk.
+static void CSCAPI CSC_ParallelUtilsRun(_In_ CONST CSC_ParallelUtilsTask* CONST pTask, _In_ CONST CSC_SIZE_T numOfChunks)
+{
+	CSC_SIZE_T iterator;
+
+#ifdef CSC_CONFIG_LINUX_NATIVE
+	if (numOfChunks > (CSC_SIZE_T)1)
+	{
+		CSC_ParallelUtilsRunPool(pTask, numOfChunks);
+		return;
+	}
+#endif
+
+	for (iterator = (CSC_SIZE_T)0; iterator < numOfChunks; ++iterator)
+	{
+		pTask->pRunChunk(pTask, iterator);
+	}
+}
+
+
+CSC_STATUS CSCAPI CSC_ParallelUtilsForEach(_Inout_ CONST CSC_PVOID pFirst, _In_ CONST CSC_SIZE_T numOfElements, _In_ CONST CSC_SIZE_T elementSize, _In_ CONST CSC_P_PARALLEL_UTILS_FOR_EACH pForEach, _In_opt_ CONST CSC_PVOID pContext, _In_ CONST CSC_SIZE_T numOfThreads, _In_ CONST CSC_SIZE_T grainSize)
+{
+	CSC_ParallelUtilsTask task;
+
+	if ((!pFirst && numOfElements) || !elementSize || !pForEach || !numOfThreads || numOfElements > (CSC_SIZE_T)-1 / elementSize)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	if (!numOfElements)
+	{
+		return CSC_STATUS_SUCCESS;
+	}
+
+	CSC_MemoryUtilsSetZeroMemory(&task, sizeof(task));
+	task.pFirst = (CSC_BYTE*)pFirst;
+	task.elementSize = elementSize;
+	task.numOfElements = numOfElements;
+	task.numOfThreads = numOfThreads;
+	task.pRunChunk = CSC_ParallelUtilsForEachChunk;
+	task.pForEach = pForEach;
+	task.pContext = pContext;
+
+	CSC_ParallelUtilsRun(&task, CSC_ParallelUtilsSplitChunks(&task, elementSize, grainSize));
+
+	return CSC_STATUS_SUCCESS;
+}
+
+CSC_STATUS CSCAPI CSC_ParallelUtilsTransform(_Out_ CONST CSC_PVOID pDst, _In_ CONST CSC_SIZE_T dstElementSize, _In_ CONST CSC_PCVOID pSrc, _In_ CONST CSC_SIZE_T srcElementSize, _In_ CONST CSC_SIZE_T numOfElements, _In_ CONST CSC_P_PARALLEL_UTILS_TRANSFORM pTransform, _In_opt_ CONST CSC_PVOID pContext, _In_ CONST CSC_SIZE_T numOfThreads, _In_ CONST CSC_SIZE_T grainSize)
+{
+	CSC_ParallelUtilsTask task;
+
+	if (((!pDst || !pSrc) && numOfElements) || !dstElementSize || !srcElementSize || !pTransform || !numOfThreads)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	if (numOfElements > (CSC_SIZE_T)-1 / dstElementSize || numOfElements > (CSC_SIZE_T)-1 / srcElementSize)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	if (!numOfElements)
+	{
+		return CSC_STATUS_SUCCESS;
+	}
+
+	CSC_MemoryUtilsSetZeroMemory(&task, sizeof(task));
+	task.pFirst = (CSC_BYTE*)pSrc;
+	task.pDst = (CSC_BYTE*)pDst;
+	task.elementSize = srcElementSize;
+	task.dstElementSize = dstElementSize;
+	task.numOfElements = numOfElements;
+	task.numOfThreads = numOfThreads;
+	task.pRunChunk = CSC_ParallelUtilsTransformChunk;
+	task.pTransform = pTransform;
+	task.pContext = pContext;
+
+	CSC_ParallelUtilsRun(&task, CSC_ParallelUtilsSplitChunks(&task, dstElementSize, grainSize));
+
+	return CSC_STATUS_SUCCESS;
+}
+
+CSC_STATUS CSCAPI CSC_ParallelUtilsReduce(_In_ CONST CSC_PCVOID pFirst, _In_ CONST CSC_SIZE_T numOfElements, _In_ CONST CSC_SIZE_T elementSize, _In_ CONST CSC_P_PARALLEL_UTILS_COMBINE pAccumulate, _In_opt_ CONST CSC_P_PARALLEL_UTILS_COMBINE pCombine, _In_opt_ CONST CSC_PVOID pContext, _Inout_ CONST CSC_PVOID pResult, _In_ CONST CSC_SIZE_T resultSize, _In_ CONST CSC_SIZE_T numOfThreads, _In_ CONST CSC_SIZE_T grainSize, _In_ CONST CSC_IAllocator* CONST pIAllocator)
+{
+	CSC_ParallelUtilsTask task;
+	CSC_SIZE_T numOfChunks;
+	CSC_SIZE_T iterator;
+
+	if ((!pFirst && numOfElements) || !elementSize || !pAccumulate || !pResult || !resultSize || !numOfThreads || !pIAllocator || numOfElements > (CSC_SIZE_T)-1 / elementSize)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	if (!numOfElements)
+	{
+		return CSC_STATUS_SUCCESS;
+	}
+
+	CSC_MemoryUtilsSetZeroMemory(&task, sizeof(task));
+	task.pFirst = (CSC_BYTE*)pFirst;
+	task.pDst = (CSC_BYTE*)pResult;
+	task.elementSize = elementSize;
+	task.dstElementSize = resultSize;
+	task.numOfElements = numOfElements;
+	task.numOfThreads = numOfThreads;
+	task.pRunChunk = CSC_ParallelUtilsReduceChunk;
+	task.pAccumulate = pAccumulate;
+	task.pContext = pContext;
+
+	// Every chunk only writes it's own partial result, hence the chunks are aligned to the element size.
+	numOfChunks = CSC_ParallelUtilsSplitChunks(&task, elementSize, grainSize);
+
+	// A single chunk is accumulated directly into the result.
+	if (numOfChunks == (CSC_SIZE_T)1)
+	{
+		CSC_ParallelUtilsReduceChunk(&task, (CSC_SIZE_T)0);
+		return CSC_STATUS_SUCCESS;
+	}
+
+	if (numOfChunks > (CSC_SIZE_T)-1 / resultSize)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	task.pDst = (CSC_BYTE*)CSC_IAllocatorAlloc(pIAllocator, numOfChunks * resultSize);
+
+	if (!task.pDst)
+	{
+		return CSC_STATUS_MEMORY_NOT_ALLOCATED;
+	}
+
+	for (iterator = (CSC_SIZE_T)0; iterator < numOfChunks; ++iterator)
+	{
+		CSC_MemoryUtilsCopyMemory(task.pDst + iterator * resultSize, pResult, resultSize);
+	}
+
+	CSC_ParallelUtilsRun(&task, numOfChunks);
+
+	for (iterator = (CSC_SIZE_T)0; iterator < numOfChunks; ++iterator)
+	{
+		(pCombine ? pCombine : pAccumulate)(pResult, task.pDst + iterator * resultSize, pContext);
+	}
+
+	return CSC_IAllocatorFreeSized(pIAllocator, task.pDst, numOfChunks * resultSize);
+}
\ No newline at end of file
@@ -0,0 +1,51 @@
+#ifndef CSC_PARALLEL_UTILS
+#define CSC_PARALLEL_UTILS
+
+/*
+Description:
+The ParallelUtils apply a function to every element of a contiguous array of elements with an arbitrary size, split across multiple threads.
+The array is split into chunks of at least grainSize elements, the size of every chunk is rounded up to a multiple of CSC_PARALLEL_UTILS_CACHE_LINE_SIZE bytes whenever the element size allows it, hence threads never write to the same cache line of an array that starts on a cache line boundary.
+The chunks are distributed evenly across the queues of the workers of an internal thread pool, a worker that runs out of chunks steals half of the remaining chunks of another worker, which balances chunks of uneven cost without any locks.
+The calling thread is one of the workers, the others run on helper threads that are created on first use and kept for later calls, hence a call only pays for waking the helpers up.
+The helpers serve one call at a time, calls that find them busy, like calls from within a callback or concurrent calls, create threads of their own for the duration of the call.
+Chunks of workers whose thread couldn't be created are stolen by the other workers.
+Arrays of less than CSC_PARALLEL_UTILS_SERIAL_CUTOFF elements and arrays that fit into a single chunk are processed on the calling thread without creating any threads.
+Reductions accumulate every chunk into a partial result of it's own and combine the partial results in the order of the chunks afterwards, hence the combiner only has to be associative, not commutative.
+All callbacks are invoked concurrently and must be thread safe, every element is passed to exactly one invocation.
+Threads are only available in the Linux native configuration, in every other configuration all functions run serially on the calling thread.
+*/
+
+// Include the current configuration of the library containing various type definitions and other things.
+#include "../Configuration/Configuration.h"
+// Include the IAllocator interface as reductions require dynamic memory allocation for their partial results.
+#include "../Interfaces/IAllocator.h"
+
+// Definition of the cache line size that the chunks are aligned to.
+#define CSC_PARALLEL_UTILS_CACHE_LINE_SIZE (CSC_SIZE_T)0x40
+// Definition of the amount of elements per chunk if no grain size is supplied.
+#define CSC_PARALLEL_UTILS_DEFAULT_GRAIN_SIZE (CSC_SIZE_T)0x1000
+// Definition of the amount of elements below which the functions don't create any threads.
+#define CSC_PARALLEL_UTILS_SERIAL_CUTOFF (CSC_SIZE_T)0x4000
+// Definition of the maximum amount of threads a single call uses.
+#define CSC_PARALLEL_UTILS_MAX_THREADS (CSC_SIZE_T)0x40
+
+// Type definition of the function that is applied to every element.
+typedef void(CSCMETHOD* CSC_P_PARALLEL_UTILS_FOR_EACH)(_Inout_ CONST CSC_PVOID pElement, _In_opt_ CONST CSC_PVOID pContext);
+// Type definition of the function that writes the transformed source element to the destination element.
+typedef void(CSCMETHOD* CSC_P_PARALLEL_UTILS_TRANSFORM)(_Out_ CONST CSC_PVOID pDst, _In_ CONST CSC_PCVOID pSrc, _In_opt_ CONST CSC_PVOID pContext);
+// Type definition of the function that combines a value with an accumulator, which is used both for accumulating elements and for combining partial results.
+typedef void(CSCMETHOD* CSC_P_PARALLEL_UTILS_COMBINE)(_Inout_ CONST CSC_PVOID pAccumulator, _In_ CONST CSC_PCVOID pValue, _In_opt_ CONST CSC_PVOID pContext);
+
+// Applies the function to every element, a grain size of 0 selects CSC_PARALLEL_UTILS_DEFAULT_GRAIN_SIZE.
+// Returns CSC_STATUS_SUCCESS on success, otherwise an error code is returned.
+CSC_STATUS CSCAPI CSC_ParallelUtilsForEach(_Inout_ CONST CSC_PVOID pFirst, _In_ CONST CSC_SIZE_T numOfElements, _In_ CONST CSC_SIZE_T elementSize, _In_ CONST CSC_P_PARALLEL_UTILS_FOR_EACH pForEach, _In_opt_ CONST CSC_PVOID pContext, _In_ CONST CSC_SIZE_T numOfThreads, _In_ CONST CSC_SIZE_T grainSize);
+// Transforms every source element into the destination element of the same index, both arrays must not overlap.
+// Returns CSC_STATUS_SUCCESS on success, otherwise an error code is returned.
+CSC_STATUS CSCAPI CSC_ParallelUtilsTransform(_Out_ CONST CSC_PVOID pDst, _In_ CONST CSC_SIZE_T dstElementSize, _In_ CONST CSC_PCVOID pSrc, _In_ CONST CSC_SIZE_T srcElementSize, _In_ CONST CSC_SIZE_T numOfElements, _In_ CONST CSC_P_PARALLEL_UTILS_TRANSFORM pTransform, _In_opt_ CONST CSC_PVOID pContext, _In_ CONST CSC_SIZE_T numOfThreads, _In_ CONST CSC_SIZE_T grainSize);
+// Reduces the elements into the result, which must hold the identity of the combiner on input and is copied into every partial result.
+// Elements are accumulated through the accumulate function and partial results are combined through the combine function, which may be NULL if elements and results share the same type.
+// The allocator is used for the partial results of the chunks.
+// Returns CSC_STATUS_SUCCESS on success, otherwise an error code is returned.
+CSC_STATUS CSCAPI CSC_ParallelUtilsReduce(_In_ CONST CSC_PCVOID pFirst, _In_ CONST CSC_SIZE_T numOfElements, _In_ CONST CSC_SIZE_T elementSize, _In_ CONST CSC_P_PARALLEL_UTILS_COMBINE pAccumulate, _In_opt_ CONST CSC_P_PARALLEL_UTILS_COMBINE pCombine, _In_opt_ CONST CSC_PVOID pContext, _Inout_ CONST CSC_PVOID pResult, _In_ CONST CSC_SIZE_T resultSize, _In_ CONST CSC_SIZE_T numOfThreads, _In_ CONST CSC_SIZE_T grainSize, _In_ CONST CSC_IAllocator* CONST pIAllocator);
+
+#endif
\ No newline at end of file
@@ -0,0 +1,221 @@
+#include "SearchUtils.h"
+#include "MemoryUtils.h"
+
+static CSC_BOOLEAN CSCAPI CSC_SearchUtilsAreParametersValid(_In_ CONST CSC_PCVOID pFirst, _In_ CONST CSC_SIZE_T numOfElements, _In_ CONST CSC_SIZE_T elementSize, _In_ CONST CSC_PCVOID pValue, _In_ CONST CSC_P_SORT_UTILS_COMPARE pCompare)
+{
+	if ((!pFirst && numOfElements) || !elementSize || !pValue || !pCompare)
+	{
+		return (CSC_BOOLEAN)FALSE;
+	}
+
+	return (CSC_BOOLEAN)TRUE;
+}
+
+// Narrows down the range [firstIndex, lastIndex) to the first element for which the predicate turns true, the elements must be partitioned by it.
+// The predicate is the comparison being less than 0 for the lower bound and being less or equal to 0 for the upper bound.
+static CSC_SIZE_T CSCAPI CSC_SearchUtilsPartitionPoint(_In_ CONST CSC_BYTE* CONST pFirst, _In_ CSC_SIZE_T firstIndex, _In_ CSC_SIZE_T lastIndex, _In_ CONST CSC_SIZE_T elementSize, _In_ CONST CSC_PCVOID pValue, _In_ CONST CSC_P_SORT_UTILS_COMPARE pCompare, _In_opt_ CONST CSC_PVOID pContext, _In_ CONST CSC_BOOLEAN isUpperBound)
+{
+	CSC_SIZE_T middle;
+	CSC_INT result;
+
+	while (firstIndex < lastIndex)
+	{
+		middle = firstIndex + ((lastIndex - firstIndex) >> 1);
+		result = pCompare(pFirst + middle * elementSize, pValue, pContext);
+
+		if (result < 0 || (isUpperBound && !result))
+		{
+			firstIndex = middle + (CSC_SIZE_T)1;
+		}
+		else
+		{
+			lastIndex = middle;
+		}
+	}
+
+	return firstIndex;
+}
+
+
+CSC_SIZE_T CSCAPI CSC_SearchUtilsLowerBound(_In_ CONST CSC_PCVOID pFirst, _In_ CONST CSC_SIZE_T numOfElements, _In_ CONST CSC_SIZE_T elementSize, _In_ CONST CSC_PCVOID pValue, _In_ CONST CSC_P_SORT_UTILS_COMPARE pCompare, _In_opt_ CONST CSC_PVOID pContext)
+{
+	if (!CSC_SearchUtilsAreParametersValid(pFirst, numOfElements, elementSize, pValue, pCompare))
+	{
+		return CSC_SEARCH_UTILS_INVALID_INDEX;
+	}
+
+	return CSC_SearchUtilsPartitionPoint((CONST CSC_BYTE*)pFirst, (CSC_SIZE_T)0, numOfElements, elementSize, pValue, pCompare, pContext, (CSC_BOOLEAN)FALSE);
+}
+
+CSC_SIZE_T CSCAPI CSC_SearchUtilsUpperBound(_In_ CONST CSC_PCVOID pFirst, _In_ CONST CSC_SIZE_T numOfElements, _In_ CONST CSC_SIZE_T elementSize, _In_ CONST CSC_PCVOID pValue, _In_ CONST CSC_P_SORT_UTILS_COMPARE pCompare, _In_opt_ CONST CSC_PVOID pContext)
+{
+	if (!CSC_SearchUtilsAreParametersValid(pFirst, numOfElements, elementSize, pValue, pCompare))
+	{
+		return CSC_SEARCH_UTILS_INVALID_INDEX;
+	}
+
+	return CSC_SearchUtilsPartitionPoint((CONST CSC_BYTE*)pFirst, (CSC_SIZE_T)0, numOfElements, elementSize, pValue, pCompare, pContext, (CSC_BOOLEAN)TRUE);
+}
+
+CSC_STATUS CSCAPI CSC_SearchUtilsEqualRange(_In_ CONST CSC_PCVOID pFirst, _In_ CONST CSC_SIZE_T numOfElements, _In_ CONST CSC_SIZE_T elementSize, _In_ CONST CSC_PCVOID pValue, _In_ CONST CSC_P_SORT_UTILS_COMPARE pCompare, _In_opt_ CONST CSC_PVOID pContext, _Out_ CSC_SIZE_T* CONST pFirstIndex, _Out_ CSC_SIZE_T* CONST pLastIndex)
+{
+	if (!CSC_SearchUtilsAreParametersValid(pFirst, numOfElements, elementSize, pValue, pCompare) || !pFirstIndex || !pLastIndex)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	// The upper bound can't be located in front of the lower bound, hence only the remaining elements are searched for it.
+	*pFirstIndex = CSC_SearchUtilsPartitionPoint((CONST CSC_BYTE*)pFirst, (CSC_SIZE_T)0, numOfElements, elementSize, pValue, pCompare, pContext, (CSC_BOOLEAN)FALSE);
+	*pLastIndex = CSC_SearchUtilsPartitionPoint((CONST CSC_BYTE*)pFirst, *pFirstIndex, numOfElements, elementSize, pValue, pCompare, pContext, (CSC_BOOLEAN)TRUE);
+
+	return CSC_STATUS_SUCCESS;
+}
+
+CSC_SIZE_T CSCAPI CSC_SearchUtilsBinarySearch(_In_ CONST CSC_PCVOID pFirst, _In_ CONST CSC_SIZE_T numOfElements, _In_ CONST CSC_SIZE_T elementSize, _In_ CONST CSC_PCVOID pValue, _In_ CONST CSC_P_SORT_UTILS_COMPARE pCompare, _In_opt_ CONST CSC_PVOID pContext)
+{
+	CSC_SIZE_T index;
+
+	if (!CSC_SearchUtilsAreParametersValid(pFirst, numOfElements, elementSize, pValue, pCompare))
+	{
+		return CSC_SEARCH_UTILS_INVALID_INDEX;
+	}
+
+	index = CSC_SearchUtilsPartitionPoint((CONST CSC_BYTE*)pFirst, (CSC_SIZE_T)0, numOfElements, elementSize, pValue, pCompare, pContext, (CSC_BOOLEAN)FALSE);
+
+	if (index == numOfElements || pCompare((CONST CSC_BYTE*)pFirst + index * elementSize, pValue, pContext))
+	{
+		return CSC_SEARCH_UTILS_INVALID_INDEX;
+	}
+
+	return index;
+}
+
+CSC_SIZE_T CSCAPI CSC_SearchUtilsBranchlessLowerBound(_In_ CONST CSC_PCVOID pFirst, _In_ CONST CSC_SIZE_T numOfElements, _In_ CONST CSC_SIZE_T elementSize, _In_ CONST CSC_PCVOID pValue, _In_ CONST CSC_P_SORT_UTILS_COMPARE pCompare, _In_opt_ CONST CSC_PVOID pContext)
+{
+	CONST CSC_BYTE* pBase = (CONST CSC_BYTE*)pFirst;
+	CSC_SIZE_T length = numOfElements;
+	CSC_SIZE_T half;
+
+	if (!CSC_SearchUtilsAreParametersValid(pFirst, numOfElements, elementSize, pValue, pCompare))
+	{
+		return CSC_SEARCH_UTILS_INVALID_INDEX;
+	}
+
+	if (!numOfElements)
+	{
+		return (CSC_SIZE_T)0;
+	}
+
+	// Every step halves the range and moves the base behind the middle element if it is ordered before the value, the move is computed instead of branched on.
+	// The middle elements of both possible ranges of the next step are prefetched while the current comparison is pending.
+	while (length > (CSC_SIZE_T)1)
+	{
+		half = length >> 1;
+		length -= half;
+
+		CSC_PREFETCH(pBase + (length >> 1) * elementSize);
+		CSC_PREFETCH(pBase + (half + (length >> 1)) * elementSize);
+
+		pBase += (CSC_SIZE_T)(pCompare(pBase + half * elementSize, pValue, pContext) < 0) * half * elementSize;
+	}
+
+	return (CSC_SIZE_T)(pBase - (CONST CSC_BYTE*)pFirst) / elementSize + (CSC_SIZE_T)(pCompare(pBase, pValue, pContext) < 0);
+}
+
+CSC_STATUS CSCAPI CSC_SearchUtilsBuildEytzinger(_Inout_ CONST CSC_PVOID pFirst, _In_ CONST CSC_SIZE_T numOfElements, _In_ CONST CSC_SIZE_T elementSize, _In_ CONST CSC_IAllocator* CONST pIAllocator)
+{
+	CSC_BYTE* pCopy;
+	CSC_SIZE_T iterator;
+	CSC_SIZE_T node;
+
+	if ((!pFirst && numOfElements) || !elementSize || !pIAllocator)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	if (numOfElements < (CSC_SIZE_T)2)
+	{
+		return CSC_STATUS_SUCCESS;
+	}
+
+	if (numOfElements > (CSC_SIZE_T)-1 / elementSize)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	pCopy = (CSC_BYTE*)CSC_IAllocatorAlloc(pIAllocator, numOfElements * elementSize);
+
+	if (!pCopy)
+	{
+		return CSC_STATUS_MEMORY_NOT_ALLOCATED;
+	}
+
+	CSC_MemoryUtilsCopyMemory(pCopy, pFirst, numOfElements * elementSize);
+
+	// The nodes of the tree are numbered from 1 in breadth first order, the children of node k are 2k and 2k + 1.
+	// Visiting the nodes in order assigns the sorted elements to them, starting at the leftmost node.
+	node = (CSC_SIZE_T)1;
+
+	while ((node << 1) <= numOfElements)
+	{
+		node <<= 1;
+	}
+
+	for (iterator = (CSC_SIZE_T)0; iterator < numOfElements; ++iterator)
+	{
+		CSC_MemoryUtilsCopyMemory((CSC_BYTE*)pFirst + (node - (CSC_SIZE_T)1) * elementSize, pCopy + iterator * elementSize, elementSize);
+
+		if ((node << 1) + (CSC_SIZE_T)1 <= numOfElements)
+		{
+			node = (node << 1) + (CSC_SIZE_T)1;
+
+			while ((node << 1) <= numOfElements)
+			{
+				node <<= 1;
+			}
+		}
+		else
+		{
+			// Without a right subtree the successor is the first ancestor whose left subtree holds the node.
+			while (node & (CSC_SIZE_T)1)
+			{
+				node >>= 1;
+			}
+
+			node >>= 1;
+		}
+	}
+
+	return CSC_IAllocatorFreeSized(pIAllocator, pCopy, numOfElements * elementSize);
+}
+
+CSC_SIZE_T CSCAPI CSC_SearchUtilsEytzingerLowerBound(_In_ CONST CSC_PCVOID pFirst, _In_ CONST CSC_SIZE_T numOfElements, _In_ CONST CSC_SIZE_T elementSize, _In_ CONST CSC_PCVOID pValue, _In_ CONST CSC_P_SORT_UTILS_COMPARE pCompare, _In_opt_ CONST CSC_PVOID pContext)
+{
+	CSC_SIZE_T node = (CSC_SIZE_T)1;
+
+	if (!CSC_SearchUtilsAreParametersValid(pFirst, numOfElements, elementSize, pValue, pCompare))
+	{
+		return CSC_SEARCH_UTILS_INVALID_INDEX;
+	}
+
+	// The descent goes right whenever the node is ordered before the value, the descendants a few levels below are prefetched on the way.
+	while (node <= numOfElements)
+	{
+		if ((node << CSC_SEARCH_UTILS_EYTZINGER_PREFETCH_LEVELS) <= numOfElements)
+		{
+			CSC_PREFETCH((CONST CSC_BYTE*)pFirst + ((node << CSC_SEARCH_UTILS_EYTZINGER_PREFETCH_LEVELS) - (CSC_SIZE_T)1) * elementSize);
+		}
+
+		node = (node << 1) + (CSC_SIZE_T)(pCompare((CONST CSC_BYTE*)pFirst + (node - (CSC_SIZE_T)1) * elementSize, pValue, pContext) < 0);
+	}
+
+	// The lower bound is the last node where the descent went left, which is found by dropping the trailing right turns and the final left turn.
+	while (node & (CSC_SIZE_T)1)
+	{
+		node >>= 1;
+	}
+
+	node >>= 1;
+
+	return node ? node - (CSC_SIZE_T)1 : numOfElements;
+}
\ No newline at end of file
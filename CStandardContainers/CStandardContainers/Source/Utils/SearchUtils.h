@@ -0,0 +1,49 @@
+#ifndef CSC_SEARCH_UTILS
+#define CSC_SEARCH_UTILS
+
+/*
+Description:
+The SearchUtils provide binary searches over contiguous arrays of elements with an arbitrary size that are sorted in ascending order of a comparison function.
+The comparison function has the same signature as the one of the SortUtils and is always invoked with an element of the array as first and the searched value as second argument, hence the value doesn't need to be of the element type.
+The branchless lower bound performs a fixed amount of steps without data dependent branches and prefetches the candidates of the next two steps, which keeps the processor busy while the cache misses of large arrays are resolved.
+For large tables that are searched often, the sorted array can be reordered into the Eytzinger layout, which stores the implicit binary search tree in breadth first order.
+The first levels of the tree share a few cache lines and the descendants of a node are placed next to each other, hence a lookup touches only a few cache lines and the nodes of the following levels are prefetched ahead.
+Indices returned by the Eytzinger search refer to positions in the reordered array.
+*/
+
+// Include the current configuration of the library containing various type definitions and other things.
+#include "../Configuration/Configuration.h"
+// Include the IAllocator interface as building the Eytzinger layout requires dynamic memory allocation.
+#include "../Interfaces/IAllocator.h"
+// Include the SortUtils for the type of the comparison function.
+#include "SortUtils.h"
+
+// Definition of the index that is returned if no element was found or the parameters are invalid.
+#define CSC_SEARCH_UTILS_INVALID_INDEX (CSC_SIZE_T)-1
+// Definition of the amount of tree levels the Eytzinger search prefetches ahead, the nodes of one level of 16 descendants usually share a few cache lines.
+#define CSC_SEARCH_UTILS_EYTZINGER_PREFETCH_LEVELS (CSC_SIZE_T)4
+
+// Retrieves the index of the first element that is not ordered before the value, which is the amount of elements if there is none.
+// Returns CSC_SEARCH_UTILS_INVALID_INDEX if the parameters are invalid.
+CSC_SIZE_T CSCAPI CSC_SearchUtilsLowerBound(_In_ CONST CSC_PCVOID pFirst, _In_ CONST CSC_SIZE_T numOfElements, _In_ CONST CSC_SIZE_T elementSize, _In_ CONST CSC_PCVOID pValue, _In_ CONST CSC_P_SORT_UTILS_COMPARE pCompare, _In_opt_ CONST CSC_PVOID pContext);
+// Retrieves the index of the first element that is ordered after the value, which is the amount of elements if there is none.
+// Returns CSC_SEARCH_UTILS_INVALID_INDEX if the parameters are invalid.
+CSC_SIZE_T CSCAPI CSC_SearchUtilsUpperBound(_In_ CONST CSC_PCVOID pFirst, _In_ CONST CSC_SIZE_T numOfElements, _In_ CONST CSC_SIZE_T elementSize, _In_ CONST CSC_PCVOID pValue, _In_ CONST CSC_P_SORT_UTILS_COMPARE pCompare, _In_opt_ CONST CSC_PVOID pContext);
+// Retrieves the range of elements that compare equal to the value as the lower and upper bound.
+// Returns CSC_STATUS_SUCCESS on success, otherwise an error code is returned.
+CSC_STATUS CSCAPI CSC_SearchUtilsEqualRange(_In_ CONST CSC_PCVOID pFirst, _In_ CONST CSC_SIZE_T numOfElements, _In_ CONST CSC_SIZE_T elementSize, _In_ CONST CSC_PCVOID pValue, _In_ CONST CSC_P_SORT_UTILS_COMPARE pCompare, _In_opt_ CONST CSC_PVOID pContext, _Out_ CSC_SIZE_T* CONST pFirstIndex, _Out_ CSC_SIZE_T* CONST pLastIndex);
+// Retrieves the index of the first element that compares equal to the value.
+// Returns CSC_SEARCH_UTILS_INVALID_INDEX if there is no such element or the parameters are invalid.
+CSC_SIZE_T CSCAPI CSC_SearchUtilsBinarySearch(_In_ CONST CSC_PCVOID pFirst, _In_ CONST CSC_SIZE_T numOfElements, _In_ CONST CSC_SIZE_T elementSize, _In_ CONST CSC_PCVOID pValue, _In_ CONST CSC_P_SORT_UTILS_COMPARE pCompare, _In_opt_ CONST CSC_PVOID pContext);
+// Retrieves the same index as CSC_SearchUtilsLowerBound through a search without data dependent branches that prefetches the candidates ahead.
+// Returns CSC_SEARCH_UTILS_INVALID_INDEX if the parameters are invalid.
+CSC_SIZE_T CSCAPI CSC_SearchUtilsBranchlessLowerBound(_In_ CONST CSC_PCVOID pFirst, _In_ CONST CSC_SIZE_T numOfElements, _In_ CONST CSC_SIZE_T elementSize, _In_ CONST CSC_PCVOID pValue, _In_ CONST CSC_P_SORT_UTILS_COMPARE pCompare, _In_opt_ CONST CSC_PVOID pContext);
+
+// Reorders a sorted array in place into the Eytzinger layout, the allocator is used for a copy of the array.
+// Returns CSC_STATUS_SUCCESS on success, otherwise an error code is returned.
+CSC_STATUS CSCAPI CSC_SearchUtilsBuildEytzinger(_Inout_ CONST CSC_PVOID pFirst, _In_ CONST CSC_SIZE_T numOfElements, _In_ CONST CSC_SIZE_T elementSize, _In_ CONST CSC_IAllocator* CONST pIAllocator);
+// Retrieves the position of the first element that is not ordered before the value within an array in Eytzinger layout, which is the amount of elements if there is none.
+// Returns CSC_SEARCH_UTILS_INVALID_INDEX if the parameters are invalid.
+CSC_SIZE_T CSCAPI CSC_SearchUtilsEytzingerLowerBound(_In_ CONST CSC_PCVOID pFirst, _In_ CONST CSC_SIZE_T numOfElements, _In_ CONST CSC_SIZE_T elementSize, _In_ CONST CSC_PCVOID pValue, _In_ CONST CSC_P_SORT_UTILS_COMPARE pCompare, _In_opt_ CONST CSC_PVOID pContext);
+
+#endif
\ No newline at end of file
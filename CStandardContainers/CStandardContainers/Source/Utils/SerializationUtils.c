@@ -0,0 +1,287 @@
+#include "SerializationUtils.h"
+#include "MemoryUtils.h"
+
+#ifdef CSC_CONFIG_LINUX_NATIVE
+#include <sys/uio.h>
+#include <errno.h>
+#include <unistd.h>
+#endif
+
+// Definition of the header at the beginning of every stream.
+typedef struct _CSC_SerializationUtilsStreamHeader
+{
+	CSC_QWORD signature;
+	CSC_DWORD version;
+	CSC_DWORD reserved;
+} CSC_SerializationUtilsStreamHeader;
+
+
+// Writes all queued blocks through writev, partial writes are continued with the remainder of the blocks.
+static CSC_STATUS CSCAPI CSC_SerializationUtilsWriteBlocks(_In_ CONST CSC_SerializationWriter* CONST pWriter)
+{
+#ifdef CSC_CONFIG_LINUX_NATIVE
+	struct iovec vectors[CSC_SERIALIZATION_UTILS_MAX_BLOCKS];
+	CSC_SIZE_T firstVector = (CSC_SIZE_T)0;
+	CSC_SIZE_T iterator;
+	ssize_t writtenSize;
+
+	for (iterator = (CSC_SIZE_T)0; iterator < pWriter->blockCount; ++iterator)
+	{
+		vectors[iterator].iov_base = (CSC_PVOID)pWriter->blocks[iterator].pData;
+		vectors[iterator].iov_len = pWriter->blocks[iterator].size;
+	}
+
+	while (firstVector < pWriter->blockCount)
+	{
+		writtenSize = writev((int)pWriter->fileDescriptor, vectors + firstVector, (int)(pWriter->blockCount - firstVector));
+
+		if (writtenSize < 0)
+		{
+			if (errno == EINTR)
+			{
+				continue;
+			}
+
+			return CSC_STATUS_GENERAL_FAILURE;
+		}
+
+		while (firstVector < pWriter->blockCount && (CSC_SIZE_T)writtenSize >= vectors[firstVector].iov_len)
+		{
+			writtenSize -= (ssize_t)vectors[firstVector].iov_len;
+			++firstVector;
+		}
+
+		if (firstVector < pWriter->blockCount)
+		{
+			vectors[firstVector].iov_base = (CSC_BYTE*)vectors[firstVector].iov_base + writtenSize;
+			vectors[firstVector].iov_len -= (CSC_SIZE_T)writtenSize;
+		}
+	}
+
+	return CSC_STATUS_SUCCESS;
+#else
+	return (pWriter->blockCount) ? CSC_STATUS_GENERAL_FAILURE : CSC_STATUS_SUCCESS;
+#endif
+}
+
+// Reads at least minSize and at most maxSize bytes, fewer than minSize bytes are only returned at the end of the stream or on an error.
+static CSC_SIZE_T CSCAPI CSC_SerializationUtilsReadFile(_In_ CONST CSC_INT fileDescriptor, _Out_ CSC_BYTE* CONST pBuffer, _In_ CONST CSC_SIZE_T minSize, _In_ CONST CSC_SIZE_T maxSize)
+{
+	CSC_SIZE_T totalSize = (CSC_SIZE_T)0;
+
+#ifdef CSC_CONFIG_LINUX_NATIVE
+	ssize_t readSize;
+
+	while (totalSize < minSize)
+	{
+		readSize = read((int)fileDescriptor, pBuffer + totalSize, maxSize - totalSize);
+
+		if (readSize < 0 && errno == EINTR)
+		{
+			continue;
+		}
+
+		if (readSize <= 0)
+		{
+			break;
+		}
+
+		totalSize += (CSC_SIZE_T)readSize;
+	}
+#else
+	(void)fileDescriptor;
+	(void)pBuffer;
+	(void)minSize;
+	(void)maxSize;
+#endif
+
+	return totalSize;
+}
+
+
+CSC_STATUS CSCAPI CSC_SerializationUtilsInitializeWriter(_Out_ CSC_SerializationWriter* CONST pWriter, _In_ CONST CSC_INT fileDescriptor)
+{
+	CSC_SerializationUtilsStreamHeader header;
+
+	if (!pWriter || fileDescriptor < (CSC_INT)0)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	pWriter->fileDescriptor = fileDescriptor;
+	pWriter->blockCount = (CSC_SIZE_T)0;
+	pWriter->scratchSize = (CSC_SIZE_T)0;
+
+	header.signature = CSC_SERIALIZATION_UTILS_SIGNATURE;
+	header.version = CSC_SERIALIZATION_UTILS_VERSION;
+	header.reserved = (CSC_DWORD)0;
+
+	return CSC_SerializationUtilsWriteValue(pWriter, &header, sizeof(header));
+}
+
+CSC_STATUS CSCAPI CSC_SerializationUtilsWrite(_Inout_ CSC_SerializationWriter* CONST pWriter, _In_ CONST CSC_PCVOID pData, _In_ CONST CSC_SIZE_T size)
+{
+	CSC_STATUS status;
+
+	if (!pWriter || (!pData && size))
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	if (!size)
+	{
+		return CSC_STATUS_SUCCESS;
+	}
+
+	if (pWriter->blockCount == CSC_SERIALIZATION_UTILS_MAX_BLOCKS)
+	{
+		status = CSC_SerializationUtilsFlush(pWriter);
+
+		if (status != CSC_STATUS_SUCCESS)
+		{
+			return status;
+		}
+	}
+
+	pWriter->blocks[pWriter->blockCount].pData = pData;
+	pWriter->blocks[pWriter->blockCount].size = size;
+	++pWriter->blockCount;
+
+	return CSC_STATUS_SUCCESS;
+}
+
+CSC_STATUS CSCAPI CSC_SerializationUtilsWriteValue(_Inout_ CSC_SerializationWriter* CONST pWriter, _In_ CONST CSC_PCVOID pValue, _In_ CONST CSC_SIZE_T size)
+{
+	CSC_STATUS status;
+	CSC_SerializationBlock* pLastBlock;
+
+	if (!pWriter || !pValue || !size || size > CSC_SERIALIZATION_UTILS_SCRATCH_SIZE)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	if (pWriter->scratchSize + size > CSC_SERIALIZATION_UTILS_SCRATCH_SIZE || pWriter->blockCount == CSC_SERIALIZATION_UTILS_MAX_BLOCKS)
+	{
+		status = CSC_SerializationUtilsFlush(pWriter);
+
+		if (status != CSC_STATUS_SUCCESS)
+		{
+			return status;
+		}
+	}
+
+	CSC_MemoryUtilsCopyMemory(pWriter->scratch + pWriter->scratchSize, pValue, size);
+	pLastBlock = (pWriter->blockCount) ? &pWriter->blocks[pWriter->blockCount - (CSC_SIZE_T)1] : NULL;
+
+	// Consecutive values share a single block as long as no reference has been queued in between.
+	if (pLastBlock && (CONST CSC_BYTE*)pLastBlock->pData + pLastBlock->size == pWriter->scratch + pWriter->scratchSize)
+	{
+		pLastBlock->size += size;
+	}
+	else
+	{
+		pWriter->blocks[pWriter->blockCount].pData = pWriter->scratch + pWriter->scratchSize;
+		pWriter->blocks[pWriter->blockCount].size = size;
+		++pWriter->blockCount;
+	}
+
+	pWriter->scratchSize += size;
+
+	return CSC_STATUS_SUCCESS;
+}
+
+CSC_STATUS CSCAPI CSC_SerializationUtilsFlush(_Inout_ CSC_SerializationWriter* CONST pWriter)
+{
+	CSC_STATUS status;
+
+	if (!pWriter)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	// The queue is emptied even if writing fails, as the position of the stream is unknown afterwards.
+	status = CSC_SerializationUtilsWriteBlocks(pWriter);
+	pWriter->blockCount = (CSC_SIZE_T)0;
+	pWriter->scratchSize = (CSC_SIZE_T)0;
+
+	return status;
+}
+
+CSC_STATUS CSCAPI CSC_SerializationUtilsInitializeReader(_Out_ CSC_SerializationReader* CONST pReader, _In_ CONST CSC_INT fileDescriptor)
+{
+	CSC_STATUS status;
+	CSC_SerializationUtilsStreamHeader header;
+
+	if (!pReader || fileDescriptor < (CSC_INT)0)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	pReader->fileDescriptor = fileDescriptor;
+	pReader->version = (CSC_DWORD)0;
+	pReader->bufferOffset = (CSC_SIZE_T)0;
+	pReader->bufferSize = (CSC_SIZE_T)0;
+
+	status = CSC_SerializationUtilsRead(pReader, &header, sizeof(header));
+
+	if (status != CSC_STATUS_SUCCESS)
+	{
+		return status;
+	}
+
+	if (header.signature != CSC_SERIALIZATION_UTILS_SIGNATURE || !header.version || header.version > CSC_SERIALIZATION_UTILS_VERSION)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	pReader->version = header.version;
+
+	return CSC_STATUS_SUCCESS;
+}
+
+CSC_STATUS CSCAPI CSC_SerializationUtilsRead(_Inout_ CSC_SerializationReader* CONST pReader, _Out_ CONST CSC_PVOID pBuffer, _In_ CONST CSC_SIZE_T size)
+{
+	CSC_SIZE_T copySize;
+	CSC_SIZE_T remainingSize = size;
+	CSC_BYTE* pDst = (CSC_BYTE*)pBuffer;
+
+	if (!pReader || (!pBuffer && size))
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	copySize = pReader->bufferSize - pReader->bufferOffset;
+	copySize = (copySize < remainingSize) ? copySize : remainingSize;
+
+	if (copySize)
+	{
+		CSC_MemoryUtilsCopyMemory(pDst, pReader->buffer + pReader->bufferOffset, copySize);
+		pReader->bufferOffset += copySize;
+		pDst += copySize;
+		remainingSize -= copySize;
+	}
+
+	if (!remainingSize)
+	{
+		return CSC_STATUS_SUCCESS;
+	}
+
+	// Large reads bypass the buffer, which is empty at this point.
+	if (remainingSize >= CSC_SERIALIZATION_UTILS_READ_BUFFER_SIZE)
+	{
+		return (CSC_SerializationUtilsReadFile(pReader->fileDescriptor, pDst, remainingSize, remainingSize) == remainingSize) ? CSC_STATUS_SUCCESS : CSC_STATUS_GENERAL_FAILURE;
+	}
+
+	pReader->bufferOffset = (CSC_SIZE_T)0;
+	pReader->bufferSize = CSC_SerializationUtilsReadFile(pReader->fileDescriptor, pReader->buffer, remainingSize, CSC_SERIALIZATION_UTILS_READ_BUFFER_SIZE);
+
+	if (pReader->bufferSize < remainingSize)
+	{
+		return CSC_STATUS_GENERAL_FAILURE;
+	}
+
+	CSC_MemoryUtilsCopyMemory(pDst, pReader->buffer, remainingSize);
+	pReader->bufferOffset = remainingSize;
+
+	return CSC_STATUS_SUCCESS;
+}
\ No newline at end of file
@@ -0,0 +1,77 @@
+#ifndef CSC_SERIALIZATION_UTILS
+#define CSC_SERIALIZATION_UTILS
+
+/*
+Description:
+The SerializationUtils write containers to file descriptors and read them back in a compact binary format, the containers themselves define their layout through the serialization methods of the IContainer interface.
+A stream begins with a header holding a signature and the version of the format, readers reject streams of newer versions.
+Writers don't copy the data they are given, they collect up to CSC_SERIALIZATION_UTILS_MAX_BLOCKS references and write them through a single scatter-gather writev call, hence the buffers of large containers are written without any intermediate copy.
+Small values like headers and length prefixes are copied into a scratch buffer of the writer, which is written together with the references.
+All data passed to a writer must remain unchanged until the writer has been flushed, which happens when it runs out of blocks or scratch space and through CSC_SerializationUtilsFlush.
+Readers buffer small reads, reads of at least CSC_SERIALIZATION_UTILS_READ_BUFFER_SIZE bytes go directly into the destination, hence containers can reserve their storage once and fill it without an intermediate copy.
+Values are stored in the byte order of the machine, streams can only be read on machines of the same byte order and word size.
+Reading and writing relies on POSIX system calls and is only available in the Linux native configuration, in every other configuration the functions fail with CSC_STATUS_GENERAL_FAILURE.
+*/
+
+// Include the current configuration of the library containing various type definitions and other things.
+#include "../Configuration/Configuration.h"
+
+// Definition of the signature at the beginning of every stream.
+#define CSC_SERIALIZATION_UTILS_SIGNATURE (CSC_QWORD)0x4D41455254534343
+// Definition of the version of the format that is written, which must be raised on every change of the layout of a container.
+#define CSC_SERIALIZATION_UTILS_VERSION (CSC_DWORD)1
+// Definition of the maximum amount of blocks a writer collects before it writes them.
+#define CSC_SERIALIZATION_UTILS_MAX_BLOCKS (CSC_SIZE_T)0x40
+// Definition of the size of the scratch buffer of a writer.
+#define CSC_SERIALIZATION_UTILS_SCRATCH_SIZE (CSC_SIZE_T)0x400
+// Definition of the size of the buffer of a reader.
+#define CSC_SERIALIZATION_UTILS_READ_BUFFER_SIZE (CSC_SIZE_T)0x1000
+// Definition of the maximum size of a length-prefixed block, larger amounts of data are split into multiple blocks.
+#define CSC_SERIALIZATION_UTILS_MAX_BLOCK_SIZE (CSC_SIZE_T)0x40000000
+
+// Definition of a block of data that is referenced by a writer.
+typedef struct _CSC_SerializationBlock
+{
+	CSC_PCVOID pData;
+	CSC_SIZE_T size;
+} CSC_SerializationBlock;
+
+typedef struct _CSC_SerializationWriter
+{
+	CSC_INT fileDescriptor;
+	CSC_SIZE_T blockCount;
+	CSC_SIZE_T scratchSize;
+	CSC_SerializationBlock blocks[CSC_SERIALIZATION_UTILS_MAX_BLOCKS];
+	CSC_BYTE scratch[CSC_SERIALIZATION_UTILS_SCRATCH_SIZE];
+} CSC_SerializationWriter;
+
+typedef struct _CSC_SerializationReader
+{
+	CSC_INT fileDescriptor;
+	CSC_DWORD version;
+	CSC_SIZE_T bufferOffset;
+	CSC_SIZE_T bufferSize;
+	CSC_BYTE buffer[CSC_SERIALIZATION_UTILS_READ_BUFFER_SIZE];
+} CSC_SerializationReader;
+
+// Initializes a writer for the file descriptor, which must be open for writing, and queues the header of the stream.
+// Returns CSC_STATUS_SUCCESS on success, otherwise an error code is returned.
+CSC_STATUS CSCAPI CSC_SerializationUtilsInitializeWriter(_Out_ CSC_SerializationWriter* CONST pWriter, _In_ CONST CSC_INT fileDescriptor);
+// Queues a reference to the data, which is written on the next flush without being copied.
+// Returns CSC_STATUS_SUCCESS on success, otherwise an error code is returned.
+CSC_STATUS CSCAPI CSC_SerializationUtilsWrite(_Inout_ CSC_SerializationWriter* CONST pWriter, _In_ CONST CSC_PCVOID pData, _In_ CONST CSC_SIZE_T size);
+// Copies a small value of at most CSC_SERIALIZATION_UTILS_SCRATCH_SIZE bytes into the scratch buffer of the writer and queues it.
+// Returns CSC_STATUS_SUCCESS on success, otherwise an error code is returned.
+CSC_STATUS CSCAPI CSC_SerializationUtilsWriteValue(_Inout_ CSC_SerializationWriter* CONST pWriter, _In_ CONST CSC_PCVOID pValue, _In_ CONST CSC_SIZE_T size);
+// Writes all queued blocks, afterwards the data passed to the writer may be modified again.
+// Returns CSC_STATUS_SUCCESS on success, otherwise an error code is returned.
+CSC_STATUS CSCAPI CSC_SerializationUtilsFlush(_Inout_ CSC_SerializationWriter* CONST pWriter);
+
+// Initializes a reader for the file descriptor, which must be open for reading, and reads and validates the header of the stream.
+// Returns CSC_STATUS_SUCCESS on success, otherwise an error code is returned.
+CSC_STATUS CSCAPI CSC_SerializationUtilsInitializeReader(_Out_ CSC_SerializationReader* CONST pReader, _In_ CONST CSC_INT fileDescriptor);
+// Reads exactly size bytes, the end of the stream before that is treated as an error.
+// Returns CSC_STATUS_SUCCESS on success, otherwise an error code is returned.
+CSC_STATUS CSCAPI CSC_SerializationUtilsRead(_Inout_ CSC_SerializationReader* CONST pReader, _Out_ CONST CSC_PVOID pBuffer, _In_ CONST CSC_SIZE_T size);
+
+#endif
\ No newline at end of file
@@ -0,0 +1,669 @@
+#include "SortUtils.h"
+#include "MemoryUtils.h"
+
+#ifdef CSC_CONFIG_LINUX_NATIVE
+#include <pthread.h>
+#endif
+
+// Definition of the context of the comparison function that compares the elements referenced by two indices.
+typedef struct _CSC_SortUtilsIndexContext
+{
+	CONST CSC_BYTE* pFirst;
+	CSC_SIZE_T elementSize;
+	CSC_P_SORT_UTILS_COMPARE pCompare;
+	CSC_PVOID pContext;
+} CSC_SortUtilsIndexContext;
+
+// Definition of an entry of the radix sort.
+typedef struct _CSC_SortUtilsRadixEntry
+{
+	CSC_QWORD key;
+	CSC_SIZE_T index;
+} CSC_SortUtilsRadixEntry;
+
+// Definition of a task of the merge sort, a range is sorted if the left count is 0, otherwise it's two sorted runs are merged.
+typedef struct _CSC_SortUtilsMergeTask
+{
+	CSC_BYTE* pFirst;
+	CSC_BYTE* pBuffer;
+	CSC_SIZE_T numOfElements;
+	CSC_SIZE_T leftCount;
+	CSC_SIZE_T elementSize;
+	CSC_P_SORT_UTILS_COMPARE pCompare;
+	CSC_PVOID pContext;
+} CSC_SortUtilsMergeTask;
+
+
+// Swaps two elements in place, word by word if both elements are aligned and byte by byte otherwise.
+static void CSCAPI CSC_SortUtilsSwapElements(_Inout_ CSC_BYTE* CONST pFirst, _Inout_ CSC_BYTE* CONST pSecond, _In_ CONST CSC_SIZE_T elementSize)
+{
+	CSC_SIZE_T iterator;
+	CSC_SIZE_T word;
+	CSC_BYTE value;
+
+	if (pFirst == pSecond)
+	{
+		return;
+	}
+
+	if (!(((CSC_SIZE_T)pFirst | (CSC_SIZE_T)pSecond | elementSize) & (sizeof(CSC_SIZE_T) - (CSC_SIZE_T)1)))
+	{
+		for (iterator = (CSC_SIZE_T)0; iterator < elementSize; iterator += sizeof(CSC_SIZE_T))
+		{
+			word = *(CSC_SIZE_T*)(pFirst + iterator);
+			*(CSC_SIZE_T*)(pFirst + iterator) = *(CSC_SIZE_T*)(pSecond + iterator);
+			*(CSC_SIZE_T*)(pSecond + iterator) = word;
+		}
+
+		return;
+	}
+
+	for (iterator = (CSC_SIZE_T)0; iterator < elementSize; ++iterator)
+	{
+		value = pFirst[iterator];
+		pFirst[iterator] = pSecond[iterator];
+		pSecond[iterator] = value;
+	}
+}
+
+// Copies an element to a location that doesn't overlap with it.
+static void CSCAPI CSC_SortUtilsCopyElement(_Out_ CSC_BYTE* CONST pDst, _In_ CONST CSC_BYTE* CONST pSrc, _In_ CONST CSC_SIZE_T elementSize)
+{
+	CSC_SIZE_T iterator;
+
+	if (!(((CSC_SIZE_T)pDst | (CSC_SIZE_T)pSrc | elementSize) & (sizeof(CSC_SIZE_T) - (CSC_SIZE_T)1)))
+	{
+		for (iterator = (CSC_SIZE_T)0; iterator < elementSize; iterator += sizeof(CSC_SIZE_T))
+		{
+			*(CSC_SIZE_T*)(pDst + iterator) = *(CONST CSC_SIZE_T*)(pSrc + iterator);
+		}
+
+		return;
+	}
+
+	for (iterator = (CSC_SIZE_T)0; iterator < elementSize; ++iterator)
+	{
+		pDst[iterator] = pSrc[iterator];
+	}
+}
+
+static void CSCAPI CSC_SortUtilsInsertionSort(_Inout_ CSC_BYTE* CONST pFirst, _In_ CONST CSC_SIZE_T numOfElements, _In_ CONST CSC_SIZE_T elementSize, _In_ CONST CSC_P_SORT_UTILS_COMPARE pCompare, _In_opt_ CONST CSC_PVOID pContext)
+{
+	CSC_SIZE_T iterator;
+	CSC_BYTE* pCurrent;
+
+	for (iterator = (CSC_SIZE_T)1; iterator < numOfElements; ++iterator)
+	{
+		for (pCurrent = pFirst + iterator * elementSize; pCurrent > pFirst && pCompare(pCurrent, pCurrent - elementSize, pContext) < 0; pCurrent -= elementSize)
+		{
+			CSC_SortUtilsSwapElements(pCurrent, pCurrent - elementSize, elementSize);
+		}
+	}
+}
+
+static void CSCAPI CSC_SortUtilsSiftDown(_Inout_ CSC_BYTE* CONST pFirst, _In_ CSC_SIZE_T root, _In_ CONST CSC_SIZE_T numOfElements, _In_ CONST CSC_SIZE_T elementSize, _In_ CONST CSC_P_SORT_UTILS_COMPARE pCompare, _In_opt_ CONST CSC_PVOID pContext)
+{
+	CSC_SIZE_T child;
+
+	while ((child = (root << 1) + (CSC_SIZE_T)1) < numOfElements)
+	{
+		if (child + (CSC_SIZE_T)1 < numOfElements && pCompare(pFirst + child * elementSize, pFirst + (child + (CSC_SIZE_T)1) * elementSize, pContext) < 0)
+		{
+			++child;
+		}
+
+		if (pCompare(pFirst + root * elementSize, pFirst + child * elementSize, pContext) >= 0)
+		{
+			return;
+		}
+
+		CSC_SortUtilsSwapElements(pFirst + root * elementSize, pFirst + child * elementSize, elementSize);
+		root = child;
+	}
+}
+
+static void CSCAPI CSC_SortUtilsHeapSort(_Inout_ CSC_BYTE* CONST pFirst, _In_ CONST CSC_SIZE_T numOfElements, _In_ CONST CSC_SIZE_T elementSize, _In_ CONST CSC_P_SORT_UTILS_COMPARE pCompare, _In_opt_ CONST CSC_PVOID pContext)
+{
+	CSC_SIZE_T iterator;
+
+	for (iterator = numOfElements >> 1; iterator > (CSC_SIZE_T)0; --iterator)
+	{
+		CSC_SortUtilsSiftDown(pFirst, iterator - (CSC_SIZE_T)1, numOfElements, elementSize, pCompare, pContext);
+	}
+
+	for (iterator = numOfElements - (CSC_SIZE_T)1; iterator > (CSC_SIZE_T)0; --iterator)
+	{
+		CSC_SortUtilsSwapElements(pFirst, pFirst + iterator * elementSize, elementSize);
+		CSC_SortUtilsSiftDown(pFirst, (CSC_SIZE_T)0, iterator, elementSize, pCompare, pContext);
+	}
+}
+
+// Sorts a range through quicksort, recursing into the smaller partition only to bound the stack usage.
+// The range is handed to heapsort once the depth limit is exhausted and to insertion sort once it is small.
+static void CSCAPI CSC_SortUtilsIntroSortRange(_Inout_ CSC_BYTE* pFirst, _In_ CSC_SIZE_T numOfElements, _In_ CONST CSC_SIZE_T elementSize, _In_ CONST CSC_P_SORT_UTILS_COMPARE pCompare, _In_opt_ CONST CSC_PVOID pContext, _In_ CSC_SIZE_T depthLimit)
+{
+	CSC_BYTE* pMiddle;
+	CSC_BYTE* pLast;
+	CSC_BYTE* pLeft;
+	CSC_BYTE* pRight;
+	CSC_SIZE_T leftCount;
+	CSC_SIZE_T rightCount;
+
+	while (numOfElements > CSC_SORT_UTILS_INSERTION_SORT_THRESHOLD)
+	{
+		if (!depthLimit)
+		{
+			CSC_SortUtilsHeapSort(pFirst, numOfElements, elementSize, pCompare, pContext);
+			return;
+		}
+
+		--depthLimit;
+
+		// The median of the first, middle and last element becomes the pivot and is kept at the first position during the partitioning.
+		// Afterwards the last element is not ordered before the pivot, which stops the left scan without a bounds check.
+		pMiddle = pFirst + (numOfElements >> 1) * elementSize;
+		pLast = pFirst + (numOfElements - (CSC_SIZE_T)1) * elementSize;
+
+		if (pCompare(pMiddle, pFirst, pContext) < 0)
+		{
+			CSC_SortUtilsSwapElements(pMiddle, pFirst, elementSize);
+		}
+
+		if (pCompare(pLast, pMiddle, pContext) < 0)
+		{
+			CSC_SortUtilsSwapElements(pLast, pMiddle, elementSize);
+
+			if (pCompare(pMiddle, pFirst, pContext) < 0)
+			{
+				CSC_SortUtilsSwapElements(pMiddle, pFirst, elementSize);
+			}
+		}
+
+		CSC_SortUtilsSwapElements(pFirst, pMiddle, elementSize);
+
+		pLeft = pFirst + elementSize;
+		pRight = pLast;
+
+		for (;;)
+		{
+			while (pCompare(pLeft, pFirst, pContext) < 0)
+			{
+				pLeft += elementSize;
+			}
+
+			while (pCompare(pFirst, pRight, pContext) < 0)
+			{
+				pRight -= elementSize;
+			}
+
+			if (pLeft >= pRight)
+			{
+				break;
+			}
+
+			CSC_SortUtilsSwapElements(pLeft, pRight, elementSize);
+			pLeft += elementSize;
+			pRight -= elementSize;
+		}
+
+		CSC_SortUtilsSwapElements(pFirst, pRight, elementSize);
+
+		leftCount = (CSC_SIZE_T)(pRight - pFirst) / elementSize;
+		rightCount = numOfElements - leftCount - (CSC_SIZE_T)1;
+
+		if (leftCount < rightCount)
+		{
+			CSC_SortUtilsIntroSortRange(pFirst, leftCount, elementSize, pCompare, pContext, depthLimit);
+			pFirst = pRight + elementSize;
+			numOfElements = rightCount;
+		}
+		else
+		{
+			CSC_SortUtilsIntroSortRange(pRight + elementSize, rightCount, elementSize, pCompare, pContext, depthLimit);
+			numOfElements = leftCount;
+		}
+	}
+
+	CSC_SortUtilsInsertionSort(pFirst, numOfElements, elementSize, pCompare, pContext);
+}
+
+static void CSCAPI CSC_SortUtilsIntroSortElements(_Inout_ CSC_BYTE* CONST pFirst, _In_ CONST CSC_SIZE_T numOfElements, _In_ CONST CSC_SIZE_T elementSize, _In_ CONST CSC_P_SORT_UTILS_COMPARE pCompare, _In_opt_ CONST CSC_PVOID pContext)
+{
+	CSC_SIZE_T depthLimit = (CSC_SIZE_T)0;
+	CSC_SIZE_T remaining;
+
+	for (remaining = numOfElements; remaining > (CSC_SIZE_T)1; remaining >>= 1)
+	{
+		depthLimit += (CSC_SIZE_T)2;
+	}
+
+	CSC_SortUtilsIntroSortRange(pFirst, numOfElements, elementSize, pCompare, pContext, depthLimit);
+}
+
+static CSC_INT CSCMETHOD CSC_SortUtilsCompareIndices(_In_ CONST CSC_PCVOID pFirst, _In_ CONST CSC_PCVOID pSecond, _In_opt_ CONST CSC_PVOID pContext)
+{
+	CONST CSC_SortUtilsIndexContext* CONST pIndexContext = (CONST CSC_SortUtilsIndexContext*)pContext;
+
+	return pIndexContext->pCompare(pIndexContext->pFirst + *(CONST CSC_SIZE_T*)pFirst * pIndexContext->elementSize, pIndexContext->pFirst + *(CONST CSC_SIZE_T*)pSecond * pIndexContext->elementSize, pIndexContext->pContext);
+}
+
+// Moves every element to it's final position, pIndices holds the current index of the element that belongs to each position.
+// Each cycle of the permutation is followed through a single temporary element, the indices are reset to the identity along the way.
+static void CSCAPI CSC_SortUtilsApplyPermutation(_Inout_ CSC_BYTE* CONST pFirst, _In_ CONST CSC_SIZE_T numOfElements, _In_ CONST CSC_SIZE_T elementSize, _Inout_ CSC_SIZE_T* CONST pIndices, _Out_ CSC_BYTE* CONST pTemp)
+{
+	CSC_SIZE_T iterator;
+	CSC_SIZE_T current;
+	CSC_SIZE_T source;
+
+	for (iterator = (CSC_SIZE_T)0; iterator < numOfElements; ++iterator)
+	{
+		if (pIndices[iterator] == iterator)
+		{
+			continue;
+		}
+
+		CSC_SortUtilsCopyElement(pTemp, pFirst + iterator * elementSize, elementSize);
+		current = iterator;
+
+		while ((source = pIndices[current]) != iterator)
+		{
+			CSC_SortUtilsCopyElement(pFirst + current * elementSize, pFirst + source * elementSize, elementSize);
+			pIndices[current] = current;
+			current = source;
+		}
+
+		CSC_SortUtilsCopyElement(pFirst + current * elementSize, pTemp, elementSize);
+		pIndices[current] = current;
+	}
+}
+
+// Merges the sorted runs [pFirst, pFirst + leftCount) and [pFirst + leftCount, pFirst + numOfElements), the left run is moved to the buffer first.
+// Elements of the left run are taken first on equality, which keeps the merge stable.
+static void CSCAPI CSC_SortUtilsMergeRuns(_Inout_ CSC_BYTE* CONST pFirst, _In_ CONST CSC_SIZE_T leftCount, _In_ CONST CSC_SIZE_T numOfElements, _In_ CONST CSC_SIZE_T elementSize, _In_ CONST CSC_P_SORT_UTILS_COMPARE pCompare, _In_opt_ CONST CSC_PVOID pContext, _Out_ CSC_BYTE* CONST pBuffer)
+{
+	CSC_BYTE* pDst = pFirst;
+	CSC_BYTE* pLeft = pBuffer;
+	CSC_BYTE* pRight = pFirst + leftCount * elementSize;
+	CONST CSC_BYTE* CONST pLeftEnd = pBuffer + leftCount * elementSize;
+	CONST CSC_BYTE* CONST pRightEnd = pFirst + numOfElements * elementSize;
+
+	if (!leftCount || leftCount == numOfElements || pCompare(pRight - elementSize, pRight, pContext) <= 0)
+	{
+		return;
+	}
+
+	CSC_MemoryUtilsCopyMemory(pBuffer, pFirst, leftCount * elementSize);
+
+	while (pLeft < pLeftEnd && pRight < pRightEnd)
+	{
+		if (pCompare(pRight, pLeft, pContext) < 0)
+		{
+			CSC_SortUtilsCopyElement(pDst, pRight, elementSize);
+			pRight += elementSize;
+		}
+		else
+		{
+			CSC_SortUtilsCopyElement(pDst, pLeft, elementSize);
+			pLeft += elementSize;
+		}
+
+		pDst += elementSize;
+	}
+
+	if (pLeft < pLeftEnd)
+	{
+		CSC_MemoryUtilsCopyMemory(pDst, pLeft, (CSC_SIZE_T)(pLeftEnd - pLeft));
+	}
+}
+
+// Sorts a range through a top down merge sort, the range uses the part of the buffer at the same offset.
+static void CSCAPI CSC_SortUtilsMergeSortRange(_Inout_ CSC_BYTE* CONST pFirst, _In_ CONST CSC_SIZE_T numOfElements, _In_ CONST CSC_SIZE_T elementSize, _In_ CONST CSC_P_SORT_UTILS_COMPARE pCompare, _In_opt_ CONST CSC_PVOID pContext, _Out_ CSC_BYTE* CONST pBuffer)
+{
+	CONST CSC_SIZE_T leftCount = numOfElements >> 1;
+
+	if (numOfElements <= CSC_SORT_UTILS_INSERTION_SORT_THRESHOLD)
+	{
+		CSC_SortUtilsInsertionSort(pFirst, numOfElements, elementSize, pCompare, pContext);
+		return;
+	}
+
+	CSC_SortUtilsMergeSortRange(pFirst, leftCount, elementSize, pCompare, pContext, pBuffer);
+	CSC_SortUtilsMergeSortRange(pFirst + leftCount * elementSize, numOfElements - leftCount, elementSize, pCompare, pContext, pBuffer + leftCount * elementSize);
+	CSC_SortUtilsMergeRuns(pFirst, leftCount, numOfElements, elementSize, pCompare, pContext, pBuffer);
+}
+
+#ifdef CSC_CONFIG_LINUX_NATIVE
+
+static void CSCAPI CSC_SortUtilsRunMergeTask(_Inout_ CSC_SortUtilsMergeTask* CONST pTask)
+{
+	if (pTask->leftCount)
+	{
+		CSC_SortUtilsMergeRuns(pTask->pFirst, pTask->leftCount, pTask->numOfElements, pTask->elementSize, pTask->pCompare, pTask->pContext, pTask->pBuffer);
+	}
+	else
+	{
+		CSC_SortUtilsMergeSortRange(pTask->pFirst, pTask->numOfElements, pTask->elementSize, pTask->pCompare, pTask->pContext, pTask->pBuffer);
+	}
+}
+
+static void* CSC_SortUtilsMergeThread(void* pTask)
+{
+	CSC_SortUtilsRunMergeTask((CSC_SortUtilsMergeTask*)pTask);
+	return NULL;
+}
+
+// Runs the tasks on separate threads, the first task runs on the calling thread.
+// Tasks whose thread couldn't be created run on the calling thread as well.
+static void CSCAPI CSC_SortUtilsRunMergeTasks(_Inout_ CSC_SortUtilsMergeTask* CONST pTasks, _In_ CONST CSC_SIZE_T numOfTasks)
+{
+	pthread_t threads[CSC_SORT_UTILS_MAX_THREADS];
+	CSC_BOOLEAN isStarted[CSC_SORT_UTILS_MAX_THREADS];
+	CSC_SIZE_T iterator;
+
+	for (iterator = (CSC_SIZE_T)1; iterator < numOfTasks; ++iterator)
+	{
+		isStarted[iterator] = (pthread_create(&threads[iterator], NULL, CSC_SortUtilsMergeThread, &pTasks[iterator]) == 0) ? (CSC_BOOLEAN)TRUE : (CSC_BOOLEAN)FALSE;
+	}
+
+	CSC_SortUtilsRunMergeTask(&pTasks[0]);
+
+	for (iterator = (CSC_SIZE_T)1; iterator < numOfTasks; ++iterator)
+	{
+		if (isStarted[iterator])
+		{
+			pthread_join(threads[iterator], NULL);
+		}
+		else
+		{
+			CSC_SortUtilsRunMergeTask(&pTasks[iterator]);
+		}
+	}
+}
+
+// Sorts equally sized chunks on separate threads and merges neighbouring chunks pairwise on separate threads until a single run remains.
+static void CSCAPI CSC_SortUtilsParallelMergeSort(_Inout_ CSC_BYTE* CONST pFirst, _In_ CONST CSC_SIZE_T numOfElements, _In_ CONST CSC_SIZE_T elementSize, _In_ CONST CSC_P_SORT_UTILS_COMPARE pCompare, _In_opt_ CONST CSC_PVOID pContext, _In_ CONST CSC_SIZE_T numOfChunks, _Out_ CSC_BYTE* CONST pBuffer)
+{
+	CSC_SortUtilsMergeTask tasks[CSC_SORT_UTILS_MAX_THREADS];
+	CSC_SIZE_T chunkStarts[CSC_SORT_UTILS_MAX_THREADS + 1];
+	CSC_SIZE_T numOfTasks;
+	CSC_SIZE_T width;
+	CSC_SIZE_T iterator;
+	CSC_SIZE_T middle;
+	CSC_SIZE_T last;
+
+	for (iterator = (CSC_SIZE_T)0; iterator <= numOfChunks; ++iterator)
+	{
+		chunkStarts[iterator] = numOfElements / numOfChunks * iterator + ((numOfElements % numOfChunks) * iterator) / numOfChunks;
+	}
+
+	for (width = (CSC_SIZE_T)1; width < (numOfChunks << 1); width <<= 1)
+	{
+		numOfTasks = (CSC_SIZE_T)0;
+
+		for (iterator = (CSC_SIZE_T)0; iterator < numOfChunks; iterator += width)
+		{
+			// The first round sorts every chunk, the following rounds merge pairs of runs that are width / 2 chunks long.
+			middle = (width == (CSC_SIZE_T)1) ? iterator : iterator + (width >> 1);
+			last = (iterator + width < numOfChunks) ? iterator + width : numOfChunks;
+
+			if (width != (CSC_SIZE_T)1 && middle >= numOfChunks)
+			{
+				continue;
+			}
+
+			tasks[numOfTasks].pFirst = pFirst + chunkStarts[iterator] * elementSize;
+			tasks[numOfTasks].pBuffer = pBuffer + chunkStarts[iterator] * elementSize;
+			tasks[numOfTasks].numOfElements = chunkStarts[last] - chunkStarts[iterator];
+			tasks[numOfTasks].leftCount = chunkStarts[middle] - chunkStarts[iterator];
+			tasks[numOfTasks].elementSize = elementSize;
+			tasks[numOfTasks].pCompare = pCompare;
+			tasks[numOfTasks].pContext = pContext;
+			++numOfTasks;
+		}
+
+		CSC_SortUtilsRunMergeTasks(tasks, numOfTasks);
+	}
+}
+
+#endif
+
+
+CSC_STATUS CSCAPI CSC_SortUtilsIntroSort(_Inout_ CONST CSC_PVOID pFirst, _In_ CONST CSC_SIZE_T numOfElements, _In_ CONST CSC_SIZE_T elementSize, _In_ CONST CSC_P_SORT_UTILS_COMPARE pCompare, _In_opt_ CONST CSC_PVOID pContext)
+{
+	if ((!pFirst && numOfElements) || !elementSize || !pCompare)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	CSC_SortUtilsIntroSortElements((CSC_BYTE*)pFirst, numOfElements, elementSize, pCompare, pContext);
+
+	return CSC_STATUS_SUCCESS;
+}
+
+CSC_STATUS CSCAPI CSC_SortUtilsIndexSort(_Inout_ CONST CSC_PVOID pFirst, _In_ CONST CSC_SIZE_T numOfElements, _In_ CONST CSC_SIZE_T elementSize, _In_ CONST CSC_P_SORT_UTILS_COMPARE pCompare, _In_opt_ CONST CSC_PVOID pContext, _In_ CONST CSC_IAllocator* CONST pIAllocator)
+{
+	CSC_SortUtilsIndexContext indexContext;
+	CSC_SIZE_T* pIndices;
+	CSC_SIZE_T iterator;
+	CSC_SIZE_T allocationSize;
+
+	if ((!pFirst && numOfElements) || !elementSize || !pCompare || !pIAllocator)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	if (numOfElements < (CSC_SIZE_T)2)
+	{
+		return CSC_STATUS_SUCCESS;
+	}
+
+	if (numOfElements > ((CSC_SIZE_T)-1 - elementSize) / sizeof(CSC_SIZE_T))
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	// The temporary element is placed behind the indices.
+	allocationSize = numOfElements * sizeof(CSC_SIZE_T) + elementSize;
+	pIndices = (CSC_SIZE_T*)CSC_IAllocatorAlloc(pIAllocator, allocationSize);
+
+	if (!pIndices)
+	{
+		return CSC_STATUS_MEMORY_NOT_ALLOCATED;
+	}
+
+	for (iterator = (CSC_SIZE_T)0; iterator < numOfElements; ++iterator)
+	{
+		pIndices[iterator] = iterator;
+	}
+
+	indexContext.pFirst = (CONST CSC_BYTE*)pFirst;
+	indexContext.elementSize = elementSize;
+	indexContext.pCompare = pCompare;
+	indexContext.pContext = pContext;
+
+	CSC_SortUtilsIntroSortElements((CSC_BYTE*)pIndices, numOfElements, sizeof(CSC_SIZE_T), CSC_SortUtilsCompareIndices, &indexContext);
+	CSC_SortUtilsApplyPermutation((CSC_BYTE*)pFirst, numOfElements, elementSize, pIndices, (CSC_BYTE*)(pIndices + numOfElements));
+
+	return CSC_IAllocatorFreeSized(pIAllocator, pIndices, allocationSize);
+}
+
+CSC_STATUS CSCAPI CSC_SortUtilsRadixSort(_Inout_ CONST CSC_PVOID pFirst, _In_ CONST CSC_SIZE_T numOfElements, _In_ CONST CSC_SIZE_T elementSize, _In_ CONST CSC_P_SORT_UTILS_GET_KEY pGetKey, _In_opt_ CONST CSC_PVOID pContext, _In_ CONST CSC_SIZE_T keySize, _In_ CONST CSC_IAllocator* CONST pIAllocator)
+{
+	CSC_SIZE_T counts[0x100];
+	CSC_SortUtilsRadixEntry* pEntries;
+	CSC_SortUtilsRadixEntry* pSrc;
+	CSC_SortUtilsRadixEntry* pDst;
+	CSC_SortUtilsRadixEntry* pSwap;
+	CSC_SIZE_T* pIndices;
+	CSC_SIZE_T allocationSize;
+	CSC_SIZE_T iterator;
+	CSC_SIZE_T shift;
+	CSC_SIZE_T offset;
+	CSC_SIZE_T count;
+
+	if ((!pFirst && numOfElements) || !elementSize || !pGetKey || !keySize || keySize > sizeof(CSC_QWORD) || !pIAllocator)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	if (numOfElements < (CSC_SIZE_T)2)
+	{
+		return CSC_STATUS_SUCCESS;
+	}
+
+	if (numOfElements > ((CSC_SIZE_T)-1 - elementSize) / (sizeof(CSC_SortUtilsRadixEntry) << 1))
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	// Both entry arrays are followed by the temporary element.
+	allocationSize = numOfElements * (sizeof(CSC_SortUtilsRadixEntry) << 1) + elementSize;
+	pEntries = (CSC_SortUtilsRadixEntry*)CSC_IAllocatorAlloc(pIAllocator, allocationSize);
+
+	if (!pEntries)
+	{
+		return CSC_STATUS_MEMORY_NOT_ALLOCATED;
+	}
+
+	pSrc = pEntries;
+	pDst = pEntries + numOfElements;
+
+	for (iterator = (CSC_SIZE_T)0; iterator < numOfElements; ++iterator)
+	{
+		pSrc[iterator].key = pGetKey((CONST CSC_BYTE*)pFirst + iterator * elementSize, pContext);
+		pSrc[iterator].index = iterator;
+	}
+
+	for (shift = (CSC_SIZE_T)0; shift < (keySize << 3); shift += (CSC_SIZE_T)8)
+	{
+		CSC_MemoryUtilsSetZeroMemory(counts, sizeof(counts));
+
+		for (iterator = (CSC_SIZE_T)0; iterator < numOfElements; ++iterator)
+		{
+			++counts[(CSC_SIZE_T)(pSrc[iterator].key >> shift) & (CSC_SIZE_T)0xFF];
+		}
+
+		// A byte that is equal for all keys doesn't change the order.
+		if (counts[(CSC_SIZE_T)(pSrc[0].key >> shift) & (CSC_SIZE_T)0xFF] == numOfElements)
+		{
+			continue;
+		}
+
+		for (iterator = (CSC_SIZE_T)0, offset = (CSC_SIZE_T)0; iterator < (CSC_SIZE_T)0x100; ++iterator)
+		{
+			count = counts[iterator];
+			counts[iterator] = offset;
+			offset += count;
+		}
+
+		for (iterator = (CSC_SIZE_T)0; iterator < numOfElements; ++iterator)
+		{
+			pDst[counts[(CSC_SIZE_T)(pSrc[iterator].key >> shift) & (CSC_SIZE_T)0xFF]++] = pSrc[iterator];
+		}
+
+		pSwap = pSrc;
+		pSrc = pDst;
+		pDst = pSwap;
+	}
+
+	// The indices are collected in the unused entry array, which is large enough to hold them.
+	pIndices = (CSC_SIZE_T*)pDst;
+
+	for (iterator = (CSC_SIZE_T)0; iterator < numOfElements; ++iterator)
+	{
+		pIndices[iterator] = pSrc[iterator].index;
+	}
+
+	CSC_SortUtilsApplyPermutation((CSC_BYTE*)pFirst, numOfElements, elementSize, pIndices, (CSC_BYTE*)(pEntries + (numOfElements << 1)));
+
+	return CSC_IAllocatorFreeSized(pIAllocator, pEntries, allocationSize);
+}
+
+CSC_STATUS CSCAPI CSC_SortUtilsMergeSort(_Inout_ CONST CSC_PVOID pFirst, _In_ CONST CSC_SIZE_T numOfElements, _In_ CONST CSC_SIZE_T elementSize, _In_ CONST CSC_P_SORT_UTILS_COMPARE pCompare, _In_opt_ CONST CSC_PVOID pContext, _In_ CONST CSC_SIZE_T numOfThreads, _In_ CONST CSC_IAllocator* CONST pIAllocator)
+{
+	CSC_BYTE* pBuffer;
+	CSC_SIZE_T numOfChunks;
+
+	if ((!pFirst && numOfElements) || !elementSize || !pCompare || !numOfThreads || !pIAllocator)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	if (numOfElements <= CSC_SORT_UTILS_INSERTION_SORT_THRESHOLD)
+	{
+		CSC_SortUtilsInsertionSort((CSC_BYTE*)pFirst, numOfElements, elementSize, pCompare, pContext);
+		return CSC_STATUS_SUCCESS;
+	}
+
+	if (numOfElements > (CSC_SIZE_T)-1 / elementSize)
+	{
+		return CSC_STATUS_INVALID_PARAMETER;
+	}
+
+	pBuffer = (CSC_BYTE*)CSC_IAllocatorAlloc(pIAllocator, numOfElements * elementSize);
+
+	if (!pBuffer)
+	{
+		return CSC_STATUS_MEMORY_NOT_ALLOCATED;
+	}
+
+	numOfChunks = numOfElements / CSC_SORT_UTILS_PARALLEL_MIN_ELEMENTS;
+
+	if (numOfChunks > numOfThreads)
+	{
+		numOfChunks = numOfThreads;
+	}
+
+	if (numOfChunks > CSC_SORT_UTILS_MAX_THREADS)
+	{
+		numOfChunks = CSC_SORT_UTILS_MAX_THREADS;
+	}
+
+#ifdef CSC_CONFIG_LINUX_NATIVE
+	if (numOfChunks > (CSC_SIZE_T)1)
+	{
+		CSC_SortUtilsParallelMergeSort((CSC_BYTE*)pFirst, numOfElements, elementSize, pCompare, pContext, numOfChunks, pBuffer);
+	}
+	else
+#endif
+	{
+		CSC_SortUtilsMergeSortRange((CSC_BYTE*)pFirst, numOfElements, elementSize, pCompare, pContext, pBuffer);
+	}
+
+	return CSC_IAllocatorFreeSized(pIAllocator, pBuffer, numOfElements * elementSize);
+}
+
+CSC_QWORD CSCAPI CSC_SortUtilsGetSignedKey(_In_ CONST CSC_QWORD value, _In_ CONST CSC_SIZE_T keySize)
+{
+	if (!keySize || keySize > sizeof(CSC_QWORD))
+	{
+		return value;
+	}
+
+	return value ^ ((CSC_QWORD)1 << ((keySize << 3) - (CSC_SIZE_T)1));
+}
+
+CSC_QWORD CSCAPI CSC_SortUtilsGetFloatKey(_In_ CONST CSC_DWORD bits)
+{
+	CONST CSC_QWORD value = (CSC_QWORD)bits & (CSC_QWORD)0xFFFFFFFF;
+
+	// Negative values are ordered in reverse by their magnitude, hence all of their bits are flipped, positive values only get the sign bit set.
+	if (value & (CSC_QWORD)0x80000000)
+	{
+		return ~value & (CSC_QWORD)0xFFFFFFFF;
+	}
+
+	return value | (CSC_QWORD)0x80000000;
+}
+
+CSC_QWORD CSCAPI CSC_SortUtilsGetDoubleKey(_In_ CONST CSC_QWORD bits)
+{
+	CONST CSC_QWORD signBit = (CSC_QWORD)1 << 63;
+
+	if (bits & signBit)
+	{
+		return ~bits;
+	}
+
+	return bits | signBit;
+}
\ No newline at end of file
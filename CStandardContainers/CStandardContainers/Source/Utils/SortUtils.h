@@ -0,0 +1,57 @@
+#ifndef CSC_SORT_UTILS
+#define CSC_SORT_UTILS
+
+/*
+Description:
+The SortUtils provide sorting algorithms that operate on contiguous arrays of elements with an arbitrary size, which are ordered either through a comparison function or through integer keys.
+The introsort is an in place quicksort with a median of three pivot that falls back to heapsort once the recursion gets too deep and to insertion sort for small ranges, which guarantees O(n log n) steps without allocating any memory.
+Elements are swapped in place without a temporary buffer, hence the size of the elements doesn't require any dynamic memory allocation.
+The index sort sorts an array of element indices instead of the elements themselves and moves every element only once at the end, which suits large elements where swapping dominates the cost of the sort.
+The radix sort is a least significant digit radix sort over integer keys of up to 8 bytes, which are retrieved once per element through a key function and sorted in O(n) steps per key byte, bytes that are equal for all keys are skipped.
+Keys of signed integers and floating point values can be converted to unsigned keys of the same order through the key helper functions.
+The merge sort is stable and requires a buffer of the size of the array, in the Linux native configuration arrays of at least CSC_SORT_UTILS_PARALLEL_MIN_ELEMENTS elements are sorted by multiple threads.
+All sorts except the merge sort and the radix sort are unstable, elements that compare equal may change their order.
+*/
+
+// Include the current configuration of the library containing various type definitions and other things.
+#include "../Configuration/Configuration.h"
+// Include the IAllocator interface as some of the sort functions require dynamic memory allocation.
+#include "../Interfaces/IAllocator.h"
+
+// Definition of the range size below which the sorts switch to insertion sort.
+#define CSC_SORT_UTILS_INSERTION_SORT_THRESHOLD (CSC_SIZE_T)0x10
+// Definition of the element size from which sorting indices is preferred over sorting the elements directly.
+#define CSC_SORT_UTILS_INDEX_SORT_MIN_ELEMENT_SIZE (CSC_SIZE_T)0x40
+// Definition of the minimum amount of elements every thread of the parallel merge sort is supposed to sort.
+#define CSC_SORT_UTILS_PARALLEL_MIN_ELEMENTS (CSC_SIZE_T)0x8000
+// Definition of the maximum amount of threads the parallel merge sort uses.
+#define CSC_SORT_UTILS_MAX_THREADS (CSC_SIZE_T)0x40
+
+// Type definition of the comparison function, which must return a negative value if the first element is ordered before the second one, a positive value if it is ordered after it and 0 otherwise.
+typedef CSC_INT(CSCMETHOD* CSC_P_SORT_UTILS_COMPARE)(_In_ CONST CSC_PCVOID pFirst, _In_ CONST CSC_PCVOID pSecond, _In_opt_ CONST CSC_PVOID pContext);
+// Type definition of the key function of the radix sort, which must return the unsigned key of an element.
+typedef CSC_QWORD(CSCMETHOD* CSC_P_SORT_UTILS_GET_KEY)(_In_ CONST CSC_PCVOID pElement, _In_opt_ CONST CSC_PVOID pContext);
+
+// Sorts the elements in place through an introsort.
+// Returns CSC_STATUS_SUCCESS on success, otherwise an error code is returned.
+CSC_STATUS CSCAPI CSC_SortUtilsIntroSort(_Inout_ CONST CSC_PVOID pFirst, _In_ CONST CSC_SIZE_T numOfElements, _In_ CONST CSC_SIZE_T elementSize, _In_ CONST CSC_P_SORT_UTILS_COMPARE pCompare, _In_opt_ CONST CSC_PVOID pContext);
+// Sorts the indices of the elements through an introsort and moves every element to it's final position afterwards.
+// The allocator is used for the index array and a temporary element.
+// Returns CSC_STATUS_SUCCESS on success, otherwise an error code is returned.
+CSC_STATUS CSCAPI CSC_SortUtilsIndexSort(_Inout_ CONST CSC_PVOID pFirst, _In_ CONST CSC_SIZE_T numOfElements, _In_ CONST CSC_SIZE_T elementSize, _In_ CONST CSC_P_SORT_UTILS_COMPARE pCompare, _In_opt_ CONST CSC_PVOID pContext, _In_ CONST CSC_IAllocator* CONST pIAllocator);
+// Sorts the elements through a stable radix sort over the lowest keySize bytes of the keys, keySize must be between 1 and sizeof(CSC_QWORD).
+// The allocator is used for two arrays of keys and indices and a temporary element.
+// Returns CSC_STATUS_SUCCESS on success, otherwise an error code is returned.
+CSC_STATUS CSCAPI CSC_SortUtilsRadixSort(_Inout_ CONST CSC_PVOID pFirst, _In_ CONST CSC_SIZE_T numOfElements, _In_ CONST CSC_SIZE_T elementSize, _In_ CONST CSC_P_SORT_UTILS_GET_KEY pGetKey, _In_opt_ CONST CSC_PVOID pContext, _In_ CONST CSC_SIZE_T keySize, _In_ CONST CSC_IAllocator* CONST pIAllocator);
+// Sorts the elements through a stable merge sort, which is split across up to numOfThreads threads if the configuration supports it.
+// The comparison function must be thread safe when more than one thread is requested, the allocator is used for a buffer of the size of the array.
+// Returns CSC_STATUS_SUCCESS on success, otherwise an error code is returned.
+CSC_STATUS CSCAPI CSC_SortUtilsMergeSort(_Inout_ CONST CSC_PVOID pFirst, _In_ CONST CSC_SIZE_T numOfElements, _In_ CONST CSC_SIZE_T elementSize, _In_ CONST CSC_P_SORT_UTILS_COMPARE pCompare, _In_opt_ CONST CSC_PVOID pContext, _In_ CONST CSC_SIZE_T numOfThreads, _In_ CONST CSC_IAllocator* CONST pIAllocator);
+
+// Helper function for converting a two's complement integer of keySize bytes to an unsigned key of the same order.
+CSC_QWORD CSCAPI CSC_SortUtilsGetSignedKey(_In_ CONST CSC_QWORD value, _In_ CONST CSC_SIZE_T keySize);
+// Helper functions for converting the bit pattern of a single or double precision floating point value to an unsigned key of the same order, negative zero is ordered before positive zero.
+CSC_QWORD CSCAPI CSC_SortUtilsGetFloatKey(_In_ CONST CSC_DWORD bits);
+CSC_QWORD CSCAPI CSC_SortUtilsGetDoubleKey(_In_ CONST CSC_QWORD bits);
+
+#endif
\ No newline at end of file